@@ -0,0 +1,156 @@
+#include "Core/Scene/Hierarchy/TransformHierarchy.hpp"
+#include "Core/Scene/Scene.hpp"
+#include <chrono>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <random>
+
+using namespace Dwarf;
+using namespace testing;
+
+namespace
+{
+  /// @brief Creates an entity with a transform and attaches it to a parent.
+  auto
+  CreateNode(entt::registry& registry,
+             entt::entity    parent,
+             glm::vec3       position = glm::vec3(0.0F)) -> entt::entity
+  {
+    entt::entity entity = registry.create();
+    auto&        transform = registry.emplace<TransformComponent>(entity);
+    transform.SetPosition(position);
+    transform.Parent = parent;
+    if (parent != entt::null)
+    {
+      registry.get<TransformComponent>(parent).Children.push_back(entity);
+    }
+    return entity;
+  }
+}
+
+/// Moves 1% of the nodes of a random 100k node hierarchy per frame and
+/// compares the update with a full recompute, on the calling thread.
+TEST(TransformHierarchyBenchmarks, MovingHierarchyUpdate)
+{
+  constexpr uint32_t NODE_COUNT = 100000;
+  constexpr uint32_t MOVED_COUNT = NODE_COUNT / 100;
+  constexpr uint32_t FRAME_COUNT = 50;
+
+  entt::registry            registry;
+  std::vector<entt::entity> nodes = { CreateNode(registry, entt::null) };
+  TransformHierarchy        hierarchy(registry, nodes[0]);
+  hierarchy.SetThreadCount(1);
+
+  // Every node is attached to a random earlier node
+  std::mt19937 random(42);
+  for (uint32_t index = 1; index < NODE_COUNT; ++index)
+  {
+    std::uniform_int_distribution<uint32_t> parent(0, index - 1);
+    nodes.push_back(
+      CreateNode(registry, nodes[parent(random)], { 1.0F, 0.0F, 0.0F }));
+  }
+  EXPECT_EQ(hierarchy.Update(), NODE_COUNT);
+
+  std::chrono::nanoseconds fullTime{ 0 };
+  std::chrono::nanoseconds dirtyTime{ 0 };
+  size_t                   dirtyCount = 0;
+  for (uint32_t frame = 0; frame < FRAME_COUNT; ++frame)
+  {
+    std::uniform_int_distribution<uint32_t> node(1, NODE_COUNT - 1);
+    for (uint32_t moved = 0; moved < MOVED_COUNT; ++moved)
+    {
+      registry.get<TransformComponent>(nodes[node(random)])
+        .SetPosition({ 0.0F, 1.0F, 0.0F });
+    }
+    auto start = std::chrono::steady_clock::now();
+    dirtyCount += hierarchy.Update();
+    dirtyTime += std::chrono::steady_clock::now() - start;
+
+    for (entt::entity entity : nodes)
+    {
+      registry.get<TransformComponent>(entity).DirtyFlag = true;
+    }
+    start = std::chrono::steady_clock::now();
+    EXPECT_EQ(hierarchy.Update(), NODE_COUNT);
+    fullTime += std::chrono::steady_clock::now() - start;
+  }
+
+  std::cout << fmt::format(
+    "{} nodes: {:8.3f} ms with 1% moving ({} recomputed), {:8.3f} ms full "
+    "recompute\n",
+    NODE_COUNT,
+    std::chrono::duration<double, std::milli>(dirtyTime).count() /
+      FRAME_COUNT,
+    dirtyCount / FRAME_COUNT,
+    std::chrono::duration<double, std::milli>(fullTime).count() /
+      FRAME_COUNT);
+}
+
+/// Times a full update and a 1% moving update of a 200k-entity scene at
+/// 1/2/4/8/16 threads.
+TEST(TransformHierarchyBenchmarks, TransformUpdateScaling)
+{
+  constexpr uint32_t NODE_COUNT = 200000;
+  constexpr uint32_t FRAME_COUNT = 50;
+
+  // A wide and deep scene: chains of ten entities below random earlier
+  // entities
+  Scene               scene(nullptr, nullptr);
+  std::vector<Entity> entities;
+  std::mt19937        random(7);
+  for (uint32_t index = 0; index < NODE_COUNT; ++index)
+  {
+    Entity entity = scene.CreateEntity("Node");
+    if (index % 10 != 0)
+    {
+      entity.SetParent(entities.back().GetHandle());
+    }
+    else if (index > 0)
+    {
+      std::uniform_int_distribution<uint32_t> parent(0, index - 1);
+      entity.SetParent(entities[parent(random)].GetHandle());
+    }
+    entity.GetComponent<TransformComponent>().SetPosition(
+      { 1.0F, 0.0F, 0.0F });
+    entities.push_back(entity);
+  }
+
+  TransformHierarchy& hierarchy = scene.GetTransformHierarchy();
+  for (uint32_t threadCount : { 1U, 2U, 4U, 8U, 16U })
+  {
+    hierarchy.SetThreadCount(threadCount);
+    hierarchy.Update();
+
+    std::chrono::nanoseconds fullTime{ 0 };
+    std::chrono::nanoseconds dirtyTime{ 0 };
+    for (uint32_t frame = 0; frame < FRAME_COUNT; ++frame)
+    {
+      for (Entity& entity : entities)
+      {
+        entity.GetComponent<TransformComponent>().DirtyFlag = true;
+      }
+      auto start = std::chrono::steady_clock::now();
+      EXPECT_EQ(hierarchy.Update(), NODE_COUNT + 1);
+      fullTime += std::chrono::steady_clock::now() - start;
+
+      std::uniform_int_distribution<uint32_t> node(0, NODE_COUNT - 1);
+      for (uint32_t moved = 0; moved < NODE_COUNT / 100; ++moved)
+      {
+        entities[node(random)].GetComponent<TransformComponent>().SetPosition(
+          { 0.0F, 1.0F, 0.0F });
+      }
+      start = std::chrono::steady_clock::now();
+      hierarchy.Update();
+      dirtyTime += std::chrono::steady_clock::now() - start;
+    }
+
+    std::cout << fmt::format(
+      "{:>2} threads: {:8.3f} ms full update, {:8.3f} ms with 1% moving\n",
+      threadCount,
+      std::chrono::duration<double, std::milli>(fullTime).count() /
+        FRAME_COUNT,
+      std::chrono::duration<double, std::milli>(dirtyTime).count() /
+        FRAME_COUNT);
+  }
+}
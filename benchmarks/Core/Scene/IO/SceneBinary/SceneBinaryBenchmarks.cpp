@@ -0,0 +1,61 @@
+#include "Core/Scene/IO/SceneBinary/SceneBinary.hpp"
+#include "Core/Scene/Scene.hpp"
+#include <chrono>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <iostream>
+
+using namespace Dwarf;
+using namespace testing;
+
+/// Loads the same 100k-entity scene from its JSON and its binary form.
+TEST(SceneBinaryBenchmarks, SceneLoadTime)
+{
+  constexpr uint32_t ENTITY_COUNT = 100000;
+
+  // Chains of ten entities attached to the root entity
+  Scene               scene(nullptr, nullptr);
+  std::vector<Entity> entities;
+  nlohmann::json      serializedGraph = nlohmann::json::array();
+  for (uint32_t index = 0; index < ENTITY_COUNT; ++index)
+  {
+    Entity entity = scene.CreateEntity(fmt::format("Node {}", index % 100));
+    if (index % 10 != 0)
+    {
+      entity.SetParent(entities.back().GetHandle());
+    }
+    entity.GetComponent<TransformComponent>().SetPosition(
+      { (float)index, 0.0F, 0.0F });
+    entities.push_back(entity);
+  }
+  for (uint32_t index = 0; index < ENTITY_COUNT; index += 10)
+  {
+    serializedGraph.push_back(entities[index].Serialize());
+  }
+
+  std::string          json = serializedGraph.dump();
+  std::vector<uint8_t> binary = SceneBinary::Write(scene.SerializeGraph());
+
+  auto start = std::chrono::steady_clock::now();
+  {
+    Scene loaded(
+      SerializedGraph(nlohmann::json::parse(json)), nullptr, nullptr);
+  }
+  auto jsonTime = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  {
+    Scene loaded(SceneBinary::Read(binary).value(), nullptr, nullptr);
+  }
+  auto binaryTime = std::chrono::steady_clock::now() - start;
+
+  auto toMilliseconds = [](auto duration)
+  { return std::chrono::duration<double, std::milli>(duration).count(); };
+  std::cout << fmt::format("{} entities\n", ENTITY_COUNT);
+  std::cout << fmt::format("  JSON:   {:>10} bytes {:8.2f} ms\n",
+                           json.size(),
+                           toMilliseconds(jsonTime));
+  std::cout << fmt::format("  Binary: {:>10} bytes {:8.2f} ms\n",
+                           binary.size(),
+                           toMilliseconds(binaryTime));
+}
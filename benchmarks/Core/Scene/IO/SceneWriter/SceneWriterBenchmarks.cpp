@@ -0,0 +1,75 @@
+#include "Core/Scene/IO/SceneWriter/SceneWriter.hpp"
+#include "Core/Scene/Scene.hpp"
+#include <chrono>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <thread>
+
+using namespace Dwarf;
+using namespace testing;
+
+namespace
+{
+  /// @brief Builds a scene with nested entities, lights and mesh renderers.
+  void
+  PopulateScene(Scene& scene, int rootCount)
+  {
+    for (int root = 0; root < rootCount; ++root)
+    {
+      Entity parent = scene.CreateEntity(fmt::format("Root {}", root));
+      parent.GetComponent<TransformComponent>().SetPosition(
+        { (float)root, 1.5F, -2.0F });
+      for (int index = 0; index < 3; ++index)
+      {
+        Entity child = scene.CreateEntity("Child \"quoted\"\nline");
+        child.SetParent(parent.GetHandle());
+        if (index == 1)
+        {
+          child.AddComponent<LightComponent>().Radius = 20.0F;
+        }
+        if (index == 2)
+        {
+          auto& meshRenderer = child.AddComponent<MeshRendererComponent>();
+          meshRenderer.MaterialAssets[0] = nullptr;
+          meshRenderer.IsHidden = true;
+        }
+      }
+    }
+  }
+}
+
+/// Compares serializing a scene on the UI thread with taking a snapshot and
+/// serializing it in parallel.
+TEST(SceneWriterBenchmarks, SaveTime)
+{
+  constexpr int ROOT_COUNT = 10000;
+
+  auto toMilliseconds = [](auto duration)
+  { return std::chrono::duration<double, std::milli>(duration).count(); };
+
+  Scene scene(nullptr, nullptr);
+  PopulateScene(scene, ROOT_COUNT);
+
+  auto        start = std::chrono::steady_clock::now();
+  std::string synchronous = scene.Serialize().dump(2);
+  auto        synchronousTime = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  SceneGraphData graph = scene.SerializeGraph();
+  auto           snapshotTime = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  std::string parallel =
+    SceneWriter::SerializeScene(graph, std::thread::hardware_concurrency());
+  auto parallelTime = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(synchronous, parallel);
+  std::cout << fmt::format("{} entities\n", ROOT_COUNT * 4);
+  std::cout << fmt::format("  Synchronous:          {:8.2f} ms\n",
+                           toMilliseconds(synchronousTime));
+  std::cout << fmt::format("  Snapshot (UI thread): {:8.2f} ms\n",
+                           toMilliseconds(snapshotTime));
+  std::cout << fmt::format("  Parallel serializer:  {:8.2f} ms\n",
+                           toMilliseconds(parallelTime));
+}
@@ -0,0 +1,63 @@
+#include "Core/Scene/Scene.hpp"
+#include "Helper/SceneDataHelper.hpp"
+#include <chrono>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <iostream>
+
+using namespace Dwarf;
+using namespace testing;
+using namespace SceneDataHelper;
+
+/// Creates scenes of doubling size entity by entity and in one batch. The
+/// time per entity should stay roughly constant as the count grows.
+TEST(SceneBenchmarks, EntityCreationScaling)
+{
+  auto toMilliseconds = [](auto duration)
+  { return std::chrono::duration<double, std::milli>(duration).count(); };
+
+  for (uint32_t entityCount : { 10000U, 20000U, 40000U, 80000U })
+  {
+    // Chains of ten entities attached to the root entity
+    SceneGraphData graph;
+    for (uint32_t index = 0; index < entityCount; ++index)
+    {
+      SceneEntityData& entity = graph.Entities.emplace_back(CreateEntityData(
+        "Node", index % 10 != 0 ? index - 1 : SceneEntityData::NO_PARENT));
+      entity.MeshRenderer.emplace();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    {
+      Scene               scene(nullptr, nullptr);
+      std::vector<Entity> entities;
+      for (const SceneEntityData& data : graph.Entities)
+      {
+        Entity entity = scene.CreateEntity(data.Name);
+        if (data.Parent != SceneEntityData::NO_PARENT)
+        {
+          entity.SetParent(entities[data.Parent].GetHandle());
+        }
+        entity.AddComponent<MeshRendererComponent>();
+        entities.push_back(entity);
+      }
+    }
+    auto singleTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    {
+      Scene scene(nullptr, nullptr);
+      scene.CreateEntities(graph, scene.GetRootEntity().GetHandle());
+    }
+    auto batchTime = std::chrono::steady_clock::now() - start;
+
+    std::cout << fmt::format("{:>6} entities: single {:8.2f} ms "
+                             "({:6.3f} us each), batch {:8.2f} ms "
+                             "({:6.3f} us each)\n",
+                             entityCount,
+                             toMilliseconds(singleTime),
+                             toMilliseconds(singleTime) * 1000.0 / entityCount,
+                             toMilliseconds(batchTime),
+                             toMilliseconds(batchTime) * 1000.0 / entityCount);
+  }
+}
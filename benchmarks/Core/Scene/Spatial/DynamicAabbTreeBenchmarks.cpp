@@ -0,0 +1,91 @@
+#include "Core/Scene/Spatial/DynamicAabbTree.hpp"
+#include "Helper/BoundingBoxHelper.hpp"
+#include <chrono>
+#include <cmath>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <iostream>
+
+using namespace Dwarf;
+using namespace testing;
+using namespace BoundingBoxHelper;
+
+/// Compares frustum and sphere queries of the tree against a brute force scan
+/// over 10k, 100k and 1M random boxes.
+TEST(DynamicAabbTreeBenchmarks, QueryScaling)
+{
+  auto toMilliseconds = [](auto duration)
+  { return std::chrono::duration<double, std::milli>(duration).count(); };
+
+  for (uint32_t count : { 10000U, 100000U, 1000000U })
+  {
+    float                    worldSize = std::cbrt((float)count) * 5.0F;
+    std::vector<BoundingBox> boxes = CreateBoxes(count, worldSize, 3);
+    CullingFrustum           frustum =
+      CreateFrustum(glm::vec3(0.0F, 0.0F, worldSize),
+                    glm::vec3(0.0F),
+                    worldSize * 0.5F);
+    std::vector<entt::entity> results;
+    results.reserve(count);
+
+    auto                  start = std::chrono::steady_clock::now();
+    DynamicAabbTree       tree;
+    std::vector<uint32_t> proxies(count);
+    for (uint32_t index = 0; index < count; ++index)
+    {
+      proxies[index] = tree.CreateProxy(boxes[index], (entt::entity)index);
+    }
+    auto buildTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    std::vector<entt::entity> bruteForce = BruteForce(
+      boxes,
+      [&](const BoundingBox& box) { return IsInFrustum(frustum, box); });
+    auto bruteFrustumTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    tree.QueryFrustum(frustum, results);
+    auto treeFrustumTime = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(bruteForce.size(), results.size());
+    size_t frustumHits = results.size();
+
+    glm::vec3 center(worldSize * 0.25F);
+    start = std::chrono::steady_clock::now();
+    bruteForce = BruteForce(boxes,
+                            [&](const BoundingBox& box)
+                            { return box.OverlapsSphere(center, 10.0F); });
+    auto bruteSphereTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    tree.QuerySphere(center, 10.0F, results);
+    auto treeSphereTime = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(bruteForce.size(), results.size());
+
+    // Every box moves by a small step, most stay inside their fat box
+    start = std::chrono::steady_clock::now();
+    for (uint32_t index = 0; index < count; ++index)
+    {
+      tree.MoveProxy(proxies[index],
+                     { boxes[index].Min + glm::vec3(0.05F),
+                       boxes[index].Max + glm::vec3(0.05F) });
+    }
+    auto refitTime = std::chrono::steady_clock::now() - start;
+
+    std::cout << fmt::format("{:>7} boxes, height {}: build {:8.2f} ms, "
+                             "refit {:8.2f} ms\n",
+                             count,
+                             tree.GetHeight(),
+                             toMilliseconds(buildTime),
+                             toMilliseconds(refitTime));
+    std::cout << fmt::format("  Frustum ({:>6} hits): brute force {:8.3f} ms, "
+                             "tree {:8.3f} ms\n",
+                             frustumHits,
+                             toMilliseconds(bruteFrustumTime),
+                             toMilliseconds(treeFrustumTime));
+    std::cout << fmt::format("  Sphere  ({:>6} hits): brute force {:8.3f} ms, "
+                             "tree {:8.3f} ms\n",
+                             bruteForce.size(),
+                             toMilliseconds(bruteSphereTime),
+                             toMilliseconds(treeSphereTime));
+  }
+}
@@ -0,0 +1,51 @@
+#include "Core/GenericComponents.hpp"
+#include "Core/UUID.hpp"
+#include <boost/uuid/uuid_generators.hpp>
+#include <chrono>
+#include <entt/entt.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+#include <iostream>
+
+using namespace Dwarf;
+using namespace testing;
+
+/// Creates 1M entities with IDs from a boost generator constructed per UUID
+/// and from the per-thread generator.
+TEST(UUIDBenchmarks, EntityCreation)
+{
+  constexpr int ENTITY_COUNT = 1000000;
+
+  auto toMilliseconds = [](auto duration)
+  { return std::chrono::duration<double, std::milli>(duration).count(); };
+
+  auto start = std::chrono::steady_clock::now();
+  {
+    entt::registry registry;
+    for (int index = 0; index < ENTITY_COUNT; ++index)
+    {
+      boost::uuids::random_generator generator;
+      boost::uuids::uuid             generated = generator();
+      UUIDBytes                      bytes;
+      std::copy(generated.begin(), generated.end(), bytes.begin());
+      registry.emplace<IDComponent>(registry.create(), UUID(bytes));
+    }
+  }
+  auto boostTime = std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  {
+    entt::registry registry;
+    for (int index = 0; index < ENTITY_COUNT; ++index)
+    {
+      registry.emplace<IDComponent>(registry.create(), UUID());
+    }
+  }
+  auto threadLocalTime = std::chrono::steady_clock::now() - start;
+
+  std::cout << fmt::format("{} entities\n", ENTITY_COUNT);
+  std::cout << fmt::format("  Generator per UUID: {:8.2f} ms\n",
+                           toMilliseconds(boostTime));
+  std::cout << fmt::format("  Thread local:       {:8.2f} ms\n",
+                           toMilliseconds(threadLocalTime));
+}
@@ -1,12 +1,13 @@
 #version 450 core
 uniform float _Time;
-uniform mat4 modelMatrix;
+#include "indirect_draw.glsl"
 uniform mat4 viewMatrix;
 uniform mat4 projectionMatrix;
-layout (location = 0) in vec3 vertex;
-layout (location = 1) in vec3 normal;
-layout (location = 2) in vec3 tangent;
-layout (location = 3) in vec3 biTangent;
+#include "vertex_compression.glsl"
+layout (location = 0) in vec4 vertexIn;
+layout (location = 1) in vec3 normalIn;
+layout (location = 2) in vec3 tangentIn;
+layout (location = 3) in vec3 biTangentIn;
 layout (location = 4) in vec2 uvCoord;
 
 out vec2 texCoord;
@@ -18,6 +19,12 @@ float amplitude = 0.2;
 float speed = 2;
 
 void main(){
+	dwarfForwardMaterialIndex();
+	vec3 vertex = decodePosition(vertexIn);
+	vec3 normal = decodeDirection(normalIn);
+	vec3 tangent = decodeDirection(tangentIn);
+	vec3 biTangent = _VertexCompression ? cross(normal, tangent) * vertexIn.w : biTangentIn;
+
 	gl_Position = projectionMatrix * viewMatrix * modelMatrix * vec4(vertex.x, vertex.y, vertex.z, 1.0);
 	texCoord = uvCoord;
 	normalLocal = normal;
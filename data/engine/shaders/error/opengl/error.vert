@@ -1,9 +1,11 @@
 #version 330 core
-layout (location = 0) in vec3 aPos;
+layout (location = 0) in vec4 aPosIn;
 uniform mat4 modelMatrix;
 uniform mat4 viewMatrix;
 uniform mat4 projectionMatrix;
+#include "vertex_compression.glsl"
 
 void main(){
+	vec3 aPos = decodePosition(aPosIn);
 	gl_Position = projectionMatrix * viewMatrix * modelMatrix * vec4(aPos.x, aPos.y, aPos.z, 1.0);
 }
\ No newline at end of file
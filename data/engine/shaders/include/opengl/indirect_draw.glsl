@@ -0,0 +1,37 @@
+// Per draw data of the multi draw indirect path. Shaders including this file
+// can be compiled with the DWARF_INDIRECT_DRAW keyword, the model matrix and
+// vertex quantization are then read from the storage buffer through the draw
+// index instead of the uniforms. Vertex shaders call
+// dwarfForwardMaterialIndex() so fragment shaders including
+// material_block.glsl can read the parameters of their material.
+#pragma keywords DWARF_INDIRECT_DRAW
+
+#ifdef DWARF_INDIRECT_DRAW
+struct DwarfDrawData {
+	mat4 ModelMatrix;
+	vec4 PositionScale;
+	vec4 PositionOffset;
+	uint MaterialIndex;
+	uint VertexCompression;
+	uint Padding0;
+	uint Padding1;
+};
+
+layout (std430, binding = 0) readonly buffer DwarfDrawDataBuffer {
+	DwarfDrawData dwarfDraws[];
+};
+
+layout (location = 5) in uint dwarfDrawIndex;
+flat out uint dwarfMaterialIndex;
+
+#define modelMatrix (dwarfDraws[dwarfDrawIndex].ModelMatrix)
+
+void dwarfForwardMaterialIndex() {
+	dwarfMaterialIndex = dwarfDraws[dwarfDrawIndex].MaterialIndex;
+}
+#else
+uniform mat4 modelMatrix;
+
+void dwarfForwardMaterialIndex() {
+}
+#endif
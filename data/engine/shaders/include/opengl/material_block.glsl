@@ -0,0 +1,14 @@
+// Material parameters of the multi draw indirect path. Fragment shaders
+// declare their non texture parameters in a DwarfMaterial struct before
+// including this file. With the DWARF_INDIRECT_DRAW keyword the parameters of
+// every material drawn with the shader are stored in one storage buffer and
+// dwarfMaterials[dwarfMaterialIndex] holds the ones of the current draw.
+#pragma keywords DWARF_INDIRECT_DRAW
+
+#ifdef DWARF_INDIRECT_DRAW
+flat in uint dwarfMaterialIndex;
+
+layout (std430, binding = 1) readonly buffer DwarfMaterialBuffer {
+	DwarfMaterial dwarfMaterials[];
+};
+#endif
@@ -0,0 +1,26 @@
+// Decoding of the compact vertex format, the renderer sets the uniforms per
+// mesh. Indirect draws read them from the per draw data (see
+// indirect_draw.glsl, which has to be included first).
+#ifdef DWARF_INDIRECT_DRAW
+#define _VertexCompression (dwarfDraws[dwarfDrawIndex].VertexCompression != 0u)
+#define _PositionScale (dwarfDraws[dwarfDrawIndex].PositionScale.xyz)
+#define _PositionOffset (dwarfDraws[dwarfDrawIndex].PositionOffset.xyz)
+#else
+uniform bool _VertexCompression;
+uniform vec3 _PositionScale;
+uniform vec3 _PositionOffset;
+#endif
+
+vec3 octDecode(vec2 e){
+	vec3 v = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	if (v.z < 0.0) v.xy = (1.0 - abs(v.yx)) * vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+	return normalize(v);
+}
+
+vec3 decodePosition(vec4 position){
+	return _VertexCompression ? position.xyz * _PositionScale + _PositionOffset : position.xyz;
+}
+
+vec3 decodeDirection(vec3 direction){
+	return _VertexCompression ? octDecode(direction.xy) : direction;
+}
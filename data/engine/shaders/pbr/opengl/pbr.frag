@@ -1,4 +1,5 @@
 #version 450 core
+#pragma keywords HAS_ALBEDO_MAP HAS_NORMAL_MAP HAS_METAL_ROUGHNESS_MAP HAS_EMISSIVE_MAP HAS_AO_MAP
 
 // Input from vertex shader
 in vec2 TexCoords;
@@ -13,32 +14,83 @@ uniform mat4 viewMatrix;
 uniform mat4 projectionMatrix;
 uniform vec3 viewPosition;
 
-// Uniforms for textures
-uniform vec4 tint;
+// Maps are only sampled in the variants with their keyword defined
 
 // Diffuse color
-uniform bool hasAlbedoMap;
+#ifdef HAS_ALBEDO_MAP
 uniform sampler2D albedoMap;
+#endif
 
 // Normal map
-uniform bool hasNormalMap;
+#ifdef HAS_NORMAL_MAP
 uniform sampler2D normalMap;
-uniform float normalStrength;
+#endif
 
-uniform bool hasMetalRoughnessMap;
+#ifdef HAS_METAL_ROUGHNESS_MAP
 uniform sampler2D metalRoughnessMap; // Metalness (R) and Roughness (G)
-// Will be used when no metalness/roughness texture is provided
-uniform float metalness;
-uniform float roughness;
+#endif
 
 // Emission
-uniform bool hasEmissiveMap;
+#ifdef HAS_EMISSIVE_MAP
 uniform sampler2D emissiveMap;
-uniform float emissionIntensity;
+#endif
 
  // Ambient Occlusion
-uniform bool hasAoMap;
+#ifdef HAS_AO_MAP
 uniform sampler2D aoMap;
+#endif
+
+// Material parameters. The indirect draw variant reads them from the material
+// buffer, every other variant from uniforms.
+#ifdef DWARF_INDIRECT_DRAW
+struct DwarfMaterial {
+	vec4 tint;
+#ifdef HAS_NORMAL_MAP
+	float normalStrength;
+#endif
+#ifndef HAS_METAL_ROUGHNESS_MAP
+	float metalness;
+	float roughness;
+#endif
+#ifdef HAS_EMISSIVE_MAP
+	float emissionIntensity;
+#endif
+};
+#define MATERIAL_PARAMETER
+#else
+#define MATERIAL_PARAMETER uniform
+#endif
+#include "material_block.glsl"
+
+MATERIAL_PARAMETER vec4 tint;
+#ifdef HAS_NORMAL_MAP
+MATERIAL_PARAMETER float normalStrength;
+#endif
+#ifndef HAS_METAL_ROUGHNESS_MAP
+// Will be used when no metalness/roughness texture is provided
+MATERIAL_PARAMETER float metalness;
+MATERIAL_PARAMETER float roughness;
+#endif
+#ifdef HAS_EMISSIVE_MAP
+MATERIAL_PARAMETER float emissionIntensity;
+#endif
+
+void loadMaterial() {
+#ifdef DWARF_INDIRECT_DRAW
+	DwarfMaterial material = dwarfMaterials[dwarfMaterialIndex];
+	tint = material.tint;
+#ifdef HAS_NORMAL_MAP
+	normalStrength = material.normalStrength;
+#endif
+#ifndef HAS_METAL_ROUGHNESS_MAP
+	metalness = material.metalness;
+	roughness = material.roughness;
+#endif
+#ifdef HAS_EMISSIVE_MAP
+	emissionIntensity = material.emissionIntensity;
+#endif
+#endif
+}
 
 // Uniforms for lighting
 vec3 lightDir = vec3(-0.8, -0.7, -0.3);  // Normalized light direction
@@ -81,18 +133,42 @@ float geometrySmith(vec3 N, vec3 V, vec3 L, float roughness) {
 }
 
 void main() {
-    // Texture samples
-    vec4 albedo = (hasAlbedoMap ? texture(albedoMap, TexCoords) : vec4(1.0)) * tint;
-    vec3 emissive = hasEmissiveMap ? texture(emissiveMap, TexCoords).rgb : vec3(0.0);
-    float ao = hasAoMap ? texture(aoMap, TexCoords).r : 1.0;
+    loadMaterial();
 
+    // Texture samples
+#ifdef HAS_ALBEDO_MAP
+    vec4 albedo = texture(albedoMap, TexCoords) * tint;
+#else
+    vec4 albedo = tint;
+#endif
+
+#ifdef HAS_EMISSIVE_MAP
+    vec3 emissive = texture(emissiveMap, TexCoords).rgb * emissionIntensity;
+#else
+    vec3 emissive = vec3(0.0);
+#endif
+
+#ifdef HAS_AO_MAP
+    float ao = texture(aoMap, TexCoords).r;
+#else
+    float ao = 1.0;
+#endif
+
+#ifdef HAS_NORMAL_MAP
     vec3 tangentNormal = texture(normalMap, TexCoords).rgb * 2.0 - 1.0;
     tangentNormal.xy *= clamp(normalStrength, 0.0, 1.0);
-    vec3 N = hasNormalMap ? normalize(TBN * tangentNormal) : TBN[2];
-
-    vec3 metalRoughness = hasMetalRoughnessMap ? texture(metalRoughnessMap, TexCoords).rgb : vec3(metalness, roughness, 0.0);
-    float metalness = metalRoughness.r;
-    float roughness = clamp(metalRoughness.g, MIN_ROUGHNESS, 1.0);
+    vec3 N = normalize(TBN * tangentNormal);
+#else
+    vec3 N = TBN[2];
+#endif
+
+#ifdef HAS_METAL_ROUGHNESS_MAP
+    vec3 metalRoughness = texture(metalRoughnessMap, TexCoords).rgb;
+#else
+    vec3 metalRoughness = vec3(metalness, roughness, 0.0);
+#endif
+    float metallic = metalRoughness.r;
+    float perceptualRoughness = clamp(metalRoughness.g, MIN_ROUGHNESS, 1.0);
 
     // Lighting calculations
     vec3 V = normalize(viewPosition - FragPos);
@@ -103,14 +179,14 @@ void main() {
     float NdotV = max(dot(N, V), 0.0);
 
     // Fresnel equation (Schlick's approximation)
-    vec3 F0 = mix(vec3(0.04), albedo.rgb, metalness);
+    vec3 F0 = mix(vec3(0.04), albedo.rgb, metallic);
     vec3 F = fresnelSchlick(max(dot(H, V), 0.0), F0);
 
     // Normal distribution function (GGX)
-    float NDF = distributionGGX(N, H, roughness);
+    float NDF = distributionGGX(N, H, perceptualRoughness);
 
     // Geometry function (Smith's method)
-    float G = geometrySmith(N, V, L, roughness);
+    float G = geometrySmith(N, V, L, perceptualRoughness);
 
     // Cook-Torrance BRDF
     vec3 numerator = NDF * G * F;
@@ -119,7 +195,7 @@ void main() {
 
     // Diffuse contribution (Lambertian)
     vec3 kD = vec3(1.0) - F;
-    kD *= 1.0 - metalness;  // Only non-metals have diffuse lighting
+    kD *= 1.0 - metallic;  // Only non-metals have diffuse lighting
     vec3 diffuse = kD * albedo.rgb / PI;
 
     // Convert Lux to Radiance
@@ -134,7 +210,7 @@ void main() {
     lighting *= ao;
 
     // Add emissive map
-    vec3 color = lighting + (emissive * emissionIntensity);
+    vec3 color = lighting + emissive;
 
     // Output final color
     FragColor = vec4(color, albedo.a);
@@ -1,16 +1,20 @@
 #version 450 core
 
-layout (location = 0) in vec3 vertex;
-layout (location = 1) in vec3 normal;
+layout (location = 0) in vec4 vertexIn;
+layout (location = 1) in vec3 normalIn;
 
 uniform mat4 modelMatrix;
 uniform mat4 viewMatrix;
 uniform mat4 projectionMatrix;
+#include "vertex_compression.glsl"
 
 out vec3 FragPos;
 out vec3 FragNormal;
 
 void main(){
+    vec3 vertex = decodePosition(vertexIn);
+    vec3 normal = decodeDirection(normalIn);
+
     // Transform vertex position into world space
     FragPos = vec3(modelMatrix * vec4(vertex, 1.0));
 
@@ -4,8 +4,24 @@ in vec2 FragUV;
 out vec4 FragColor;
 
 uniform sampler2D albedoMap;
-uniform vec4 color;
+
+// Material parameters, read from the material buffer by the indirect draw
+// variant
+#ifdef DWARF_INDIRECT_DRAW
+struct DwarfMaterial {
+    vec4 color;
+};
+#define MATERIAL_PARAMETER
+#else
+#define MATERIAL_PARAMETER uniform
+#endif
+#include "material_block.glsl"
+
+MATERIAL_PARAMETER vec4 color;
 
 void main() {
+#ifdef DWARF_INDIRECT_DRAW
+    color = dwarfMaterials[dwarfMaterialIndex].color;
+#endif
     FragColor = color * texture(albedoMap, FragUV);
 }
@@ -1,18 +1,21 @@
 #version 450 core
 
-layout (location = 0) in vec3 vertex;
+layout (location = 0) in vec4 vertexIn;
 layout (location = 1) in vec3 normal;
 layout (location = 2) in vec3 tangent;
 layout (location = 3) in vec3 biTangent;
 layout (location = 4) in vec2 uvCoord;
 
-uniform mat4 modelMatrix;
+#include "indirect_draw.glsl"
 uniform mat4 viewMatrix;
 uniform mat4 projectionMatrix;
+#include "vertex_compression.glsl"
 
 out vec2 FragUV;
 
 void main(){
+	dwarfForwardMaterialIndex();
+	vec3 vertex = decodePosition(vertexIn);
 	FragUV = uvCoord;
     gl_Position = projectionMatrix * viewMatrix * modelMatrix * vec4(vertex, 1.0);
 }
\ No newline at end of file
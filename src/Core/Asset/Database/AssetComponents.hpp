@@ -4,6 +4,7 @@
 #include "Core/Rendering/Material/IMaterial.hpp"
 #include "Core/Rendering/Mesh/IMesh.hpp"
 #include "Core/Rendering/Texture/ITexture.hpp"
+#include "Utilities/ContentHash.hpp"
 
 namespace Dwarf
 {
@@ -88,100 +89,81 @@ namespace Dwarf
     }
   };
 
-  /// @brief Component containing a vertex shader asset.
-  struct VertexShaderAsset : public IAssetComponent
+  /// @brief Base of the components containing the source of a shader stage.
+  /// The hash of the source is computed once when the asset is (re)imported.
+  struct ShaderSourceAsset : public IAssetComponent
   {
   private:
     /// @brief The content of the file.
     std::string mFileContent;
 
-  public:
-    explicit VertexShaderAsset(const std::string& fileContent)
+    /// @brief Hash of the content.
+    ContentHash mContentHash;
+
+  protected:
+    explicit ShaderSourceAsset(const std::string& fileContent)
       : mFileContent(fileContent)
+      , mContentHash(ContentHash::Compute(fileContent))
     {
     }
 
+  public:
     auto
     GetFileContent() const -> const std::string&
     {
       return mFileContent;
     }
+
+    auto
+    GetContentHash() const -> const ContentHash&
+    {
+      return mContentHash;
+    }
   };
 
-  /// @brief Component containing a fragment shader asset.
-  struct FragmentShaderAsset : public IAssetComponent
+  /// @brief Component containing a vertex shader asset.
+  struct VertexShaderAsset : public ShaderSourceAsset
   {
-  private:
-    std::string mFileContent;
-
-  public:
-    explicit FragmentShaderAsset(const std::string& fileContent)
-      : mFileContent(fileContent)
+    explicit VertexShaderAsset(const std::string& fileContent)
+      : ShaderSourceAsset(fileContent)
     {
     }
+  };
 
-    auto
-    GetFileContent() const -> const std::string&
+  /// @brief Component containing a fragment shader asset.
+  struct FragmentShaderAsset : public ShaderSourceAsset
+  {
+    explicit FragmentShaderAsset(const std::string& fileContent)
+      : ShaderSourceAsset(fileContent)
     {
-      return mFileContent;
     }
   };
 
   /// @brief Component containing a geometry shader asset.
-  struct GeometryShaderAsset : public IAssetComponent
+  struct GeometryShaderAsset : public ShaderSourceAsset
   {
-  private:
-    std::string mFileContent;
-
-  public:
     explicit GeometryShaderAsset(const std::string& fileContent)
-      : mFileContent(fileContent)
-    {
-    }
-
-    auto
-    GetFileContent() const -> const std::string&
+      : ShaderSourceAsset(fileContent)
     {
-      return mFileContent;
     }
   };
 
   /// @brief Component containing a tesselation control shader asset.
-  struct TessellationControlShaderAsset : public IAssetComponent
+  struct TessellationControlShaderAsset : public ShaderSourceAsset
   {
-  private:
-    std::string mFileContent;
-
-  public:
     explicit TessellationControlShaderAsset(const std::string& fileContent)
-      : mFileContent(fileContent)
+      : ShaderSourceAsset(fileContent)
     {
     }
-
-    auto
-    GetFileContent() const -> const std::string&
-    {
-      return mFileContent;
-    }
   };
 
   /// @brief Component containing a tesselation evaluation shader asset.
-  struct TessellationEvaluationShaderAsset : public IAssetComponent
+  struct TessellationEvaluationShaderAsset : public ShaderSourceAsset
   {
-  private:
-    std::string mFileContent;
-
-  public:
     explicit TessellationEvaluationShaderAsset(const std::string& fileContent)
-      : mFileContent(fileContent)
+      : ShaderSourceAsset(fileContent)
     {
     }
-
-    auto
-    GetFileContent() const -> const std::string&
-    {
-      return mFileContent;
-    }
   };
 
   /// @brief Component containing a compute shader asset.
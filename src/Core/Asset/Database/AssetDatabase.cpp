@@ -49,6 +49,11 @@ namespace Dwarf
       mFileHandler->CreateDirectoryAt(mAssetDirectoryPath.t);
     }
 
+    mRegistry.on_construct<IDComponent>()
+      .connect<&AssetDatabase::OnIdComponentConstruct>(this);
+    mRegistry.on_destroy<IDComponent>()
+      .connect<&AssetDatabase::OnIdComponentDestroy>(this);
+
     ImportDefaultAssets();
 
     mAssetDirectoryListener->registerAddFileCallback(
@@ -81,9 +86,31 @@ namespace Dwarf
 
   AssetDatabase::~AssetDatabase()
   {
+    mRegistry.on_construct<IDComponent>()
+      .disconnect<&AssetDatabase::OnIdComponentConstruct>(this);
+    mRegistry.on_destroy<IDComponent>()
+      .disconnect<&AssetDatabase::OnIdComponentDestroy>(this);
     mLogger->LogDebug(Log("AssetDatabase destroyed", "AssetDatabase"));
   }
 
+  void
+  AssetDatabase::OnIdComponentConstruct(entt::registry& registry,
+                                        entt::entity    entity)
+  {
+    mAssetIndex[registry.get<IDComponent>(entity).getId()] = entity;
+  }
+
+  void
+  AssetDatabase::OnIdComponentDestroy(entt::registry& registry,
+                                      entt::entity    entity)
+  {
+    auto it = mAssetIndex.find(registry.get<IDComponent>(entity).getId());
+    if (it != mAssetIndex.end() && it->second == entity)
+    {
+      mAssetIndex.erase(it);
+    }
+  }
+
   void
   AssetDatabase::GatherAssetPaths(
     const std::filesystem::path&        directory,
@@ -189,13 +216,14 @@ namespace Dwarf
           {
             mRegistry.emplace_or_replace<FragmentShaderAsset>(
               asset->GetHandle(), mFileHandler->ReadFile(assetPath));
-            HotReloadShaders(assetPath);
+            HotReloadShaders(asset->GetUID());
             break;
           }
         case ASSET_TYPE::GEOMETRY_SHADER:
           {
             mRegistry.emplace_or_replace<GeometryShaderAsset>(
               asset->GetHandle(), mFileHandler->ReadFile(assetPath));
+            HotReloadShaders(asset->GetUID());
             break;
           }
         case ASSET_TYPE::HLSL_SHADER:
@@ -208,18 +236,21 @@ namespace Dwarf
           {
             mRegistry.emplace_or_replace<TessellationControlShaderAsset>(
               asset->GetHandle(), mFileHandler->ReadFile(assetPath));
+            HotReloadShaders(asset->GetUID());
             break;
           }
         case ASSET_TYPE::TESE_SHADER:
           {
             mRegistry.emplace_or_replace<TessellationEvaluationShaderAsset>(
               asset->GetHandle(), mFileHandler->ReadFile(assetPath));
+            HotReloadShaders(asset->GetUID());
             break;
           }
         case ASSET_TYPE::VERTEX_SHADER:
           {
             mRegistry.emplace_or_replace<VertexShaderAsset>(
               asset->GetHandle(), mFileHandler->ReadFile(assetPath));
+            HotReloadShaders(asset->GetUID());
             break;
           }
         case ASSET_TYPE::SCENE:
@@ -233,6 +264,9 @@ namespace Dwarf
           {
             mRegistry.emplace_or_replace<UnknownAsset>(
               asset->GetHandle(), mFileHandler->ReadFile(assetPath));
+            // Shader include files have no asset type of their own, only the
+            // programs including them are recompiled
+            mShaderRegistry->RecompileIncluding(assetPath);
             break;
           }
       }
@@ -247,19 +281,16 @@ namespace Dwarf
   void
   AssetDatabase::Remove(const UUID& uid)
   {
-    auto view = mRegistry.view<IDComponent, PathComponent>();
-    for (auto entity : view)
+    std::unique_ptr<IAssetReference> asset = Retrieve(uid);
+    if (asset)
     {
-      std::unique_ptr<IAssetReference> asset = Retrieve(uid);
-      if (asset->GetUID() == uid)
-      {
-        mRegistry.destroy(entity);
+      std::filesystem::path path = asset->GetPath();
+      ASSET_TYPE            type = asset->GetType();
+      mRegistry.destroy(mAssetIndex.at(uid));
 
-        for (auto* observer : mObservers)
-        {
-          observer->OnReimportAsset(
-            asset->GetPath(), asset->GetType(), asset->GetUID());
-        }
+      for (auto* observer : mObservers)
+      {
+        observer->OnReimportAsset(path, type, uid);
       }
     }
   }
@@ -383,12 +414,7 @@ namespace Dwarf
   auto
   AssetDatabase::Exists(const UUID& uid) -> bool
   {
-    // Retrieve entt::entity with UID component
-    auto view = mRegistry.view<IDComponent>();
-    return std::ranges::any_of(
-      view,
-      [view, uid](auto entity)
-      { return view.get<IDComponent>(entity).getId() == uid; });
+    return mAssetIndex.contains(uid);
   }
 
   auto
@@ -405,20 +431,17 @@ namespace Dwarf
   auto
   AssetDatabase::Retrieve(const UUID& uid) -> std::unique_ptr<IAssetReference>
   {
-    auto view = mRegistry.view<IDComponent, PathComponent>();
-    for (auto entity : view)
+    auto it = mAssetIndex.find(uid);
+    if (it == mAssetIndex.end() || !mRegistry.all_of<PathComponent>(it->second))
     {
-      if (view.get<IDComponent>(entity).getId() == uid)
-      {
-        auto pathHandle = PathComponentHandle(mRegistry, entity);
-        return mAssetReferenceFactory->Create(
-          entity,
-          mRegistry,
-          AssetDatabase::GetAssetType(
-            pathHandle.GetPath().extension().string()));
-      }
+      return nullptr;
     }
-    return nullptr;
+
+    auto pathHandle = PathComponentHandle(mRegistry, it->second);
+    return mAssetReferenceFactory->Create(
+      it->second,
+      mRegistry,
+      AssetDatabase::GetAssetType(pathHandle.GetPath().extension().string()));
   }
 
   auto
@@ -707,24 +730,11 @@ namespace Dwarf
   }
 
   void
-  AssetDatabase::HotReloadShaders(const std::filesystem::path& shaderAssetPath)
+  AssetDatabase::HotReloadShaders(const UUID& shaderAssetId)
   {
-
-    auto view = mRegistry.view<MaterialAsset>();
-    for (auto entity : view)
-    {
-      MaterialAsset& materialAsset = view.get<MaterialAsset>(entity);
-      std::unique_ptr<IShaderSourceCollection> shaderSources =
-        materialAsset.GetMaterial().GetShaderAssetSources()->GetShaderSources();
-      if (std::ranges::any_of(
-            shaderSources->GetShaderSources(),
-            [shaderAssetPath](const std::unique_ptr<IAssetReference>& ref)
-            { return ref->GetPath() == shaderAssetPath; }))
-      {
-        materialAsset.GetMaterial().UpdateShader();
-        return;
-      }
-    }
+    // Only the materials using programs with the changed stage are updated,
+    // their parameters are patched once the new programs are compiled
+    mShaderRegistry->ReloadShaderAsset(shaderAssetId);
   }
 
   void
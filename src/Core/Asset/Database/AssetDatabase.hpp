@@ -43,6 +43,10 @@ namespace Dwarf
     /// @brief ECS registry containing entities for every asset in the "/Assets"
     entt::registry mRegistry;
 
+    /// @brief Asset entities by their UID, kept in sync with the ID components
+    /// of the registry.
+    std::unordered_map<UUID, entt::entity> mAssetIndex;
+
     std::map<std::filesystem::path, std::shared_ptr<IShader>> mShaderAssetMap;
     std::vector<IAssetDatabaseObserver*>                      mObservers;
 
@@ -60,6 +64,18 @@ namespace Dwarf
     std::shared_ptr<IFileHandler>            mFileHandler;
     std::shared_ptr<IShaderRegistry>         mShaderRegistry;
 
+    /**
+     * @brief Adds a newly identified asset entity to the UID index
+     */
+    void
+    OnIdComponentConstruct(entt::registry& registry, entt::entity entity);
+
+    /**
+     * @brief Removes a destroyed asset entity from the UID index
+     */
+    void
+    OnIdComponentDestroy(entt::registry& registry, entt::entity entity);
+
   public:
     /**
      * @brief Construct a new Asset Database object
@@ -276,7 +292,12 @@ namespace Dwarf
     void
     ImportDefaultModels();
 
+    /**
+     * @brief Updates the materials using a changed shader stage
+     *
+     * @param shaderAssetId UID of the changed shader stage asset
+     */
     void
-    HotReloadShaders(const std::filesystem::path& shaderAssetPath);
+    HotReloadShaders(const UUID& shaderAssetId);
   };
 }
\ No newline at end of file
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Core/Rendering/Mesh/VertexLayout.hpp"
+#include "Utilities/ISerializable.hpp"
+#include <cstdint>
+#include <nlohmann/json.hpp>
+
+namespace Dwarf
+{
+  /// @brief Per model import settings stored in the ImportSettings section of
+  /// the asset metadata.
+  struct ModelImportSettings : public ISerializable
+  {
+    /// @brief Reorder triangles for post-transform vertex cache efficiency.
+    bool mOptimizeVertexCache = true;
+
+    /// @brief Reorder triangle clusters to reduce overdraw.
+    bool mOptimizeOverdraw = true;
+
+    /// @brief Reorder vertices in order of first use.
+    bool mOptimizeVertexFetch = true;
+
+    /// @brief Size of the targeted post-transform vertex cache.
+    uint32_t mVertexCacheSize = 16;
+
+    /// @brief Allowed ACMR degradation of the overdraw pass.
+    float mOverdrawThreshold = 1.05F;
+
+    /// @brief Vertex format the meshes are uploaded with. The compact format
+    /// requires shaders that decode it (see the engine shaders).
+    VertexFormat mVertexFormat = VertexFormat::Standard;
+
+    /// @brief Split meshes with more vertices than 16 bit indices can address
+    /// so every part can use 16 bit indices.
+    bool mSplitForUInt16Indices = true;
+
+    /// @brief Generate reduced detail levels with the mesh simplifier.
+    bool mGenerateLods = false;
+
+    /// @brief Number of reduced detail levels to generate.
+    uint32_t mLodCount = 3;
+
+    /// @brief Targeted triangle ratio of a level relative to the previous one.
+    float mLodReduction = 0.5F;
+
+    /// @brief Maximum geometric error of a level relative to the mesh radius.
+    float mLodMaxError = 0.02F;
+
+    /// @brief Screen height fraction below which the first reduced level is
+    /// used. Every following level halves the threshold.
+    float mLodScreenSize = 0.5F;
+
+    /// @brief Partition the meshes into meshlets for cluster culling.
+    bool mGenerateMeshlets = false;
+
+    ModelImportSettings() = default;
+
+    ModelImportSettings(nlohmann::json& serializedData)
+    {
+      if (serializedData.contains("OptimizeVertexCache"))
+      {
+        mOptimizeVertexCache =
+          serializedData["OptimizeVertexCache"].get<bool>();
+      }
+
+      if (serializedData.contains("OptimizeOverdraw"))
+      {
+        mOptimizeOverdraw = serializedData["OptimizeOverdraw"].get<bool>();
+      }
+
+      if (serializedData.contains("OptimizeVertexFetch"))
+      {
+        mOptimizeVertexFetch =
+          serializedData["OptimizeVertexFetch"].get<bool>();
+      }
+
+      if (serializedData.contains("VertexCacheSize"))
+      {
+        mVertexCacheSize = serializedData["VertexCacheSize"].get<uint32_t>();
+      }
+
+      if (serializedData.contains("OverdrawThreshold"))
+      {
+        mOverdrawThreshold = serializedData["OverdrawThreshold"].get<float>();
+      }
+
+      if (serializedData.contains("VertexFormat"))
+      {
+        mVertexFormat = serializedData["VertexFormat"].get<VertexFormat>();
+      }
+
+      if (serializedData.contains("SplitForUInt16Indices"))
+      {
+        mSplitForUInt16Indices =
+          serializedData["SplitForUInt16Indices"].get<bool>();
+      }
+
+      if (serializedData.contains("GenerateLods"))
+      {
+        mGenerateLods = serializedData["GenerateLods"].get<bool>();
+      }
+
+      if (serializedData.contains("LodCount"))
+      {
+        mLodCount = serializedData["LodCount"].get<uint32_t>();
+      }
+
+      if (serializedData.contains("LodReduction"))
+      {
+        mLodReduction = serializedData["LodReduction"].get<float>();
+      }
+
+      if (serializedData.contains("LodMaxError"))
+      {
+        mLodMaxError = serializedData["LodMaxError"].get<float>();
+      }
+
+      if (serializedData.contains("LodScreenSize"))
+      {
+        mLodScreenSize = serializedData["LodScreenSize"].get<float>();
+      }
+
+      if (serializedData.contains("GenerateMeshlets"))
+      {
+        mGenerateMeshlets = serializedData["GenerateMeshlets"].get<bool>();
+      }
+    }
+
+    auto
+    Serialize() -> nlohmann::json override
+    {
+      nlohmann::json serializedData;
+
+      serializedData["OptimizeVertexCache"] = mOptimizeVertexCache;
+
+      serializedData["OptimizeOverdraw"] = mOptimizeOverdraw;
+
+      serializedData["OptimizeVertexFetch"] = mOptimizeVertexFetch;
+
+      serializedData["VertexCacheSize"] = mVertexCacheSize;
+
+      serializedData["OverdrawThreshold"] = mOverdrawThreshold;
+
+      serializedData["VertexFormat"] = mVertexFormat;
+
+      serializedData["SplitForUInt16Indices"] = mSplitForUInt16Indices;
+
+      serializedData["GenerateLods"] = mGenerateLods;
+
+      serializedData["LodCount"] = mLodCount;
+
+      serializedData["LodReduction"] = mLodReduction;
+
+      serializedData["LodMaxError"] = mLodMaxError;
+
+      serializedData["LodScreenSize"] = mLodScreenSize;
+
+      serializedData["GenerateMeshlets"] = mGenerateMeshlets;
+
+      return serializedData;
+    }
+  };
+}
@@ -1,5 +1,8 @@
 #include "pch.hpp"
 
+#include "Core/Rendering/Mesh/MeshOptimizer/MeshOptimizer.hpp"
+#include "Core/Rendering/Mesh/MeshSimplifier/MeshSimplifier.hpp"
+#include "Core/Rendering/Mesh/MeshletBuilder/MeshletBuilder.hpp"
 #include "ModelImporter.hpp"
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
@@ -7,6 +10,13 @@
 
 namespace Dwarf
 {
+  namespace
+  {
+    /// @brief Detail levels keeping more than this ratio of the triangles of
+    /// the previous level are discarded.
+    constexpr float MIN_LOD_REDUCTION = 0.9F;
+  }
+
   auto
   AssimpToGlmMatrix(const aiMatrix4x4& from) -> glm::mat4
   {
@@ -35,7 +45,10 @@ namespace Dwarf
   auto
   GetImportFlags(const std::filesystem::path& path) -> unsigned int
   {
-    unsigned int flags = aiProcess_Triangulate | aiProcess_GenSmoothNormals |
+    // Triangulation keeps point and line faces, sorting by primitive type
+    // moves them into meshes of their own
+    unsigned int flags = aiProcess_Triangulate | aiProcess_SortByPType |
+                         aiProcess_GenSmoothNormals |
                          aiProcess_CalcTangentSpace |
                          aiProcess_JoinIdenticalVertices;
     std::string ext = path.extension().string();
@@ -78,6 +91,12 @@ namespace Dwarf
     mLogger->LogDebug(
       Log(fmt::format("Metadata:\n{}", metaData.dump(2)), "ModelImporter"));
 
+    ModelImportSettings settings;
+    if (metaData.contains("ImportSettings"))
+    {
+      settings = ModelImportSettings(metaData["ImportSettings"]);
+    }
+
     Assimp::Importer importer;
     const aiScene*   scene =
       importer.ReadFile(path.string(), GetImportFlags(path));
@@ -115,7 +134,7 @@ namespace Dwarf
     std::vector<std::shared_ptr<IMesh>> meshes;
 
     ModelImporter::ProcessNode(
-      scene->mRootNode, scene, meshes, glm::mat4(1.0F));
+      scene->mRootNode, scene, meshes, glm::mat4(1.0F), settings);
 
     return meshes;
   }
@@ -124,7 +143,8 @@ namespace Dwarf
   ModelImporter::ProcessNode(const aiNode*                        node,
                              const aiScene*                       scene,
                              std::vector<std::shared_ptr<IMesh>>& meshes,
-                             glm::mat4 parentTransform)
+                             glm::mat4 parentTransform,
+                             const ModelImportSettings& settings)
   {
     glm::mat4          nodeTransform = AssimpToGlmMatrix(node->mTransformation);
     glm::mat4          globalTransform = parentTransform * nodeTransform;
@@ -136,22 +156,30 @@ namespace Dwarf
     {
       const aiMesh* mesh = meshSpan[nodeMeshesSpan[i]];
       // meshes.push_back(ProcessMesh(mesh, scene));
-      ProcessMesh(mesh, meshes, globalTransform);
+      ProcessMesh(mesh, meshes, globalTransform, settings);
     }
 
     std::span<aiNode*> nodeChildrenSpan(node->mChildren, node->mNumChildren);
     // then do the same for each of its children
     for (uint32_t i = 0; i < node->mNumChildren; i++)
     {
-      ProcessNode(nodeChildrenSpan[i], scene, meshes, globalTransform);
+      ProcessNode(
+        nodeChildrenSpan[i], scene, meshes, globalTransform, settings);
     }
   }
 
   void
   ModelImporter::ProcessMesh(const aiMesh*                        mesh,
                              std::vector<std::shared_ptr<IMesh>>& meshes,
-                             glm::mat4                            transform)
+                             glm::mat4                            transform,
+                             const ModelImportSettings&           settings)
   {
+    // Point and line meshes are not rendered
+    if ((mesh->mPrimitiveTypes & aiPrimitiveType_TRIANGLE) == 0U)
+    {
+      return;
+    }
+
     std::vector<Vertex>   vertices;
     std::vector<uint32_t> indices;
     uint32_t              materialIndex = mesh->mMaterialIndex;
@@ -224,7 +252,12 @@ namespace Dwarf
 
     for (uint32_t i = 0; i < mesh->mNumFaces; i++)
     {
-      const aiFace&       face = meshFacesSpan[i];
+      const aiFace& face = meshFacesSpan[i];
+      if (face.mNumIndices != 3)
+      {
+        continue;
+      }
+
       std::span<uint32_t> faceIndicesSpan(face.mIndices, face.mNumIndices);
       for (uint32_t j = 0; j < face.mNumIndices; j++)
       {
@@ -232,6 +265,147 @@ namespace Dwarf
       }
     }
 
-    meshes.push_back(mMeshFactory->Create(vertices, indices, materialIndex));
+    OptimizeMesh(vertices, indices, settings);
+
+    // Meshes exceeding the 16 bit index range are split, so every part only
+    // needs half the index memory
+    std::vector<MeshChunk> chunks;
+    if (settings.mSplitForUInt16Indices &&
+        vertices.size() > MAX_UINT16_INDEX_VERTICES)
+    {
+      chunks = MeshOptimizer::SplitByVertexLimit(
+        vertices, indices, MAX_UINT16_INDEX_VERTICES);
+
+      mLogger->LogDebug(
+        Log(fmt::format("Split mesh with {} vertices into {} parts",
+                        vertices.size(),
+                        chunks.size()),
+            "ModelImporter"));
+    }
+    else
+    {
+      chunks.push_back({ std::move(vertices), std::move(indices) });
+    }
+
+    for (const MeshChunk& chunk : chunks)
+    {
+      std::shared_ptr<IMesh> chunkMesh = mMeshFactory->Create(
+        chunk.Vertices, chunk.Indices, materialIndex, settings.mVertexFormat);
+
+      if (settings.mGenerateLods)
+      {
+        chunkMesh->SetLods(
+          GenerateLods(chunk.Vertices, chunk.Indices, settings));
+      }
+
+      if (settings.mGenerateMeshlets)
+      {
+        chunkMesh->SetMeshlets(
+          MeshletBuilder::Build(chunk.Vertices, chunk.Indices));
+      }
+
+      meshes.push_back(chunkMesh);
+    }
+  }
+
+  void
+  ModelImporter::OptimizeMesh(std::vector<Vertex>&       vertices,
+                              std::vector<uint32_t>&     indices,
+                              const ModelImportSettings& settings)
+  {
+    if (!settings.mOptimizeVertexCache && !settings.mOptimizeOverdraw &&
+        !settings.mOptimizeVertexFetch)
+    {
+      return;
+    }
+
+    VertexCacheStatistics before = MeshOptimizer::AnalyzeVertexCache(
+      indices, vertices.size(), settings.mVertexCacheSize);
+
+    if (settings.mOptimizeOverdraw)
+    {
+      MeshOptimizer::OptimizeOverdraw(indices,
+                                      vertices,
+                                      settings.mVertexCacheSize,
+                                      settings.mOverdrawThreshold);
+    }
+    else if (settings.mOptimizeVertexCache)
+    {
+      MeshOptimizer::OptimizeVertexCache(
+        indices, vertices.size(), settings.mVertexCacheSize);
+    }
+
+    if (settings.mOptimizeVertexFetch)
+    {
+      MeshOptimizer::OptimizeVertexFetch(indices, vertices);
+    }
+
+    VertexCacheStatistics after = MeshOptimizer::AnalyzeVertexCache(
+      indices, vertices.size(), settings.mVertexCacheSize);
+
+    mLogger->LogDebug(
+      Log(fmt::format("Optimized mesh: ACMR {:.3f} -> {:.3f}, ATVR {:.3f} -> "
+                      "{:.3f}",
+                      before.Acmr,
+                      after.Acmr,
+                      before.Atvr,
+                      after.Atvr),
+          "ModelImporter"));
+  }
+
+  auto
+  ModelImporter::GenerateLods(const std::vector<Vertex>&   vertices,
+                              const std::vector<uint32_t>& indices,
+                              const ModelImportSettings&   settings)
+    -> std::vector<MeshLod>
+  {
+    std::vector<MeshLod> lods;
+    lods.reserve(settings.mLodCount);
+
+    float maxError =
+      settings.mLodMaxError * MeshSimplifier::ComputeRadius(vertices);
+    float                        screenSize = settings.mLodScreenSize;
+    const std::vector<uint32_t>* source = &indices;
+
+    for (uint32_t level = 0; level < settings.mLodCount; level++)
+    {
+      auto targetIndexCount = static_cast<size_t>(
+        static_cast<float>(source->size() / 3) * settings.mLodReduction) * 3;
+
+      MeshLod lod;
+      lod.Indices = MeshSimplifier::Simplify(
+        vertices, *source, targetIndexCount, maxError, &lod.Error);
+
+      // Stop once the simplifier can no longer reduce the mesh notably,
+      // the level would only cost memory
+      if (lod.Indices.empty() ||
+          static_cast<float>(lod.Indices.size()) >
+            static_cast<float>(source->size()) * MIN_LOD_REDUCTION)
+      {
+        break;
+      }
+
+      if (settings.mOptimizeVertexCache)
+      {
+        MeshOptimizer::OptimizeVertexCache(
+          lod.Indices, vertices.size(), settings.mVertexCacheSize);
+      }
+
+      lod.ScreenSize = screenSize;
+      screenSize *= 0.5F;
+
+      mLogger->LogDebug(
+        Log(fmt::format("Generated LOD {}: {} -> {} triangles, error {:.5f}",
+                        level + 1,
+                        indices.size() / 3,
+                        lod.Indices.size() / 3,
+                        lod.Error),
+            "ModelImporter"));
+
+      lods.push_back(std::move(lod));
+      source = &lods.back().Indices;
+    }
+
+    return lods;
   }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "Core/Asset/Metadata/IAssetMetadata.hpp"
 #include "Core/Asset/Model/IModelImporter.hpp"
+#include "Core/Asset/Model/ModelImportSettings.hpp"
 #include "Core/Rendering/Mesh/IMeshFactory.hpp"
 #include "Logging/IDwarfLogger.hpp"
 #include <assimp/scene.h>
@@ -23,12 +24,14 @@ namespace Dwarf
      * @param scene Assimp scene
      * @param meshes Mesh vector reference to store the found meshes
      * @param parentTransform Transformation matrix of the parent node
+     * @param settings Import settings of the model
      */
     void
     ProcessNode(const aiNode*                        node,
                 const aiScene*                       scene,
                 std::vector<std::shared_ptr<IMesh>>& meshes,
-                glm::mat4                            parentTransform);
+                glm::mat4                            parentTransform,
+                const ModelImportSettings&           settings);
 
     /**
      * @brief Processes an assimp mesh
@@ -36,11 +39,39 @@ namespace Dwarf
      * @param mesh Assimp mesh to process
      * @param meshes Mesh vector reference to store the mesh
      * @param transform Transformation matrix for the mesh
+     * @param settings Import settings of the model
      */
     void
     ProcessMesh(const aiMesh*                        mesh,
                 std::vector<std::shared_ptr<IMesh>>& meshes,
-                glm::mat4                            transform);
+                glm::mat4                            transform,
+                const ModelImportSettings&           settings);
+
+    /**
+     * @brief Runs the mesh optimization passes enabled in the import settings
+     *
+     * @param vertices Vertices of the mesh
+     * @param indices Indices of the mesh
+     * @param settings Import settings of the model
+     */
+    void
+    OptimizeMesh(std::vector<Vertex>&       vertices,
+                 std::vector<uint32_t>&     indices,
+                 const ModelImportSettings& settings);
+
+    /**
+     * @brief Generates the reduced detail levels of a mesh as configured in
+     * the import settings. Every level is simplified from the previous one.
+     *
+     * @param vertices Vertices of the mesh
+     * @param indices Full detail indices of the mesh
+     * @param settings Import settings of the model
+     * @return Reduced detail levels ordered from fine to coarse
+     */
+    auto
+    GenerateLods(const std::vector<Vertex>&   vertices,
+                 const std::vector<uint32_t>& indices,
+                 const ModelImportSettings&   settings) -> std::vector<MeshLod>;
 
   public:
     ModelImporter(std::shared_ptr<IDwarfLogger>   logger,
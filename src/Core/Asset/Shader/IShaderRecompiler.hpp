@@ -4,15 +4,48 @@
 
 namespace Dwarf
 {
+  /**
+   * @brief Drives shader compilation from the main loop. Compilations are
+   * submitted to the driver and polled every frame, so they never block a
+   * frame while the driver compiles.
+   *
+   */
   class IShaderRecompiler
   {
   public:
     virtual ~IShaderRecompiler() = default;
 
+    /**
+     * @brief Queues a shader to be compiled at the next call to Recompile
+     *
+     * @param shader Shader to compile
+     */
     virtual void
     MarkForRecompilation(std::shared_ptr<IShader> shader) = 0;
 
+    /**
+     * @brief Polls the already submitted compilation of a shader during
+     * Recompile until it is finished
+     *
+     * @param shader Shader with a submitted compilation
+     */
+    virtual void
+    TrackCompilation(std::shared_ptr<IShader> shader) = 0;
+
+    /**
+     * @brief Submits the queued shaders and finishes the compilations the
+     * driver is done with
+     *
+     */
     virtual void
     Recompile() = 0;
+
+    /**
+     * @brief Returns the number of queued and submitted compilations
+     *
+     * @return Number of compilations that are not finished yet
+     */
+    [[nodiscard]] virtual auto
+    GetPendingCompilationCount() const -> size_t = 0;
   };
-}
\ No newline at end of file
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Dwarf
+{
+  /// @brief Result of preprocessing the source of a shader stage.
+  struct PreprocessedShaderSource
+  {
+    /// @brief Source with the includes resolved and the keywords defined.
+    std::string Source;
+
+    /// @brief Files included by the source, directly or indirectly, in the
+    /// order of their first inclusion.
+    std::vector<std::filesystem::path> IncludedFiles;
+
+    /// @brief Keywords declared with "#pragma keywords" in the source or its
+    /// includes.
+    std::vector<std::string> DeclaredKeywords;
+
+    /// @brief Problems found while preprocessing, e.g. unresolved includes.
+    std::vector<std::string> Errors;
+  };
+
+  /**
+   * @brief Resolves #include directives of shader sources and defines the
+   * keywords that select a shader variant. Keywords have to be declared by
+   * the shader with "#pragma keywords KEYWORD_A KEYWORD_B", each enabled
+   * keyword is then defined after the #version directive.
+   */
+  class IShaderPreprocessor
+  {
+  public:
+    virtual ~IShaderPreprocessor() = default;
+
+    /**
+     * @brief Preprocesses the source of a shader stage
+     *
+     * @param source Source of the stage
+     * @param sourcePath Path of the stage, includes are resolved relative to
+     * it before the engine include directories are searched
+     * @param keywords Keywords to enable
+     * @return The preprocessed source and its dependencies
+     */
+    [[nodiscard]] virtual auto
+    Preprocess(std::string_view                source,
+               const std::filesystem::path&    sourcePath,
+               const std::vector<std::string>& keywords) const
+      -> PreprocessedShaderSource = 0;
+  };
+}
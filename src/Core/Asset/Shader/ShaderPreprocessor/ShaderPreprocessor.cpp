@@ -0,0 +1,308 @@
+#include "pch.hpp"
+
+#include "Platform/OpenGL/OpenGLUtilities.hpp"
+#include "ShaderPreprocessor.hpp"
+
+namespace Dwarf
+{
+  namespace
+  {
+    /// @brief State shared by the files of one preprocessing run.
+    struct PreprocessingContext
+    {
+      const std::vector<std::filesystem::path>& IncludeDirectories;
+      const ShaderPreprocessor::FileReader&     ReadFile;
+      PreprocessedShaderSource&                 Result;
+    };
+
+    auto
+    TrimStart(std::string_view text) -> std::string_view
+    {
+      size_t start = text.find_first_not_of(" \t");
+      return start == std::string_view::npos ? std::string_view()
+                                             : text.substr(start);
+    }
+
+    /// @brief Returns the arguments of a preprocessor directive if the line
+    /// contains it, e.g. "#  include "a.glsl"" for the "include" directive.
+    auto
+    MatchDirective(std::string_view line, std::string_view directive)
+      -> std::optional<std::string_view>
+    {
+      line = TrimStart(line);
+      if (!line.starts_with('#'))
+      {
+        return std::nullopt;
+      }
+
+      line = TrimStart(line.substr(1));
+      if (!line.starts_with(directive))
+      {
+        return std::nullopt;
+      }
+
+      std::string_view arguments = line.substr(directive.size());
+      if (!arguments.empty() && arguments.front() != ' ' &&
+          arguments.front() != '\t')
+      {
+        return std::nullopt;
+      }
+
+      return TrimStart(arguments);
+    }
+
+    /// @brief Splits the arguments of a directive at whitespace.
+    auto
+    SplitArguments(std::string_view arguments) -> std::vector<std::string>
+    {
+      std::vector<std::string> tokens;
+      while (!(arguments = TrimStart(arguments)).empty())
+      {
+        size_t end = arguments.find_first_of(" \t");
+        tokens.emplace_back(arguments.substr(0, end));
+        arguments = end == std::string_view::npos ? std::string_view()
+                                                  : arguments.substr(end);
+      }
+      return tokens;
+    }
+
+    /// @brief Extracts the file name of an include directive in quotes or
+    /// angle brackets.
+    auto
+    ParseIncludeName(std::string_view arguments) -> std::optional<std::string>
+    {
+      if (arguments.size() < 2)
+      {
+        return std::nullopt;
+      }
+
+      char   closing = arguments.front() == '<' ? '>' : '"';
+      size_t end = arguments.find(closing, 1);
+      if ((arguments.front() != '"' && arguments.front() != '<') ||
+          end == std::string_view::npos || end == 1)
+      {
+        return std::nullopt;
+      }
+
+      return std::string(arguments.substr(1, end - 1));
+    }
+
+    auto
+    IsValidKeyword(std::string_view keyword) -> bool
+    {
+      auto isIdentifierCharacter = [](char character)
+      {
+        return std::isalnum(static_cast<unsigned char>(character)) != 0 ||
+               character == '_';
+      };
+
+      return !keyword.empty() &&
+             std::isdigit(static_cast<unsigned char>(keyword.front())) == 0 &&
+             std::ranges::all_of(keyword, isIdentifierCharacter);
+    }
+
+    void
+    ProcessFile(std::string_view             source,
+                const std::filesystem::path& sourcePath,
+                int                          sourceIndex,
+                PreprocessingContext&        context,
+                std::string&                 output,
+                std::optional<size_t>*       versionEnd)
+    {
+      int lineNumber = 0;
+      while (!source.empty())
+      {
+        size_t           end = source.find('\n');
+        std::string_view line = source.substr(0, end);
+        source = end == std::string_view::npos ? std::string_view()
+                                               : source.substr(end + 1);
+        lineNumber++;
+        if (line.ends_with('\r'))
+        {
+          line.remove_suffix(1);
+        }
+
+        if (auto arguments = MatchDirective(line, "include"))
+        {
+          std::optional<std::string> name = ParseIncludeName(*arguments);
+          if (!name.has_value())
+          {
+            context.Result.Errors.push_back(
+              fmt::format("{}:{}: Malformed include directive",
+                          sourcePath.string(),
+                          lineNumber));
+            output += '\n';
+            continue;
+          }
+
+          // Relative to the including file first, then the include
+          // directories
+          std::vector<std::filesystem::path> candidates;
+          if (!sourcePath.empty())
+          {
+            candidates.push_back(sourcePath.parent_path() / *name);
+          }
+          for (const auto& directory : context.IncludeDirectories)
+          {
+            candidates.push_back(directory / *name);
+          }
+
+          std::optional<std::string>           content;
+          std::optional<std::filesystem::path> includePath;
+          for (const auto& candidate : candidates)
+          {
+            std::filesystem::path normalized = candidate.lexically_normal();
+            if (std::ranges::find(context.Result.IncludedFiles, normalized) !=
+                context.Result.IncludedFiles.end())
+            {
+              // Already included, every file is only included once
+              includePath = normalized;
+              break;
+            }
+            if ((content = context.ReadFile(normalized)).has_value())
+            {
+              includePath = normalized;
+              break;
+            }
+          }
+
+          if (!includePath.has_value())
+          {
+            context.Result.Errors.push_back(
+              fmt::format("{}:{}: Could not resolve include \"{}\"",
+                          sourcePath.string(),
+                          lineNumber,
+                          *name));
+            output += '\n';
+            continue;
+          }
+
+          if (!content.has_value())
+          {
+            output += '\n';
+            continue;
+          }
+
+          context.Result.IncludedFiles.push_back(*includePath);
+          int includeIndex =
+            static_cast<int>(context.Result.IncludedFiles.size());
+          output += fmt::format("#line 1 {}\n", includeIndex);
+          ProcessFile(
+            *content, *includePath, includeIndex, context, output, nullptr);
+          output += fmt::format("#line {} {}\n", lineNumber + 1, sourceIndex);
+          continue;
+        }
+
+        if (auto arguments = MatchDirective(line, "pragma"))
+        {
+          std::vector<std::string> tokens = SplitArguments(*arguments);
+          if (!tokens.empty() && tokens.front() == "keywords")
+          {
+            for (size_t i = 1; i < tokens.size(); i++)
+            {
+              if (IsValidKeyword(tokens[i]) &&
+                  std::ranges::find(context.Result.DeclaredKeywords,
+                                    tokens[i]) ==
+                    context.Result.DeclaredKeywords.end())
+              {
+                context.Result.DeclaredKeywords.push_back(tokens[i]);
+              }
+            }
+            output += '\n';
+            continue;
+          }
+        }
+
+        output += line;
+        output += '\n';
+
+        if (versionEnd != nullptr && !versionEnd->has_value() &&
+            MatchDirective(line, "version").has_value())
+        {
+          *versionEnd = output.size();
+        }
+      }
+    }
+  }
+
+  ShaderPreprocessor::ShaderPreprocessor(
+    std::shared_ptr<IFileHandler> fileHandler,
+    GraphicsApi                   graphicsApi)
+    : mFileHandler(std::move(fileHandler))
+  {
+    switch (graphicsApi)
+    {
+      case GraphicsApi::OpenGL:
+        mIncludeDirectories.push_back(OpenGLUtilities::GetShaderIncludePath());
+        break;
+      case GraphicsApi::Vulkan:
+      case GraphicsApi::D3D12:
+      default: break;
+    }
+  }
+
+  auto
+  ShaderPreprocessor::Preprocess(std::string_view                source,
+                                 const std::filesystem::path&    sourcePath,
+                                 const std::vector<std::string>& keywords) const
+    -> PreprocessedShaderSource
+  {
+    return Preprocess(source,
+                      sourcePath,
+                      keywords,
+                      mIncludeDirectories,
+                      [this](const std::filesystem::path& path)
+                        -> std::optional<std::string>
+                      {
+                        if (!mFileHandler->FileExists(path))
+                        {
+                          return std::nullopt;
+                        }
+                        return mFileHandler->ReadFile(path);
+                      });
+  }
+
+  auto
+  ShaderPreprocessor::Preprocess(
+    std::string_view                          source,
+    const std::filesystem::path&              sourcePath,
+    const std::vector<std::string>&           keywords,
+    const std::vector<std::filesystem::path>& includeDirectories,
+    const FileReader& readFile) -> PreprocessedShaderSource
+  {
+    PreprocessedShaderSource result;
+    PreprocessingContext     context{ includeDirectories, readFile, result };
+    std::optional<size_t>    versionEnd;
+
+    std::string body;
+    body.reserve(source.size());
+    ProcessFile(source, sourcePath, 0, context, body, &versionEnd);
+
+    // Only declared keywords are defined, the declarations may follow the
+    // #version directive so the defines are inserted afterwards
+    std::string defines;
+    for (const std::string& keyword : keywords)
+    {
+      if (std::ranges::find(result.DeclaredKeywords, keyword) !=
+          result.DeclaredKeywords.end())
+      {
+        defines += fmt::format("#define {}\n", keyword);
+      }
+    }
+
+    if (defines.empty())
+    {
+      result.Source = std::move(body);
+      return result;
+    }
+
+    size_t insertAt = versionEnd.value_or(0);
+    int    nextLine =
+      static_cast<int>(std::count(body.begin(), body.begin() + insertAt, '\n'));
+    result.Source = body.substr(0, insertAt);
+    result.Source += defines;
+    result.Source += fmt::format("#line {} 0\n", nextLine + 1);
+    result.Source += body.substr(insertAt);
+    return result;
+  }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Core/Base.hpp"
+#include "IShaderPreprocessor.hpp"
+#include "Utilities/FileHandler/IFileHandler.hpp"
+#include <boost/di.hpp>
+#include <functional>
+#include <optional>
+
+namespace Dwarf
+{
+  class ShaderPreprocessor : public IShaderPreprocessor
+  {
+  public:
+    /// @brief Reads an include file, returns no value if it doesn't exist.
+    using FileReader = std::function<std::optional<std::string>(
+      const std::filesystem::path&)>;
+
+  private:
+    std::shared_ptr<IFileHandler>      mFileHandler;
+    std::vector<std::filesystem::path> mIncludeDirectories;
+
+  public:
+    BOOST_DI_INJECT(ShaderPreprocessor,
+                    std::shared_ptr<IFileHandler> fileHandler,
+                    GraphicsApi                   graphicsApi);
+
+    ~ShaderPreprocessor() override = default;
+
+    /**
+     * @brief Preprocesses the source of a shader stage, includes are read
+     * with the file handler
+     *
+     * @param source Source of the stage
+     * @param sourcePath Path of the stage
+     * @param keywords Keywords to enable
+     * @return The preprocessed source and its dependencies
+     */
+    [[nodiscard]] auto
+    Preprocess(std::string_view                source,
+               const std::filesystem::path&    sourcePath,
+               const std::vector<std::string>& keywords) const
+      -> PreprocessedShaderSource override;
+
+    /**
+     * @brief Preprocesses the source of a shader stage. Every file is only
+     * included once, #line directives keep the line numbers of compiler
+     * messages intact. The source string number of an include is its index in
+     * IncludedFiles plus one.
+     *
+     * @param source Source of the stage
+     * @param sourcePath Path of the stage
+     * @param keywords Keywords to enable
+     * @param includeDirectories Directories searched for includes that can't
+     * be found relative to the including file
+     * @param readFile Function used to read the include files
+     * @return The preprocessed source and its dependencies
+     */
+    static auto
+    Preprocess(std::string_view                          source,
+               const std::filesystem::path&              sourcePath,
+               const std::vector<std::string>&           keywords,
+               const std::vector<std::filesystem::path>& includeDirectories,
+               const FileReader& readFile) -> PreprocessedShaderSource;
+  };
+}
@@ -11,14 +11,36 @@ namespace Dwarf
     mShadersToRecompile.push_back(shader);
   }
 
+  void
+  ShaderRecompiler::TrackCompilation(std::shared_ptr<IShader> shader)
+  {
+    std::unique_lock<std::mutex> lock(mRecompilationMutex);
+    mPendingCompilations.push_back(shader);
+  }
+
   void
   ShaderRecompiler::Recompile()
   {
     std::unique_lock<std::mutex> lock(mRecompilationMutex);
+
+    // Polled before submitting so new compilations get at least one frame in
+    // the driver before they are polled
+    std::erase_if(mPendingCompilations,
+                  [](const std::shared_ptr<IShader>& shader)
+                  { return shader->PollCompilation(); });
+
     for (const auto& shader : mShadersToRecompile)
     {
-      shader->Compile();
+      shader->SubmitCompilation();
+      mPendingCompilations.push_back(shader);
     }
     mShadersToRecompile.clear();
   }
-}
\ No newline at end of file
+
+  auto
+  ShaderRecompiler::GetPendingCompilationCount() const -> size_t
+  {
+    std::unique_lock<std::mutex> lock(mRecompilationMutex);
+    return mShadersToRecompile.size() + mPendingCompilations.size();
+  }
+}
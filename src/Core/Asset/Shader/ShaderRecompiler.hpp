@@ -14,11 +14,18 @@ namespace Dwarf
     void
     MarkForRecompilation(std::shared_ptr<IShader> shader) override;
 
+    void
+    TrackCompilation(std::shared_ptr<IShader> shader) override;
+
     void
     Recompile() override;
 
+    [[nodiscard]] auto
+    GetPendingCompilationCount() const -> size_t override;
+
   private:
     std::vector<std::shared_ptr<IShader>> mShadersToRecompile;
-    std::mutex                            mRecompilationMutex;
+    std::vector<std::shared_ptr<IShader>> mPendingCompilations;
+    mutable std::mutex                    mRecompilationMutex;
   };
-}
\ No newline at end of file
+}
@@ -17,5 +17,21 @@ namespace Dwarf
      */
     virtual auto
     GetShaderSources() -> std::vector<std::unique_ptr<IAssetReference>>& = 0;
+
+    /**
+     * @brief Retrieves the keywords selecting the variant of the shader
+     *
+     * @return Reference to the sorted list of enabled keywords
+     */
+    [[nodiscard]] virtual auto
+    GetKeywords() const -> const std::vector<std::string>& = 0;
+
+    /**
+     * @brief Sets the keywords selecting the variant of the shader
+     *
+     * @param keywords Keywords to enable
+     */
+    virtual void
+    SetKeywords(std::vector<std::string> keywords) = 0;
   };
 }
\ No newline at end of file
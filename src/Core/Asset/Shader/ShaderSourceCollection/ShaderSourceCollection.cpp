@@ -16,4 +16,20 @@ namespace Dwarf
   {
     return mShaderSources;
   }
+
+  auto
+  ShaderSourceCollection::GetKeywords() const -> const std::vector<std::string>&
+  {
+    return mKeywords;
+  }
+
+  void
+  ShaderSourceCollection::SetKeywords(std::vector<std::string> keywords)
+  {
+    // Sorted so the same keywords always select the same variant
+    std::ranges::sort(keywords);
+    auto duplicates = std::ranges::unique(keywords);
+    keywords.erase(duplicates.begin(), duplicates.end());
+    mKeywords = std::move(keywords);
+  }
 } // namespace Dwarf
\ No newline at end of file
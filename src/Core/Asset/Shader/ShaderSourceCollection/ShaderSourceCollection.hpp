@@ -9,6 +9,7 @@ namespace Dwarf
   {
   private:
     std::vector<std::unique_ptr<IAssetReference>> mShaderSources;
+    std::vector<std::string>                      mKeywords;
 
   public:
     ShaderSourceCollection(
@@ -25,5 +26,21 @@ namespace Dwarf
     auto
     GetShaderSources()
       -> std::vector<std::unique_ptr<IAssetReference>>& override;
+
+    /**
+     * @brief Retrieves the keywords selecting the variant of the shader
+     *
+     * @return Reference to the sorted list of enabled keywords
+     */
+    [[nodiscard]] auto
+    GetKeywords() const -> const std::vector<std::string>& override;
+
+    /**
+     * @brief Sets the keywords selecting the variant of the shader
+     *
+     * @param keywords Keywords to enable
+     */
+    void
+    SetKeywords(std::vector<std::string> keywords) override;
   };
 }
\ No newline at end of file
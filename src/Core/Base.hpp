@@ -53,9 +53,11 @@ namespace Dwarf
     { "2D Texture", ShaderParameterType::TEX2D }
   };
 
-  inline const std::array<std::string, 8> reservedParameterNames = {
-    "_Time",    "modelMatrix", "viewMatrix", "projectionMatrix",
-    "fogStart", "fogEnd",      "fogColor",   "viewPosition"
+  inline const std::array<std::string, 11> reservedParameterNames = {
+    "_Time",            "modelMatrix",    "viewMatrix",
+    "projectionMatrix", "fogStart",       "fogEnd",
+    "fogColor",         "viewPosition",   "_VertexCompression",
+    "_PositionScale",   "_PositionOffset"
   };
 
 #ifdef _WIN32
@@ -16,7 +16,8 @@ namespace Dwarf
     std::shared_ptr<IMeshFactory>        meshFactory,
     std::shared_ptr<IMeshBufferFactory>  meshBufferFactory,
     std::shared_ptr<IFramebufferFactory> framebufferFactory,
-    std::shared_ptr<IRendererApiFactory> rendererApiFactory)
+    std::shared_ptr<IRendererApiFactory> rendererApiFactory,
+    std::shared_ptr<IOpenGLStateTracker> stateTracker)
     : mLogger(std::move(logger))
     , mApi(graphicsApi)
     , mTextureFactory(std::move(textureFactory))
@@ -26,6 +27,7 @@ namespace Dwarf
     , mMeshBufferFactory(std::move(meshBufferFactory))
     , mFramebufferFactory(std::move(framebufferFactory))
     , mRendererApiFactory(std::move(rendererApiFactory))
+    , mStateTracker(std::move(stateTracker))
   {
   }
 
@@ -51,7 +53,8 @@ namespace Dwarf
           mMeshFactory,
           mMeshBufferFactory,
           mFramebufferFactory,
-          mRendererApiFactory);
+          mRendererApiFactory,
+          mStateTracker);
       case Vulkan:
         mLogger->LogError(Log("Vulkan API has not been implemented yet",
                               "CubemapGeneratorFactory"));
@@ -11,6 +11,7 @@
 #include "Core/Rendering/Texture/ITextureFactory.hpp"
 #include "ICubemapGeneratorFactory.hpp"
 #include "Logging/IDwarfLogger.hpp"
+#include "Platform/OpenGL/IOpenGLStateTracker.hpp"
 
 namespace Dwarf
 {
@@ -27,6 +28,7 @@ namespace Dwarf
     std::shared_ptr<IMeshBufferFactory>  mMeshBufferFactory;
     std::shared_ptr<IFramebufferFactory> mFramebufferFactory;
     std::shared_ptr<IRendererApiFactory> mRendererApiFactory;
+    std::shared_ptr<IOpenGLStateTracker> mStateTracker;
 
   public:
     CubemapGeneratorFactory(
@@ -39,7 +41,8 @@ namespace Dwarf
       std::shared_ptr<IMeshFactory>        meshFactory,
       std::shared_ptr<IMeshBufferFactory>  meshBufferFactory,
       std::shared_ptr<IFramebufferFactory> framebufferFactory,
-      std::shared_ptr<IRendererApiFactory> rendererApiFactory);
+      std::shared_ptr<IRendererApiFactory> rendererApiFactory,
+      std::shared_ptr<IOpenGLStateTracker> stateTracker);
     ~CubemapGeneratorFactory() override = default;
 
     [[nodiscard]] auto
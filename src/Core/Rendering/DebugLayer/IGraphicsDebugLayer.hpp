@@ -0,0 +1,73 @@
+#pragma once
+
+#include <string_view>
+
+namespace Dwarf
+{
+  /**
+   * @brief Class that reports errors of the graphics API through its debug
+   * output and annotates the submitted work with debug groups. Can be toggled
+   * at runtime, a disabled layer does not issue any API calls.
+   *
+   */
+  class IGraphicsDebugLayer
+  {
+  public:
+    virtual ~IGraphicsDebugLayer() = default;
+
+    /**
+     * @brief Enables or disables the debug output and the debug groups
+     *
+     * @param enabled True to enable the debug layer
+     */
+    virtual void
+    SetEnabled(bool enabled) = 0;
+
+    /**
+     * @brief Returns whether the debug layer is enabled
+     *
+     * @return True if the debug output and the debug groups are enabled
+     */
+    [[nodiscard]] virtual auto
+    IsEnabled() const -> bool = 0;
+
+    /**
+     * @brief Opens a debug group that annotates all following work until it
+     * is closed with PopGroup
+     *
+     * @param name Name of the group
+     */
+    virtual void
+    PushGroup(std::string_view name) = 0;
+
+    /**
+     * @brief Closes the last opened debug group
+     *
+     */
+    virtual void
+    PopGroup() = 0;
+  };
+
+  /// @brief Opens a debug group for the lifetime of the object.
+  class ScopedDebugGroup
+  {
+  private:
+    IGraphicsDebugLayer& mDebugLayer;
+
+  public:
+    ScopedDebugGroup(IGraphicsDebugLayer& debugLayer, std::string_view name)
+      : mDebugLayer(debugLayer)
+    {
+      mDebugLayer.PushGroup(name);
+    }
+
+    ~ScopedDebugGroup()
+    {
+      mDebugLayer.PopGroup();
+    }
+
+    ScopedDebugGroup(const ScopedDebugGroup&) = delete;
+    auto
+    operator=(const ScopedDebugGroup&) -> ScopedDebugGroup& = delete;
+  };
+}
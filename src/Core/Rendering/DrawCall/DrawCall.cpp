@@ -6,10 +6,14 @@ namespace Dwarf
 {
   DrawCall::DrawCall(std::unique_ptr<IMeshBuffer>&& meshBuffer,
                      MaterialAsset&                 material,
-                     TransformComponent&            transform)
+                     TransformComponent&            transform,
+                     LodSelection                   lodSelection,
+                     std::vector<Meshlet>           meshlets)
     : mMeshBuffer(std::move(meshBuffer))
     , mMaterial(material)
     , mTransform(transform)
+    , mLodSelection(std::move(lodSelection))
+    , mMeshlets(std::move(meshlets))
   {
   }
 
@@ -36,4 +40,16 @@ namespace Dwarf
   {
     return mTransform;
   }
+
+  auto
+  DrawCall::GetLodSelection() -> LodSelection&
+  {
+    return mLodSelection;
+  }
+
+  auto
+  DrawCall::GetMeshlets() -> const std::vector<Meshlet>&
+  {
+    return mMeshlets;
+  }
 }
\ No newline at end of file
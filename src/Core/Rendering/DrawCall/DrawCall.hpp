@@ -11,11 +11,15 @@ namespace Dwarf
     std::shared_ptr<IMeshBuffer> mMeshBuffer = nullptr;
     MaterialAsset&               mMaterial;
     TransformComponent&          mTransform;
+    LodSelection                 mLodSelection;
+    std::vector<Meshlet>         mMeshlets;
 
   public:
     DrawCall(std::unique_ptr<IMeshBuffer>&& meshBuffer,
              MaterialAsset&                 material,
-             TransformComponent&            transform);
+             TransformComponent&            transform,
+             LodSelection                   lodSelection,
+             std::vector<Meshlet>           meshlets);
 
     ~DrawCall() override = default;
 
@@ -45,5 +49,21 @@ namespace Dwarf
      */
     auto
     GetTransform() -> TransformComponent& override;
+
+    /**
+     * @brief Retrieves the detail level selection state of the draw call
+     *
+     * @return Reference to the detail level selection
+     */
+    auto
+    GetLodSelection() -> LodSelection& override;
+
+    /**
+     * @brief Retrieves the meshlets of the full detail level of the draw call
+     *
+     * @return Reference to the meshlets, empty if cluster culling is not used
+     */
+    auto
+    GetMeshlets() -> const std::vector<Meshlet>& override;
   };
 }
\ No newline at end of file
@@ -27,8 +27,12 @@ namespace Dwarf
                           TransformComponent&     transform)
     -> std::shared_ptr<IDrawCall>
   {
-    std::shared_ptr<DrawCall> drawCall =
-      std::make_shared<DrawCall>(nullptr, material, transform);
+    std::shared_ptr<DrawCall> drawCall = std::make_shared<DrawCall>(
+      nullptr,
+      material,
+      transform,
+      LodSelector::CreateSelection(mesh->GetVertices(), mesh->GetLods()),
+      mesh->GetMeshlets());
 
     mMeshBufferRequestList->RequestMeshBuffer(
       std::make_unique<MeshBufferRequest>(
@@ -9,66 +9,75 @@ namespace Dwarf
   {
   }
 
-  DrawCallList::~DrawCallList()
-  {
-    std::lock_guard<std::mutex> lock(mDrawCallMutex);
-    mDrawCalls.clear();
-  }
+  DrawCallList::~DrawCallList() = default;
 
   void
   DrawCallList::SubmitDrawCalls(
-    std::vector<std::shared_ptr<IDrawCall>> drawCalls)
+    std::vector<std::shared_ptr<IDrawCall>> drawCalls,
+    DrawCallStatistics                      stats)
   {
-    std::lock_guard<std::mutex> lock(mDrawCallMutex);
-    mDrawCalls = std::move(drawCalls);
-    mAllDrawCallsLoaded.store(false);
+    Slot& slot = mSlots[mWriteSlot];
+
+    // A list that was published but never acquired is released by the render
+    // thread along with the new list
+    std::vector<std::shared_ptr<IDrawCall>>& previous = slot.Snapshot.DrawCalls;
+    slot.Retired.insert(slot.Retired.end(),
+                        std::make_move_iterator(previous.begin()),
+                        std::make_move_iterator(previous.end()));
 
-    mStats.DrawCallCount.store(mDrawCalls.size());
+    stats.DrawCallCount = static_cast<uint32_t>(drawCalls.size());
+    slot.Snapshot.DrawCalls = std::move(drawCalls);
+    slot.Snapshot.Stats = stats;
+    slot.Snapshot.Version = ++mVersion;
+
+    mWriteSlot =
+      mReadySlot.exchange(mWriteSlot | PUBLISHED, std::memory_order_acq_rel) &
+      SLOT_MASK;
   }
 
   auto
-  DrawCallList::GetDrawCalls() -> std::vector<std::shared_ptr<IDrawCall>>&
+  DrawCallList::AcquireDrawCalls() -> const DrawCallListSnapshot&
   {
-    return mDrawCalls;
+    if ((mReadySlot.load(std::memory_order_relaxed) & PUBLISHED) != 0)
+    {
+      // The slot handed back to the worker has to be empty
+      Release(mSlots[mReadSlot]);
+      mReadSlot =
+        mReadySlot.exchange(mReadSlot, std::memory_order_acq_rel) & SLOT_MASK;
+      mSlots[mReadSlot].Retired.clear();
+    }
+    return mSlots[mReadSlot].Snapshot;
   }
 
   auto
-  DrawCallList::GetMutex() -> std::mutex&
+  DrawCallList::HasPendingDrawCalls() const -> bool
   {
-    return mDrawCallMutex;
+    return (mReadySlot.load(std::memory_order_relaxed) & PUBLISHED) != 0;
   }
 
   void
   DrawCallList::Clear()
   {
     mLogger->LogDebug(Log("Clearing Draw Calls", "DrawCallList"));
-    std::lock_guard<std::mutex> lock(mDrawCallMutex);
-    mDrawCalls.clear();
+
+    // A list published before the clear is dropped as well
+    AcquireDrawCalls();
+    Slot& slot = mSlots[mReadSlot];
+    Release(slot);
+    slot.Snapshot.Version = ++mVersion;
   }
 
   auto
-  DrawCallList::GetStats() -> const DrawCallStatistics&
+  DrawCallList::GetStats() const -> const DrawCallStatistics&
   {
-    if (!mAllDrawCallsLoaded.load())
-    {
-      std::lock_guard<std::mutex> lock(mDrawCallMutex);
-      uint32_t                    verts = 0;
-      uint32_t                    indices = 0;
-      uint32_t                    loaded = 0;
-      for (const auto& drawCall : mDrawCalls)
-      {
-        if (drawCall->GetMeshBuffer() != nullptr)
-        {
-          verts += drawCall->GetMeshBuffer()->GetVertexCount();
-          indices += drawCall->GetMeshBuffer()->GetIndexCount();
-          loaded++;
-        }
-      }
+    return mSlots[mReadSlot].Snapshot.Stats;
+  }
 
-      mStats.VertexCount.store(verts);
-      mStats.TriangleCount.store(indices / 3);
-      mAllDrawCallsLoaded = mDrawCalls.size() == loaded;
-    }
-    return mStats;
+  void
+  DrawCallList::Release(Slot& slot)
+  {
+    slot.Snapshot.DrawCalls.clear();
+    slot.Snapshot.Stats = {};
+    slot.Retired.clear();
   }
 }
\ No newline at end of file
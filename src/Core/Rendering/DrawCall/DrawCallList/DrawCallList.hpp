@@ -3,56 +3,98 @@
 #include "Core/Rendering/DrawCall/IDrawCall.hpp"
 #include "IDrawCallList.hpp"
 #include "Logging/IDwarfLogger.hpp"
+#include <array>
+#include <atomic>
 #include <memory>
-#include <mutex>
 
 namespace Dwarf
 {
+  /**
+   * @brief Triple buffered draw call list. The worker fills its own slot and
+   * publishes it by swapping the slot index with the ready slot, the render
+   * thread swaps its slot with the ready slot when a new list was published
+   *
+   * The draw calls own GPU buffers, so they are only released on the render
+   * thread. Lists that are replaced before the render thread acquired them
+   * are handed over with the next published list. The draw call worker does
+   * not publish while a list is pending, so at most one list is handed over.
+   *
+   */
   class DrawCallList : public IDrawCallList
   {
   private:
-    std::shared_ptr<IDwarfLogger>           mLogger;
-    std::mutex                              mDrawCallMutex;
-    std::vector<std::shared_ptr<IDrawCall>> mDrawCalls;
-    DrawCallStatistics                      mStats;
-    std::atomic<bool>                       mAllDrawCallsLoaded = false;
+    /// @brief Bits of the ready slot value holding the slot index.
+    static constexpr uint8_t SLOT_MASK = 0x3;
+
+    /// @brief Set in the ready slot value while it holds a list that has not
+    /// been acquired yet.
+    static constexpr uint8_t PUBLISHED = 0x4;
+
+    struct Slot
+    {
+      DrawCallListSnapshot Snapshot;
+
+      /// @brief Draw calls of lists that were replaced without being
+      /// acquired, released by the render thread.
+      std::vector<std::shared_ptr<IDrawCall>> Retired;
+    };
+
+    std::shared_ptr<IDwarfLogger> mLogger;
+    std::array<Slot, 3>           mSlots;
+
+    /// @brief Slot filled by the worker, only used by the worker thread.
+    uint8_t mWriteSlot = 0;
+
+    /// @brief Slot handed between the threads, with the published flag.
+    std::atomic<uint8_t> mReadySlot = 1;
+
+    /// @brief Slot being rendered, only used by the render thread.
+    uint8_t mReadSlot = 2;
+
+    std::atomic<uint64_t> mVersion = 0;
+
+    /**
+     * @brief Releases the draw calls of a slot owned by the render thread
+     *
+     */
+    static void
+    Release(Slot& slot);
 
   public:
     DrawCallList(std::shared_ptr<IDwarfLogger> logger);
     ~DrawCallList() override;
 
     /**
-     * @brief Store a new list of draw calls
+     * @brief Publishes a new list of draw calls. Called from the draw call
+     * worker thread
      *
      * @param drawCalls Vector containing a list of draw calls
+     * @param stats Vertex and triangle counts of the draw calls
      */
     void
-    SubmitDrawCalls(std::vector<std::shared_ptr<IDrawCall>> drawCalls) override;
+    SubmitDrawCalls(std::vector<std::shared_ptr<IDrawCall>> drawCalls,
+                    DrawCallStatistics                      stats) override;
 
     /**
-     * @brief Retrieves the list of the draw calls
+     * @brief Picks up the most recently published list of draw calls. Called
+     * from the render thread
      *
-     * @return Reference to the vector of the draw calls
+     * @return The published list of draw calls
      */
     auto
-    GetDrawCalls() -> std::vector<std::shared_ptr<IDrawCall>>& override;
+    AcquireDrawCalls() -> const DrawCallListSnapshot& override;
 
-    /**
-     * @brief Retrieves the mutex used for accessing the draw calls
-     *
-     * @return std::mutex&
-     */
-    auto
-    GetMutex() -> std::mutex& override;
+    [[nodiscard]] auto
+    HasPendingDrawCalls() const -> bool override;
 
     /**
-     * @brief Clears the draw call list
+     * @brief Clears the draw call list. Called from the render thread
      *
      */
     void
     Clear() override;
 
-    auto
-    GetStats() -> const DrawCallStatistics& override;
+    [[nodiscard]] auto
+    GetStats() const -> const DrawCallStatistics& override;
   };
 }
\ No newline at end of file
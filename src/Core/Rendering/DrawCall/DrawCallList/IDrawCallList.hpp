@@ -1,20 +1,36 @@
 #pragma once
 
 #include "Core/Rendering/DrawCall/IDrawCall.hpp"
-#include <mutex>
 
 namespace Dwarf
 {
   struct DrawCallStatistics
   {
-    std::atomic<uint32_t> DrawCallCount = 0;
-    std::atomic<uint32_t> TriangleCount = 0;
-    std::atomic<uint32_t> VertexCount = 0;
+    uint32_t DrawCallCount = 0;
+    uint32_t TriangleCount = 0;
+    uint32_t VertexCount = 0;
   };
 
   /**
-   * @brief A class that contains a list of draw calls and allows for thread
-   * safe access
+   * @brief A published list of draw calls. The list is not modified anymore
+   * once it has been published
+   *
+   */
+  struct DrawCallListSnapshot
+  {
+    std::vector<std::shared_ptr<IDrawCall>> DrawCalls;
+
+    /// @brief Statistics computed when the list was published.
+    DrawCallStatistics Stats;
+
+    /// @brief Changes whenever the draw calls are replaced or cleared, so
+    /// renderers can detect stale cached data.
+    uint64_t Version = 0;
+  };
+
+  /**
+   * @brief A class that hands lists of draw calls from the draw call worker to
+   * the render thread. Neither side waits for the other
    *
    */
   class IDrawCallList
@@ -23,37 +39,48 @@ namespace Dwarf
     virtual ~IDrawCallList() = default;
 
     /**
-     * @brief Store a new list of draw calls
+     * @brief Publishes a new list of draw calls. Called from the draw call
+     * worker thread
      *
      * @param drawCalls Vector containing a list of draw calls
+     * @param stats Vertex and triangle counts of the draw calls
      */
     virtual void
-    SubmitDrawCalls(std::vector<std::shared_ptr<IDrawCall>> drawCalls) = 0;
+    SubmitDrawCalls(std::vector<std::shared_ptr<IDrawCall>> drawCalls,
+                    DrawCallStatistics                      stats) = 0;
 
     /**
-     * @brief Retrieves the list of the draw calls
+     * @brief Picks up the most recently published list of draw calls. Called
+     * from the render thread, the list stays valid until the next call to
+     * AcquireDrawCalls or Clear
      *
-     * @return Reference to the vector of the draw calls
+     * @return The published list of draw calls
      */
     virtual auto
-    GetDrawCalls() -> std::vector<std::shared_ptr<IDrawCall>>& = 0;
+    AcquireDrawCalls() -> const DrawCallListSnapshot& = 0;
 
     /**
-     * @brief Retrieves the mutex used for accessing the draw calls
+     * @brief Checks if the last published list has not been acquired yet.
+     * Called from the draw call worker thread, which waits with the next list
+     * so replaced lists don't pile up while nothing is rendered
      *
-     * @return std::mutex&
      */
-    virtual auto
-    GetMutex() -> std::mutex& = 0;
+    [[nodiscard]] virtual auto
+    HasPendingDrawCalls() const -> bool = 0;
 
     /**
-     * @brief Clears the draw call list
+     * @brief Clears the draw call list. Called from the render thread
      *
      */
     virtual void
     Clear() = 0;
 
+    /**
+     * @brief Retrieves the statistics of the last acquired list. Called from
+     * the render thread
+     *
+     */
     [[nodiscard]] virtual auto
-    GetStats() -> const DrawCallStatistics& = 0;
+    GetStats() const -> const DrawCallStatistics& = 0;
   };
 }
\ No newline at end of file
@@ -2,7 +2,6 @@
 #include "Core/Scene/Components/SceneComponents.hpp"
 #include "pch.hpp"
 
-#include "Core/Scene/Components/MeshRendererComponentHandle.hpp"
 #include "DrawCallWorker.hpp"
 
 namespace Dwarf
@@ -73,19 +72,28 @@ namespace Dwarf
         mCondition.wait(
           lock, [this] { return mInvalidate.load() || mStopWorker.load(); });
 
+        // A list the render thread has not picked up yet is not replaced, the
+        // replaced lists could only be released by the render thread
+        while (!mStopWorker.load() && mDrawCallList->HasPendingDrawCalls())
+        {
+          mCondition.wait_for(lock, PENDING_LIST_POLL_INTERVAL);
+        }
+
         mLogger->LogDebug(Log("Woken up", "DrawCallWorker"));
         if (mStopWorker.load())
         {
           mLogger->LogDebug(Log("Stop flag set", "DrawCallWorker"));
         }
+
+        // Cleared before generating, so invalidations arriving meanwhile
+        // trigger another pass
+        mInvalidate.store(false);
       }
 
       if (!mStopWorker.load())
       {
         // Generating the draw calls
         GenerateDrawCalls();
-
-        mInvalidate.store(false);
       }
     }
   }
@@ -107,53 +115,43 @@ namespace Dwarf
 
     IScene& scene = mLoadedScene->GetScene();
 
+    // The main thread replaces the proxies of edited mesh renderers and
+    // refreshes all of them after asset changes, both under this lock. The
+    // draw calls keep references to the proxy materials until they are
+    // submitted
+    std::lock_guard<std::mutex> proxyLock(
+      scene.GetRenderProxies().GetMutex());
+
     // ===== Gathering the scene geometry that should be rendered =====
-    // Go through all entities with MeshRendererComponents
-    // If they are not hidden and have a model asset assigned, loop through the
-    // meshes If the material index of the mesh is connected to a material,
-    // grabe the material From the entities TransformComponent, the Mesh, and
-    // the Material, create a temporary draw call Depending on if the material
-    // is transparent or not, put it in the corresponding vector. That is
-    // because we are rendering transparent geometry after the opague geometry
+    // The render proxies hold the meshes of the visible mesh renderers with
+    // their resolved materials. From the entities TransformComponent, the
+    // Mesh, and the Material, create a temporary draw call. Depending on if
+    // the material is transparent or not, put it in the corresponding vector.
+    // That is because we are rendering transparent geometry after the opague
+    // geometry
 
     for (auto view = scene.GetRegistry()
-                       .view<TransformComponent, MeshRendererComponent>();
-         auto [entityHandle, transform, component] : view.each())
+                       .view<TransformComponent, RenderProxyComponent>();
+         auto [entityHandle, transform, proxy] : view.each())
     {
-      MeshRendererComponentHandle meshRenderer(scene.GetRegistry(),
-                                               entityHandle);
-      if (meshRenderer.GetModelAsset() &&
-          meshRenderer.GetModelAsset()->IsValid() &&
-          !meshRenderer.GetIsHidden())
+      if (!proxy.IsVisible())
       {
-        auto& model =
-          dynamic_cast<ModelAsset&>(meshRenderer.GetModelAsset()->GetAsset());
+        continue;
+      }
 
-        for (const auto& mesh : model.Meshes())
+      for (const RenderProxyMesh& proxyMesh : proxy.Meshes)
+      {
+        if (proxyMesh.Material->GetMaterial()
+              .GetMaterialProperties()
+              .IsTransparent)
         {
-          if (meshRenderer.GetMaterialAssets().contains(
-                mesh->GetMaterialIndex()) &&
-              meshRenderer.GetMaterialAssets().at(mesh->GetMaterialIndex()) &&
-              meshRenderer.GetMaterialAssets()
-                .at(mesh->GetMaterialIndex())
-                ->IsValid())
-          {
-            MaterialAsset& materialAsset =
-              dynamic_cast<MaterialAsset&>(meshRenderer.GetMaterialAssets()
-                                             .at(mesh->GetMaterialIndex())
-                                             ->GetAsset());
-
-            if (materialAsset.GetMaterial()
-                  .GetMaterialProperties()
-                  .IsTransparent)
-            {
-              transparentTemps.emplace_back(mesh, materialAsset, transform);
-            }
-            else
-            {
-              batchedTemps.emplace_back(mesh, materialAsset, transform);
-            }
-          }
+          transparentTemps.emplace_back(
+            proxyMesh.Mesh, *proxyMesh.Material, transform);
+        }
+        else
+        {
+          batchedTemps.emplace_back(
+            proxyMesh.Mesh, *proxyMesh.Material, transform);
         }
       }
     }
@@ -182,6 +180,8 @@ namespace Dwarf
     // Batch per Material and upload geometry
     for (auto& currentTempDrawCall : batchedTemps)
     {
+      size_t meshVertexCount = currentTempDrawCall.Mesh->GetVertices().size();
+
       // No current batch, creating new and adding the current draw call
       if (!currentBatch)
       {
@@ -191,15 +191,24 @@ namespace Dwarf
 
         // Add the geometry of the current temporary draw call
         currentBatch->Meshes.emplace_back(currentTempDrawCall.Mesh->Clone());
+        currentBatch->VertexCount = meshVertexCount;
       }
       else
       {
+        // Merging past the 16 bit index range would double the index memory
+        // of the whole batch
+        bool exceedsUInt16Indices =
+          currentBatch->VertexCount <= MAX_UINT16_INDEX_VERTICES &&
+          currentBatch->VertexCount + meshVertexCount >
+            MAX_UINT16_INDEX_VERTICES;
+
         // If there is a current batch and we encounter a different material or
         // a different entity
         if ((std::addressof(currentBatch->Material) !=
              std::addressof(currentTempDrawCall.Material.get())) ||
             (std::addressof(currentBatch->Transform) !=
-             std::addressof(currentTempDrawCall.Transform)))
+             std::addressof(currentTempDrawCall.Transform)) ||
+            exceedsUInt16Indices)
         {
           // Push the current batch
           batches.push_back(std::move(currentBatch));
@@ -210,11 +219,13 @@ namespace Dwarf
 
           // Add the geometry of the current temporary draw call
           currentBatch->Meshes.emplace_back(currentTempDrawCall.Mesh->Clone());
+          currentBatch->VertexCount = meshVertexCount;
         }
         // We can still add to the current batch
         else
         {
           currentBatch->Meshes.push_back(currentTempDrawCall.Mesh->Clone());
+          currentBatch->VertexCount += meshVertexCount;
         }
       }
     }
@@ -226,10 +237,13 @@ namespace Dwarf
     }
 
     // Generate draw calls from batches
+    DrawCallStatistics stats;
     for (auto& batch : batches)
     {
       std::shared_ptr<IMesh> mergedMesh =
         mMeshFactory->MergeMeshes(batch->Meshes);
+      stats.VertexCount += mergedMesh->GetVertices().size();
+      stats.TriangleCount += mergedMesh->GetIndices().size() / 3;
 
       drawCalls.push_back(mDrawCallFactory->Create(
         mergedMesh, batch->Material, batch->Transform));
@@ -239,11 +253,14 @@ namespace Dwarf
     for (auto& transparentCall : transparentTemps)
     {
       std::shared_ptr<IMesh> mesh = transparentCall.Mesh->Clone();
+      stats.VertexCount += mesh->GetVertices().size();
+      stats.TriangleCount += mesh->GetIndices().size() / 3;
+
       drawCalls.push_back(mDrawCallFactory->Create(
         mesh, transparentCall.Material, transparentCall.Transform));
     }
 
-    mDrawCallList->SubmitDrawCalls(std::move(drawCalls));
+    mDrawCallList->SubmitDrawCalls(std::move(drawCalls), stats);
   }
 
   void
@@ -251,35 +268,37 @@ namespace Dwarf
   {
     this->Invalidate();
 
+    mLoadedScene->GetScene().RegisterSceneObserver(this);
     mLoadedScene->GetScene()
       .GetRegistry()
-      .on_construct<MeshRendererComponent>()
-      .connect<&DrawCallWorker::OnMeshRendererComponentChange>(this);
+      .on_construct<RenderProxyComponent>()
+      .connect<&DrawCallWorker::OnRenderProxyChange>(this);
     mLoadedScene->GetScene()
       .GetRegistry()
-      .on_update<MeshRendererComponent>()
-      .connect<&DrawCallWorker::OnMeshRendererComponentChange>(this);
+      .on_update<RenderProxyComponent>()
+      .connect<&DrawCallWorker::OnRenderProxyChange>(this);
     mLoadedScene->GetScene()
       .GetRegistry()
-      .on_destroy<MeshRendererComponent>()
-      .connect<&DrawCallWorker::OnMeshRendererComponentChange>(this);
+      .on_destroy<RenderProxyComponent>()
+      .connect<&DrawCallWorker::OnRenderProxyChange>(this);
   }
 
   void
   DrawCallWorker::OnSceneUnload()
   {
+    mLoadedScene->GetScene().UnregisterSceneObserver(this);
     mLoadedScene->GetScene()
       .GetRegistry()
-      .on_construct<MeshRendererComponent>()
-      .disconnect<&DrawCallWorker::OnMeshRendererComponentChange>(this);
+      .on_construct<RenderProxyComponent>()
+      .disconnect<&DrawCallWorker::OnRenderProxyChange>(this);
     mLoadedScene->GetScene()
       .GetRegistry()
-      .on_update<MeshRendererComponent>()
-      .disconnect<&DrawCallWorker::OnMeshRendererComponentChange>(this);
+      .on_update<RenderProxyComponent>()
+      .disconnect<&DrawCallWorker::OnRenderProxyChange>(this);
     mLoadedScene->GetScene()
       .GetRegistry()
-      .on_destroy<MeshRendererComponent>()
-      .disconnect<&DrawCallWorker::OnMeshRendererComponentChange>(this);
+      .on_destroy<RenderProxyComponent>()
+      .disconnect<&DrawCallWorker::OnRenderProxyChange>(this);
 
     mDrawCallList->Clear();
   }
@@ -288,6 +307,7 @@ namespace Dwarf
   void
   DrawCallWorker::OnReimportAll()
   {
+    RefreshRenderProxies();
     mMeshBufferRequestList->ClearRequests();
     std::unique_lock<std::mutex> meshBufferRequestLock(
       mMeshBufferRequestList->GetMutex());
@@ -303,6 +323,7 @@ namespace Dwarf
   {
     if (assetType != ASSET_TYPE::SCENE && assetType != ASSET_TYPE::UNKNOWN)
     {
+      RefreshRenderProxies();
       mMeshBufferRequestList->ClearRequests();
       std::unique_lock<std::mutex> meshBufferRequestLock(
         mMeshBufferRequestList->GetMutex());
@@ -323,6 +344,7 @@ namespace Dwarf
   void
   DrawCallWorker::OnAssetDatabaseClear()
   {
+    RefreshRenderProxies();
     mDrawCallList->Clear();
     this->Invalidate();
   }
@@ -331,6 +353,7 @@ namespace Dwarf
   void
   DrawCallWorker::OnRemoveAsset(const std::filesystem::path& path)
   {
+    RefreshRenderProxies();
     mDrawCallList->Clear();
     this->Invalidate();
   }
@@ -344,14 +367,48 @@ namespace Dwarf
 
   // This should be called from the main thread
   void
-  DrawCallWorker::OnMeshRendererComponentChange(entt::registry& registry,
-                                                entt::entity    entity)
+  DrawCallWorker::RefreshRenderProxies()
+  {
+    // The proxies point into the assets that were just changed. The refresh
+    // waits for the worker to finish reading them
+    if (mLoadedScene->HasLoadedScene())
+    {
+      mLoadedScene->GetScene().GetRenderProxies().RefreshAll();
+    }
+  }
+
+  void
+  DrawCallWorker::OnEntityCreated()
+  {
+  }
+
+  void
+  DrawCallWorker::OnEntityDeleted()
+  {
+  }
+
+  // This should be called from the main thread
+  void
+  DrawCallWorker::OnEntitiesCreated()
+  {
+    // The render proxies of the batch were skipped one by one
+    mDrawCallList->Clear();
+    this->Invalidate();
+  }
+
+  // This should be called from the main thread
+  void
+  DrawCallWorker::OnRenderProxyChange(entt::registry& registry,
+                                      entt::entity    entity)
   {
     mLogger->LogDebug(Log("Updating Draw Calls", "DrawCallWorker"));
 
     // We do not want to react to component changes while a scene is being
-    // loaded
-    if (mLoadedScene->HasLoadedScene())
+    // loaded, to every single component of a batch of created entities, or to
+    // every proxy of a refresh
+    if (mLoadedScene->HasLoadedScene() &&
+        !mLoadedScene->GetScene().IsCreatingEntities() &&
+        !mLoadedScene->GetScene().GetRenderProxies().IsRefreshing())
     {
       mDrawCallList->Clear();
       this->Invalidate();
@@ -6,9 +6,11 @@
 #include "Core/Rendering/DrawCall/IDrawCallFactory.hpp"
 #include "Core/Rendering/Mesh/IMeshFactory.hpp"
 #include "Core/Rendering/MeshBuffer/MeshBufferRequestList/IMeshBufferRequestList.hpp"
+#include "Core/Scene/ISceneObserver.hpp"
 #include "Editor/LoadedScene/ILoadedScene.hpp"
 #include "IDrawCallWorker.hpp"
 #include "Logging/IDwarfLogger.hpp"
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <mutex>
@@ -60,6 +62,7 @@ namespace Dwarf
     std::vector<std::shared_ptr<IMesh>> Meshes;
     MaterialAsset&                      Material;
     TransformComponent&                 Transform;
+    size_t                              VertexCount = 0;
 
     Batch(MaterialAsset& material, TransformComponent& transform)
       : Material(material)
@@ -72,8 +75,13 @@ namespace Dwarf
     : public IDrawCallWorker
     , public ILoadedSceneObserver
     , public IAssetDatabaseObserver
+    , public ISceneObserver
   {
   private:
+    /// @brief Interval in which the worker checks if the render thread
+    /// acquired the pending list.
+    static constexpr std::chrono::milliseconds PENDING_LIST_POLL_INTERVAL{ 5 };
+
     std::thread                             mWorkerThread;
     std::shared_ptr<IDwarfLogger>           mLogger;
     std::shared_ptr<ILoadedScene>           mLoadedScene;
@@ -87,6 +95,14 @@ namespace Dwarf
     std::atomic<bool>                       mInvalidate = false;
     std::mutex                              mThreadMutex;
 
+    /**
+     * @brief Resolves the render proxies of the loaded scene again after the
+     * assets changed
+     *
+     */
+    void
+    RefreshRenderProxies();
+
   public:
     DrawCallWorker(
       std::shared_ptr<IDwarfLogger>           logger,
@@ -150,7 +166,15 @@ namespace Dwarf
              const std::filesystem::path& newPath) override;
 
     void
-    OnMeshRendererComponentChange(entt::registry& registry,
-                                  entt::entity    entity);
+    OnEntityCreated() override;
+
+    void
+    OnEntityDeleted() override;
+
+    void
+    OnEntitiesCreated() override;
+
+    void
+    OnRenderProxyChange(entt::registry& registry, entt::entity entity);
   };
 }
\ No newline at end of file
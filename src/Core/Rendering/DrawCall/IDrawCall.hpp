@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Core/Asset/Database/AssetComponents.hpp"
+#include "Core/Rendering/Mesh/LodSelector/LodSelector.hpp"
+#include "Core/Rendering/Mesh/Meshlet.hpp"
 #include "Core/Rendering/MeshBuffer/IMeshBuffer.hpp"
 #include "Core/Scene/Components/TransformComponentHandle.hpp"
 #include <glm/fwd.hpp>
@@ -42,5 +44,21 @@ namespace Dwarf
      */
     virtual auto
     GetTransform() -> TransformComponent& = 0;
+
+    /**
+     * @brief Retrieves the detail level selection state of the draw call
+     *
+     * @return Reference to the detail level selection
+     */
+    virtual auto
+    GetLodSelection() -> LodSelection& = 0;
+
+    /**
+     * @brief Retrieves the meshlets of the full detail level of the draw call
+     *
+     * @return Reference to the meshlets, empty if cluster culling is not used
+     */
+    virtual auto
+    GetMeshlets() -> const std::vector<Meshlet>& = 0;
   };
 }
\ No newline at end of file
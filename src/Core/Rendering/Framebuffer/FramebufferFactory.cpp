@@ -7,14 +7,16 @@
 namespace Dwarf
 {
   FramebufferFactory::FramebufferFactory(
-    GraphicsApi                      api,
-    std::shared_ptr<IDwarfLogger>    logger,
-    std::shared_ptr<ITextureFactory> textureFactory,
-    std::shared_ptr<IVramTracker>    vramTracker)
+    GraphicsApi                          api,
+    std::shared_ptr<IDwarfLogger>        logger,
+    std::shared_ptr<ITextureFactory>     textureFactory,
+    std::shared_ptr<IVramTracker>        vramTracker,
+    std::shared_ptr<IOpenGLStateTracker> stateTracker)
     : mApi(api)
     , mLogger(std::move(logger))
     , mTextureFactory(std::move(textureFactory))
     , mVramTracker(std::move(vramTracker))
+    , mStateTracker(std::move(stateTracker))
   {
     mLogger->LogDebug(Log("FramebufferFactory created", "FramebufferFactory"));
   }
@@ -33,7 +35,7 @@ namespace Dwarf
         throw std::runtime_error("Graphics API is not set");
       case OpenGL:
         return std::make_unique<OpenGLFramebuffer>(
-          mLogger, spec, mTextureFactory, mVramTracker);
+          mLogger, spec, mTextureFactory, mVramTracker, mStateTracker);
       case Vulkan:
         mLogger->LogError(
           Log("Vulkan API has not been implemented yet", "FramebufferFactory"));
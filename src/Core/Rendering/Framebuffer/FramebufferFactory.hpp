@@ -5,22 +5,25 @@
 #include "Core/Rendering/VramTracker/IVramTracker.hpp"
 #include "IFramebufferFactory.hpp"
 #include "Logging/IDwarfLogger.hpp"
+#include "Platform/OpenGL/IOpenGLStateTracker.hpp"
 
 namespace Dwarf
 {
   class FramebufferFactory : public IFramebufferFactory
   {
   private:
-    std::shared_ptr<IDwarfLogger>    mLogger;
-    GraphicsApi                      mApi;
-    std::shared_ptr<ITextureFactory> mTextureFactory;
-    std::shared_ptr<IVramTracker>    mVramTracker;
+    std::shared_ptr<IDwarfLogger>        mLogger;
+    GraphicsApi                          mApi;
+    std::shared_ptr<ITextureFactory>     mTextureFactory;
+    std::shared_ptr<IVramTracker>        mVramTracker;
+    std::shared_ptr<IOpenGLStateTracker> mStateTracker;
 
   public:
-    FramebufferFactory(GraphicsApi                      api,
-                       std::shared_ptr<IDwarfLogger>    logger,
-                       std::shared_ptr<ITextureFactory> textureFactory,
-                       std::shared_ptr<IVramTracker>    vramTracker);
+    FramebufferFactory(GraphicsApi                          api,
+                       std::shared_ptr<IDwarfLogger>        logger,
+                       std::shared_ptr<ITextureFactory>     textureFactory,
+                       std::shared_ptr<IVramTracker>        vramTracker,
+                       std::shared_ptr<IOpenGLStateTracker> stateTracker);
     ~FramebufferFactory() override = default;
 
     /**
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Core/Rendering/IndirectDraw/IndirectDrawTypes.hpp"
+#include "Core/Rendering/MeshBuffer/IMeshBuffer.hpp"
+#include "Core/Scene/Camera/ICamera.hpp"
+#include <optional>
+#include <span>
+
+namespace Dwarf
+{
+  /**
+   * @brief Graphics API side of the indirect draw path. Holds the shared
+   * vertex and index arenas the meshes are copied into and submits the
+   * batches built by the IndirectDrawBuilder.
+   *
+   */
+  class IIndirectDrawBackend
+  {
+  public:
+    virtual ~IIndirectDrawBackend() = default;
+
+    /**
+     * @brief Removes all meshes from the arenas
+     *
+     */
+    virtual void
+    ClearMeshes() = 0;
+
+    /**
+     * @brief Copies a mesh into the arena matching its vertex format and
+     * index type
+     *
+     * @param meshBuffer The mesh to add
+     * @return Placement of the mesh, empty if it can't be drawn indirectly
+     */
+    virtual auto
+    AddMesh(const IMeshBuffer& meshBuffer)
+      -> std::optional<IndirectMeshPlacement> = 0;
+
+    /**
+     * @brief Uploads the per draw data and the commands of a frame
+     *
+     * @param drawData Per draw data, indexed by the base instance
+     * @param commands Draw commands of all batches
+     */
+    virtual void
+    Upload(std::span<const IndirectDrawData>    drawData,
+           std::span<const IndirectDrawCommand> commands) = 0;
+
+    /**
+     * @brief Updates the material parameter buffer of a shader. Only the
+     * materials that changed since the last upload are transferred.
+     *
+     * @param shader Shader variant the materials are drawn with
+     * @param materials Materials, indexed by the material index of the draws
+     */
+    virtual void
+    UploadMaterials(IShader& shader, std::span<IMaterial* const> materials) = 0;
+
+    /**
+     * @brief Draws the commands of a batch with a single multi draw call
+     *
+     * @param batch The batch to draw
+     * @param camera The camera to render with
+     */
+    virtual void
+    Draw(const IndirectDrawBatch& batch, ICamera& camera) = 0;
+  };
+}
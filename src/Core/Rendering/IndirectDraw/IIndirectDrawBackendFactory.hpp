@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Core/Rendering/IndirectDraw/IIndirectDrawBackend.hpp"
+#include "Core/Rendering/RendererApi/IRendererApi.hpp"
+
+namespace Dwarf
+{
+  /**
+   * @brief A class that creates indirect draw backend instances
+   *
+   */
+  class IIndirectDrawBackendFactory
+  {
+  public:
+    virtual ~IIndirectDrawBackendFactory() = default;
+
+    /**
+     * @brief Creates an indirect draw backend
+     *
+     * @param rendererApi Renderer api the backend binds the materials with
+     * @return Unique pointer to the created backend
+     */
+    [[nodiscard]] virtual auto
+    Create(std::shared_ptr<IRendererApi> rendererApi) const
+      -> std::unique_ptr<IIndirectDrawBackend> = 0;
+  };
+}
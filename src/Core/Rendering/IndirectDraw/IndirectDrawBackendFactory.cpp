@@ -0,0 +1,64 @@
+#include "pch.hpp"
+
+#include "IndirectDrawBackendFactory.hpp"
+#include "Platform/OpenGL/OpenGLIndirectDrawBackend.hpp"
+
+namespace Dwarf
+{
+  IndirectDrawBackendFactory::IndirectDrawBackendFactory(
+    GraphicsApi                          graphicsApi,
+    std::shared_ptr<IDwarfLogger>        logger,
+    std::shared_ptr<IVramTracker>        vramTracker,
+    std::shared_ptr<IOpenGLStateTracker> stateTracker)
+    : mGraphicsApi(graphicsApi)
+    , mLogger(std::move(logger))
+    , mVramTracker(std::move(vramTracker))
+    , mStateTracker(std::move(stateTracker))
+  {
+    mLogger->LogDebug(Log("IndirectDrawBackendFactory created",
+                          "IndirectDrawBackendFactory"));
+  }
+
+  IndirectDrawBackendFactory::~IndirectDrawBackendFactory()
+  {
+    mLogger->LogDebug(Log("IndirectDrawBackendFactory destroyed",
+                          "IndirectDrawBackendFactory"));
+  }
+
+  auto
+  IndirectDrawBackendFactory::Create(
+    std::shared_ptr<IRendererApi> rendererApi) const
+    -> std::unique_ptr<IIndirectDrawBackend>
+  {
+    switch (mGraphicsApi)
+    {
+      using enum GraphicsApi;
+      case None:
+        mLogger->LogError(
+          Log("Graphics API is not set", "IndirectDrawBackendFactory"));
+        throw std::runtime_error("Graphics API is not set");
+      case Vulkan:
+        mLogger->LogError(Log("Vulkan API has not been implemented yet",
+                              "IndirectDrawBackendFactory"));
+        throw std::runtime_error("Vulkan API has not been implemented yet");
+      case OpenGL:
+        return std::make_unique<OpenGLIndirectDrawBackend>(
+          std::move(rendererApi), mLogger, mVramTracker, mStateTracker);
+      case D3D12:
+#ifdef _WIN32
+        mLogger->LogError(Log("Direct3D12 API has not been implemented yet",
+                              "IndirectDrawBackendFactory"));
+        throw std::runtime_error("Direct3D12 API has not been implemented yet");
+#elif __linux__
+        mLogger->LogError(Log("Direct3D12 is only supported on Windows",
+                              "IndirectDrawBackendFactory"));
+        throw std::runtime_error("Direct3D12 is only supported on Windows");
+#endif
+    }
+
+    mLogger->LogError(Log("Failed to create indirect draw backend",
+                          "IndirectDrawBackendFactory"));
+
+    return nullptr;
+  }
+}
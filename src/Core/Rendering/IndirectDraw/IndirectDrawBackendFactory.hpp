@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Core/Base.hpp"
+#include "Core/Rendering/IndirectDraw/IIndirectDrawBackendFactory.hpp"
+#include "Core/Rendering/VramTracker/IVramTracker.hpp"
+#include "Logging/IDwarfLogger.hpp"
+#include "Platform/OpenGL/IOpenGLStateTracker.hpp"
+
+namespace Dwarf
+{
+  class IndirectDrawBackendFactory : public IIndirectDrawBackendFactory
+  {
+  private:
+    GraphicsApi                          mGraphicsApi;
+    std::shared_ptr<IDwarfLogger>        mLogger;
+    std::shared_ptr<IVramTracker>        mVramTracker;
+    std::shared_ptr<IOpenGLStateTracker> mStateTracker;
+
+  public:
+    IndirectDrawBackendFactory(
+      GraphicsApi                          graphicsApi,
+      std::shared_ptr<IDwarfLogger>        logger,
+      std::shared_ptr<IVramTracker>        vramTracker,
+      std::shared_ptr<IOpenGLStateTracker> stateTracker);
+    ~IndirectDrawBackendFactory() override;
+
+    /**
+     * @brief Creates an indirect draw backend
+     *
+     * @param rendererApi Renderer api the backend binds the materials with
+     * @return Unique pointer to the created backend
+     */
+    [[nodiscard]] auto
+    Create(std::shared_ptr<IRendererApi> rendererApi) const
+      -> std::unique_ptr<IIndirectDrawBackend> override;
+  };
+}
@@ -0,0 +1,156 @@
+#include "pch.hpp"
+
+#include "IndirectDrawBuilder.hpp"
+#include <numeric>
+#include <unordered_map>
+
+namespace Dwarf
+{
+  void
+  IndirectDrawBuilder::Clear()
+  {
+    mItems.clear();
+    mOrder.clear();
+    mCommands.clear();
+    mDrawData.clear();
+    mBatches.clear();
+    mMaterialSets.clear();
+  }
+
+  void
+  IndirectDrawBuilder::Add(const IndirectDrawItem& item)
+  {
+    mItems.push_back(item);
+  }
+
+  void
+  IndirectDrawBuilder::Build()
+  {
+    mOrder.resize(mItems.size());
+    std::iota(mOrder.begin(), mOrder.end(), 0);
+
+    // Stable, so draws of the same batch keep their submission order
+    std::ranges::stable_sort(
+      mOrder,
+      [this](uint32_t left, uint32_t right)
+      {
+        const IndirectDrawItem& a = mItems[left];
+        const IndirectDrawItem& b = mItems[right];
+        if (a.Placement.Arena != b.Placement.Arena)
+        {
+          return a.Placement.Arena < b.Placement.Arena;
+        }
+        if (a.Shader != b.Shader)
+        {
+          return std::less<IShader*>()(a.Shader, b.Shader);
+        }
+        return std::less<IMaterial*>()(a.Material, b.Material);
+      });
+
+    mCommands.clear();
+    mDrawData.clear();
+    mBatches.clear();
+    mMaterialSets.clear();
+    mCommands.reserve(mItems.size());
+    mDrawData.reserve(mItems.size());
+
+    // Material indices are per shader, every shader has its own buffer
+    std::unordered_map<IShader*, size_t> materialSets;
+    std::unordered_map<IShader*, std::unordered_map<IMaterial*, uint32_t>>
+      materialIndices;
+    for (uint32_t index : mOrder)
+    {
+      const IndirectDrawItem& item = mItems[index];
+      auto drawIndex = static_cast<uint32_t>(mCommands.size());
+
+      mCommands.push_back({ item.Range.Count,
+                            1,
+                            item.Placement.FirstIndex + item.Range.Offset,
+                            item.Placement.BaseVertex,
+                            drawIndex });
+
+      IndirectDrawData& data = mDrawData.emplace_back();
+      data.ModelMatrix = item.ModelMatrix;
+      data.PositionScale = glm::vec4(item.Quantization.Scale, 0.0F);
+      data.PositionOffset = glm::vec4(item.Quantization.Offset, 0.0F);
+      auto [set, newSet] =
+        materialSets.try_emplace(item.Shader, mMaterialSets.size());
+      if (newSet)
+      {
+        mMaterialSets.push_back({ item.Shader, {} });
+      }
+      std::vector<IMaterial*>& materials = mMaterialSets[set->second].Materials;
+      auto [material, newMaterial] = materialIndices[item.Shader].try_emplace(
+        item.Material, static_cast<uint32_t>(materials.size()));
+      if (newMaterial)
+      {
+        materials.push_back(item.Material);
+      }
+      data.MaterialIndex = material->second;
+      data.VertexCompression = item.VertexCompression ? 1 : 0;
+
+      if (mBatches.empty() || mBatches.back().Arena != item.Placement.Arena ||
+          mBatches.back().Shader != item.Shader ||
+          mBatches.back().Material != item.Material)
+      {
+        mBatches.push_back(
+          { item.Placement.Arena, item.Material, item.Shader, drawIndex, 0 });
+      }
+      mBatches.back().CommandCount++;
+    }
+  }
+
+  void
+  IndirectDrawBuilder::Submit(IIndirectDrawBackend& backend,
+                              ICamera&              camera) const
+  {
+    if (mCommands.empty())
+    {
+      return;
+    }
+
+    backend.Upload(mDrawData, mCommands);
+    for (const IndirectMaterialSet& set : mMaterialSets)
+    {
+      backend.UploadMaterials(*set.Shader, set.Materials);
+    }
+    for (const IndirectDrawBatch& batch : mBatches)
+    {
+      backend.Draw(batch, camera);
+    }
+  }
+
+  auto
+  IndirectDrawBuilder::GetDrawCount() const -> uint32_t
+  {
+    return static_cast<uint32_t>(mItems.size());
+  }
+
+  auto
+  IndirectDrawBuilder::GetCommands() const
+    -> const std::vector<IndirectDrawCommand>&
+  {
+    return mCommands;
+  }
+
+  auto
+  IndirectDrawBuilder::GetDrawData() const
+    -> const std::vector<IndirectDrawData>&
+  {
+    return mDrawData;
+  }
+
+  auto
+  IndirectDrawBuilder::GetBatches() const
+    -> const std::vector<IndirectDrawBatch>&
+  {
+    return mBatches;
+  }
+
+  auto
+  IndirectDrawBuilder::GetMaterialSets() const
+    -> const std::vector<IndirectMaterialSet>&
+  {
+    return mMaterialSets;
+  }
+}
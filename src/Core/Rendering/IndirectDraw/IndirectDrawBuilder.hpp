@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Core/Rendering/IndirectDraw/IIndirectDrawBackend.hpp"
+#include "Core/Rendering/IndirectDraw/IndirectDrawTypes.hpp"
+
+namespace Dwarf
+{
+  /// @brief Builds the indirect draw commands, per draw data and batches of
+  /// a frame on the CPU. Draws sharing an arena, shader and material end up
+  /// in the same batch and are submitted with a single multi draw call. The
+  /// materials of every shader are numbered, so the draws reference their
+  /// parameters in the material buffer of the shader by index.
+  class IndirectDrawBuilder
+  {
+  private:
+    std::vector<IndirectDrawItem>    mItems;
+    std::vector<uint32_t>            mOrder;
+    std::vector<IndirectDrawCommand> mCommands;
+    std::vector<IndirectDrawData>    mDrawData;
+    std::vector<IndirectDrawBatch>   mBatches;
+    std::vector<IndirectMaterialSet> mMaterialSets;
+
+  public:
+    /**
+     * @brief Removes the draws and the built commands
+     *
+     */
+    void
+    Clear();
+
+    /**
+     * @brief Adds a draw to the current frame
+     *
+     * @param item The draw to add
+     */
+    void
+    Add(const IndirectDrawItem& item);
+
+    /**
+     * @brief Sorts the draws by arena, shader and material and builds the
+     * commands, per draw data and batches
+     *
+     */
+    void
+    Build();
+
+    /**
+     * @brief Uploads the built commands and materials and draws all batches
+     *
+     * @param backend The backend to submit to
+     * @param camera The camera to render with
+     */
+    void
+    Submit(IIndirectDrawBackend& backend, ICamera& camera) const;
+
+    /**
+     * @brief Returns the number of added draws
+     *
+     * @return Draw count
+     */
+    [[nodiscard]] auto
+    GetDrawCount() const -> uint32_t;
+
+    /**
+     * @brief Returns the commands of the last build
+     *
+     * @return The draw commands, in submission order
+     */
+    [[nodiscard]] auto
+    GetCommands() const -> const std::vector<IndirectDrawCommand>&;
+
+    /**
+     * @brief Returns the per draw data of the last build
+     *
+     * @return The per draw data, indexed by the base instance of a command
+     */
+    [[nodiscard]] auto
+    GetDrawData() const -> const std::vector<IndirectDrawData>&;
+
+    /**
+     * @brief Returns the batches of the last build
+     *
+     * @return The batches, in submission order
+     */
+    [[nodiscard]] auto
+    GetBatches() const -> const std::vector<IndirectDrawBatch>&;
+
+    /**
+     * @brief Returns the materials of every shader of the last build
+     *
+     * @return The material sets, one per shader
+     */
+    [[nodiscard]] auto
+    GetMaterialSets() const -> const std::vector<IndirectMaterialSet>&;
+  };
+}
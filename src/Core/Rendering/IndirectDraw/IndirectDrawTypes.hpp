@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Core/Rendering/Mesh/IndexType.hpp"
+#include "Core/Rendering/Mesh/VertexLayout.hpp"
+
+namespace Dwarf
+{
+  class IMaterial;
+  class IShader;
+
+  /// @brief Shader keyword selecting the variant that reads the model matrix
+  /// and vertex quantization from the per draw data.
+  constexpr std::string_view INDIRECT_DRAW_KEYWORD = "DWARF_INDIRECT_DRAW";
+
+  /// @brief Layout of a single indexed indirect draw command, as consumed by
+  /// glMultiDrawElementsIndirect.
+  struct IndirectDrawCommand
+  {
+    /// @brief Number of indices to draw.
+    uint32_t Count = 0;
+
+    /// @brief Number of instances, always 1 for the opaque pass.
+    uint32_t InstanceCount = 1;
+
+    /// @brief First index inside the index arena.
+    uint32_t FirstIndex = 0;
+
+    /// @brief Offset added to every index to address the vertex arena.
+    int32_t BaseVertex = 0;
+
+    /// @brief Index of the per draw data of the command.
+    uint32_t BaseInstance = 0;
+  };
+
+  static_assert(sizeof(IndirectDrawCommand) == 20,
+                "IndirectDrawCommand has to match the GL command layout");
+
+  /// @brief Per draw data read by the shaders through the draw index, laid
+  /// out for a std430 storage buffer.
+  struct IndirectDrawData
+  {
+    glm::mat4 ModelMatrix = glm::mat4(1.0F);
+
+    /// @brief Scale of the vertex quantization, w is unused.
+    glm::vec4 PositionScale = glm::vec4(1.0F);
+
+    /// @brief Offset of the vertex quantization, w is unused.
+    glm::vec4 PositionOffset = glm::vec4(0.0F);
+
+    /// @brief Index of the material of the draw inside the material buffer
+    /// of its shader.
+    uint32_t MaterialIndex = 0;
+
+    /// @brief Whether the vertices use the compact format.
+    uint32_t VertexCompression = 0;
+
+    std::array<uint32_t, 2> Padding = { 0, 0 };
+  };
+
+  static_assert(sizeof(IndirectDrawData) == 112,
+                "IndirectDrawData has to match the std430 shader layout");
+
+  /// @brief Location of a mesh inside the shared buffers of a backend.
+  struct IndirectMeshPlacement
+  {
+    /// @brief Arena holding the vertices and indices of the mesh. Meshes can
+    /// only be drawn together if they share an arena.
+    uint32_t Arena = 0;
+
+    /// @brief Position of the first index of the mesh inside the arena.
+    uint32_t FirstIndex = 0;
+
+    /// @brief Position of the first vertex of the mesh inside the arena.
+    int32_t BaseVertex = 0;
+  };
+
+  /// @brief A draw to submit through the indirect path.
+  struct IndirectDrawItem
+  {
+    IndirectMeshPlacement Placement;
+
+    /// @brief Index range of the mesh to draw, relative to the mesh.
+    IndexRange Range;
+
+    IMaterial* Material = nullptr;
+
+    /// @brief Shader variant compiled for indirect drawing.
+    IShader* Shader = nullptr;
+
+    glm::mat4 ModelMatrix = glm::mat4(1.0F);
+
+    VertexQuantization Quantization;
+
+    bool VertexCompression = false;
+  };
+
+  /// @brief Consecutive commands drawn with a single multi draw call.
+  struct IndirectDrawBatch
+  {
+    uint32_t Arena = 0;
+
+    IMaterial* Material = nullptr;
+
+    IShader* Shader = nullptr;
+
+    /// @brief Index of the first command of the batch.
+    uint32_t FirstCommand = 0;
+
+    /// @brief Number of commands of the batch.
+    uint32_t CommandCount = 0;
+  };
+
+  /// @brief Materials drawn with a shader in the current frame. The position
+  /// of a material in the list is the material index of its draws.
+  struct IndirectMaterialSet
+  {
+    IShader* Shader = nullptr;
+
+    std::vector<IMaterial*> Materials;
+  };
+}
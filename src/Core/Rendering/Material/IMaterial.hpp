@@ -70,6 +70,23 @@ namespace Dwarf
     virtual void
     UpdateShader() = 0;
 
+    /**
+     * @brief Get the shader keywords selected by this material.
+     *
+     * @return Sorted list of the selected keywords.
+     */
+    [[nodiscard]] virtual auto
+    GetKeywords() const -> const std::vector<std::string>& = 0;
+
+    /**
+     * @brief Selects the shader keywords of this material. Switches to the
+     * shader variant with the keywords defined.
+     *
+     * @param keywords Keywords to select.
+     */
+    virtual void
+    SetKeywords(std::vector<std::string> keywords) = 0;
+
     /**
      * @brief Get the shader parameters for this material.
      *
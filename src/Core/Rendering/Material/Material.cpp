@@ -1,22 +1,48 @@
 #include "pch.hpp"
 
+#include "Core/Rendering/IndirectDraw/IndirectDrawTypes.hpp"
 #include "Material.hpp"
 
 namespace Dwarf
 {
+  namespace
+  {
+    /// @brief Sorts the keywords and removes duplicates and the keywords the
+    /// renderer selects itself, which a material must never store.
+    void
+    NormalizeKeywords(std::vector<std::string>& keywords)
+    {
+      std::erase(keywords, INDIRECT_DRAW_KEYWORD);
+      std::ranges::sort(keywords);
+      keywords.erase(std::ranges::unique(keywords).begin(), keywords.end());
+    }
+  }
+
   Material::Material(
     MaterialProperties                           materialProperties,
     std::unique_ptr<IShaderParameterCollection>  shaderParameters,
     std::unique_ptr<IShaderAssetSourceContainer> shaderAssetSourceContainer,
-    const std::shared_ptr<IShaderRegistry>&      shaderRegistry)
+    const std::shared_ptr<IShaderRegistry>&      shaderRegistry,
+    std::vector<std::string>                     keywords)
     : mMaterialProperties(std::move(materialProperties))
     , mShaderParameters(std::move(shaderParameters))
     , mShaderAssetSourceContainer(std::move(shaderAssetSourceContainer))
     , mShaderRegistry(shaderRegistry)
+    , mKeywords(std::move(keywords))
   {
+    NormalizeKeywords(mKeywords);
     UpdateShader();
   }
 
+  Material::~Material()
+  {
+    if (std::shared_ptr<IShaderRegistry> shaderRegistry =
+          mShaderRegistry.lock())
+    {
+      shaderRegistry->RemoveMaterial(*this);
+    }
+  }
+
   auto
   Material::GetShader() -> std::shared_ptr<IShader>
   {
@@ -33,8 +59,34 @@ namespace Dwarf
   void
   Material::UpdateShader()
   {
-    mShader = mShaderRegistry.lock()->GetOrCreate(
-      mShaderAssetSourceContainer->GetShaderSources());
+    std::unique_ptr<IShaderSourceCollection> shaderSources =
+      mShaderAssetSourceContainer->GetShaderSources();
+    if (shaderSources != nullptr)
+    {
+      shaderSources->SetKeywords(mKeywords);
+    }
+    std::shared_ptr<IShaderRegistry> shaderRegistry = mShaderRegistry.lock();
+    mShader = shaderRegistry->GetOrCreate(std::move(shaderSources));
+    shaderRegistry->AddMaterial(*this);
+  }
+
+  auto
+  Material::GetKeywords() const -> const std::vector<std::string>&
+  {
+    return mKeywords;
+  }
+
+  void
+  Material::SetKeywords(std::vector<std::string> keywords)
+  {
+    NormalizeKeywords(keywords);
+    if (keywords == mKeywords)
+    {
+      return;
+    }
+
+    mKeywords = std::move(keywords);
+    UpdateShader();
   }
 
   auto
@@ -63,6 +115,7 @@ namespace Dwarf
     serializedMaterial["Shader"] = mShaderAssetSourceContainer->Serialize();
     serializedMaterial["Properties"] = mMaterialProperties.Serialize();
     serializedMaterial["ShaderParameters"] = mShaderParameters->Serialize();
+    serializedMaterial["Keywords"] = mKeywords;
 
     return serializedMaterial;
   }
@@ -25,13 +25,17 @@ namespace Dwarf
 
     std::weak_ptr<IShaderRegistry> mShaderRegistry;
 
+    /// @brief Shader keywords selecting the variant of the shader.
+    std::vector<std::string> mKeywords;
+
   public:
     Material(
       MaterialProperties                           materialProperties,
       std::unique_ptr<IShaderParameterCollection>  shaderParameters,
       std::unique_ptr<IShaderAssetSourceContainer> shaderAssetSourceContainer,
-      const std::shared_ptr<IShaderRegistry>&      shaderRegistry);
-    ~Material() override = default;
+      const std::shared_ptr<IShaderRegistry>&      shaderRegistry,
+      std::vector<std::string>                     keywords = {});
+    ~Material() override;
 
     /**
      * @brief Get the shader for this material.
@@ -42,12 +46,29 @@ namespace Dwarf
     GetShader() -> std::shared_ptr<IShader> override;
 
     /**
-     * @brief Updates the
+     * @brief Updates the shader to the variant of the current sources and
+     * keywords and registers the material as user of it
      *
      */
     void
     UpdateShader() override;
 
+    /**
+     * @brief Gets the selected shader keywords
+     *
+     * @return Sorted list of the selected keywords
+     */
+    [[nodiscard]] auto
+    GetKeywords() const -> const std::vector<std::string>& override;
+
+    /**
+     * @brief Selects the shader keywords and switches to the matching variant
+     *
+     * @param keywords Keywords to select
+     */
+    void
+    SetKeywords(std::vector<std::string> keywords) override;
+
     /**
      * @brief Gets the ShaderParameterCollection
      *
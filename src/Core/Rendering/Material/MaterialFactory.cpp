@@ -5,6 +5,41 @@
 
 namespace Dwarf
 {
+  namespace
+  {
+    /// @brief Converts the boolean "hasXxxMap" parameters that toggled
+    /// features before shader keywords existed into "HAS_XXX_MAP" keywords.
+    auto
+    MigrateLegacyKeywords(const nlohmann::json& serializedParameters)
+      -> std::vector<std::string>
+    {
+      std::vector<std::string> keywords;
+      for (const auto& [name, parameter] : serializedParameters.items())
+      {
+        if (!name.starts_with("has") || name.size() <= 3 ||
+            !parameter.contains("type") || parameter["type"] != "boolean" ||
+            !parameter.contains("value") || !parameter["value"].is_boolean() ||
+            !parameter["value"].get<bool>())
+        {
+          continue;
+        }
+
+        std::string keyword = "HAS";
+        for (char character : name.substr(3))
+        {
+          auto unsignedCharacter = static_cast<unsigned char>(character);
+          if (std::isupper(unsignedCharacter) != 0)
+          {
+            keyword += '_';
+          }
+          keyword += static_cast<char>(std::toupper(unsignedCharacter));
+        }
+        keywords.push_back(keyword);
+      }
+      return keywords;
+    }
+  }
+
   MaterialFactory::MaterialFactory(
     std::shared_ptr<IDwarfLogger> logger,
     std::shared_ptr<IShaderParameterCollectionFactory>
@@ -71,6 +106,9 @@ namespace Dwarf
               serializedMaterial["Shader"])
           : mShaderSourceCollectionFactory
               ->CreateDefaultShaderSourceCollection()),
-      mShaderRegistry);
+      mShaderRegistry,
+      serializedMaterial.contains("Keywords")
+        ? serializedMaterial["Keywords"].get<std::vector<std::string>>()
+        : MigrateLegacyKeywords(serializedMaterial["ShaderParameters"]));
   }
 }
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include "pch.hpp"
+
+#include "ClusterCuller.hpp"
+
+namespace Dwarf
+{
+  namespace
+  {
+    /// @brief Relative difference of the axis scales up to which a model
+    /// matrix is treated as uniformly scaled.
+    constexpr float UNIFORM_SCALE_TOLERANCE = 0.01F;
+  }
+
+  auto
+  ClusterCuller::CreateFrustum(const glm::mat4& viewProjection,
+                               glm::vec3        cameraPosition)
+    -> CullingFrustum
+  {
+    CullingFrustum frustum;
+    frustum.CameraPosition = cameraPosition;
+
+    // Gribb/Hartmann plane extraction from the rows of the matrix
+    std::array<glm::vec4, 4> rows;
+    for (int row = 0; row < 4; row++)
+    {
+      rows[row] = glm::vec4(viewProjection[0][row],
+                            viewProjection[1][row],
+                            viewProjection[2][row],
+                            viewProjection[3][row]);
+    }
+
+    frustum.Planes = { rows[3] + rows[0], rows[3] - rows[0],
+                       rows[3] + rows[1], rows[3] - rows[1],
+                       rows[3] + rows[2], rows[3] - rows[2] };
+
+    for (glm::vec4& plane : frustum.Planes)
+    {
+      float length = glm::length(glm::vec3(plane));
+      if (length > 0.0F)
+      {
+        plane = plane / length;
+      }
+    }
+
+    return frustum;
+  }
+
+  auto
+  ClusterCuller::Cull(const std::vector<Meshlet>& meshlets,
+                      const glm::mat4&            modelMatrix,
+                      const CullingFrustum&       frustum,
+                      std::vector<IndexRange>&    visibleRanges,
+                      bool backfaceCulling) -> ClusterCullingStatistics
+  {
+    ClusterCullingStatistics stats;
+    visibleRanges.clear();
+
+    glm::vec3 axisScale(glm::length(glm::vec3(modelMatrix[0])),
+                        glm::length(glm::vec3(modelMatrix[1])),
+                        glm::length(glm::vec3(modelMatrix[2])));
+    float     maxScale = std::max({ axisScale.x, axisScale.y, axisScale.z });
+    float     minScale = std::min({ axisScale.x, axisScale.y, axisScale.z });
+
+    // Normal cones can only be transformed reliably without shearing
+    bool coneCulling =
+      backfaceCulling && minScale > 0.0F &&
+      (maxScale - minScale) <= maxScale * UNIFORM_SCALE_TOLERANCE;
+
+    for (const Meshlet& meshlet : meshlets)
+    {
+      glm::vec3 center =
+        glm::vec3(modelMatrix * glm::vec4(meshlet.Center, 1.0F));
+      float radius = meshlet.Radius * maxScale;
+
+      bool outside = false;
+      for (const glm::vec4& plane : frustum.Planes)
+      {
+        if (glm::dot(glm::vec3(plane), center) + plane.w < -radius)
+        {
+          outside = true;
+          break;
+        }
+      }
+
+      if (outside)
+      {
+        stats.FrustumCulled++;
+        continue;
+      }
+
+      if (coneCulling && meshlet.ConeCutoff < 1.0F)
+      {
+        glm::vec3 axis = glm::normalize(
+          glm::vec3(modelMatrix * glm::vec4(meshlet.ConeAxis, 0.0F)));
+        glm::vec3 view = center - frustum.CameraPosition;
+
+        // Every triangle of the cluster faces away from the camera
+        if (glm::dot(view, axis) >=
+            (meshlet.ConeCutoff * glm::length(view)) + radius)
+        {
+          stats.BackfaceCulled++;
+          continue;
+        }
+      }
+
+      stats.VisibleMeshlets++;
+      if (!visibleRanges.empty() &&
+          visibleRanges.back().Offset + visibleRanges.back().Count ==
+            meshlet.IndexOffset)
+      {
+        visibleRanges.back().Count += meshlet.IndexCount;
+      }
+      else
+      {
+        visibleRanges.push_back({ meshlet.IndexOffset, meshlet.IndexCount });
+      }
+    }
+
+    return stats;
+  }
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Core/Rendering/Mesh/IndexType.hpp"
+#include "Core/Rendering/Mesh/Meshlet.hpp"
+
+namespace Dwarf
+{
+  /// @brief World space view volume used to cull meshlets.
+  struct CullingFrustum
+  {
+    /// @brief Left, right, bottom, top, near and far planes. The normals
+    /// point inwards, a point p is inside if dot(xyz, p) + w >= 0.
+    std::array<glm::vec4, 6> Planes;
+
+    /// @brief World space position of the camera.
+    glm::vec3 CameraPosition = glm::vec3(0.0F);
+  };
+
+  /// @brief Result of culling the meshlets of a mesh.
+  struct ClusterCullingStatistics
+  {
+    /// @brief Number of meshlets that passed the culling.
+    uint32_t VisibleMeshlets = 0;
+
+    /// @brief Number of meshlets rejected by the frustum test.
+    uint32_t FrustumCulled = 0;
+
+    /// @brief Number of meshlets rejected by the normal cone test.
+    uint32_t BackfaceCulled = 0;
+  };
+
+  /// @brief CPU culling of meshlets against the view frustum and their
+  /// normal cones.
+  class ClusterCuller
+  {
+  public:
+    /**
+     * @brief Extracts the frustum planes of a view projection matrix
+     *
+     * @param viewProjection Projection matrix multiplied with the view matrix
+     * @param cameraPosition World space position of the camera
+     * @return The culling frustum
+     */
+    static auto
+    CreateFrustum(const glm::mat4& viewProjection, glm::vec3 cameraPosition)
+      -> CullingFrustum;
+
+    /**
+     * @brief Culls the meshlets of a mesh and collects the index ranges of
+     * the visible ones. Ranges of consecutive visible meshlets are merged, so
+     * the result can be submitted with a single multi draw.
+     *
+     * @param meshlets Meshlets of the mesh
+     * @param modelMatrix Model matrix of the mesh
+     * @param frustum World space culling frustum
+     * @param visibleRanges Output receiving the index ranges to draw
+     * @param backfaceCulling Whether the normal cone test is applied, off for
+     * double sided materials whose back faces are visible
+     * @return Statistics of the culling pass
+     */
+    static auto
+    Cull(const std::vector<Meshlet>& meshlets,
+         const glm::mat4&            modelMatrix,
+         const CullingFrustum&       frustum,
+         std::vector<IndexRange>&    visibleRanges,
+         bool backfaceCulling = true) -> ClusterCullingStatistics;
+  };
+}
@@ -1,6 +1,10 @@
 #pragma once
 
+#include "Core/Rendering/Mesh/IndexType.hpp"
+#include "Core/Rendering/Mesh/MeshLod.hpp"
+#include "Core/Rendering/Mesh/Meshlet.hpp"
 #include "Core/Rendering/Mesh/Vertex.hpp"
+#include "Core/Rendering/Mesh/VertexLayout.hpp"
 
 namespace Dwarf
 {
@@ -37,6 +41,57 @@ namespace Dwarf
     [[nodiscard]] virtual auto
     GetIndices() const -> const std::vector<uint32_t>& = 0;
 
+    /**
+     * @brief Retrieves the vertex format the mesh should be uploaded with
+     *
+     * @return Vertex format of the mesh
+     */
+    [[nodiscard]] virtual auto
+    GetVertexFormat() const -> VertexFormat = 0;
+
+    /**
+     * @brief Retrieves the index type the mesh should be uploaded with
+     *
+     * @return Index type of the mesh
+     */
+    [[nodiscard]] virtual auto
+    GetIndexType() const -> IndexType = 0;
+
+    /**
+     * @brief Returns the reduced detail levels of the mesh. The full detail
+     * level (LOD 0) is not part of the list.
+     *
+     * @return Immutable reference to the stored detail levels, ordered from
+     * fine to coarse
+     */
+    [[nodiscard]] virtual auto
+    GetLods() const -> const std::vector<MeshLod>& = 0;
+
+    /**
+     * @brief Replaces the reduced detail levels of the mesh
+     *
+     * @param lods Detail levels ordered from fine to coarse
+     */
+    virtual void
+    SetLods(std::vector<MeshLod> lods) = 0;
+
+    /**
+     * @brief Returns the meshlets partitioning the full detail level. Empty if
+     * no meshlets were generated for the mesh.
+     *
+     * @return Immutable reference to the stored meshlets
+     */
+    [[nodiscard]] virtual auto
+    GetMeshlets() const -> const std::vector<Meshlet>& = 0;
+
+    /**
+     * @brief Replaces the meshlets of the mesh
+     *
+     * @param meshlets Meshlets covering the indices of the mesh
+     */
+    virtual void
+    SetMeshlets(std::vector<Meshlet> meshlets) = 0;
+
     /**
      * @brief Clones the Mesh instance
      *
@@ -14,17 +14,21 @@ namespace Dwarf
     virtual ~IMeshFactory() = default;
 
     /**
-     * @brief Creates a mesh instance based on the given data
+     * @brief Creates a mesh instance based on the given data. 16 bit indices
+     * are chosen automatically when the vertex count allows it.
      *
      * @param vertices Vertices of the mesh
      * @param indices Indices of the mesh
      * @param materialIndex Material index of the mesh
+     * @param vertexFormat Vertex format the mesh should be uploaded with
      * @return Unique pointer to the created mesh instance
      */
     [[nodiscard]] virtual auto
     Create(const std::vector<Vertex>&   vertices,
            const std::vector<uint32_t>& indices,
-           uint32_t materialIndex) const -> std::shared_ptr<IMesh> = 0;
+           uint32_t                     materialIndex,
+           VertexFormat vertexFormat = VertexFormat::Standard) const
+      -> std::shared_ptr<IMesh> = 0;
 
     /**
      * @brief Creates a mesh representing a unit sphere
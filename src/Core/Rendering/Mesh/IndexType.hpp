@@ -0,0 +1,55 @@
+#pragma once
+
+#include <limits>
+
+namespace Dwarf
+{
+  /// @brief Width of the indices a mesh is uploaded with.
+  enum class IndexType : uint8_t
+  {
+    /// @brief 16 bit indices, usable for up to 65536 vertices.
+    UInt16,
+    /// @brief 32 bit indices.
+    UInt32
+  };
+
+  /// @brief Range of indices inside an index buffer.
+  struct IndexRange
+  {
+    /// @brief Index of the first element of the range.
+    uint32_t Offset = 0;
+
+    /// @brief Number of indices of the range.
+    uint32_t Count = 0;
+  };
+
+  /// @brief Largest vertex count that can be addressed with 16 bit indices.
+  constexpr size_t MAX_UINT16_INDEX_VERTICES =
+    static_cast<size_t>(std::numeric_limits<uint16_t>::max()) + 1;
+
+  /**
+   * @brief Chooses the smallest index type able to address a vertex count
+   *
+   * @param vertexCount Number of vertices the indices refer to
+   * @return The smallest sufficient index type
+   */
+  inline auto
+  GetIndexType(size_t vertexCount) -> IndexType
+  {
+    return vertexCount <= MAX_UINT16_INDEX_VERTICES ? IndexType::UInt16
+                                                    : IndexType::UInt32;
+  }
+
+  /**
+   * @brief Retrieves the size of a single index in bytes
+   *
+   * @param indexType The index type
+   * @return Size of an index in bytes
+   */
+  inline auto
+  GetIndexSize(IndexType indexType) -> size_t
+  {
+    return indexType == IndexType::UInt16 ? sizeof(uint16_t)
+                                          : sizeof(uint32_t);
+  }
+}
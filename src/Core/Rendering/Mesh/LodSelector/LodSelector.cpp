@@ -0,0 +1,80 @@
+#include "pch.hpp"
+
+#include "LodSelector.hpp"
+
+namespace Dwarf
+{
+  auto
+  LodSelector::CreateSelection(const std::vector<Vertex>&  vertices,
+                               const std::vector<MeshLod>& lods)
+    -> LodSelection
+  {
+    LodSelection selection;
+    if (vertices.empty())
+    {
+      return selection;
+    }
+
+    glm::vec3 min(std::numeric_limits<float>::max());
+    glm::vec3 max(std::numeric_limits<float>::lowest());
+    for (const Vertex& vertex : vertices)
+    {
+      min = glm::min(min, vertex.Position);
+      max = glm::max(max, vertex.Position);
+    }
+
+    selection.BoundsCenter = (min + max) * 0.5F;
+    for (const Vertex& vertex : vertices)
+    {
+      selection.BoundsRadius =
+        std::max(selection.BoundsRadius,
+                 glm::distance(selection.BoundsCenter, vertex.Position));
+    }
+
+    for (const MeshLod& lod : lods)
+    {
+      selection.ScreenSizes.push_back(lod.ScreenSize);
+    }
+
+    return selection;
+  }
+
+  auto
+  LodSelector::ProjectedScreenSize(glm::vec3 center,
+                                   float     radius,
+                                   glm::vec3 cameraPosition,
+                                   float     fovRadians) -> float
+  {
+    float distance = glm::distance(center, cameraPosition);
+    if (distance <= radius)
+    {
+      return std::numeric_limits<float>::max();
+    }
+
+    // Sphere diameter relative to the visible height at its distance
+    return radius / (distance * std::tan(fovRadians * 0.5F));
+  }
+
+  auto
+  LodSelector::SelectLod(float                     screenSize,
+                         const std::vector<float>& screenSizes,
+                         uint32_t                  currentLod,
+                         float hysteresis) -> uint32_t
+  {
+    auto     levelCount = static_cast<uint32_t>(screenSizes.size());
+    uint32_t lod = std::min(currentLod, levelCount);
+
+    while (lod < levelCount &&
+           screenSize < screenSizes[lod] * (1.0F - hysteresis))
+    {
+      lod++;
+    }
+
+    while (lod > 0 && screenSize > screenSizes[lod - 1] * (1.0F + hysteresis))
+    {
+      lod--;
+    }
+
+    return lod;
+  }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Core/Rendering/Mesh/MeshLod.hpp"
+#include "Core/Rendering/Mesh/Vertex.hpp"
+
+namespace Dwarf
+{
+  /// @brief Per draw call state needed to pick a detail level.
+  struct LodSelection
+  {
+    /// @brief Center of the object space bounding sphere.
+    glm::vec3 BoundsCenter = glm::vec3(0.0F);
+
+    /// @brief Radius of the object space bounding sphere.
+    float BoundsRadius = 0.0F;
+
+    /// @brief Screen size thresholds of the detail levels 1..n.
+    std::vector<float> ScreenSizes;
+
+    /// @brief Detail level selected in the last frame.
+    uint32_t CurrentLod = 0;
+  };
+
+  /// @brief Selects mesh detail levels based on their projected size.
+  class LodSelector
+  {
+  public:
+    /// @brief Default relative band around a threshold in which the current
+    /// level is kept, avoiding popping when hovering around a threshold.
+    static constexpr float DEFAULT_HYSTERESIS = 0.1F;
+
+    /**
+     * @brief Creates the selection state of a mesh
+     *
+     * @param vertices Vertices of the mesh
+     * @param lods Reduced detail levels of the mesh
+     * @return Selection state starting at full detail
+     */
+    static auto
+    CreateSelection(const std::vector<Vertex>&  vertices,
+                    const std::vector<MeshLod>& lods) -> LodSelection;
+
+    /**
+     * @brief Computes the fraction of the screen height a bounding sphere
+     * covers. Values above 1 mean the sphere is larger than the screen.
+     *
+     * @param center World space center of the sphere
+     * @param radius World space radius of the sphere
+     * @param cameraPosition World space position of the camera
+     * @param fovRadians Vertical field of view of the camera in radians
+     * @return Projected screen height fraction
+     */
+    static auto
+    ProjectedScreenSize(glm::vec3 center,
+                        float     radius,
+                        glm::vec3 cameraPosition,
+                        float     fovRadians) -> float;
+
+    /**
+     * @brief Selects the detail level for a projected screen size. Moving to
+     * another level requires crossing its threshold by the hysteresis band.
+     *
+     * @param screenSize Projected screen height fraction of the object
+     * @param screenSizes Thresholds of the detail levels 1..n, descending
+     * @param currentLod Detail level selected in the last frame
+     * @param hysteresis Relative band around the thresholds
+     * @return Detail level to render, 0 being full detail
+     */
+    static auto
+    SelectLod(float                     screenSize,
+              const std::vector<float>& screenSizes,
+              uint32_t                  currentLod,
+              float hysteresis = DEFAULT_HYSTERESIS) -> uint32_t;
+  };
+}
@@ -7,10 +7,14 @@ namespace Dwarf
   Mesh::Mesh(const std::vector<Vertex>&    vertices,
              const std::vector<uint32_t>&  indices,
              uint32_t                      materialIndex,
+             VertexFormat                  vertexFormat,
+             IndexType                     indexType,
              std::shared_ptr<IDwarfLogger> logger)
     : mVertices(vertices)
     , mIndices(indices)
     , mMaterialIndex(materialIndex)
+    , mVertexFormat(vertexFormat)
+    , mIndexType(indexType)
     , mLogger(std::move(logger))
   {
     mLogger->LogDebug(Log("Mesh created.", "Mesh"));
@@ -39,9 +43,53 @@ namespace Dwarf
     return mIndices;
   }
 
+  auto
+  Mesh::GetVertexFormat() const -> VertexFormat
+  {
+    return mVertexFormat;
+  }
+
+  auto
+  Mesh::GetIndexType() const -> IndexType
+  {
+    return mIndexType;
+  }
+
+  auto
+  Mesh::GetLods() const -> const std::vector<MeshLod>&
+  {
+    return mLods;
+  }
+
+  void
+  Mesh::SetLods(std::vector<MeshLod> lods)
+  {
+    mLods = std::move(lods);
+  }
+
+  auto
+  Mesh::GetMeshlets() const -> const std::vector<Meshlet>&
+  {
+    return mMeshlets;
+  }
+
+  void
+  Mesh::SetMeshlets(std::vector<Meshlet> meshlets)
+  {
+    mMeshlets = std::move(meshlets);
+  }
+
   auto
   Mesh::Clone() const -> std::unique_ptr<IMesh>
   {
-    return std::make_unique<Mesh>(mVertices, mIndices, mMaterialIndex, mLogger);
+    auto clone = std::make_unique<Mesh>(mVertices,
+                                        mIndices,
+                                        mMaterialIndex,
+                                        mVertexFormat,
+                                        mIndexType,
+                                        mLogger);
+    clone->SetLods(mLods);
+    clone->SetMeshlets(mMeshlets);
+    return clone;
   }
 }
\ No newline at end of file
@@ -12,11 +12,17 @@ namespace Dwarf
     std::vector<Vertex>           mVertices;
     std::vector<uint32_t>         mIndices;
     uint32_t                      mMaterialIndex = 0;
+    VertexFormat                  mVertexFormat = VertexFormat::Standard;
+    IndexType                     mIndexType = IndexType::UInt32;
+    std::vector<MeshLod>          mLods;
+    std::vector<Meshlet>          mMeshlets;
 
   public:
     Mesh(const std::vector<Vertex>&    vertices,
          const std::vector<uint32_t>&  indices,
          uint32_t                      materialIndex,
+         VertexFormat                  vertexFormat,
+         IndexType                     indexType,
          std::shared_ptr<IDwarfLogger> logger);
     ~Mesh() override;
 
@@ -44,6 +50,57 @@ namespace Dwarf
     [[nodiscard]] auto
     GetIndices() const -> const std::vector<uint32_t>& override;
 
+    /**
+     * @brief Retrieves the vertex format the mesh should be uploaded with
+     *
+     * @return Vertex format of the mesh
+     */
+    [[nodiscard]] auto
+    GetVertexFormat() const -> VertexFormat override;
+
+    /**
+     * @brief Retrieves the index type the mesh should be uploaded with
+     *
+     * @return Index type of the mesh
+     */
+    [[nodiscard]] auto
+    GetIndexType() const -> IndexType override;
+
+    /**
+     * @brief Returns the reduced detail levels of the mesh. The full detail
+     * level (LOD 0) is not part of the list.
+     *
+     * @return Immutable reference to the stored detail levels, ordered from
+     * fine to coarse
+     */
+    [[nodiscard]] auto
+    GetLods() const -> const std::vector<MeshLod>& override;
+
+    /**
+     * @brief Replaces the reduced detail levels of the mesh
+     *
+     * @param lods Detail levels ordered from fine to coarse
+     */
+    void
+    SetLods(std::vector<MeshLod> lods) override;
+
+    /**
+     * @brief Returns the meshlets partitioning the full detail level. Empty if
+     * no meshlets were generated for the mesh.
+     *
+     * @return Immutable reference to the stored meshlets
+     */
+    [[nodiscard]] auto
+    GetMeshlets() const -> const std::vector<Meshlet>& override;
+
+    /**
+     * @brief Replaces the meshlets of the mesh
+     *
+     * @param meshlets Meshlets covering the indices of the mesh
+     */
+    void
+    SetMeshlets(std::vector<Meshlet> meshlets) override;
+
     /**
      * @brief Clones the Mesh instance
      *
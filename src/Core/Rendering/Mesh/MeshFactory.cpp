@@ -13,9 +13,16 @@ namespace Dwarf
   auto
   MeshFactory::Create(const std::vector<Vertex>&   vertices,
                       const std::vector<uint32_t>& indices,
-                      uint32_t materialIndex) const -> std::shared_ptr<IMesh>
+                      uint32_t                     materialIndex,
+                      VertexFormat vertexFormat) const -> std::shared_ptr<IMesh>
   {
-    return std::make_shared<Mesh>(vertices, indices, materialIndex, mLogger);
+    // Use 16 bit indices whenever the vertex count allows it
+    return std::make_shared<Mesh>(vertices,
+                                  indices,
+                                  materialIndex,
+                                  vertexFormat,
+                                  GetIndexType(vertices.size()),
+                                  mLogger);
   }
 
   auto
@@ -471,8 +478,71 @@ namespace Dwarf
       indexOffset += mesh->GetVertices().size();
     }
 
+    // Only keep the compact format if every merged mesh asked for it
+    bool isCompact = !meshes.empty() &&
+                     std::ranges::all_of(
+                       meshes,
+                       [](const std::shared_ptr<IMesh>& mesh)
+                       {
+                         return mesh->GetVertexFormat() ==
+                                VertexFormat::Compact;
+                       });
+    VertexFormat vertexFormat =
+      isCompact ? VertexFormat::Compact : VertexFormat::Standard;
+
     std::shared_ptr<IMesh> mergedMesh =
-      Create(mergedVertices, mergedIndices, 0);
+      Create(mergedVertices, mergedIndices, 0, vertexFormat);
+
+    // Merge the detail levels every mesh provides. The thresholds are shared
+    // by all meshes of a model, so the ones of the first mesh are used.
+    size_t lodCount = meshes.empty() ? 0 : meshes.front()->GetLods().size();
+    for (const auto& mesh : meshes)
+    {
+      lodCount = std::min(lodCount, mesh->GetLods().size());
+    }
+
+    std::vector<MeshLod> mergedLods(lodCount);
+    for (size_t level = 0; level < lodCount; level++)
+    {
+      MeshLod& mergedLod = mergedLods[level];
+      mergedLod.ScreenSize = meshes.front()->GetLods()[level].ScreenSize;
+      indexOffset = 0;
+
+      for (const auto& mesh : meshes)
+      {
+        const MeshLod& lod = mesh->GetLods()[level];
+        for (auto index : lod.Indices)
+        {
+          mergedLod.Indices.push_back(index + indexOffset);
+        }
+
+        mergedLod.Error = std::max(mergedLod.Error, lod.Error);
+        indexOffset += mesh->GetVertices().size();
+      }
+    }
+    mergedMesh->SetLods(std::move(mergedLods));
+
+    // Meshlets are only kept if they cover every merged mesh
+    bool hasMeshlets = !meshes.empty() &&
+                       std::ranges::all_of(
+                         meshes,
+                         [](const std::shared_ptr<IMesh>& mesh)
+                         { return !mesh->GetMeshlets().empty(); });
+    if (hasMeshlets)
+    {
+      std::vector<Meshlet> mergedMeshlets;
+      uint32_t             meshletIndexOffset = 0;
+      for (const auto& mesh : meshes)
+      {
+        for (Meshlet meshlet : mesh->GetMeshlets())
+        {
+          meshlet.IndexOffset += meshletIndexOffset;
+          mergedMeshlets.push_back(meshlet);
+        }
+        meshletIndexOffset += static_cast<uint32_t>(mesh->GetIndices().size());
+      }
+      mergedMesh->SetMeshlets(std::move(mergedMeshlets));
+    }
 
     return mergedMesh;
   }
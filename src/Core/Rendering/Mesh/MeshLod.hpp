@@ -0,0 +1,18 @@
+#pragma once
+
+namespace Dwarf
+{
+  /// @brief A reduced detail level of a mesh. Levels share the vertex list of
+  /// the full detail mesh and only store their own triangle list.
+  struct MeshLod
+  {
+    /// @brief Triangle list indices into the vertices of the mesh.
+    std::vector<uint32_t> Indices;
+
+    /// @brief Geometric error of the level in object space units.
+    float Error = 0.0F;
+
+    /// @brief Projected screen height fraction below which this level is used.
+    float ScreenSize = 0.0F;
+  };
+}
@@ -0,0 +1,465 @@
+#include "pch.hpp"
+
+#include "MeshOptimizer.hpp"
+
+namespace Dwarf
+{
+  namespace
+  {
+    constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    /// @brief FIFO vertex cache simulation based on insertion timestamps.
+    class FifoCacheSimulation
+    {
+    private:
+      std::vector<uint32_t> mTimestamps;
+      uint32_t              mCacheSize;
+      uint32_t              mTime;
+
+    public:
+      FifoCacheSimulation(size_t vertexCount, uint32_t cacheSize)
+        : mTimestamps(vertexCount, 0)
+        , mCacheSize(cacheSize)
+        , mTime(cacheSize + 1)
+      {
+      }
+
+      /// @brief Touches a vertex and returns true if it missed the cache.
+      auto
+      Access(uint32_t vertex) -> bool
+      {
+        if (mTime - mTimestamps[vertex] > mCacheSize)
+        {
+          mTimestamps[vertex] = mTime++;
+          return true;
+        }
+        return false;
+      }
+
+      /// @brief Evicts every vertex from the cache.
+      void
+      Reset()
+      {
+        mTime += mCacheSize + 1;
+      }
+    };
+
+    /// @brief Triangle adjacency of every vertex stored in a flat array.
+    struct VertexAdjacency
+    {
+      std::vector<uint32_t> Offsets;
+      std::vector<uint32_t> Counts;
+      std::vector<uint32_t> Triangles;
+
+      VertexAdjacency(const std::vector<uint32_t>& indices, size_t vertexCount)
+        : Offsets(vertexCount, 0)
+        , Counts(vertexCount, 0)
+        , Triangles(indices.size())
+      {
+        for (uint32_t index : indices)
+        {
+          Counts[index]++;
+        }
+
+        uint32_t offset = 0;
+        for (size_t i = 0; i < vertexCount; i++)
+        {
+          Offsets[i] = offset;
+          offset += Counts[i];
+        }
+
+        std::vector<uint32_t> fill = Offsets;
+        for (size_t i = 0; i < indices.size(); i++)
+        {
+          Triangles[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+      }
+    };
+
+    auto
+    CountCacheMisses(std::span<const uint32_t> indices,
+                     FifoCacheSimulation&      cache) -> uint32_t
+    {
+      uint32_t misses = 0;
+      for (uint32_t index : indices)
+      {
+        misses += cache.Access(index) ? 1 : 0;
+      }
+      return misses;
+    }
+  }
+
+  auto
+  MeshOptimizer::AnalyzeVertexCache(const std::vector<uint32_t>& indices,
+                                    size_t                       vertexCount,
+                                    uint32_t cacheSize) -> VertexCacheStatistics
+  {
+    VertexCacheStatistics stats;
+    if (indices.size() < 3 || vertexCount == 0)
+    {
+      return stats;
+    }
+
+    FifoCacheSimulation cache(vertexCount, cacheSize);
+    stats.VerticesTransformed = CountCacheMisses(indices, cache);
+
+    std::vector<bool> referenced(vertexCount, false);
+    size_t            uniqueVertices = 0;
+    for (uint32_t index : indices)
+    {
+      if (!referenced[index])
+      {
+        referenced[index] = true;
+        uniqueVertices++;
+      }
+    }
+
+    stats.Acmr = static_cast<float>(stats.VerticesTransformed) /
+                 static_cast<float>(indices.size() / 3);
+    stats.Atvr = static_cast<float>(stats.VerticesTransformed) /
+                 static_cast<float>(uniqueVertices);
+
+    return stats;
+  }
+
+  void
+  MeshOptimizer::OptimizeVertexCache(std::vector<uint32_t>& indices,
+                                     size_t                 vertexCount,
+                                     uint32_t               cacheSize,
+                                     std::vector<uint32_t>* clusters)
+  {
+    // A trailing partial triangle is not part of the triangle list
+    size_t triangleCount = indices.size() / 3;
+    indices.resize(triangleCount * 3);
+    if (clusters != nullptr)
+    {
+      clusters->clear();
+    }
+    if (triangleCount == 0 || vertexCount == 0)
+    {
+      return;
+    }
+
+    VertexAdjacency       adjacency(indices, vertexCount);
+    std::vector<uint32_t> liveTriangles = adjacency.Counts;
+    std::vector<uint32_t> cacheTimestamps(vertexCount, 0);
+    std::vector<bool>     emitted(triangleCount, false);
+    std::vector<uint32_t> deadEndStack;
+    std::vector<uint32_t> candidates;
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+
+    uint32_t timestamp = cacheSize + 1;
+    uint32_t cursor = 0;
+    uint32_t fanningVertex = 0;
+
+    // Start at the first referenced vertex
+    while (fanningVertex < vertexCount && liveTriangles[fanningVertex] == 0)
+    {
+      fanningVertex++;
+    }
+
+    if (clusters != nullptr)
+    {
+      clusters->push_back(0);
+    }
+
+    while (fanningVertex != INVALID_INDEX)
+    {
+      candidates.clear();
+
+      std::span<const uint32_t> neighbours(
+        adjacency.Triangles.data() + adjacency.Offsets[fanningVertex],
+        adjacency.Counts[fanningVertex]);
+
+      for (uint32_t triangle : neighbours)
+      {
+        if (emitted[triangle])
+        {
+          continue;
+        }
+
+        for (uint32_t corner = 0; corner < 3; corner++)
+        {
+          uint32_t vertex = indices[(triangle * 3) + corner];
+          result.push_back(vertex);
+          deadEndStack.push_back(vertex);
+          candidates.push_back(vertex);
+          liveTriangles[vertex]--;
+
+          if (timestamp - cacheTimestamps[vertex] > cacheSize)
+          {
+            cacheTimestamps[vertex] = timestamp++;
+          }
+        }
+
+        emitted[triangle] = true;
+      }
+
+      // Pick the candidate that stays in the cache for the most of its
+      // remaining triangles
+      uint32_t bestVertex = INVALID_INDEX;
+      int      bestPriority = -1;
+      for (uint32_t vertex : candidates)
+      {
+        if (liveTriangles[vertex] == 0)
+        {
+          continue;
+        }
+
+        int priority = 0;
+        if (timestamp - cacheTimestamps[vertex] + (2 * liveTriangles[vertex]) <=
+            cacheSize)
+        {
+          priority = static_cast<int>(timestamp - cacheTimestamps[vertex]);
+        }
+
+        if (priority > bestPriority)
+        {
+          bestPriority = priority;
+          bestVertex = vertex;
+        }
+      }
+
+      if (bestVertex != INVALID_INDEX)
+      {
+        fanningVertex = bestVertex;
+        continue;
+      }
+
+      // Dead end: fall back to recently used vertices, then to input order
+      fanningVertex = INVALID_INDEX;
+      while (!deadEndStack.empty())
+      {
+        uint32_t vertex = deadEndStack.back();
+        deadEndStack.pop_back();
+        if (liveTriangles[vertex] > 0)
+        {
+          fanningVertex = vertex;
+          break;
+        }
+      }
+
+      while (fanningVertex == INVALID_INDEX && cursor < vertexCount)
+      {
+        if (liveTriangles[cursor] > 0)
+        {
+          fanningVertex = cursor;
+        }
+        cursor++;
+      }
+
+      if (fanningVertex != INVALID_INDEX && clusters != nullptr)
+      {
+        clusters->push_back(static_cast<uint32_t>(result.size() / 3));
+      }
+    }
+
+    indices = std::move(result);
+  }
+
+  void
+  MeshOptimizer::OptimizeOverdraw(std::vector<uint32_t>&     indices,
+                                  const std::vector<Vertex>& vertices,
+                                  uint32_t                   cacheSize,
+                                  float                      threshold)
+  {
+    // A trailing partial triangle is not part of the triangle list
+    size_t triangleCount = indices.size() / 3;
+    indices.resize(triangleCount * 3);
+    if (triangleCount < 2)
+    {
+      return;
+    }
+
+    std::vector<uint32_t> hardBoundaries;
+    OptimizeVertexCache(indices, vertices.size(), cacheSize, &hardBoundaries);
+    hardBoundaries.push_back(static_cast<uint32_t>(triangleCount));
+
+    // Split the hard clusters further as long as the local cache efficiency
+    // stays close to the efficiency of the whole cluster
+    std::vector<uint32_t> boundaries;
+    FifoCacheSimulation   cache(vertices.size(), cacheSize);
+    for (size_t c = 0; c + 1 < hardBoundaries.size(); c++)
+    {
+      uint32_t begin = hardBoundaries[c];
+      uint32_t end = hardBoundaries[c + 1];
+
+      cache.Reset();
+      uint32_t clusterMisses = CountCacheMisses(
+        std::span<const uint32_t>(indices.data() + (begin * 3),
+                                  static_cast<size_t>(end - begin) * 3),
+        cache);
+      float clusterAcmr =
+        static_cast<float>(clusterMisses) / static_cast<float>(end - begin);
+
+      boundaries.push_back(begin);
+      cache.Reset();
+      uint32_t misses = 0;
+      uint32_t start = begin;
+      for (uint32_t triangle = begin; triangle < end; triangle++)
+      {
+        misses += CountCacheMisses(
+          std::span<const uint32_t>(indices.data() + (triangle * 3), 3), cache);
+
+        uint32_t count = triangle - start + 1;
+        if (triangle + 1 < end &&
+            static_cast<float>(misses) / static_cast<float>(count) <=
+              clusterAcmr * threshold)
+        {
+          boundaries.push_back(triangle + 1);
+          start = triangle + 1;
+          misses = 0;
+          cache.Reset();
+        }
+      }
+    }
+    boundaries.push_back(static_cast<uint32_t>(triangleCount));
+
+    // Area weighted centroid of the whole mesh
+    glm::vec3 meshCentroid(0.0F);
+    float     meshArea = 0.0F;
+    for (size_t t = 0; t < triangleCount; t++)
+    {
+      const glm::vec3& p0 = vertices[indices[(t * 3) + 0]].Position;
+      const glm::vec3& p1 = vertices[indices[(t * 3) + 1]].Position;
+      const glm::vec3& p2 = vertices[indices[(t * 3) + 2]].Position;
+      float            area = glm::length(glm::cross(p1 - p0, p2 - p0));
+
+      meshCentroid += (p0 + p1 + p2) * (area / 3.0F);
+      meshArea += area;
+    }
+    meshCentroid = meshArea > 0.0F ? meshCentroid / meshArea : meshCentroid;
+
+    struct ClusterSortData
+    {
+      uint32_t Begin;
+      uint32_t End;
+      float    Key;
+    };
+
+    std::vector<ClusterSortData> sortData;
+    sortData.reserve(boundaries.size() - 1);
+    for (size_t c = 0; c + 1 < boundaries.size(); c++)
+    {
+      glm::vec3 centroid(0.0F);
+      glm::vec3 normal(0.0F);
+      float     area = 0.0F;
+
+      for (uint32_t t = boundaries[c]; t < boundaries[c + 1]; t++)
+      {
+        const glm::vec3& p0 = vertices[indices[(t * 3) + 0]].Position;
+        const glm::vec3& p1 = vertices[indices[(t * 3) + 1]].Position;
+        const glm::vec3& p2 = vertices[indices[(t * 3) + 2]].Position;
+        glm::vec3        faceNormal = glm::cross(p1 - p0, p2 - p0);
+        float            faceArea = glm::length(faceNormal);
+
+        centroid += (p0 + p1 + p2) * (faceArea / 3.0F);
+        normal += faceNormal;
+        area += faceArea;
+      }
+
+      centroid = area > 0.0F ? centroid / area : centroid;
+      float normalLength = glm::length(normal);
+      normal = normalLength > 0.0F ? normal / normalLength : normal;
+
+      sortData.push_back({ boundaries[c],
+                           boundaries[c + 1],
+                           glm::dot(centroid - meshCentroid, normal) });
+    }
+
+    // Outward facing clusters first, they are the most likely occluders
+    std::ranges::stable_sort(sortData,
+                             [](const ClusterSortData& a,
+                                const ClusterSortData& b)
+                             { return a.Key > b.Key; });
+
+    std::vector<uint32_t> result;
+    result.reserve(indices.size());
+    for (const ClusterSortData& cluster : sortData)
+    {
+      auto begin = static_cast<ptrdiff_t>(cluster.Begin) * 3;
+      auto end = static_cast<ptrdiff_t>(cluster.End) * 3;
+      result.insert(
+        result.end(), indices.begin() + begin, indices.begin() + end);
+    }
+
+    indices = std::move(result);
+  }
+
+  void
+  MeshOptimizer::OptimizeVertexFetch(std::vector<uint32_t>& indices,
+                                     std::vector<Vertex>&   vertices)
+  {
+    std::vector<uint32_t> remap(vertices.size(), INVALID_INDEX);
+    std::vector<Vertex>   result;
+    result.reserve(vertices.size());
+
+    for (uint32_t& index : indices)
+    {
+      if (remap[index] == INVALID_INDEX)
+      {
+        remap[index] = static_cast<uint32_t>(result.size());
+        result.push_back(vertices[index]);
+      }
+      index = remap[index];
+    }
+
+    vertices = std::move(result);
+  }
+
+  auto
+  MeshOptimizer::SplitByVertexLimit(const std::vector<Vertex>&   vertices,
+                                    const std::vector<uint32_t>& indices,
+                                    size_t                       maxVertices)
+    -> std::vector<MeshChunk>
+  {
+    std::vector<MeshChunk> chunks;
+    std::vector<uint32_t>  remap(vertices.size(), INVALID_INDEX);
+    std::vector<uint32_t>  chunkVertices;
+    MeshChunk              chunk;
+    maxVertices = std::max<size_t>(maxVertices, 3);
+
+    for (size_t i = 0; i + 2 < indices.size(); i += 3)
+    {
+      size_t newVertices = 0;
+      for (size_t corner = 0; corner < 3; corner++)
+      {
+        uint32_t index = indices[i + corner];
+        bool     duplicate = (corner > 0 && indices[i] == index) ||
+                         (corner > 1 && indices[i + 1] == index);
+        newVertices += remap[index] == INVALID_INDEX && !duplicate ? 1 : 0;
+      }
+
+      if (chunk.Vertices.size() + newVertices > maxVertices)
+      {
+        chunks.push_back(std::move(chunk));
+        chunk = MeshChunk();
+        for (uint32_t vertex : chunkVertices)
+        {
+          remap[vertex] = INVALID_INDEX;
+        }
+        chunkVertices.clear();
+      }
+
+      for (size_t corner = 0; corner < 3; corner++)
+      {
+        uint32_t index = indices[i + corner];
+        if (remap[index] == INVALID_INDEX)
+        {
+          remap[index] = static_cast<uint32_t>(chunk.Vertices.size());
+          chunk.Vertices.push_back(vertices[index]);
+          chunkVertices.push_back(index);
+        }
+        chunk.Indices.push_back(remap[index]);
+      }
+    }
+
+    if (!chunk.Indices.empty())
+    {
+      chunks.push_back(std::move(chunk));
+    }
+
+    return chunks;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Core/Rendering/Mesh/Vertex.hpp"
+
+namespace Dwarf
+{
+  /// @brief Post-transform vertex cache statistics of an index buffer.
+  struct VertexCacheStatistics
+  {
+    /// @brief Number of vertices that missed the simulated cache.
+    uint32_t VerticesTransformed = 0;
+
+    /// @brief Average cache miss ratio (transformed vertices per triangle).
+    float Acmr = 0.0F;
+
+    /// @brief Average transform to vertex ratio (transformed vertices per
+    /// referenced vertex). 1.0 is optimal.
+    float Atvr = 0.0F;
+  };
+
+  /// @brief Vertices and indices of a part of a split mesh.
+  struct MeshChunk
+  {
+    std::vector<Vertex>   Vertices;
+    std::vector<uint32_t> Indices;
+  };
+
+  /// @brief CPU side mesh optimization passes applied to triangle lists.
+  class MeshOptimizer
+  {
+  public:
+    /// @brief Default size of the simulated post-transform vertex cache.
+    static constexpr uint32_t DEFAULT_CACHE_SIZE = 16;
+
+    /// @brief Default threshold for the overdraw pass. Clusters are only split
+    /// as long as their cache efficiency stays within this factor of the
+    /// vertex cache optimized order.
+    static constexpr float DEFAULT_OVERDRAW_THRESHOLD = 1.05F;
+
+    /**
+     * @brief Simulates a FIFO post-transform vertex cache over an index buffer
+     *
+     * @param indices Triangle list indices
+     * @param vertexCount Number of vertices the indices refer to
+     * @param cacheSize Size of the simulated cache
+     * @return ACMR and ATVR of the index buffer
+     */
+    static auto
+    AnalyzeVertexCache(const std::vector<uint32_t>& indices,
+                       size_t                       vertexCount,
+                       uint32_t cacheSize = DEFAULT_CACHE_SIZE)
+      -> VertexCacheStatistics;
+
+    /**
+     * @brief Reorders triangles for post-transform vertex cache efficiency
+     * using the Tipsify algorithm
+     *
+     * @param indices Triangle list indices to reorder in place
+     * @param vertexCount Number of vertices the indices refer to
+     * @param cacheSize Size of the targeted vertex cache
+     * @param clusters Optional output receiving the first triangle of every
+     * cluster boundary the algorithm produced
+     */
+    static void
+    OptimizeVertexCache(std::vector<uint32_t>& indices,
+                        size_t                 vertexCount,
+                        uint32_t               cacheSize = DEFAULT_CACHE_SIZE,
+                        std::vector<uint32_t>* clusters = nullptr);
+
+    /**
+     * @brief Reorders triangle clusters so that outward facing clusters are
+     * drawn first, reducing overdraw while keeping most of the vertex cache
+     * efficiency. Runs the vertex cache pass internally to obtain the
+     * clusters.
+     *
+     * @param indices Triangle list indices to reorder in place
+     * @param vertices Vertices the indices refer to
+     * @param cacheSize Size of the targeted vertex cache
+     * @param threshold Allowed ACMR degradation factor when splitting clusters
+     */
+    static void
+    OptimizeOverdraw(std::vector<uint32_t>&     indices,
+                     const std::vector<Vertex>& vertices,
+                     uint32_t                   cacheSize = DEFAULT_CACHE_SIZE,
+                     float threshold = DEFAULT_OVERDRAW_THRESHOLD);
+
+    /**
+     * @brief Reorders vertices in order of first use and drops unreferenced
+     * vertices, remapping the indices accordingly
+     *
+     * @param indices Triangle list indices to remap in place
+     * @param vertices Vertices to reorder in place
+     */
+    static void
+    OptimizeVertexFetch(std::vector<uint32_t>& indices,
+                        std::vector<Vertex>&   vertices);
+
+    /**
+     * @brief Splits a mesh into chunks referencing at most the given number
+     * of vertices. Triangles keep their order, vertices shared between chunks
+     * are duplicated and every chunk stores its vertices in order of first
+     * use.
+     *
+     * @param vertices Vertices of the mesh
+     * @param indices Triangle list indices of the mesh
+     * @param maxVertices Maximum vertex count of a chunk, at least 3
+     * @return The chunks of the mesh
+     */
+    static auto
+    SplitByVertexLimit(const std::vector<Vertex>&   vertices,
+                       const std::vector<uint32_t>& indices,
+                       size_t maxVertices) -> std::vector<MeshChunk>;
+  };
+}
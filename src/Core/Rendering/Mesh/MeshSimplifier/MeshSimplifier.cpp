@@ -0,0 +1,344 @@
+#include "pch.hpp"
+
+#include "MeshSimplifier.hpp"
+#include <queue>
+#include <unordered_map>
+
+namespace Dwarf
+{
+  namespace
+  {
+    /// @brief Symmetric 4x4 error quadric stored as its upper triangle.
+    struct Quadric
+    {
+      double A2 = 0, AB = 0, AC = 0, AD = 0;
+      double B2 = 0, BC = 0, BD = 0;
+      double C2 = 0, CD = 0;
+      double D2 = 0;
+
+      static auto
+      FromPlane(glm::vec3 normal, float distance) -> Quadric
+      {
+        double a = normal.x;
+        double b = normal.y;
+        double c = normal.z;
+        double d = distance;
+        return { a * a, a * b, a * c, a * d, b * b,
+                 b * c, b * d, c * c, c * d, d * d };
+      }
+
+      auto
+      operator+=(const Quadric& other) -> Quadric&
+      {
+        A2 += other.A2;
+        AB += other.AB;
+        AC += other.AC;
+        AD += other.AD;
+        B2 += other.B2;
+        BC += other.BC;
+        BD += other.BD;
+        C2 += other.C2;
+        CD += other.CD;
+        D2 += other.D2;
+        return *this;
+      }
+
+      [[nodiscard]] auto
+      Evaluate(glm::vec3 point) const -> double
+      {
+        double x = point.x;
+        double y = point.y;
+        double z = point.z;
+        double error = (A2 * x * x) + (2 * AB * x * y) + (2 * AC * x * z) +
+                       (2 * AD * x) + (B2 * y * y) + (2 * BC * y * z) +
+                       (2 * BD * y) + (C2 * z * z) + (2 * CD * z) + D2;
+        return std::max(error, 0.0);
+      }
+    };
+
+    struct Collapse
+    {
+      double   Cost;
+      uint32_t From;
+      uint32_t To;
+      uint32_t FromVersion;
+      uint32_t ToVersion;
+
+      auto
+      operator>(const Collapse& other) const -> bool
+      {
+        return Cost > other.Cost;
+      }
+    };
+
+    auto
+    EdgeKey(uint32_t a, uint32_t b) -> uint64_t
+    {
+      return (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+    }
+  }
+
+  auto
+  MeshSimplifier::Simplify(const std::vector<Vertex>&   vertices,
+                           const std::vector<uint32_t>& indices,
+                           size_t                       targetIndexCount,
+                           float                        targetError,
+                           float* resultError) -> std::vector<uint32_t>
+  {
+    if (resultError != nullptr)
+    {
+      *resultError = 0.0F;
+    }
+
+    // A trailing partial triangle is not part of the triangle list
+    size_t                triangleCount = indices.size() / 3;
+    std::vector<uint32_t> triangles(
+      indices.begin(),
+      indices.begin() + static_cast<ptrdiff_t>(triangleCount * 3));
+    if (triangles.size() <= targetIndexCount || vertices.empty())
+    {
+      return triangles;
+    }
+
+    std::vector<bool>                  triangleAlive(triangleCount, true);
+    std::vector<std::vector<uint32_t>> adjacency(vertices.size());
+    std::vector<Quadric>               quadrics(vertices.size());
+    std::vector<bool>                  locked(vertices.size(), false);
+    std::vector<bool>                  removed(vertices.size(), false);
+    std::vector<uint32_t>              versions(vertices.size(), 0);
+    std::unordered_map<uint64_t, uint32_t> edgeUsage;
+
+    for (uint32_t t = 0; t < triangleCount; t++)
+    {
+      uint32_t  i0 = triangles[(t * 3) + 0];
+      uint32_t  i1 = triangles[(t * 3) + 1];
+      uint32_t  i2 = triangles[(t * 3) + 2];
+      glm::vec3 p0 = vertices[i0].Position;
+      glm::vec3 normal =
+        glm::cross(vertices[i1].Position - p0, vertices[i2].Position - p0);
+      float length = glm::length(normal);
+
+      if (length > 0.0F)
+      {
+        normal /= length;
+        Quadric plane = Quadric::FromPlane(normal, -glm::dot(normal, p0));
+        quadrics[i0] += plane;
+        quadrics[i1] += plane;
+        quadrics[i2] += plane;
+      }
+
+      for (uint32_t corner = 0; corner < 3; corner++)
+      {
+        uint32_t a = triangles[(t * 3) + corner];
+        uint32_t b = triangles[(t * 3) + ((corner + 1) % 3)];
+        adjacency[a].push_back(t);
+        edgeUsage[EdgeKey(a, b)]++;
+      }
+    }
+
+    // Open borders and attribute seams (split vertices) only have one
+    // triangle on one side of the edge, moving them would tear the surface
+    for (const auto& [key, usage] : edgeUsage)
+    {
+      if (usage == 1)
+      {
+        locked[static_cast<uint32_t>(key >> 32)] = true;
+        locked[static_cast<uint32_t>(key & 0xFFFFFFFFU)] = true;
+      }
+    }
+
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<>> heap;
+
+    auto pushCollapse = [&](uint32_t from, uint32_t to)
+    {
+      if (locked[from] || from == to)
+      {
+        return;
+      }
+      Quadric combined = quadrics[from];
+      combined += quadrics[to];
+      heap.push({ combined.Evaluate(vertices[to].Position),
+                  from,
+                  to,
+                  versions[from],
+                  versions[to] });
+    };
+
+    for (const auto& [key, usage] : edgeUsage)
+    {
+      auto a = static_cast<uint32_t>(key >> 32);
+      auto b = static_cast<uint32_t>(key & 0xFFFFFFFFU);
+      pushCollapse(a, b);
+      pushCollapse(b, a);
+    }
+
+    size_t aliveTriangles = triangleCount;
+    double maxError = 0.0;
+    double errorLimit = static_cast<double>(targetError) * targetError;
+
+    while (!heap.empty() && aliveTriangles * 3 > targetIndexCount)
+    {
+      Collapse collapse = heap.top();
+      heap.pop();
+
+      if (removed[collapse.From] || removed[collapse.To] ||
+          versions[collapse.From] != collapse.FromVersion ||
+          versions[collapse.To] != collapse.ToVersion)
+      {
+        continue;
+      }
+
+      if (collapse.Cost > errorLimit)
+      {
+        break;
+      }
+
+      // Reject collapses that would flip a triangle
+      bool      flips = false;
+      glm::vec3 target = vertices[collapse.To].Position;
+      for (uint32_t t : adjacency[collapse.From])
+      {
+        if (!triangleAlive[t])
+        {
+          continue;
+        }
+
+        std::array<uint32_t, 3> corners = { triangles[(t * 3) + 0],
+                                            triangles[(t * 3) + 1],
+                                            triangles[(t * 3) + 2] };
+        if (std::ranges::find(corners, collapse.To) != corners.end())
+        {
+          continue;
+        }
+
+        std::array<glm::vec3, 3> before = { vertices[corners[0]].Position,
+                                            vertices[corners[1]].Position,
+                                            vertices[corners[2]].Position };
+        std::array<glm::vec3, 3> after = before;
+        for (size_t c = 0; c < 3; c++)
+        {
+          if (corners[c] == collapse.From)
+          {
+            after[c] = target;
+          }
+        }
+
+        glm::vec3 normalBefore =
+          glm::cross(before[1] - before[0], before[2] - before[0]);
+        glm::vec3 normalAfter =
+          glm::cross(after[1] - after[0], after[2] - after[0]);
+
+        if (glm::dot(normalBefore, normalAfter) <= 0.0F)
+        {
+          flips = true;
+          break;
+        }
+      }
+
+      if (flips)
+      {
+        continue;
+      }
+
+      for (uint32_t t : adjacency[collapse.From])
+      {
+        if (!triangleAlive[t])
+        {
+          continue;
+        }
+
+        bool containsTarget = false;
+        for (uint32_t c = 0; c < 3; c++)
+        {
+          containsTarget |= triangles[(t * 3) + c] == collapse.To;
+        }
+
+        if (containsTarget)
+        {
+          triangleAlive[t] = false;
+          aliveTriangles--;
+          continue;
+        }
+
+        for (uint32_t c = 0; c < 3; c++)
+        {
+          if (triangles[(t * 3) + c] == collapse.From)
+          {
+            triangles[(t * 3) + c] = collapse.To;
+          }
+        }
+        adjacency[collapse.To].push_back(t);
+      }
+
+      removed[collapse.From] = true;
+      adjacency[collapse.From].clear();
+      quadrics[collapse.To] += quadrics[collapse.From];
+      versions[collapse.To]++;
+      maxError = std::max(maxError, collapse.Cost);
+
+      // The quadric of the surviving vertex changed, re-evaluate its edges
+      for (uint32_t t : adjacency[collapse.To])
+      {
+        if (!triangleAlive[t])
+        {
+          continue;
+        }
+
+        for (uint32_t c = 0; c < 3; c++)
+        {
+          uint32_t neighbour = triangles[(t * 3) + c];
+          if (neighbour != collapse.To)
+          {
+            pushCollapse(neighbour, collapse.To);
+            pushCollapse(collapse.To, neighbour);
+          }
+        }
+      }
+    }
+
+    std::vector<uint32_t> result;
+    result.reserve(aliveTriangles * 3);
+    for (uint32_t t = 0; t < triangleCount; t++)
+    {
+      if (triangleAlive[t])
+      {
+        result.insert(result.end(),
+                      triangles.begin() + (static_cast<ptrdiff_t>(t) * 3),
+                      triangles.begin() + (static_cast<ptrdiff_t>(t) * 3) + 3);
+      }
+    }
+
+    if (resultError != nullptr)
+    {
+      *resultError = static_cast<float>(std::sqrt(maxError));
+    }
+
+    return result;
+  }
+
+  auto
+  MeshSimplifier::ComputeRadius(const std::vector<Vertex>& vertices) -> float
+  {
+    if (vertices.empty())
+    {
+      return 0.0F;
+    }
+
+    glm::vec3 min(std::numeric_limits<float>::max());
+    glm::vec3 max(std::numeric_limits<float>::lowest());
+    for (const Vertex& vertex : vertices)
+    {
+      min = glm::min(min, vertex.Position);
+      max = glm::max(max, vertex.Position);
+    }
+
+    glm::vec3 center = (min + max) * 0.5F;
+    float     radius = 0.0F;
+    for (const Vertex& vertex : vertices)
+    {
+      radius = std::max(radius, glm::distance(center, vertex.Position));
+    }
+
+    return radius;
+  }
+}
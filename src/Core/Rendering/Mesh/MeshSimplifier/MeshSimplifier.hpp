@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Core/Rendering/Mesh/Vertex.hpp"
+
+namespace Dwarf
+{
+  /// @brief CPU mesh simplification based on quadric error metrics.
+  class MeshSimplifier
+  {
+  public:
+    /**
+     * @brief Simplifies a triangle list by collapsing edges in order of their
+     * quadric error. Vertices are never moved or created, so the resulting
+     * indices can share the vertex buffer of the source mesh. Border and
+     * attribute seam vertices are locked to keep the silhouette and UV
+     * layout intact.
+     *
+     * @param vertices Vertices of the mesh
+     * @param indices Triangle list indices of the mesh
+     * @param targetIndexCount Index count to reduce the mesh to
+     * @param targetError Maximum allowed geometric error in object space
+     * units
+     * @param resultError Optional output receiving the largest error of all
+     * performed collapses
+     * @return Simplified triangle list indices
+     */
+    static auto
+    Simplify(const std::vector<Vertex>&   vertices,
+             const std::vector<uint32_t>& indices,
+             size_t                       targetIndexCount,
+             float                        targetError,
+             float* resultError = nullptr) -> std::vector<uint32_t>;
+
+    /**
+     * @brief Computes the radius of the bounding sphere around the bounding
+     * box center of the vertices. Useful to express errors relative to the
+     * mesh size.
+     *
+     * @param vertices Vertices of the mesh
+     * @return Bounding sphere radius
+     */
+    static auto
+    ComputeRadius(const std::vector<Vertex>& vertices) -> float;
+  };
+}
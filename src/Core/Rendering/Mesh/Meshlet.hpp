@@ -0,0 +1,30 @@
+#pragma once
+
+namespace Dwarf
+{
+  /// @brief A small cluster of triangles of a mesh with bounds for culling.
+  struct Meshlet
+  {
+    /// @brief Index of the first index of the cluster in the mesh indices.
+    uint32_t IndexOffset = 0;
+
+    /// @brief Number of indices of the cluster.
+    uint32_t IndexCount = 0;
+
+    /// @brief Number of unique vertices referenced by the cluster.
+    uint32_t VertexCount = 0;
+
+    /// @brief Center of the object space bounding sphere.
+    glm::vec3 Center = glm::vec3(0.0F);
+
+    /// @brief Radius of the object space bounding sphere.
+    float Radius = 0.0F;
+
+    /// @brief Average facing direction of the triangles.
+    glm::vec3 ConeAxis = glm::vec3(0.0F, 0.0F, 1.0F);
+
+    /// @brief Sine of the normal cone angle. 1 disables backface culling of
+    /// the cluster.
+    float ConeCutoff = 1.0F;
+  };
+}
@@ -0,0 +1,145 @@
+#include "pch.hpp"
+
+#include "MeshletBuilder.hpp"
+
+namespace Dwarf
+{
+  namespace
+  {
+    /// @brief Normal cones wider than this (dot product with the axis) can
+    /// not be culled reliably.
+    constexpr float MIN_CONE_DOT = 0.1F;
+  }
+
+  auto
+  MeshletBuilder::Build(const std::vector<Vertex>&   vertices,
+                        const std::vector<uint32_t>& indices,
+                        uint32_t                     maxVertices,
+                        uint32_t maxTriangles) -> std::vector<Meshlet>
+  {
+    std::vector<Meshlet>  meshlets;
+    std::vector<uint32_t> lastMeshlet(vertices.size(),
+                                      std::numeric_limits<uint32_t>::max());
+    Meshlet               current;
+    maxVertices = std::max<uint32_t>(maxVertices, 3);
+    maxTriangles = std::max<uint32_t>(maxTriangles, 1);
+
+    auto flush = [&]()
+    {
+      if (current.IndexCount > 0)
+      {
+        ComputeBounds(vertices, indices, current);
+        meshlets.push_back(current);
+      }
+      current = Meshlet();
+      current.IndexOffset =
+        meshlets.empty()
+          ? 0
+          : meshlets.back().IndexOffset + meshlets.back().IndexCount;
+    };
+
+    // A trailing partial triangle is not part of the triangle list
+    size_t indexCount = indices.size() - (indices.size() % 3);
+    for (size_t i = 0; i < indexCount; i += 3)
+    {
+      // Vertices are tracked by the meshlet that last referenced them
+      auto     meshletId = static_cast<uint32_t>(meshlets.size());
+      uint32_t newVertices = 0;
+      for (size_t corner = 0; corner < 3; corner++)
+      {
+        uint32_t index = indices[i + corner];
+        bool     duplicate = (corner > 0 && indices[i] == index) ||
+                         (corner > 1 && indices[i + 1] == index);
+        newVertices += lastMeshlet[index] != meshletId && !duplicate ? 1 : 0;
+      }
+
+      if (current.VertexCount + newVertices > maxVertices ||
+          current.IndexCount / 3 + 1 > maxTriangles)
+      {
+        flush();
+        meshletId = static_cast<uint32_t>(meshlets.size());
+      }
+
+      for (size_t corner = 0; corner < 3; corner++)
+      {
+        uint32_t index = indices[i + corner];
+        if (lastMeshlet[index] != meshletId)
+        {
+          lastMeshlet[index] = meshletId;
+          current.VertexCount++;
+        }
+      }
+      current.IndexCount += 3;
+    }
+
+    flush();
+
+    return meshlets;
+  }
+
+  void
+  MeshletBuilder::ComputeBounds(const std::vector<Vertex>&   vertices,
+                                const std::vector<uint32_t>& indices,
+                                Meshlet&                     meshlet)
+  {
+    std::span<const uint32_t> meshletIndices(
+      indices.data() + meshlet.IndexOffset, meshlet.IndexCount);
+
+    glm::vec3 min(std::numeric_limits<float>::max());
+    glm::vec3 max(std::numeric_limits<float>::lowest());
+    for (uint32_t index : meshletIndices)
+    {
+      min = glm::min(min, vertices[index].Position);
+      max = glm::max(max, vertices[index].Position);
+    }
+
+    meshlet.Center = (min + max) * 0.5F;
+    meshlet.Radius = 0.0F;
+    for (uint32_t index : meshletIndices)
+    {
+      meshlet.Radius =
+        std::max(meshlet.Radius,
+                 glm::distance(meshlet.Center, vertices[index].Position));
+    }
+
+    // The cone axis is the average triangle normal, the cutoff is derived
+    // from the normal deviating the most from it
+    std::vector<glm::vec3> normals;
+    glm::vec3              axis(0.0F);
+    for (size_t i = 0; i + 2 < meshletIndices.size(); i += 3)
+    {
+      glm::vec3 p0 = vertices[meshletIndices[i]].Position;
+      glm::vec3 p1 = vertices[meshletIndices[i + 1]].Position;
+      glm::vec3 p2 = vertices[meshletIndices[i + 2]].Position;
+      glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+      float     length = glm::length(normal);
+      if (length > 0.0F)
+      {
+        normals.push_back(normal / length);
+        axis += normals.back();
+      }
+    }
+
+    meshlet.ConeAxis = glm::vec3(0.0F, 0.0F, 1.0F);
+    meshlet.ConeCutoff = 1.0F;
+
+    float axisLength = glm::length(axis);
+    if (normals.empty() || axisLength <= 0.0F)
+    {
+      return;
+    }
+    axis = axis / axisLength;
+
+    float minDot = 1.0F;
+    for (const glm::vec3& normal : normals)
+    {
+      minDot = std::min(minDot, glm::dot(normal, axis));
+    }
+
+    meshlet.ConeAxis = axis;
+    if (minDot > MIN_CONE_DOT)
+    {
+      meshlet.ConeCutoff = std::sqrt(1.0F - (minDot * minDot));
+    }
+  }
+}
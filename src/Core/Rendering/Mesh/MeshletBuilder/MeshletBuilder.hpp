@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Core/Rendering/Mesh/Meshlet.hpp"
+#include "Core/Rendering/Mesh/Vertex.hpp"
+
+namespace Dwarf
+{
+  /// @brief Partitions triangle lists into meshlets.
+  class MeshletBuilder
+  {
+  public:
+    /// @brief Default maximum number of vertices of a meshlet.
+    static constexpr uint32_t MAX_VERTICES = 64;
+
+    /// @brief Default maximum number of triangles of a meshlet.
+    static constexpr uint32_t MAX_TRIANGLES = 124;
+
+    /**
+     * @brief Partitions a triangle list into meshlets by scanning the
+     * triangles in order. The indices are expected to be optimized for vertex
+     * locality (see MeshOptimizer), every meshlet covers a contiguous range
+     * of them.
+     *
+     * @param vertices Vertices of the mesh
+     * @param indices Triangle list indices of the mesh
+     * @param maxVertices Maximum number of vertices of a meshlet, at least 3
+     * @param maxTriangles Maximum number of triangles of a meshlet
+     * @return The meshlets with their bounding spheres and normal cones
+     */
+    static auto
+    Build(const std::vector<Vertex>&   vertices,
+          const std::vector<uint32_t>& indices,
+          uint32_t                     maxVertices = MAX_VERTICES,
+          uint32_t maxTriangles = MAX_TRIANGLES) -> std::vector<Meshlet>;
+
+    /**
+     * @brief Computes the bounding sphere and normal cone of a meshlet
+     *
+     * @param vertices Vertices of the mesh
+     * @param indices Triangle list indices of the mesh
+     * @param meshlet Meshlet to compute the bounds of
+     */
+    static void
+    ComputeBounds(const std::vector<Vertex>&   vertices,
+                  const std::vector<uint32_t>& indices,
+                  Meshlet&                     meshlet);
+  };
+}
@@ -0,0 +1,148 @@
+#include "pch.hpp"
+
+#include "VertexCompression.hpp"
+#include <glm/gtc/packing.hpp>
+
+namespace Dwarf
+{
+  namespace
+  {
+    auto
+    SignNotZero(glm::vec2 value) -> glm::vec2
+    {
+      return { value.x >= 0.0F ? 1.0F : -1.0F, value.y >= 0.0F ? 1.0F : -1.0F };
+    }
+
+    auto
+    PackSnorm(float value) -> int16_t
+    {
+      return static_cast<int16_t>(glm::packSnorm1x16(value));
+    }
+
+    auto
+    UnpackSnorm(int16_t value) -> float
+    {
+      return glm::unpackSnorm1x16(static_cast<uint16_t>(value));
+    }
+  }
+
+  auto
+  VertexCompression::OctEncode(glm::vec3 direction) -> glm::vec2
+  {
+    float length =
+      std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z);
+    if (length <= 0.0F)
+    {
+      return glm::vec2(0.0F);
+    }
+
+    glm::vec2 encoded = glm::vec2(direction.x, direction.y) / length;
+    if (direction.z < 0.0F)
+    {
+      encoded = (glm::vec2(1.0F) - glm::abs(glm::vec2(encoded.y, encoded.x))) *
+                SignNotZero(encoded);
+    }
+    return encoded;
+  }
+
+  auto
+  VertexCompression::OctDecode(glm::vec2 encoded) -> glm::vec3
+  {
+    glm::vec3 direction(
+      encoded.x, encoded.y, 1.0F - std::abs(encoded.x) - std::abs(encoded.y));
+    if (direction.z < 0.0F)
+    {
+      glm::vec2 folded =
+        (glm::vec2(1.0F) - glm::abs(glm::vec2(direction.y, direction.x))) *
+        SignNotZero(glm::vec2(direction.x, direction.y));
+      direction.x = folded.x;
+      direction.y = folded.y;
+    }
+    return glm::normalize(direction);
+  }
+
+  auto
+  VertexCompression::ComputeQuantization(const std::vector<Vertex>& vertices)
+    -> VertexQuantization
+  {
+    VertexQuantization quantization;
+    if (vertices.empty())
+    {
+      return quantization;
+    }
+
+    glm::vec3 min(std::numeric_limits<float>::max());
+    glm::vec3 max(std::numeric_limits<float>::lowest());
+    for (const Vertex& vertex : vertices)
+    {
+      min = glm::min(min, vertex.Position);
+      max = glm::max(max, vertex.Position);
+    }
+
+    quantization.Offset = (min + max) * 0.5F;
+    // Keep degenerated axes invertible
+    quantization.Scale = glm::max((max - min) * 0.5F, glm::vec3(1e-6F));
+
+    return quantization;
+  }
+
+  auto
+  VertexCompression::Compress(const std::vector<Vertex>& vertices,
+                              const VertexQuantization&  quantization)
+    -> std::vector<CompactVertex>
+  {
+    std::vector<CompactVertex> result;
+    result.reserve(vertices.size());
+
+    for (const Vertex& vertex : vertices)
+    {
+      CompactVertex compact;
+      glm::vec3     position =
+        (vertex.Position - quantization.Offset) / quantization.Scale;
+      float handedness =
+        glm::dot(glm::cross(vertex.Normal, vertex.Tangent), vertex.BiTangent) <
+            0.0F
+          ? -1.0F
+          : 1.0F;
+
+      compact.Position = { PackSnorm(position.x),
+                           PackSnorm(position.y),
+                           PackSnorm(position.z),
+                           PackSnorm(handedness) };
+
+      glm::vec2 normal = OctEncode(vertex.Normal);
+      glm::vec2 tangent = OctEncode(vertex.Tangent);
+      compact.Normal = { PackSnorm(normal.x), PackSnorm(normal.y) };
+      compact.Tangent = { PackSnorm(tangent.x), PackSnorm(tangent.y) };
+
+      compact.UV = { glm::packHalf1x16(vertex.UV.x),
+                     glm::packHalf1x16(vertex.UV.y) };
+
+      result.push_back(compact);
+    }
+
+    return result;
+  }
+
+  auto
+  VertexCompression::Decompress(const CompactVertex&      vertex,
+                                const VertexQuantization& quantization)
+    -> Vertex
+  {
+    glm::vec3 position(UnpackSnorm(vertex.Position[0]),
+                       UnpackSnorm(vertex.Position[1]),
+                       UnpackSnorm(vertex.Position[2]));
+    float     handedness = UnpackSnorm(vertex.Position[3]);
+    glm::vec3 normal = OctDecode(
+      glm::vec2(UnpackSnorm(vertex.Normal[0]), UnpackSnorm(vertex.Normal[1])));
+    glm::vec3 tangent = OctDecode(glm::vec2(UnpackSnorm(vertex.Tangent[0]),
+                                            UnpackSnorm(vertex.Tangent[1])));
+
+    return { (position * quantization.Scale) + quantization.Offset,
+             normal,
+             tangent,
+             glm::cross(normal, tangent) * handedness,
+             glm::vec2(glm::unpackHalf1x16(vertex.UV[0]),
+                       glm::unpackHalf1x16(vertex.UV[1])) };
+  }
+}
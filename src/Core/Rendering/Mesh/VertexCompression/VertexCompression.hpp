@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Core/Rendering/Mesh/Vertex.hpp"
+#include "Core/Rendering/Mesh/VertexLayout.hpp"
+
+namespace Dwarf
+{
+  /// @brief Conversion between the Standard and Compact vertex formats.
+  class VertexCompression
+  {
+  public:
+    /**
+     * @brief Encodes a unit vector with an octahedron mapping
+     *
+     * @param direction Normalized direction
+     * @return Encoded direction in [-1, 1]
+     */
+    static auto
+    OctEncode(glm::vec3 direction) -> glm::vec2;
+
+    /**
+     * @brief Decodes an octahedron encoded unit vector
+     *
+     * @param encoded Encoded direction in [-1, 1]
+     * @return Normalized direction
+     */
+    static auto
+    OctDecode(glm::vec2 encoded) -> glm::vec3;
+
+    /**
+     * @brief Computes the quantization mapping the bounding box of the
+     * vertices to the snorm16 range
+     *
+     * @param vertices Vertices of the mesh
+     * @return Per mesh quantization
+     */
+    static auto
+    ComputeQuantization(const std::vector<Vertex>& vertices)
+      -> VertexQuantization;
+
+    /**
+     * @brief Packs vertices into the compact format
+     *
+     * @param vertices Vertices to pack
+     * @param quantization Quantization used for the positions
+     * @return Packed vertices
+     */
+    static auto
+    Compress(const std::vector<Vertex>& vertices,
+             const VertexQuantization&  quantization)
+      -> std::vector<CompactVertex>;
+
+    /**
+     * @brief Unpacks a compact vertex, mirroring the decoding done in the
+     * vertex shaders
+     *
+     * @param vertex Packed vertex
+     * @param quantization Quantization used for the positions
+     * @return Unpacked vertex
+     */
+    static auto
+    Decompress(const CompactVertex&      vertex,
+               const VertexQuantization& quantization) -> Vertex;
+  };
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Core/Rendering/Mesh/Vertex.hpp"
+
+namespace Dwarf
+{
+  /// @brief Memory layouts a mesh can be uploaded with.
+  enum class VertexFormat : uint8_t
+  {
+    /// @brief Full precision float vertices (see Vertex).
+    Standard,
+    /// @brief Quantized vertices (see CompactVertex).
+    Compact
+  };
+
+  /// @brief Component types of a vertex attribute.
+  enum class VertexAttributeType : uint8_t
+  {
+    Float,
+    Short,
+    HalfFloat
+  };
+
+  /// @brief Describes a single vertex attribute inside an interleaved buffer.
+  struct VertexAttribute
+  {
+    /// @brief Shader attribute location.
+    uint32_t Location = 0;
+
+    /// @brief Number of components of the attribute.
+    int32_t ComponentCount = 0;
+
+    /// @brief Type of a single component.
+    VertexAttributeType Type = VertexAttributeType::Float;
+
+    /// @brief Whether integer components are normalized to [-1, 1].
+    bool Normalized = false;
+
+    /// @brief Byte offset of the attribute inside a vertex.
+    uint32_t Offset = 0;
+  };
+
+  /// @brief Packed vertex of 20 bytes.
+  /// Positions are snorm16 relative to the per mesh VertexQuantization, with
+  /// the bitangent handedness stored in the fourth component. Normal and
+  /// tangent are octahedron encoded snorm16 pairs, UVs are half floats.
+  struct CompactVertex
+  {
+    std::array<int16_t, 4>  Position = { 0, 0, 0, 0 };
+    std::array<int16_t, 2>  Normal = { 0, 0 };
+    std::array<int16_t, 2>  Tangent = { 0, 0 };
+    std::array<uint16_t, 2> UV = { 0, 0 };
+  };
+
+  static_assert(sizeof(CompactVertex) == 20,
+                "CompactVertex is expected to be tightly packed");
+
+  /// @brief Per mesh transformation from quantized to object space positions.
+  /// position = quantized * Scale + Offset
+  struct VertexQuantization
+  {
+    glm::vec3 Offset = glm::vec3(0.0F);
+    glm::vec3 Scale = glm::vec3(1.0F);
+  };
+
+  /// @brief Describes how the vertices of a mesh buffer are laid out.
+  struct VertexLayout
+  {
+    /// @brief The format this layout describes.
+    VertexFormat Format = VertexFormat::Standard;
+
+    /// @brief Size of a single vertex in bytes.
+    uint32_t Stride = 0;
+
+    /// @brief Attributes of the layout.
+    std::vector<VertexAttribute> Attributes;
+
+    /**
+     * @brief Retrieves the layout of a vertex format
+     *
+     * @param format The vertex format
+     * @return The layout describing the format
+     */
+    static auto
+    Get(VertexFormat format) -> const VertexLayout&
+    {
+      using enum VertexAttributeType;
+      static const VertexLayout standard = {
+        VertexFormat::Standard,
+        sizeof(Vertex),
+        { { 0, 3, Float, false, offsetof(Vertex, Position) },
+          { 1, 3, Float, false, offsetof(Vertex, Normal) },
+          { 2, 3, Float, false, offsetof(Vertex, Tangent) },
+          { 3, 3, Float, false, offsetof(Vertex, BiTangent) },
+          { 4, 2, Float, false, offsetof(Vertex, UV) } }
+      };
+      static const VertexLayout compact = {
+        VertexFormat::Compact,
+        sizeof(CompactVertex),
+        { { 0, 4, Short, true, offsetof(CompactVertex, Position) },
+          { 1, 2, Short, true, offsetof(CompactVertex, Normal) },
+          { 2, 2, Short, true, offsetof(CompactVertex, Tangent) },
+          { 4, 2, HalfFloat, false, offsetof(CompactVertex, UV) } }
+      };
+
+      return format == VertexFormat::Compact ? compact : standard;
+    }
+  };
+}
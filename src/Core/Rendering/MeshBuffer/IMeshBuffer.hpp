@@ -1,5 +1,8 @@
 #pragma once
 
+#include "Core/Rendering/Mesh/IndexType.hpp"
+#include "Core/Rendering/Mesh/VertexLayout.hpp"
+
 namespace Dwarf
 {
   /**
@@ -28,6 +31,50 @@ namespace Dwarf
     [[nodiscard]] virtual auto
     GetIndexCount() const -> uint32_t = 0;
 
+    /**
+     * @brief Returns the type of the uploaded indices
+     *
+     * @return Index type of the mesh
+     */
+    [[nodiscard]] virtual auto
+    GetIndexType() const -> IndexType = 0;
+
+    /**
+     * @brief Returns the number of detail levels stored in the index buffer,
+     * including the full detail level
+     *
+     * @return Detail level count, at least 1
+     */
+    [[nodiscard]] virtual auto
+    GetLodCount() const -> uint32_t = 0;
+
+    /**
+     * @brief Returns the index range of a detail level. Levels past the
+     * coarsest one are clamped to it.
+     *
+     * @param lod Detail level, 0 being the full detail mesh
+     * @return Index range of the detail level
+     */
+    [[nodiscard]] virtual auto
+    GetLodIndexRange(uint32_t lod) const -> IndexRange = 0;
+
+    /**
+     * @brief Returns the layout the vertices were uploaded with
+     *
+     * @return Vertex layout of the mesh
+     */
+    [[nodiscard]] virtual auto
+    GetVertexLayout() const -> const VertexLayout& = 0;
+
+    /**
+     * @brief Returns the transformation from quantized to object space
+     * positions. Identity for non quantized layouts.
+     *
+     * @return Position quantization of the mesh
+     */
+    [[nodiscard]] virtual auto
+    GetVertexQuantization() const -> const VertexQuantization& = 0;
+
     IMeshBuffer(const IMeshBuffer&) = delete; // Delete copy constructor
     auto
     operator=(const IMeshBuffer&)
@@ -7,12 +7,14 @@
 namespace Dwarf
 {
   MeshBufferFactory::MeshBufferFactory(
-    GraphicsApi                   graphicsApi,
-    std::shared_ptr<IDwarfLogger> logger,
-    std::shared_ptr<IVramTracker> vramTracker)
+    GraphicsApi                          graphicsApi,
+    std::shared_ptr<IDwarfLogger>        logger,
+    std::shared_ptr<IVramTracker>        vramTracker,
+    std::shared_ptr<IOpenGLStateTracker> stateTracker)
     : mGraphicsApi(graphicsApi)
     , mLogger(std::move(logger))
     , mVramTracker(std::move(vramTracker))
+    , mStateTracker(std::move(stateTracker))
   {
     mLogger->LogDebug(Log("MeshBufferFactory created", "MeshBufferFactory"));
   }
@@ -40,8 +42,14 @@ namespace Dwarf
           Log("Vulkan API has not been implemented yet", "MeshBufferFactory"));
         throw std::runtime_error("Vulkan API has not been implemented yet");
       case OpenGL:
-        return std::make_unique<OpenGLMeshBuffer>(
-          mesh->GetVertices(), mesh->GetIndices(), mLogger, mVramTracker);
+        return std::make_unique<OpenGLMeshBuffer>(mesh->GetVertices(),
+                                                  mesh->GetIndices(),
+                                                  mesh->GetLods(),
+                                                  mesh->GetVertexFormat(),
+                                                  mesh->GetIndexType(),
+                                                  mLogger,
+                                                  mVramTracker,
+                                                  mStateTracker);
       case D3D12:
 #ifdef _WIN32
         mLogger->LogError(Log("Direct3D12 API has not been implemented yet",
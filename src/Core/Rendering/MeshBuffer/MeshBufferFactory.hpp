@@ -4,20 +4,23 @@
 #include "Core/Rendering/MeshBuffer/IMeshBufferFactory.hpp"
 #include "Core/Rendering/VramTracker/IVramTracker.hpp"
 #include "Logging/IDwarfLogger.hpp"
+#include "Platform/OpenGL/IOpenGLStateTracker.hpp"
 
 namespace Dwarf
 {
   class MeshBufferFactory : public IMeshBufferFactory
   {
   private:
-    GraphicsApi                   mGraphicsApi;
-    std::shared_ptr<IDwarfLogger> mLogger;
-    std::shared_ptr<IVramTracker> mVramTracker;
+    GraphicsApi                          mGraphicsApi;
+    std::shared_ptr<IDwarfLogger>        mLogger;
+    std::shared_ptr<IVramTracker>        mVramTracker;
+    std::shared_ptr<IOpenGLStateTracker> mStateTracker;
 
   public:
-    MeshBufferFactory(GraphicsApi                   graphicsApi,
-                      std::shared_ptr<IDwarfLogger> logger,
-                      std::shared_ptr<IVramTracker> vramTracker);
+    MeshBufferFactory(GraphicsApi                          graphicsApi,
+                      std::shared_ptr<IDwarfLogger>        logger,
+                      std::shared_ptr<IVramTracker>        vramTracker,
+                      std::shared_ptr<IOpenGLStateTracker> stateTracker);
     ~MeshBufferFactory() override;
 
     /**
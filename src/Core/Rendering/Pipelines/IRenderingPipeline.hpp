@@ -153,7 +153,8 @@ namespace Dwarf
     GetVertexCount() const -> uint32_t = 0;
 
     /**
-     * @brief Gets the total amount of triangles over all draw calls
+     * @brief Gets the amount of triangles rendered in the last frame, taking
+     * the selected detail levels into account
      *
      * @return Triangle count
      */
@@ -167,5 +168,24 @@ namespace Dwarf
      */
     virtual void
     SetTonemapType(TonemapType type) = 0;
+
+    /**
+     * @brief Enables submitting the opaque draw calls with multi draw
+     * indirect. Draw calls whose shader has no indirect variant keep using
+     * the per draw path.
+     *
+     * @param enabled Whether the indirect path is used
+     */
+    virtual void
+    SetIndirectDrawEnabled(bool enabled) = 0;
+
+    /**
+     * @brief Returns whether the opaque draw calls are submitted with multi
+     * draw indirect
+     *
+     * @return True if the indirect path is used
+     */
+    [[nodiscard]] virtual auto
+    IsIndirectDrawEnabled() const -> bool = 0;
   };
 }
\ No newline at end of file
@@ -25,7 +25,10 @@ namespace Dwarf
     const std::shared_ptr<IMaterialFactory>&     materialFactory,
     const std::shared_ptr<IDrawCallListFactory>& drawCallListFactory,
     const std::shared_ptr<IDrawCallWorkerFactory>& drawCallWorkerFactory,
-    const std::shared_ptr<IPingPongBufferFactory>& pingPongBufferFactory)
+    const std::shared_ptr<IPingPongBufferFactory>& pingPongBufferFactory,
+    const std::shared_ptr<IIndirectDrawBackendFactory>&
+                                         indirectDrawBackendFactory,
+    std::shared_ptr<IGraphicsDebugLayer> debugLayer)
     : mRendererApi(std::move(rendererApi))
     , mLoadedScene(std::move(loadedScene))
     , mShaderRegistry(std::move(shaderRegistry))
@@ -33,8 +36,10 @@ namespace Dwarf
     , mMeshFactory(std::move(meshFactory))
     , mMeshBufferFactory(std::move(meshBufferFactory))
     , mSkyboxRenderer(std::move(skyboxRenderer))
+    , mDebugLayer(std::move(debugLayer))
     , mDrawCallList(drawCallListFactory->Create())
     , mDrawCallWorker(drawCallWorkerFactory->Create(mDrawCallList))
+    , mIndirectDrawBackend(indirectDrawBackendFactory->Create(mRendererApi))
   {
     mLoadedScene->RegisterLoadedSceneObserver(this);
     mRendererApi->SetClearColor(glm::vec4(0.065F, 0.07F, 0.085F, 1.0F));
@@ -118,50 +123,104 @@ namespace Dwarf
   {
     // ==================== Scene Rendering ====================
 
-    mRenderFramebuffer->Bind();
-    mRenderFramebuffer->SetDrawBuffer(0);
-    mRendererApi->SetViewport(0,
-                              0,
-                              mRenderFramebuffer->GetSpecification().Width,
-                              mRenderFramebuffer->GetSpecification().Height);
-    mRendererApi->SetClearColor(glm::vec4(0.065F, 0.07F, 0.085F, 1.0F));
-    mRendererApi->Clear();
-
-    // Render skybox
-    mSkyboxRenderer->SetCamera(camera);
-    mSkyboxRenderer->Render();
-
-    // Render draw calls
     {
-      std::lock_guard<std::mutex> lock(mDrawCallList->GetMutex());
-      for (auto& drawCall : mDrawCallList->GetDrawCalls())
+      ScopedDebugGroup group(*mDebugLayer, "Scene");
+
+      mRenderFramebuffer->Bind();
+      mRenderFramebuffer->SetDrawBuffer(0);
+      mRendererApi->SetViewport(0,
+                                0,
+                                mRenderFramebuffer->GetSpecification().Width,
+                                mRenderFramebuffer->GetSpecification().Height);
+      mRendererApi->SetClearColor(glm::vec4(0.065F, 0.07F, 0.085F, 1.0F));
+      mRendererApi->Clear();
+
+      // Render skybox
+      mSkyboxRenderer->SetCamera(camera);
+      mSkyboxRenderer->Render();
+
+      // Render draw calls
       {
-        if (drawCall->GetMeshBuffer() != nullptr)
+        const DrawCallListSnapshot& drawCalls =
+          mDrawCallList->AcquireDrawCalls();
+        mRenderedTriangleCount = 0;
+        CullingFrustum frustum = ClusterCuller::CreateFrustum(
+          camera.GetProjectionMatrix() * camera.GetViewMatrix(),
+          camera.GetProperties().Transform.GetPosition());
+
+        // Cached placements and variants refer to the previous draw calls
+        if (drawCalls.Version != mIndirectDrawListVersion)
+        {
+          mIndirectDrawListVersion = drawCalls.Version;
+          mMeshPlacements.clear();
+          mIndirectShaders.clear();
+          if (mIndirectDrawBackend)
+          {
+            mIndirectDrawBackend->ClearMeshes();
+          }
+        }
+
+        // Opaque draw calls first, the indirect batches are submitted before
+        // the transparent draw calls to keep the blending order
+        mIndirectDrawBuilder.Clear();
+        for (const auto& drawCall : drawCalls.DrawCalls)
         {
-          mRendererApi->RenderIndexed(
-            drawCall->GetMeshBuffer(),
-            drawCall->GetMaterialAsset().GetMaterial(),
-            camera,
-            drawCall->GetTransform().GetMatrix());
+          if (drawCall->GetMeshBuffer() == nullptr ||
+              drawCall->GetMaterialAsset()
+                .GetMaterial()
+                .GetMaterialProperties()
+                .IsTransparent)
+          {
+            continue;
+          }
+
+          uint32_t lod = SelectLod(*drawCall, camera);
+          if (!AddIndirectDraw(*drawCall, lod, frustum))
+          {
+            RenderDrawCall(*drawCall, lod, frustum, camera);
+          }
+        }
+
+        if (mIndirectDrawBackend)
+        {
+          mIndirectDrawBuilder.Build();
+          mIndirectDrawBuilder.Submit(*mIndirectDrawBackend, camera);
+        }
+
+        for (const auto& drawCall : drawCalls.DrawCalls)
+        {
+          if (drawCall->GetMeshBuffer() != nullptr &&
+              drawCall->GetMaterialAsset()
+                .GetMaterial()
+                .GetMaterialProperties()
+                .IsTransparent)
+          {
+            RenderDrawCall(
+              *drawCall, SelectLod(*drawCall, camera), frustum, camera);
+          }
         }
       }
-    }
 
-    mRenderFramebuffer->Unbind();
+      mRenderFramebuffer->Unbind();
+    }
 
     // ==================== Resolve MSAA ====================
 
-    mRendererApi->Blit(*mRenderFramebuffer,
-                       *mHdrPingPong->GetWriteFramebuffer().lock(),
-                       0,
-                       0,
-                       mRenderFramebuffer->GetSpecification().Width,
-                       mRenderFramebuffer->GetSpecification().Height);
-    mRendererApi->BlitDepth(*mRenderFramebuffer,
-                            *mHdrPingPong->GetWriteFramebuffer().lock(),
-                            mRenderFramebuffer->GetSpecification().Width,
-                            mRenderFramebuffer->GetSpecification().Height);
-    mHdrPingPong->Swap();
+    {
+      ScopedDebugGroup group(*mDebugLayer, "Resolve MSAA");
+
+      mRendererApi->Blit(*mRenderFramebuffer,
+                         *mHdrPingPong->GetWriteFramebuffer().lock(),
+                         0,
+                         0,
+                         mRenderFramebuffer->GetSpecification().Width,
+                         mRenderFramebuffer->GetSpecification().Height);
+      mRendererApi->BlitDepth(*mRenderFramebuffer,
+                              *mHdrPingPong->GetWriteFramebuffer().lock(),
+                              mRenderFramebuffer->GetSpecification().Width,
+                              mRenderFramebuffer->GetSpecification().Height);
+      mHdrPingPong->Swap();
+    }
 
     // ==================== Exposure Scaling ====================
 
@@ -169,6 +228,8 @@ namespace Dwarf
         mHdrPingPong->GetReadFramebuffer().lock() &&
         mHdrPingPong->GetWriteFramebuffer().lock())
     {
+      ScopedDebugGroup group(*mDebugLayer, "Exposure Scaling");
+
       mExposureScalingShader->SetParameter("hdrTexture",
                                            mHdrPingPong->GetReadTexture());
       mRendererApi->ApplyPostProcess(
@@ -198,6 +259,8 @@ namespace Dwarf
         mHdrPingPong->GetReadFramebuffer().lock() && mLdrPingPong &&
         mLdrPingPong->GetWriteFramebuffer().lock())
     {
+      ScopedDebugGroup group(*mDebugLayer, "Tonemapping");
+
       mTonemapShader->SetParameter("hdrTexture",
                                    mHdrPingPong->GetReadTexture());
       mRendererApi->CustomBlit(*mHdrPingPong->GetReadFramebuffer().lock(),
@@ -213,6 +276,8 @@ namespace Dwarf
 
     if (gridSettings.RenderGrid)
     {
+      ScopedDebugGroup group(*mDebugLayer, "Grid");
+
       mGridShader->SetParameter("uSceneDepth",
                                 mHdrPingPong->GetReadFramebuffer()
                                   .lock()
@@ -235,12 +300,207 @@ namespace Dwarf
 
     // ==================== Presentation ====================
 
-    mRendererApi->Blit(*mLdrPingPong->GetReadFramebuffer().lock(),
-                       *mPresentationBuffer,
-                       0,
-                       0,
-                       mRenderFramebuffer->GetSpecification().Width,
-                       mRenderFramebuffer->GetSpecification().Height);
+    {
+      ScopedDebugGroup group(*mDebugLayer, "Presentation");
+
+      mRendererApi->Blit(*mLdrPingPong->GetReadFramebuffer().lock(),
+                         *mPresentationBuffer,
+                         0,
+                         0,
+                         mRenderFramebuffer->GetSpecification().Width,
+                         mRenderFramebuffer->GetSpecification().Height);
+    }
+  }
+
+  auto
+  RenderingPipeline::SelectLod(IDrawCall& drawCall, ICamera& camera)
+    -> uint32_t
+  {
+    LodSelection& selection = drawCall.GetLodSelection();
+    uint32_t      levelCount = drawCall.GetMeshBuffer()->GetLodCount();
+    if (levelCount <= 1 || selection.ScreenSizes.empty())
+    {
+      return 0;
+    }
+
+    glm::mat4 modelMatrix = GetModelMatrix(drawCall);
+    glm::vec3 center =
+      glm::vec3(modelMatrix * glm::vec4(selection.BoundsCenter, 1.0F));
+    float scale = std::max({ glm::length(glm::vec3(modelMatrix[0])),
+                             glm::length(glm::vec3(modelMatrix[1])),
+                             glm::length(glm::vec3(modelMatrix[2])) });
+
+    float screenSize = LodSelector::ProjectedScreenSize(
+      center,
+      selection.BoundsRadius * scale,
+      camera.GetProperties().Transform.GetPosition(),
+      glm::radians(camera.GetProperties().Fov));
+
+    selection.CurrentLod = std::min(
+      LodSelector::SelectLod(
+        screenSize, selection.ScreenSizes, selection.CurrentLod),
+      levelCount - 1);
+
+    return selection.CurrentLod;
+  }
+
+  void
+  RenderingPipeline::RenderDrawCall(IDrawCall&            drawCall,
+                                    uint32_t              lod,
+                                    const CullingFrustum& frustum,
+                                    ICamera&              camera)
+  {
+    glm::mat4 modelMatrix = GetModelMatrix(drawCall);
+
+    // Meshlets partition the full detail level only
+    if (lod == 0 && !drawCall.GetMeshlets().empty())
+    {
+      // Back faces of double sided materials are visible
+      ClusterCuller::Cull(drawCall.GetMeshlets(),
+                          modelMatrix,
+                          frustum,
+                          mVisibleRanges,
+                          !drawCall.GetMaterialAsset()
+                             .GetMaterial()
+                             .GetMaterialProperties()
+                             .IsDoubleSided);
+      // One multi draw per mesh. Only the indirect path merges the visible
+      // meshlets of several meshes into one submission
+      mRendererApi->RenderIndexedRanges(
+        drawCall.GetMeshBuffer(),
+        drawCall.GetMaterialAsset().GetMaterial(),
+        camera,
+        modelMatrix,
+        mVisibleRanges);
+      for (const IndexRange& range : mVisibleRanges)
+      {
+        mRenderedTriangleCount += range.Count / 3;
+      }
+      return;
+    }
+
+    mRendererApi->RenderIndexed(drawCall.GetMeshBuffer(),
+                                drawCall.GetMaterialAsset().GetMaterial(),
+                                camera,
+                                modelMatrix,
+                                lod);
+    mRenderedTriangleCount +=
+      drawCall.GetMeshBuffer()->GetLodIndexRange(lod).Count / 3;
+  }
+
+  auto
+  RenderingPipeline::AddIndirectDraw(IDrawCall&            drawCall,
+                                     uint32_t              lod,
+                                     const CullingFrustum& frustum) -> bool
+  {
+    if (!mIndirectDrawEnabled || !mIndirectDrawBackend)
+    {
+      return false;
+    }
+
+    IMaterial& material = drawCall.GetMaterialAsset().GetMaterial();
+    IShader*   shader = GetIndirectShader(material);
+    if (shader == nullptr)
+    {
+      return false;
+    }
+
+    const IMeshBuffer&                   meshBuffer = *drawCall.GetMeshBuffer();
+    std::optional<IndirectMeshPlacement> placement =
+      GetMeshPlacement(meshBuffer);
+    if (!placement.has_value())
+    {
+      return false;
+    }
+
+    IndirectDrawItem item;
+    item.Placement = placement.value();
+    item.Material = &material;
+    item.Shader = shader;
+    item.ModelMatrix = GetModelMatrix(drawCall);
+    item.Quantization = meshBuffer.GetVertexQuantization();
+    item.VertexCompression =
+      meshBuffer.GetVertexLayout().Format == VertexFormat::Compact;
+
+    // Every visible meshlet range becomes a command of its own
+    if (lod == 0 && !drawCall.GetMeshlets().empty())
+    {
+      ClusterCuller::Cull(drawCall.GetMeshlets(),
+                          item.ModelMatrix,
+                          frustum,
+                          mVisibleRanges,
+                          !material.GetMaterialProperties().IsDoubleSided);
+      for (const IndexRange& range : mVisibleRanges)
+      {
+        item.Range = range;
+        mIndirectDrawBuilder.Add(item);
+        mRenderedTriangleCount += range.Count / 3;
+      }
+      return true;
+    }
+
+    item.Range = meshBuffer.GetLodIndexRange(lod);
+    mIndirectDrawBuilder.Add(item);
+    mRenderedTriangleCount += item.Range.Count / 3;
+    return true;
+  }
+
+  auto
+  RenderingPipeline::GetModelMatrix(IDrawCall& drawCall) const -> glm::mat4
+  {
+    return mLoadedScene->GetScene().GetTransformHierarchy().GetWorldMatrix(
+      drawCall.GetTransform());
+  }
+
+  auto
+  RenderingPipeline::GetIndirectShader(IMaterial& material) -> IShader*
+  {
+    std::shared_ptr<IShader> baseShader = material.GetShader();
+    if (!baseShader || !baseShader->IsCompiled() ||
+        std::ranges::find(baseShader->GetDeclaredKeywords(),
+                          INDIRECT_DRAW_KEYWORD) ==
+          baseShader->GetDeclaredKeywords().end())
+    {
+      return nullptr;
+    }
+
+    // Resolved again when the material switched to another program, e.g.
+    // after a keyword change or a hot reload
+    IndirectShaderVariant& variant = mIndirectShaders[&material];
+    if (variant.BaseShader.lock() != baseShader)
+    {
+      variant.BaseShader = baseShader;
+      variant.Shader = nullptr;
+
+      std::unique_ptr<IShaderSourceCollection> shaderSources =
+        material.GetShaderAssetSources()->GetShaderSources();
+      if (shaderSources != nullptr)
+      {
+        std::vector<std::string> keywords = material.GetKeywords();
+        keywords.emplace_back(INDIRECT_DRAW_KEYWORD);
+        std::ranges::sort(keywords);
+        shaderSources->SetKeywords(std::move(keywords));
+        variant.Shader = mShaderRegistry->GetOrCreate(std::move(shaderSources));
+      }
+    }
+
+    return variant.Shader && variant.Shader->IsCompiled() ? variant.Shader.get()
+                                                          : nullptr;
+  }
+
+  auto
+  RenderingPipeline::GetMeshPlacement(const IMeshBuffer& meshBuffer)
+    -> std::optional<IndirectMeshPlacement>
+  {
+    auto iterator = mMeshPlacements.find(&meshBuffer);
+    if (iterator == mMeshPlacements.end())
+    {
+      iterator =
+        mMeshPlacements
+          .emplace(&meshBuffer, mIndirectDrawBackend->AddMesh(meshBuffer))
+          .first;
+    }
+    return iterator->second;
   }
 
   auto
@@ -259,6 +519,8 @@ namespace Dwarf
   void
   RenderingPipeline::RenderIds(IScene& scene, ICamera& camera)
   {
+    ScopedDebugGroup group(*mDebugLayer, "Object IDs");
+
     mIdBuffer->Bind();
     mRendererApi->Clear(0);
 
@@ -267,10 +529,16 @@ namespace Dwarf
                               mIdBuffer->GetSpecification().Width,
                               mIdBuffer->GetSpecification().Height);
 
-    for (auto view = scene.GetRegistry()
-                       .view<TransformComponent, MeshRendererComponent>();
-         auto [entity, transform, component] : view.each())
+    // Only the mesh renderers inside the view can be picked
+    scene.GetSpatialIndex().QueryFrustum(
+      ClusterCuller::CreateFrustum(
+        camera.GetProjectionMatrix() * camera.GetViewMatrix(),
+        camera.GetProperties().Transform.GetPosition()),
+      mVisibleEntities);
+
+    for (entt::entity entity : mVisibleEntities)
     {
+      auto& transform = scene.GetRegistry().get<TransformComponent>(entity);
       MeshRendererComponentHandle meshRenderer(scene.GetRegistry(), entity);
       if (meshRenderer.GetModelAsset() && !meshRenderer.GetIsHidden())
       {
@@ -285,11 +553,14 @@ namespace Dwarf
         }
 
         glm::mat4 modelMatrix =
-          TransformComponentHandle(scene.GetRegistry(), entity).GetMatrix();
+          scene.GetTransformHierarchy().GetWorldMatrix(transform);
         auto entityId = (uint32_t)entity;
         mIdMaterial->GetShaderParameters()->SetParameter("objectId", entityId);
-        mRendererApi->RenderIndexed(
-          meshRenderer.GetIdMeshBuffer(), *mIdMaterial, camera, modelMatrix);
+        mRendererApi->RenderIndexed(meshRenderer.GetIdMeshBuffer(),
+                                    *mIdMaterial,
+                                    camera,
+                                    modelMatrix,
+                                    0);
       }
     }
     mIdBuffer->Unbind();
@@ -354,19 +625,19 @@ namespace Dwarf
   [[nodiscard]] auto
   RenderingPipeline::GetDrawCallCount() const -> uint32_t
   {
-    return mDrawCallList->GetStats().DrawCallCount.load();
+    return mDrawCallList->GetStats().DrawCallCount;
   }
 
   [[nodiscard]] auto
   RenderingPipeline::GetVertexCount() const -> uint32_t
   {
-    return mDrawCallList->GetStats().VertexCount.load();
+    return mDrawCallList->GetStats().VertexCount;
   }
 
   [[nodiscard]] auto
   RenderingPipeline::GetTriangleCount() const -> uint32_t
   {
-    return mDrawCallList->GetStats().TriangleCount.load();
+    return mRenderedTriangleCount;
   }
 
   void
@@ -408,6 +679,18 @@ namespace Dwarf
     OnExposureSettingsChanged();
   }
 
+  void
+  RenderingPipeline::SetIndirectDrawEnabled(bool enabled)
+  {
+    mIndirectDrawEnabled = enabled;
+  }
+
+  auto
+  RenderingPipeline::IsIndirectDrawEnabled() const -> bool
+  {
+    return mIndirectDrawEnabled;
+  }
+
   void
   RenderingPipeline::OnAntiAliasingSettingsChanged()
   {
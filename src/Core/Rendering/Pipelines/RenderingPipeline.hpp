@@ -1,13 +1,17 @@
 #pragma once
 
 #include "Core/Asset/Shader/ShaderSourceCollection/IShaderSourceCollectionFactory.hpp"
+#include "Core/Rendering/DebugLayer/IGraphicsDebugLayer.hpp"
 #include "Core/Rendering/DrawCall/DrawCallList/IDrawCallList.hpp"
 #include "Core/Rendering/DrawCall/DrawCallList/IDrawCallListFactory.hpp"
 #include "Core/Rendering/DrawCall/DrawCallWorker/IDrawCallWorker.hpp"
 #include "Core/Rendering/DrawCall/DrawCallWorker/IDrawCallWorkerFactory.hpp"
 #include "Core/Rendering/Framebuffer/IFramebuffer.hpp"
 #include "Core/Rendering/Framebuffer/IFramebufferFactory.hpp"
+#include "Core/Rendering/IndirectDraw/IIndirectDrawBackendFactory.hpp"
+#include "Core/Rendering/IndirectDraw/IndirectDrawBuilder.hpp"
 #include "Core/Rendering/Material/IMaterialFactory.hpp"
+#include "Core/Rendering/Mesh/ClusterCuller/ClusterCuller.hpp"
 #include "Core/Rendering/Mesh/IMeshFactory.hpp"
 #include "Core/Rendering/MeshBuffer/IMeshBufferFactory.hpp"
 #include "Core/Rendering/PingPongBuffer/IPingPongBufferFactory.hpp"
@@ -19,6 +23,7 @@
 #include "Editor/LoadedScene/ILoadedScene.hpp"
 #include "IRenderingPipeline.hpp"
 #include <memory>
+#include <unordered_map>
 
 namespace Dwarf
 {
@@ -29,12 +34,13 @@ namespace Dwarf
   {
   private:
     std::shared_ptr<IShaderSourceCollectionFactory>
-                                        mShaderSourceCollectionFactory;
-    std::shared_ptr<IMeshFactory>       mMeshFactory;
-    std::shared_ptr<IMeshBufferFactory> mMeshBufferFactory;
-    std::shared_ptr<IShaderRegistry>    mShaderRegistry;
-    std::shared_ptr<ILoadedScene>       mLoadedScene;
-    std::shared_ptr<ISkyboxRenderer>    mSkyboxRenderer;
+                                         mShaderSourceCollectionFactory;
+    std::shared_ptr<IMeshFactory>        mMeshFactory;
+    std::shared_ptr<IMeshBufferFactory>  mMeshBufferFactory;
+    std::shared_ptr<IShaderRegistry>     mShaderRegistry;
+    std::shared_ptr<ILoadedScene>        mLoadedScene;
+    std::shared_ptr<ISkyboxRenderer>     mSkyboxRenderer;
+    std::shared_ptr<IGraphicsDebugLayer> mDebugLayer;
 
     std::unique_ptr<IMaterial> mIdMaterial;
     std::shared_ptr<IShader>   mGridShader;
@@ -51,6 +57,106 @@ namespace Dwarf
     std::unique_ptr<IDrawCallList>   mDrawCallList;
     std::unique_ptr<IDrawCallWorker> mDrawCallWorker;
 
+    /// @brief Shader variant of a material compiled for indirect drawing.
+    struct IndirectShaderVariant
+    {
+      /// @brief Shader of the material the variant was created for.
+      std::weak_ptr<IShader> BaseShader;
+
+      std::shared_ptr<IShader> Shader;
+    };
+
+    std::unique_ptr<IIndirectDrawBackend> mIndirectDrawBackend;
+    IndirectDrawBuilder                   mIndirectDrawBuilder;
+    bool                                  mIndirectDrawEnabled = true;
+
+    /// @brief Version of the draw call list the cached placements and
+    /// shader variants belong to.
+    uint64_t mIndirectDrawListVersion = 0;
+
+    std::unordered_map<const IMeshBuffer*,
+                       std::optional<IndirectMeshPlacement>>
+      mMeshPlacements;
+    std::unordered_map<IMaterial*, IndirectShaderVariant> mIndirectShaders;
+
+    /// @brief Triangles rendered in the last frame with the selected LODs.
+    uint32_t mRenderedTriangleCount = 0;
+
+    /// @brief Index ranges of the visible meshlets, reused between draw calls.
+    std::vector<IndexRange> mVisibleRanges;
+
+    /// @brief Mesh renderers inside the camera frustum, reused between frames.
+    std::vector<entt::entity> mVisibleEntities;
+
+    /**
+     * @brief Updates the detail level of a draw call for the given camera
+     *
+     * @param drawCall The draw call to select the detail level of
+     * @param camera The camera the draw call is rendered with
+     * @return The selected detail level
+     */
+    auto
+    SelectLod(IDrawCall& drawCall, ICamera& camera) -> uint32_t;
+
+    /**
+     * @brief Renders a draw call with its own draw call, culling its
+     * meshlets if the full detail level is selected
+     *
+     * @param drawCall The draw call to render
+     * @param lod The selected detail level
+     * @param frustum The culling frustum of the camera
+     * @param camera The camera the draw call is rendered with
+     */
+    void
+    RenderDrawCall(IDrawCall&            drawCall,
+                   uint32_t              lod,
+                   const CullingFrustum& frustum,
+                   ICamera&              camera);
+
+    /**
+     * @brief Adds a draw call to the indirect draws of the frame
+     *
+     * @param drawCall The draw call to add
+     * @param lod The selected detail level
+     * @param frustum The culling frustum of the camera
+     * @return False if the draw call has to be rendered with the per draw
+     * path
+     */
+    auto
+    AddIndirectDraw(IDrawCall&            drawCall,
+                    uint32_t              lod,
+                    const CullingFrustum& frustum) -> bool;
+
+    /**
+     * @brief Retrieves the world matrix of a draw call from the transform
+     * hierarchy of the loaded scene
+     *
+     * @param drawCall The draw call to get the matrix of
+     * @return The world matrix as of the last hierarchy update
+     */
+    auto
+    GetModelMatrix(IDrawCall& drawCall) const -> glm::mat4;
+
+    /**
+     * @brief Retrieves the indirect draw variant of the shader of a material
+     *
+     * @param material The material to get the variant for
+     * @return The compiled variant, nullptr if there is none (yet)
+     */
+    auto
+    GetIndirectShader(IMaterial& material) -> IShader*;
+
+    /**
+     * @brief Retrieves the placement of a mesh in the indirect draw arenas,
+     * adding it on first use
+     *
+     * @param meshBuffer The mesh to get the placement of
+     * @return The placement, empty if the mesh can't be drawn indirectly
+     */
+    auto
+    GetMeshPlacement(const IMeshBuffer& meshBuffer)
+      -> std::optional<IndirectMeshPlacement>;
+
     void
     SetupRenderFramebuffer(
       const std::shared_ptr<IFramebufferFactory>& framebufferFactory);
@@ -85,7 +191,10 @@ namespace Dwarf
       const std::shared_ptr<IMaterialFactory>&    materialFactory,
       const std::shared_ptr<IDrawCallListFactory>&   drawCallListFactory,
       const std::shared_ptr<IDrawCallWorkerFactory>& drawCallWorkerFactory,
-      const std::shared_ptr<IPingPongBufferFactory>& pingPongBufferFactory);
+      const std::shared_ptr<IPingPongBufferFactory>& pingPongBufferFactory,
+      const std::shared_ptr<IIndirectDrawBackendFactory>&
+                                           indirectDrawBackendFactory,
+      std::shared_ptr<IGraphicsDebugLayer> debugLayer);
     ~RenderingPipeline() override;
 
     /**
@@ -198,7 +307,8 @@ namespace Dwarf
     GetVertexCount() const -> uint32_t override;
 
     /**
-     * @brief Gets the total amount of triangles over all draw calls
+     * @brief Gets the amount of triangles rendered in the last frame, taking
+     * the selected detail levels into account
      *
      * @return Triangle count
      */
@@ -213,6 +323,24 @@ namespace Dwarf
     void
     SetTonemapType(TonemapType type) override;
 
+    /**
+     * @brief Enables submitting the opaque draw calls with multi draw
+     * indirect
+     *
+     * @param enabled Whether the indirect path is used
+     */
+    void
+    SetIndirectDrawEnabled(bool enabled) override;
+
+    /**
+     * @brief Returns whether the opaque draw calls are submitted with multi
+     * draw indirect
+     *
+     * @return True if the indirect path is used
+     */
+    [[nodiscard]] auto
+    IsIndirectDrawEnabled() const -> bool override;
+
     void
     OnAntiAliasingSettingsChanged() override;
 
@@ -18,8 +18,11 @@ namespace Dwarf
     std::shared_ptr<IDrawCallListFactory>   drawCallListFactory,
     std::shared_ptr<IDrawCallWorkerFactory> drawCallWorkerFactory,
     std::shared_ptr<IPingPongBufferFactory> pingPongBufferFactory,
-    std::shared_ptr<ILoadedScene>           loadedScene,
-    std::shared_ptr<ISkyboxRenderer>        skyboxRenderer)
+    std::shared_ptr<IIndirectDrawBackendFactory>
+                                         indirectDrawBackendFactory,
+    std::shared_ptr<ILoadedScene>        loadedScene,
+    std::shared_ptr<ISkyboxRenderer>     skyboxRenderer,
+    std::shared_ptr<IGraphicsDebugLayer> debugLayer)
     : mLogger(std::move(logger))
     , mRendererApi(rendererApiFactory->Create())
     , mMaterialFactory(std::move(materialFactory))
@@ -31,8 +34,10 @@ namespace Dwarf
     , mDrawCallListFactory(std::move(drawCallListFactory))
     , mDrawCallWorkerFactory(std::move(drawCallWorkerFactory))
     , mPingPongBufferFactory(std::move(pingPongBufferFactory))
+    , mIndirectDrawBackendFactory(std::move(indirectDrawBackendFactory))
     , mLoadedScene(std::move(loadedScene))
     , mSkyboxRenderer(std::move(skyboxRenderer))
+    , mDebugLayer(std::move(debugLayer))
   {
     mLogger->LogDebug(
       Log("RenderingPipelineFactory created", "RenderingPipelineFactory"));
@@ -59,6 +64,8 @@ namespace Dwarf
                                                mMaterialFactory,
                                                mDrawCallListFactory,
                                                mDrawCallWorkerFactory,
-                                               mPingPongBufferFactory);
+                                               mPingPongBufferFactory,
+                                               mIndirectDrawBackendFactory,
+                                               mDebugLayer);
   }
 } // namespace Dwarf
\ No newline at end of file
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "Core/Asset/Shader/ShaderSourceCollection/IShaderSourceCollectionFactory.hpp"
+#include "Core/Rendering/DebugLayer/IGraphicsDebugLayer.hpp"
 #include "Core/Rendering/DrawCall/DrawCallList/IDrawCallListFactory.hpp"
 #include "Core/Rendering/DrawCall/DrawCallWorker/IDrawCallWorkerFactory.hpp"
 #include "Core/Rendering/Framebuffer/IFramebufferFactory.hpp"
+#include "Core/Rendering/IndirectDraw/IIndirectDrawBackendFactory.hpp"
 #include "Core/Rendering/Material/IMaterialFactory.hpp"
 #include "Core/Rendering/Mesh/IMeshFactory.hpp"
 #include "Core/Rendering/MeshBuffer/IMeshBufferFactory.hpp"
@@ -33,8 +35,11 @@ namespace Dwarf
     std::shared_ptr<IDrawCallListFactory>   mDrawCallListFactory;
     std::shared_ptr<IDrawCallWorkerFactory> mDrawCallWorkerFactory;
     std::shared_ptr<IPingPongBufferFactory> mPingPongBufferFactory;
-    std::shared_ptr<ILoadedScene>           mLoadedScene;
-    std::shared_ptr<ISkyboxRenderer>        mSkyboxRenderer;
+    std::shared_ptr<IIndirectDrawBackendFactory>
+                                         mIndirectDrawBackendFactory;
+    std::shared_ptr<ILoadedScene>        mLoadedScene;
+    std::shared_ptr<ISkyboxRenderer>     mSkyboxRenderer;
+    std::shared_ptr<IGraphicsDebugLayer> mDebugLayer;
 
   public:
     RenderingPipelineFactory(
@@ -50,8 +55,11 @@ namespace Dwarf
       std::shared_ptr<IDrawCallListFactory>   drawCallListFactory,
       std::shared_ptr<IDrawCallWorkerFactory> drawCallWorkerFactory,
       std::shared_ptr<IPingPongBufferFactory> pingPongBufferFactory,
-      std::shared_ptr<ILoadedScene>           loadedScene,
-      std::shared_ptr<ISkyboxRenderer>        skyboxRenderer);
+      std::shared_ptr<IIndirectDrawBackendFactory>
+                                           indirectDrawBackendFactory,
+      std::shared_ptr<ILoadedScene>        loadedScene,
+      std::shared_ptr<ISkyboxRenderer>     skyboxRenderer,
+      std::shared_ptr<IGraphicsDebugLayer> debugLayer);
 
     ~RenderingPipelineFactory() override;
 
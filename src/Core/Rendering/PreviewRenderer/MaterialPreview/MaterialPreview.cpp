@@ -80,7 +80,8 @@ namespace Dwarf
     mRendererApi->RenderIndexed(mMeshBuffer.get(),
                                 material,
                                 *mCamera,
-                                glm::toMat4(mProperties.ModelRotationQuat));
+                                glm::toMat4(mProperties.ModelRotationQuat),
+                                0);
     mRenderFramebuffer->Unbind();
 
     mRendererApi->Blit(*mRenderFramebuffer,
@@ -115,7 +115,8 @@ namespace Dwarf
       mRendererApi->RenderIndexed(mPreviewMeshBuffer.get(),
                                   *mMaterial,
                                   *mCamera,
-                                  glm::toMat4(mProperties.ModelRotationQuat));
+                                  glm::toMat4(mProperties.ModelRotationQuat),
+                                  0);
     }
 
     mRenderFramebuffer->Unbind();
@@ -4,6 +4,7 @@
 #include "Core/Rendering/Material/IMaterial.hpp"
 #include "Core/Rendering/MeshBuffer/IMeshBuffer.hpp"
 #include "Core/Rendering/PingPongBuffer/IPingPongBuffer.hpp"
+#include "Core/Rendering/RendererApi/StateChangeStatistics.hpp"
 #include "Core/Rendering/Shader/IComputeShader.hpp"
 #include "Core/Scene/Camera/ICamera.hpp"
 
@@ -65,12 +66,31 @@ namespace Dwarf
      * @param material Material to render with
      * @param camera Camera to use
      * @param modelMatrix Model matrix of the mesh buffer
+     * @param lod Detail level of the mesh buffer to draw
      */
     virtual void
     RenderIndexed(const IMeshBuffer* mesh,
                   IMaterial&         material,
                   ICamera&           camera,
-                  glm::mat4          modelMatrix) = 0;
+                  glm::mat4          modelMatrix,
+                  uint32_t           lod) = 0;
+
+    /**
+     * @brief Renders multiple index ranges of the full detail level of a mesh
+     * buffer with a single multi draw
+     *
+     * @param mesh Mesh buffer to render
+     * @param material Material to render with
+     * @param camera Camera to use
+     * @param modelMatrix Model matrix of the mesh buffer
+     * @param ranges Index ranges to draw, e.g. the visible meshlets
+     */
+    virtual void
+    RenderIndexedRanges(const IMeshBuffer*             mesh,
+                        IMaterial&                     material,
+                        ICamera&                       camera,
+                        glm::mat4                      modelMatrix,
+                        const std::vector<IndexRange>& ranges) = 0;
 
     virtual void
     RenderSkyboxIndexed(const IMeshBuffer* mesh,
@@ -184,5 +204,21 @@ namespace Dwarf
 
     virtual auto
     GetMaxAnisoLevel() -> uint8_t = 0;
+
+    /**
+     * @brief Returns the state changes requested since the statistics have
+     * been reset. The state is shared by all renderer APIs of a context.
+     *
+     * @return Issued and skipped state changes by kind
+     */
+    [[nodiscard]] virtual auto
+    GetStateChangeStatistics() const -> StateChangeStatistics = 0;
+
+    /**
+     * @brief Resets the state change statistics, usually once per frame
+     *
+     */
+    virtual void
+    ResetStateChangeStatistics() = 0;
   };
 }
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Dwarf
+{
+  /// @brief State changes of one kind that were sent to the graphics API and
+  /// that were skipped because the state was already set.
+  struct StateChangeCounter
+  {
+    uint32_t Issued = 0;
+    uint32_t Skipped = 0;
+  };
+
+  /// @brief State changes requested by the renderer since the statistics have
+  /// been reset.
+  struct StateChangeStatistics
+  {
+    StateChangeCounter Programs;
+    StateChangeCounter Textures;
+    StateChangeCounter VertexArrays;
+    StateChangeCounter Framebuffers;
+    StateChangeCounter Viewports;
+    StateChangeCounter RasterState;
+  };
+}
@@ -32,12 +32,39 @@ namespace Dwarf
     virtual ~IShader() = default;
 
     /**
-     * @brief Compiles the shader program
+     * @brief Compiles the shader program and waits for the result. Finishes
+     * a previously submitted compilation instead of starting a new one.
      *
      */
     virtual void
     Compile() = 0;
 
+    /**
+     * @brief Hands the shader sources to the driver without waiting for the
+     * result. A previously compiled program stays in use until the new one is
+     * ready.
+     *
+     */
+    virtual void
+    SubmitCompilation() = 0;
+
+    /**
+     * @brief Finishes a submitted compilation if the driver is done with it.
+     * Does not block if the driver supports parallel shader compilation.
+     *
+     * @return true if no compilation is pending anymore, false otherwise.
+     */
+    virtual auto
+    PollCompilation() -> bool = 0;
+
+    /**
+     * @brief Returns whether a submitted compilation is still pending.
+     *
+     * @return true if the shader is being compiled, false otherwise.
+     */
+    [[nodiscard]] virtual auto
+    IsCompiling() const -> bool = 0;
+
     /**
      * @brief Returns the compilation status of the shader.
      *
@@ -46,6 +73,24 @@ namespace Dwarf
     [[nodiscard]] virtual auto
     IsCompiled() const -> bool = 0;
 
+    /**
+     * @brief Returns the keywords the shader sources declare. Known once the
+     * compilation has been submitted.
+     *
+     * @return List of the declared keywords
+     */
+    [[nodiscard]] virtual auto
+    GetDeclaredKeywords() const -> const std::vector<std::string>& = 0;
+
+    /**
+     * @brief Returns the files included by the shader sources. Known once the
+     * compilation has been submitted.
+     *
+     * @return List of the included files
+     */
+    [[nodiscard]] virtual auto
+    GetIncludedFiles() const -> const std::vector<std::filesystem::path>& = 0;
+
     /**
      * @brief Sets parameter in the shader
      *
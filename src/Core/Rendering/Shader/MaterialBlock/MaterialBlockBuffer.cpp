@@ -0,0 +1,236 @@
+#include "pch.hpp"
+
+#include "MaterialBlockBuffer.hpp"
+#include <limits>
+
+namespace Dwarf
+{
+  namespace
+  {
+    /// @brief Columns of std430 matrices are aligned like a vec4.
+    constexpr uint32_t MATRIX_COLUMN_STRIDE = sizeof(glm::vec4);
+
+    /// @brief Version of a block that wasn't packed yet, parameter versions
+    /// start at 1.
+    constexpr uint64_t UNPACKED_VERSION = 0;
+
+    /// @brief Version of a block packed from a material without parameters.
+    constexpr uint64_t EMPTY_VERSION = std::numeric_limits<uint64_t>::max();
+
+    template<typename T>
+    constexpr auto
+    GetValueSize() -> uint32_t
+    {
+      if constexpr (std::is_same_v<T, glm::mat3> ||
+                    std::is_same_v<T, glm::mat4>)
+      {
+        return T::length() * MATRIX_COLUMN_STRIDE;
+      }
+      else if constexpr (std::is_same_v<T, bool>)
+      {
+        // Booleans take up a full 32 bit word in a storage buffer
+        return sizeof(uint32_t);
+      }
+      else
+      {
+        return sizeof(T);
+      }
+    }
+
+    template<typename T>
+    void
+    WriteValue(std::span<std::byte>          block,
+               uint32_t                      offset,
+               const MaterialParameterValue& value)
+    {
+      const T* typed = std::get_if<T>(&value);
+      if (typed == nullptr)
+      {
+        return;
+      }
+
+      if constexpr (std::is_same_v<T, glm::mat3> ||
+                    std::is_same_v<T, glm::mat4>)
+      {
+        for (glm::length_t column = 0; column < T::length(); column++)
+        {
+          std::memcpy(block.data() + offset + (column * MATRIX_COLUMN_STRIDE),
+                      &(*typed)[column],
+                      sizeof((*typed)[column]));
+        }
+      }
+      else if constexpr (std::is_same_v<T, bool>)
+      {
+        uint32_t word = *typed ? 1 : 0;
+        std::memcpy(block.data() + offset, &word, sizeof(word));
+      }
+      else
+      {
+        std::memcpy(block.data() + offset, typed, sizeof(T));
+      }
+    }
+
+    /// @brief Returns the writer of a member, or nullptr if the member can't
+    /// be written into a block of the given stride.
+    template<typename T>
+    auto
+    GetWriter(const MaterialBlockMember& member, uint32_t stride)
+      -> MaterialBlockWriter
+    {
+      if (member.Offset + GetValueSize<T>() > stride)
+      {
+        return nullptr;
+      }
+      return &WriteValue<T>;
+    }
+
+    auto
+    GetMemberWriter(const MaterialBlockMember& member, uint32_t stride)
+      -> MaterialBlockWriter
+    {
+      switch (member.Type)
+      {
+        using enum ShaderParameterType;
+        case FLOAT: return GetWriter<float>(member, stride);
+        case VEC2: return GetWriter<glm::vec2>(member, stride);
+        case VEC3: return GetWriter<glm::vec3>(member, stride);
+        case VEC4: return GetWriter<glm::vec4>(member, stride);
+        case INTEGER: return GetWriter<int>(member, stride);
+        case IVEC2: return GetWriter<glm::ivec2>(member, stride);
+        case IVEC3: return GetWriter<glm::ivec3>(member, stride);
+        case IVEC4: return GetWriter<glm::ivec4>(member, stride);
+        case UNSIGNED_INTEGER: return GetWriter<uint32_t>(member, stride);
+        case UVEC2: return GetWriter<glm::uvec2>(member, stride);
+        case UVEC3: return GetWriter<glm::uvec3>(member, stride);
+        case UVEC4: return GetWriter<glm::uvec4>(member, stride);
+        case BOOLEAN: return GetWriter<bool>(member, stride);
+        case MAT3: return GetWriter<glm::mat3>(member, stride);
+        case MAT4: return GetWriter<glm::mat4>(member, stride);
+        // Samplers can't be stored in a buffer, they stay uniforms
+        case TEX2D: return nullptr;
+      }
+      return nullptr;
+    }
+  }
+
+  MaterialBlockBuffer::MaterialBlockBuffer(MaterialBlockLayout layout)
+    : mLayout(std::move(layout))
+    , mMembers(ResolveMembers(mLayout))
+  {
+  }
+
+  auto
+  MaterialBlockBuffer::ResolveMembers(const MaterialBlockLayout& layout)
+    -> std::vector<ResolvedMember>
+  {
+    std::vector<ResolvedMember> members;
+    members.reserve(layout.Members.size());
+    for (const MaterialBlockMember& member : layout.Members)
+    {
+      MaterialBlockWriter writer = GetMemberWriter(member, layout.Stride);
+      if (writer != nullptr)
+      {
+        members.push_back({ member.Name, member.Offset, writer });
+      }
+    }
+    return members;
+  }
+
+  void
+  MaterialBlockBuffer::PackMembers(std::span<const ResolvedMember>   members,
+                                   const IShaderParameterCollection& parameters,
+                                   std::span<std::byte>              block)
+  {
+    std::ranges::fill(block, std::byte{ 0 });
+
+    for (const ResolvedMember& member : members)
+    {
+      const MaterialParameterValue* value =
+        parameters.FindParameter(member.Name);
+      if (value != nullptr)
+      {
+        member.Write(block, member.Offset, *value);
+      }
+    }
+  }
+
+  void
+  MaterialBlockBuffer::Pack(const MaterialBlockLayout&        layout,
+                            const IShaderParameterCollection& parameters,
+                            std::span<std::byte>              block)
+  {
+    PackMembers(ResolveMembers(layout), parameters, block.first(layout.Stride));
+  }
+
+  auto
+  MaterialBlockBuffer::Update(std::span<IMaterial* const> materials)
+    -> std::optional<MaterialBlockRange>
+  {
+    size_t stride = mLayout.Stride;
+    if (stride == 0)
+    {
+      return std::nullopt;
+    }
+
+    mData.resize(materials.size() * stride);
+    mVersions.resize(materials.size(), UNPACKED_VERSION);
+    mScratch.resize(stride);
+
+    std::optional<size_t> firstChanged;
+    size_t                lastChanged = 0;
+    for (size_t index = 0; index < materials.size(); index++)
+    {
+      const std::unique_ptr<IShaderParameterCollection>& parameters =
+        materials[index]->GetShaderParameters();
+      uint64_t version =
+        parameters != nullptr ? parameters->GetVersion() : EMPTY_VERSION;
+      if (mVersions[index] == version)
+      {
+        continue;
+      }
+
+      if (parameters != nullptr)
+      {
+        PackMembers(mMembers, *parameters, mScratch);
+      }
+      else
+      {
+        std::ranges::fill(mScratch, std::byte{ 0 });
+      }
+
+      // A new version doesn't always mean new values, e.g. when a parameter
+      // was only read through the mutable accessor
+      std::span<std::byte> block(mData.data() + (index * stride), stride);
+      bool changed = mVersions[index] == UNPACKED_VERSION ||
+                     !std::ranges::equal(block, mScratch);
+      mVersions[index] = version;
+      if (changed)
+      {
+        std::ranges::copy(mScratch, block.begin());
+        firstChanged = firstChanged.value_or(index);
+        lastChanged = index;
+      }
+    }
+
+    if (!firstChanged.has_value())
+    {
+      return std::nullopt;
+    }
+    return MaterialBlockRange{
+      static_cast<uint32_t>(firstChanged.value() * stride),
+      static_cast<uint32_t>((lastChanged + 1 - firstChanged.value()) * stride)
+    };
+  }
+
+  auto
+  MaterialBlockBuffer::GetData() const -> std::span<const std::byte>
+  {
+    return mData;
+  }
+
+  auto
+  MaterialBlockBuffer::GetLayout() const -> const MaterialBlockLayout&
+  {
+    return mLayout;
+  }
+}
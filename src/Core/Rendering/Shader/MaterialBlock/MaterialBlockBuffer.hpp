@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Core/Rendering/Material/IMaterial.hpp"
+#include "Core/Rendering/Shader/MaterialBlock/MaterialBlockLayout.hpp"
+#include <optional>
+#include <span>
+
+namespace Dwarf
+{
+  /// @brief Byte range of a material buffer that has to be uploaded.
+  struct MaterialBlockRange
+  {
+    uint32_t Offset = 0;
+    uint32_t Size = 0;
+  };
+
+  /// @brief Writes a parameter into a block at a byte offset, if it has the
+  /// type of the member.
+  using MaterialBlockWriter = void (*)(std::span<std::byte>,
+                                       uint32_t,
+                                       const MaterialParameterValue&);
+
+  /// @brief CPU copy of the material parameter blocks of a shader. The blocks
+  /// are packed with the reflected layout, so the graphics API only has to
+  /// upload the bytes that changed since the last update.
+  class MaterialBlockBuffer
+  {
+  private:
+    /// @brief A block member with the writer for its type, resolved once when
+    /// the buffer of a shader is created.
+    struct ResolvedMember
+    {
+      std::string         Name;
+      uint32_t            Offset = 0;
+      MaterialBlockWriter Write = nullptr;
+    };
+
+    MaterialBlockLayout         mLayout;
+    std::vector<ResolvedMember> mMembers;
+    std::vector<std::byte>      mData;
+    std::vector<std::byte>      mScratch;
+
+    /// @brief Parameter version each block was packed from, so unchanged
+    /// materials are skipped.
+    std::vector<uint64_t> mVersions;
+
+    static auto
+    ResolveMembers(const MaterialBlockLayout& layout)
+      -> std::vector<ResolvedMember>;
+
+    static void
+    PackMembers(std::span<const ResolvedMember>   members,
+                const IShaderParameterCollection& parameters,
+                std::span<std::byte>              block);
+
+  public:
+    explicit MaterialBlockBuffer(MaterialBlockLayout layout);
+
+    /**
+     * @brief Packs the parameters of a material into a block. Parameters the
+     * material doesn't have, or has with a different type, are zeroed.
+     *
+     * @param layout Layout of the block
+     * @param parameters Parameters of the material
+     * @param block Destination, at least as large as the stride of the layout
+     */
+    static void
+    Pack(const MaterialBlockLayout&        layout,
+         const IShaderParameterCollection& parameters,
+         std::span<std::byte>              block);
+
+    /**
+     * @brief Packs the blocks of the materials, the index of a material in
+     * the list is its index in the buffer. Materials whose parameters kept
+     * their version since the last update are not packed again.
+     *
+     * @param materials Materials drawn with the shader
+     * @return Range that changed since the last update, empty if the buffer
+     * is unchanged
+     */
+    auto
+    Update(std::span<IMaterial* const> materials)
+      -> std::optional<MaterialBlockRange>;
+
+    /**
+     * @brief Returns the packed blocks of all materials
+     *
+     * @return The buffer content
+     */
+    [[nodiscard]] auto
+    GetData() const -> std::span<const std::byte>;
+
+    /**
+     * @brief Returns the layout the blocks are packed with
+     *
+     * @return The block layout
+     */
+    [[nodiscard]] auto
+    GetLayout() const -> const MaterialBlockLayout&;
+  };
+}
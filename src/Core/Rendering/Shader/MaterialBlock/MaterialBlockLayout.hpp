@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Core/Base.hpp"
+
+namespace Dwarf
+{
+  /// @brief Name of the storage block holding the material parameters of the
+  /// multi draw indirect path.
+  constexpr std::string_view MATERIAL_BLOCK_NAME = "DwarfMaterialBuffer";
+
+  /// @brief Binding point of the material storage block, the per draw data
+  /// uses binding 0.
+  constexpr uint32_t MATERIAL_BLOCK_BINDING = 1;
+
+  /// @brief A material parameter stored in the material block.
+  struct MaterialBlockMember
+  {
+    /// @brief Name of the parameter, matching the identifier in the shader
+    /// parameter collection of a material.
+    std::string Name;
+
+    ShaderParameterType Type = ShaderParameterType::FLOAT;
+
+    /// @brief Byte offset of the parameter inside the block of a material.
+    uint32_t Offset = 0;
+  };
+
+  /// @brief std430 layout of the per material parameter block of a shader,
+  /// as reflected from the compiled program.
+  struct MaterialBlockLayout
+  {
+    std::vector<MaterialBlockMember> Members;
+
+    /// @brief Distance in bytes between the blocks of two materials.
+    uint32_t Stride = 0;
+  };
+}
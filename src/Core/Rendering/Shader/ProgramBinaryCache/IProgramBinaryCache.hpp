@@ -0,0 +1,121 @@
+#pragma once
+
+#include <chrono>
+#include <fmt/format.h>
+
+namespace Dwarf
+{
+  /// @brief 128 bit hash identifying a linked shader program.
+  struct ProgramBinaryKey
+  {
+    uint64_t High = 0;
+    uint64_t Low = 0;
+
+    /**
+     * @brief Formats the key as a 32 character hexadecimal string
+     *
+     * @return The hexadecimal representation of the key
+     */
+    [[nodiscard]] auto
+    ToString() const -> std::string
+    {
+      return fmt::format("{:016x}{:016x}", High, Low);
+    }
+
+    auto
+    operator==(const ProgramBinaryKey& other) const -> bool = default;
+  };
+
+  /// @brief Driver specific binary of a linked shader program.
+  struct ProgramBinary
+  {
+    /// @brief Driver specific format of the binary.
+    uint32_t Format = 0;
+
+    /// @brief Binary data as returned by the driver.
+    std::vector<uint8_t> Data;
+
+    /// @brief Serialized ShaderReflection of the program, so programs loaded
+    /// from the cache don't have to be reflected again.
+    std::vector<uint8_t> Reflection;
+
+    /// @brief Time it took to compile and link the program from source.
+    std::chrono::microseconds CompileTime{ 0 };
+  };
+
+  /// @brief Usage statistics of a program binary cache.
+  struct ProgramBinaryCacheStatistics
+  {
+    /// @brief Programs created from a cached binary.
+    uint32_t Hits = 0;
+
+    /// @brief Programs compiled from source.
+    uint32_t Misses = 0;
+
+    /// @brief Compile time saved by the cache hits.
+    std::chrono::microseconds SavedTime{ 0 };
+  };
+
+  /**
+   * @brief Persistent cache of linked shader program binaries. Binaries are
+   * only valid for the driver that produced them, so the key has to include
+   * the driver identification besides the sources.
+   */
+  class IProgramBinaryCache
+  {
+  public:
+    virtual ~IProgramBinaryCache() = default;
+
+    /**
+     * @brief Loads a cached binary. Corrupted entries or entries written by a
+     * different cache version are removed and reported as missing.
+     *
+     * @param key Key of the program
+     * @return The binary if a valid entry exists
+     */
+    [[nodiscard]] virtual auto
+    Load(const ProgramBinaryKey& key) -> std::optional<ProgramBinary> = 0;
+
+    /**
+     * @brief Stores the binary of a program
+     *
+     * @param key Key of the program
+     * @param binary Binary to store
+     */
+    virtual void
+    Store(const ProgramBinaryKey& key, const ProgramBinary& binary) = 0;
+
+    /**
+     * @brief Removes the entry of a program, e.g. when the driver rejected
+     * the cached binary
+     *
+     * @param key Key of the program
+     */
+    virtual void
+    Remove(const ProgramBinaryKey& key) = 0;
+
+    /**
+     * @brief Records that a program was created from a cached binary
+     *
+     * @param binary The cached binary that was used
+     * @param loadTime Time it took to create the program from the binary
+     */
+    virtual void
+    RecordHit(const ProgramBinary&      binary,
+              std::chrono::microseconds loadTime) = 0;
+
+    /**
+     * @brief Records that a program had to be compiled from source
+     */
+    virtual void
+    RecordMiss() = 0;
+
+    /**
+     * @brief Retrieves the usage statistics of the cache
+     *
+     * @return The statistics since the cache was created
+     */
+    [[nodiscard]] virtual auto
+    GetStatistics() const -> ProgramBinaryCacheStatistics = 0;
+  };
+}
@@ -0,0 +1,230 @@
+#include "pch.hpp"
+
+#include "ProgramBinaryCache.hpp"
+#include "Utilities/ContentHash.hpp"
+
+namespace Dwarf
+{
+  namespace
+  {
+    /// @brief Identifies program binary cache entries ("DWPB").
+    constexpr uint32_t CACHE_MAGIC = 0x42505744;
+
+    /// @brief Header preceding the binary data and the reflection of a
+    /// cache entry.
+    struct ProgramBinaryHeader
+    {
+      uint32_t Magic = CACHE_MAGIC;
+      uint32_t Version = ProgramBinaryCache::CACHE_VERSION;
+      uint32_t Format = 0;
+      uint32_t Reserved = 0;
+      uint64_t CompileTimeMicroseconds = 0;
+      uint64_t DataSize = 0;
+      uint64_t ReflectionSize = 0;
+      uint64_t Checksum = 0;
+    };
+
+    /// @brief Checksum over the binary data and the reflection.
+    auto
+    ComputeChecksum(const ProgramBinary& binary) -> uint64_t
+    {
+      return XXH3_64bits_withSeed(
+        binary.Reflection.data(),
+        binary.Reflection.size(),
+        XXH3_64bits(binary.Data.data(), binary.Data.size()));
+    }
+  }
+
+  ProgramBinaryCache::ProgramBinaryCache(
+    const ProjectPath&            projectPath,
+    std::shared_ptr<IDwarfLogger> logger)
+    : mLogger(std::move(logger))
+    , mCacheDirectory(projectPath.t / CACHE_DIRECTORY)
+  {
+    mLogger->LogDebug(Log("ProgramBinaryCache created", "ProgramBinaryCache"));
+  }
+
+  ProgramBinaryCache::~ProgramBinaryCache()
+  {
+    ProgramBinaryCacheStatistics stats = GetStatistics();
+    uint32_t                     total = stats.Hits + stats.Misses;
+    if (total > 0)
+    {
+      mLogger->LogInfo(Log(
+        fmt::format("{} of {} programs loaded from cache ({:.1f}% hit rate), "
+                    "saved {:.1f} ms of compile time",
+                    stats.Hits,
+                    total,
+                    100.0 * stats.Hits / total,
+                    static_cast<double>(stats.SavedTime.count()) / 1000.0),
+        "ProgramBinaryCache"));
+    }
+    mLogger->LogDebug(
+      Log("ProgramBinaryCache destroyed", "ProgramBinaryCache"));
+  }
+
+  auto
+  ProgramBinaryCache::ComputeKey(const std::vector<std::string_view>& parts)
+    -> ProgramBinaryKey
+  {
+    ContentHashBuilder builder;
+    for (std::string_view part : parts)
+    {
+      builder.Add(part);
+    }
+    ContentHash hash = builder.GetHash();
+
+    return { hash.High, hash.Low };
+  }
+
+  auto
+  ProgramBinaryCache::GetEntryPath(const ProgramBinaryKey& key) const
+    -> std::filesystem::path
+  {
+    return mCacheDirectory / (key.ToString() + ".bin");
+  }
+
+  auto
+  ProgramBinaryCache::Load(const ProgramBinaryKey& key)
+    -> std::optional<ProgramBinary>
+  {
+    std::filesystem::path path = GetEntryPath(key);
+    std::ifstream         file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+      return std::nullopt;
+    }
+
+    std::error_code     error;
+    uintmax_t           fileSize = std::filesystem::file_size(path, error);
+    ProgramBinaryHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    // The size check also guards the allocation against corrupted headers
+    bool valid = !error && file.good() && header.Magic == CACHE_MAGIC &&
+                 header.Version == CACHE_VERSION &&
+                 header.DataSize <= fileSize - sizeof(header) &&
+                 header.ReflectionSize ==
+                   fileSize - sizeof(header) - header.DataSize;
+
+    ProgramBinary binary;
+    if (valid)
+    {
+      binary.Format = header.Format;
+      binary.CompileTime =
+        std::chrono::microseconds(header.CompileTimeMicroseconds);
+      binary.Data.resize(header.DataSize);
+      file.read(reinterpret_cast<char*>(binary.Data.data()),
+                static_cast<std::streamsize>(binary.Data.size()));
+      binary.Reflection.resize(header.ReflectionSize);
+      file.read(reinterpret_cast<char*>(binary.Reflection.data()),
+                static_cast<std::streamsize>(binary.Reflection.size()));
+
+      valid = file.good() && ComputeChecksum(binary) == header.Checksum;
+    }
+    file.close();
+
+    if (!valid)
+    {
+      mLogger->LogWarn(
+        Log(fmt::format("Discarding invalid program binary {}", path.string()),
+            "ProgramBinaryCache"));
+      Remove(key);
+      return std::nullopt;
+    }
+
+    return binary;
+  }
+
+  void
+  ProgramBinaryCache::Store(const ProgramBinaryKey& key,
+                            const ProgramBinary&    binary)
+  {
+    std::error_code error;
+    std::filesystem::create_directories(mCacheDirectory, error);
+    if (error)
+    {
+      mLogger->LogWarn(Log(fmt::format("Failed to create {}: {}",
+                                       mCacheDirectory.string(),
+                                       error.message()),
+                           "ProgramBinaryCache"));
+      return;
+    }
+
+    ProgramBinaryHeader header;
+    header.Format = binary.Format;
+    header.CompileTimeMicroseconds = binary.CompileTime.count();
+    header.DataSize = binary.Data.size();
+    header.ReflectionSize = binary.Reflection.size();
+    header.Checksum = ComputeChecksum(binary);
+
+    // Write to a temporary file first so a crash never leaves a partial entry
+    std::filesystem::path path = GetEntryPath(key);
+    std::filesystem::path temporaryPath = path;
+    temporaryPath += ".tmp";
+    {
+      std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+      file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      file.write(reinterpret_cast<const char*>(binary.Data.data()),
+                 static_cast<std::streamsize>(binary.Data.size()));
+      file.write(reinterpret_cast<const char*>(binary.Reflection.data()),
+                 static_cast<std::streamsize>(binary.Reflection.size()));
+      if (!file.good())
+      {
+        mLogger->LogWarn(
+          Log(fmt::format("Failed to write {}", temporaryPath.string()),
+              "ProgramBinaryCache"));
+        file.close();
+        std::filesystem::remove(temporaryPath, error);
+        return;
+      }
+    }
+
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error)
+    {
+      mLogger->LogWarn(Log(fmt::format("Failed to store {}: {}",
+                                       path.string(),
+                                       error.message()),
+                           "ProgramBinaryCache"));
+      std::filesystem::remove(temporaryPath, error);
+    }
+  }
+
+  void
+  ProgramBinaryCache::Remove(const ProgramBinaryKey& key)
+  {
+    std::error_code error;
+    std::filesystem::remove(GetEntryPath(key), error);
+  }
+
+  void
+  ProgramBinaryCache::RecordHit(const ProgramBinary&      binary,
+                                std::chrono::microseconds loadTime)
+  {
+    std::chrono::microseconds saved =
+      std::max(binary.CompileTime - loadTime, std::chrono::microseconds(0));
+
+    std::lock_guard<std::mutex> lock(mStatisticsMutex);
+    mStatistics.Hits++;
+    mStatistics.SavedTime += saved;
+    mLogger->LogDebug(
+      Log(fmt::format("Program loaded from cache, saved {:.2f} ms",
+                      static_cast<double>(saved.count()) / 1000.0),
+          "ProgramBinaryCache"));
+  }
+
+  void
+  ProgramBinaryCache::RecordMiss()
+  {
+    std::lock_guard<std::mutex> lock(mStatisticsMutex);
+    mStatistics.Misses++;
+  }
+
+  auto
+  ProgramBinaryCache::GetStatistics() const -> ProgramBinaryCacheStatistics
+  {
+    std::lock_guard<std::mutex> lock(mStatisticsMutex);
+    return mStatistics;
+  }
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "IProgramBinaryCache.hpp"
+#include "Logging/IDwarfLogger.hpp"
+#include "Project/ProjectTypes.hpp"
+#include <boost/di.hpp>
+#include <mutex>
+
+namespace Dwarf
+{
+  /// @brief Program binary cache storing one file per program in the cache
+  /// directory of the project.
+  class ProgramBinaryCache : public IProgramBinaryCache
+  {
+  private:
+    std::shared_ptr<IDwarfLogger> mLogger;
+    std::filesystem::path         mCacheDirectory;
+    ProgramBinaryCacheStatistics  mStatistics;
+    mutable std::mutex            mStatisticsMutex;
+
+    [[nodiscard]] auto
+    GetEntryPath(const ProgramBinaryKey& key) const -> std::filesystem::path;
+
+  public:
+    /// @brief Version of the entry layout. Entries of other versions are
+    /// discarded.
+    static constexpr uint32_t CACHE_VERSION = 2;
+
+    /// @brief Directory of the cache relative to the project directory.
+    static constexpr const char* CACHE_DIRECTORY = "Cache/ProgramBinaries";
+
+    BOOST_DI_INJECT(ProgramBinaryCache,
+                    const ProjectPath&            projectPath,
+                    std::shared_ptr<IDwarfLogger> logger);
+    ~ProgramBinaryCache() override;
+
+    /**
+     * @brief Computes the key of a program. Every part is hashed with its
+     * length, so moving text between parts changes the key.
+     *
+     * @param parts Sources, defines and driver identification of the program
+     * @return The key of the program
+     */
+    [[nodiscard]] static auto
+    ComputeKey(const std::vector<std::string_view>& parts) -> ProgramBinaryKey;
+
+    /**
+     * @brief Loads a cached binary. Corrupted entries or entries written by a
+     * different cache version are removed and reported as missing.
+     *
+     * @param key Key of the program
+     * @return The binary if a valid entry exists
+     */
+    [[nodiscard]] auto
+    Load(const ProgramBinaryKey& key) -> std::optional<ProgramBinary> override;
+
+    /**
+     * @brief Stores the binary of a program
+     *
+     * @param key Key of the program
+     * @param binary Binary to store
+     */
+    void
+    Store(const ProgramBinaryKey& key, const ProgramBinary& binary) override;
+
+    /**
+     * @brief Removes the entry of a program, e.g. when the driver rejected
+     * the cached binary
+     *
+     * @param key Key of the program
+     */
+    void
+    Remove(const ProgramBinaryKey& key) override;
+
+    /**
+     * @brief Records that a program was created from a cached binary
+     *
+     * @param binary The cached binary that was used
+     * @param loadTime Time it took to create the program from the binary
+     */
+    void
+    RecordHit(const ProgramBinary&      binary,
+              std::chrono::microseconds loadTime) override;
+
+    /**
+     * @brief Records that a program had to be compiled from source
+     */
+    void
+    RecordMiss() override;
+
+    /**
+     * @brief Retrieves the usage statistics of the cache
+     *
+     * @return The statistics since the cache was created
+     */
+    [[nodiscard]] auto
+    GetStatistics() const -> ProgramBinaryCacheStatistics override;
+  };
+}
@@ -12,14 +12,18 @@ namespace Dwarf
     std::shared_ptr<IShaderSourceCollectionFactory>
       shaderSourceCollectionFactory,
     std::shared_ptr<IShaderParameterCollectionFactory>
-                                  shaderParameterCollectionFactory,
-    std::shared_ptr<IVramTracker> vramTracker)
+                                         shaderParameterCollectionFactory,
+    std::shared_ptr<IVramTracker>        vramTracker,
+    std::shared_ptr<IProgramBinaryCache> programBinaryCache,
+    std::shared_ptr<IShaderPreprocessor> shaderPreprocessor)
     : mGraphicsApi(graphicsApi)
     , mLogger(std::move(logger))
     , mShaderSourceCollectionFactory(std::move(shaderSourceCollectionFactory))
     , mShaderParameterCollectionFactory(
         std::move(shaderParameterCollectionFactory))
     , mVramTracker(std::move(vramTracker))
+    , mProgramBinaryCache(std::move(programBinaryCache))
+    , mShaderPreprocessor(std::move(shaderPreprocessor))
   {
     mLogger->LogDebug(Log("ShaderFactory created", "ShaderFactory"));
   }
@@ -46,7 +50,9 @@ namespace Dwarf
         return std::make_shared<OpenGLShader>(std::move(shaderSources),
                                               mShaderParameterCollectionFactory,
                                               mLogger,
-                                              mVramTracker);
+                                              mVramTracker,
+                                              mProgramBinaryCache,
+                                              mShaderPreprocessor);
       case Vulkan:
         mLogger->LogError(
           Log("Vulkan API has not been implemented yet", "ShaderFactory"));
@@ -1,8 +1,10 @@
 #pragma once
 
+#include "Core/Asset/Shader/ShaderPreprocessor/IShaderPreprocessor.hpp"
 #include "Core/Asset/Shader/ShaderSourceCollection/IShaderSourceCollectionFactory.hpp"
 #include "Core/Base.hpp"
 #include "Core/Rendering/Shader/IShader.hpp"
+#include "Core/Rendering/Shader/ProgramBinaryCache/IProgramBinaryCache.hpp"
 #include "Core/Rendering/Shader/ShaderParameterCollection/IShaderParameterCollectionFactory.hpp"
 #include "Core/Rendering/VramTracker/IVramTracker.hpp"
 #include "IShaderFactory.hpp"
@@ -18,8 +20,10 @@ namespace Dwarf
     std::shared_ptr<IShaderSourceCollectionFactory>
       mShaderSourceCollectionFactory;
     std::shared_ptr<IShaderParameterCollectionFactory>
-                                  mShaderParameterCollectionFactory;
-    std::shared_ptr<IVramTracker> mVramTracker;
+                                         mShaderParameterCollectionFactory;
+    std::shared_ptr<IVramTracker>        mVramTracker;
+    std::shared_ptr<IProgramBinaryCache> mProgramBinaryCache;
+    std::shared_ptr<IShaderPreprocessor> mShaderPreprocessor;
 
   public:
     ShaderFactory(GraphicsApi                   graphicsApi,
@@ -28,7 +32,9 @@ namespace Dwarf
                     shaderSourceCollectionFactory,
                   std::shared_ptr<IShaderParameterCollectionFactory>
                     shaderParameterCollectionFactory,
-                  std::shared_ptr<IVramTracker> vramTracker);
+                  std::shared_ptr<IVramTracker>        vramTracker,
+                  std::shared_ptr<IProgramBinaryCache> programBinaryCache,
+                  std::shared_ptr<IShaderPreprocessor> shaderPreprocessor);
     ~ShaderFactory() override;
 
     /**
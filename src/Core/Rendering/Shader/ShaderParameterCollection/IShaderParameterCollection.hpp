@@ -45,11 +45,31 @@ namespace Dwarf
                  MaterialParameterValue parameter) = 0;
 
     /**
-     * @brief Gets a parameter from the collection.
+     * @brief Gets a parameter from the collection. The parameter can be edited
+     * in place, so this counts as a change of the collection.
      */
     virtual auto
     GetParameter(const std::string& name) -> MaterialParameterValue& = 0;
 
+    /**
+     * @brief Gets a parameter for reading, without changing the version.
+     *
+     * @param name Name of the parameter
+     * @return The parameter, nullptr if it isn't present
+     */
+    [[nodiscard]] virtual auto
+    FindParameter(const std::string& name) const
+      -> const MaterialParameterValue* = 0;
+
+    /**
+     * @brief Returns the version of the parameters. It changes whenever a
+     * parameter may have changed, and is never shared by two collections.
+     *
+     * @return The current version
+     */
+    [[nodiscard]] virtual auto
+    GetVersion() const -> uint64_t = 0;
+
     /**
      * @brief Gets the list of parameter identifiers.
      */
@@ -2,21 +2,62 @@
 
 #include "ShaderParameterCollection.hpp"
 #include "Utilities/JsonHelper/JsonHelper.hpp"
+#include <atomic>
 
 namespace Dwarf
 {
+  namespace
+  {
+    /// @brief Versions are drawn from one counter, so a new collection never
+    /// reuses the version of another one.
+    auto
+    NextVersion() -> uint64_t
+    {
+      static std::atomic<uint64_t> sVersionCounter = 0;
+      return ++sVersionCounter;
+    }
+  }
+
+  ShaderParameterCollection::ShaderParameterCollection()
+    : mVersion(NextVersion())
+  {
+  }
+
+  void
+  ShaderParameterCollection::MarkChanged()
+  {
+    mVersion = NextVersion();
+  }
+
   void
   ShaderParameterCollection::SetParameter(std::string_view       identifier,
                                           MaterialParameterValue parameter)
   {
     mParameters[identifier.data()] = std::move(parameter);
+    MarkChanged();
   }
 
   auto
   ShaderParameterCollection::GetParameter(const std::string& name)
     -> MaterialParameterValue&
   {
-    return mParameters.at(name);
+    MaterialParameterValue& parameter = mParameters.at(name);
+    MarkChanged();
+    return parameter;
+  }
+
+  auto
+  ShaderParameterCollection::FindParameter(const std::string& name) const
+    -> const MaterialParameterValue*
+  {
+    auto parameter = mParameters.find(name);
+    return parameter != mParameters.end() ? &parameter->second : nullptr;
+  }
+
+  auto
+  ShaderParameterCollection::GetVersion() const -> uint64_t
+  {
+    return mVersion;
   }
 
   auto
@@ -62,6 +103,7 @@ namespace Dwarf
   ShaderParameterCollection::RemoveParameter(std::string const& name)
   {
     mParameters.erase(name);
+    MarkChanged();
   }
 
   auto
@@ -74,6 +116,7 @@ namespace Dwarf
   ShaderParameterCollection::ClearParameters()
   {
     mParameters.clear();
+    MarkChanged();
   }
 
   auto
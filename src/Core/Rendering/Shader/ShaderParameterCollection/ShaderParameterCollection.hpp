@@ -8,9 +8,16 @@ namespace Dwarf
   {
   private:
     std::map<std::string, MaterialParameterValue> mParameters;
+    uint64_t                                      mVersion;
+
+    /**
+     * @brief Moves the collection to a new version after a change.
+     */
+    void
+    MarkChanged();
 
   public:
-    ShaderParameterCollection() = default;
+    ShaderParameterCollection();
     ~ShaderParameterCollection() override = default;
 
     /**
@@ -21,11 +28,31 @@ namespace Dwarf
                  MaterialParameterValue parameter) override;
 
     /**
-     * @brief Gets a parameter from the collection.
+     * @brief Gets a parameter from the collection. The parameter can be edited
+     * in place, so this counts as a change of the collection.
      */
     auto
     GetParameter(const std::string& name) -> MaterialParameterValue& override;
 
+    /**
+     * @brief Gets a parameter for reading, without changing the version.
+     *
+     * @param name Name of the parameter
+     * @return The parameter, nullptr if it isn't present
+     */
+    [[nodiscard]] auto
+    FindParameter(const std::string& name) const
+      -> const MaterialParameterValue* override;
+
+    /**
+     * @brief Returns the version of the parameters. It changes whenever a
+     * parameter may have changed, and is never shared by two collections.
+     *
+     * @return The current version
+     */
+    [[nodiscard]] auto
+    GetVersion() const -> uint64_t override;
+
     /**
      * @brief Gets the list of parameter identifiers.
      */
@@ -0,0 +1,207 @@
+#include "pch.hpp"
+
+#include "ShaderReflection.hpp"
+
+namespace Dwarf
+{
+  namespace
+  {
+    /// @brief Stored instead of a type for uniforms without parameter type.
+    constexpr uint32_t NO_TYPE = std::numeric_limits<uint32_t>::max();
+
+    class ReflectionWriter
+    {
+    private:
+      std::vector<uint8_t>& mData;
+
+    public:
+      explicit ReflectionWriter(std::vector<uint8_t>& data)
+        : mData(data)
+      {
+      }
+
+      template<typename T>
+      void
+      Write(T value)
+      {
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+        mData.insert(mData.end(), bytes, bytes + sizeof(T));
+      }
+
+      void
+      WriteString(std::string_view value)
+      {
+        Write(static_cast<uint32_t>(value.size()));
+        mData.insert(mData.end(), value.begin(), value.end());
+      }
+
+      void
+      WriteType(std::optional<ShaderParameterType> type)
+      {
+        Write(type.has_value() ? static_cast<uint32_t>(type.value())
+                               : NO_TYPE);
+      }
+    };
+
+    class ReflectionReader
+    {
+    private:
+      std::span<const uint8_t> mData;
+      size_t                   mPosition = 0;
+
+    public:
+      explicit ReflectionReader(std::span<const uint8_t> data)
+        : mData(data)
+      {
+      }
+
+      template<typename T>
+      auto
+      Read(T& value) -> bool
+      {
+        if (mData.size() - mPosition < sizeof(T))
+        {
+          return false;
+        }
+        std::memcpy(&value, mData.data() + mPosition, sizeof(T));
+        mPosition += sizeof(T);
+        return true;
+      }
+
+      auto
+      ReadString(std::string& value) -> bool
+      {
+        uint32_t length = 0;
+        if (!Read(length) || mData.size() - mPosition < length)
+        {
+          return false;
+        }
+        value.assign(reinterpret_cast<const char*>(mData.data() + mPosition),
+                     length);
+        mPosition += length;
+        return true;
+      }
+
+      auto
+      ReadType(std::optional<ShaderParameterType>& type) -> bool
+      {
+        uint32_t value = 0;
+        if (!Read(value) ||
+            (value != NO_TYPE &&
+             value > static_cast<uint32_t>(ShaderParameterType::TEX2D)))
+        {
+          return false;
+        }
+        type = value == NO_TYPE
+                 ? std::nullopt
+                 : std::optional(static_cast<ShaderParameterType>(value));
+        return true;
+      }
+
+      [[nodiscard]] auto
+      IsAtEnd() const -> bool
+      {
+        return mPosition == mData.size();
+      }
+    };
+  }
+
+  auto
+  ShaderReflection::FindUniform(std::string_view name) const
+    -> const ShaderUniform*
+  {
+    auto uniform =
+      std::ranges::lower_bound(Uniforms, name, {}, &ShaderUniform::Name);
+    return uniform != Uniforms.end() && uniform->Name == name ? &*uniform
+                                                              : nullptr;
+  }
+
+  auto
+  ShaderReflection::Serialize() const -> std::vector<uint8_t>
+  {
+    std::vector<uint8_t> data;
+    ReflectionWriter     writer(data);
+
+    writer.Write(static_cast<uint32_t>(Uniforms.size()));
+    for (const ShaderUniform& uniform : Uniforms)
+    {
+      writer.WriteString(uniform.Name);
+      writer.WriteType(uniform.Type);
+      writer.Write(uniform.Location);
+      writer.Write(uniform.TextureUnit);
+    }
+
+    writer.Write(static_cast<uint8_t>(MaterialBlock.has_value()));
+    if (MaterialBlock.has_value())
+    {
+      writer.Write(MaterialBlock->Stride);
+      writer.Write(static_cast<uint32_t>(MaterialBlock->Members.size()));
+      for (const MaterialBlockMember& member : MaterialBlock->Members)
+      {
+        writer.WriteString(member.Name);
+        writer.WriteType(member.Type);
+        writer.Write(member.Offset);
+      }
+    }
+
+    return data;
+  }
+
+  auto
+  ShaderReflection::Deserialize(std::span<const uint8_t> data)
+    -> std::optional<ShaderReflection>
+  {
+    ReflectionReader reader(data);
+    ShaderReflection reflection;
+
+    uint32_t uniformCount = 0;
+    if (!reader.Read(uniformCount))
+    {
+      return std::nullopt;
+    }
+    for (uint32_t i = 0; i < uniformCount; i++)
+    {
+      ShaderUniform& uniform = reflection.Uniforms.emplace_back();
+      if (!reader.ReadString(uniform.Name) || !reader.ReadType(uniform.Type) ||
+          !reader.Read(uniform.Location) || !reader.Read(uniform.TextureUnit))
+      {
+        return std::nullopt;
+      }
+    }
+
+    uint8_t hasMaterialBlock = 0;
+    if (!reader.Read(hasMaterialBlock))
+    {
+      return std::nullopt;
+    }
+    if (hasMaterialBlock != 0)
+    {
+      MaterialBlockLayout& layout = reflection.MaterialBlock.emplace();
+      uint32_t             memberCount = 0;
+      if (!reader.Read(layout.Stride) || !reader.Read(memberCount))
+      {
+        return std::nullopt;
+      }
+      for (uint32_t i = 0; i < memberCount; i++)
+      {
+        MaterialBlockMember& member = layout.Members.emplace_back();
+
+        std::optional<ShaderParameterType> type;
+        if (!reader.ReadString(member.Name) || !reader.ReadType(type) ||
+            !type.has_value() || !reader.Read(member.Offset))
+        {
+          return std::nullopt;
+        }
+        member.Type = type.value();
+      }
+    }
+
+    // FindUniform relies on the order
+    if (!reader.IsAtEnd() ||
+        !std::ranges::is_sorted(reflection.Uniforms, {}, &ShaderUniform::Name))
+    {
+      return std::nullopt;
+    }
+    return reflection;
+  }
+}
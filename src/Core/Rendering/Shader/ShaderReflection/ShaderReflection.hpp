@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Core/Base.hpp"
+#include "Core/Rendering/Shader/MaterialBlock/MaterialBlockLayout.hpp"
+#include <optional>
+#include <span>
+
+namespace Dwarf
+{
+  /// @brief An active uniform of a linked shader program.
+  struct ShaderUniform
+  {
+    std::string Name;
+
+    /// @brief Parameter type of the uniform, empty for types materials can't
+    /// edit, e.g. cube map samplers.
+    std::optional<ShaderParameterType> Type;
+
+    int32_t Location = -1;
+
+    /// @brief Texture unit assigned to a sampler, -1 for other uniforms.
+    int32_t TextureUnit = -1;
+  };
+
+  /// @brief Everything the engine queries from a linked program, computed
+  /// once per program and shared by all materials using it. The record is
+  /// stored next to the program binary, so programs loaded from the binary
+  /// cache don't query the driver at all.
+  struct ShaderReflection
+  {
+    /// @brief Active uniforms outside of blocks, sorted by name.
+    std::vector<ShaderUniform> Uniforms;
+
+    /// @brief Layout of the material storage block, if the program has one.
+    std::optional<MaterialBlockLayout> MaterialBlock;
+
+    /**
+     * @brief Finds an active uniform
+     *
+     * @param name Name of the uniform
+     * @return The uniform, nullptr if the program has no such active uniform
+     */
+    [[nodiscard]] auto
+    FindUniform(std::string_view name) const -> const ShaderUniform*;
+
+    /**
+     * @brief Writes the record to a compact binary representation
+     *
+     * @return The serialized record
+     */
+    [[nodiscard]] auto
+    Serialize() const -> std::vector<uint8_t>;
+
+    /**
+     * @brief Reads a record written by Serialize
+     *
+     * @param data The serialized record
+     * @return The record, empty if the data is truncated or malformed
+     */
+    [[nodiscard]] static auto
+    Deserialize(std::span<const uint8_t> data)
+      -> std::optional<ShaderReflection>;
+  };
+}
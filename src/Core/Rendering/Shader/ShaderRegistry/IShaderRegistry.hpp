@@ -1,7 +1,9 @@
 #pragma once
 
 #include "Core/Asset/Shader/ShaderSourceCollection/IShaderSourceCollection.hpp"
+#include "Core/Rendering/Material/IMaterial.hpp"
 #include "Core/Rendering/Shader/IShader.hpp"
+#include "Core/UUID.hpp"
 
 namespace Dwarf
 {
@@ -23,5 +25,67 @@ namespace Dwarf
     virtual auto
     GetOrCreate(std::unique_ptr<IShaderSourceCollection> shaderSources)
       -> std::shared_ptr<IShader> = 0;
+
+    /**
+     * @brief Releases the programs that are not used outside of the registry
+     * anymore
+     *
+     * @return Number of released programs
+     */
+    virtual auto
+    ReleaseUnused() -> size_t = 0;
+
+    /**
+     * @brief Returns the number of programs held by the registry
+     *
+     * @return Number of programs
+     */
+    [[nodiscard]] virtual auto
+    GetProgramCount() const -> size_t = 0;
+
+    /**
+     * @brief Marks the programs that include a file for recompilation
+     *
+     * @param includePath Path of the changed include file
+     * @return Number of marked programs
+     */
+    virtual auto
+    RecompileIncluding(const std::filesystem::path& includePath) -> size_t = 0;
+
+    /**
+     * @brief Registers a material as user of its current shader program, so
+     * it is updated when a source of the program changes
+     *
+     * @param material Material to register
+     */
+    virtual void
+    AddMaterial(IMaterial& material) = 0;
+
+    /**
+     * @brief Removes a material from the dependency index
+     *
+     * @param material Material to remove
+     */
+    virtual void
+    RemoveMaterial(IMaterial& material) = 0;
+
+    /**
+     * @brief Updates the materials whose programs use a changed shader source
+     * asset. Programs not using the asset are left untouched.
+     *
+     * @param shaderAsset UID of the changed shader source asset
+     * @return Number of updated materials
+     */
+    virtual auto
+    ReloadShaderAsset(const UUID& shaderAsset) -> size_t = 0;
+
+    /**
+     * @brief Patches the parameters of the reloaded materials whose programs
+     * finished compiling
+     *
+     * @return Number of patched materials
+     */
+    virtual auto
+    PatchReloadedMaterials() -> size_t = 0;
   };
 }
\ No newline at end of file
@@ -5,10 +5,13 @@
 
 namespace Dwarf
 {
-  ShaderRegistry::ShaderRegistry(std::shared_ptr<IDwarfLogger>   logger,
-                                 std::shared_ptr<IShaderFactory> shaderFactory)
+  ShaderRegistry::ShaderRegistry(
+    std::shared_ptr<IDwarfLogger>      logger,
+    std::shared_ptr<IShaderFactory>    shaderFactory,
+    std::shared_ptr<IShaderRecompiler> shaderRecompiler)
     : mLogger(std::move(logger))
     , mShaderFactory(std::move(shaderFactory))
+    , mShaderRecompiler(std::move(shaderRecompiler))
   {
     mLogger->LogDebug(Log("ShaderRegistry created", "ShaderRegistry"));
   }
@@ -19,52 +22,59 @@ namespace Dwarf
   }
 
   auto
-  ShaderRegistry::GetOrCreate(std::unique_ptr<IShaderSourceCollection>
-                                shaderSources) -> std::shared_ptr<IShader>
+  ShaderRegistry::ComputeProgramKey(IShaderSourceCollection& shaderSources)
+    -> ContentHash
   {
-    // Hashing the shader sources
-    std::hash<std::string> hasher;
-    std::string            combinedSource;
-
-    for (auto& shaderSource : shaderSources->GetShaderSources())
+    std::vector<std::pair<ASSET_TYPE, ContentHash>> stages;
+    for (auto& shaderSource : shaderSources.GetShaderSources())
     {
-      std::string sourceString;
-
       switch (shaderSource->GetType())
       {
-        case Dwarf::ASSET_TYPE::VERTEX_SHADER:
-          sourceString =
-            (dynamic_cast<VertexShaderAsset&>(shaderSource->GetAsset()))
-              .GetFileContent();
-          break;
-        case Dwarf::ASSET_TYPE::FRAGMENT_SHADER:
-          sourceString =
-            (dynamic_cast<FragmentShaderAsset&>(shaderSource->GetAsset()))
-              .GetFileContent();
-          break;
-        case Dwarf::ASSET_TYPE::GEOMETRY_SHADER:
-          sourceString =
-            (dynamic_cast<GeometryShaderAsset&>(shaderSource->GetAsset()))
-              .GetFileContent();
-          break;
-        case Dwarf::ASSET_TYPE::TESC_SHADER:
-          sourceString = (dynamic_cast<TessellationControlShaderAsset&>(
-                            shaderSource->GetAsset()))
-                           .GetFileContent();
-          break;
-        case Dwarf::ASSET_TYPE::TESE_SHADER:
-          sourceString = (dynamic_cast<TessellationEvaluationShaderAsset&>(
-                            shaderSource->GetAsset()))
-                           .GetFileContent();
+        case ASSET_TYPE::VERTEX_SHADER:
+        case ASSET_TYPE::TESC_SHADER:
+        case ASSET_TYPE::TESE_SHADER:
+        case ASSET_TYPE::GEOMETRY_SHADER:
+        case ASSET_TYPE::FRAGMENT_SHADER:
+          // The type determines the component, no cast check is needed
+          stages.emplace_back(
+            shaderSource->GetType(),
+            static_cast<ShaderSourceAsset&>(shaderSource->GetAsset())
+              .GetContentHash());
           break;
         default: break;
       }
-      combinedSource += sourceString;
     }
 
-    size_t hash = hasher(combinedSource);
+    // The order of the sources in the collection doesn't matter
+    std::ranges::sort(stages,
+                      [](const auto& a, const auto& b)
+                      { return a.first < b.first; });
+
+    ContentHashBuilder builder;
+    for (const auto& [type, hash] : stages)
+    {
+      builder.AddValue(static_cast<int32_t>(type))
+        .AddValue(hash.High)
+        .AddValue(hash.Low);
+    }
+    // Every keyword combination is a separate variant of the program. The
+    // keywords are sorted by the collection, the length prefixes keep "AB"
+    // and "A", "B" apart
+    for (const std::string& keyword : shaderSources.GetKeywords())
+    {
+      builder.Add(keyword);
+    }
+
+    return builder.GetHash();
+  }
 
-    auto iterator = mShaders.find(hash);
+  auto
+  ShaderRegistry::GetOrCreate(std::unique_ptr<IShaderSourceCollection>
+                                shaderSources) -> std::shared_ptr<IShader>
+  {
+    ContentHash key = ComputeProgramKey(*shaderSources);
+
+    auto iterator = mShaders.find(key);
     if (iterator != mShaders.end())
     {
 
@@ -78,9 +88,249 @@ namespace Dwarf
       Log(fmt::format("Shader program not present yet. Building it now."),
           "ShaderRegistry"));
 
-    mShaders[hash] = mShaderFactory->Create(std::move(shaderSources));
-    mShaders[hash]->Compile();
+    // A new program usually replaces an old one after a hot reload
+    ReleaseUnused();
+
+    // Compiled in the background, users fall back to the error shader until
+    // the program is ready
+    std::vector<UUID> shaderAssets;
+    for (const auto& shaderSource : shaderSources->GetShaderSources())
+    {
+      shaderAssets.push_back(shaderSource->GetUID());
+    }
+
+    std::shared_ptr<IShader> shader =
+      mShaderFactory->Create(std::move(shaderSources));
+    shader->SubmitCompilation();
+    mShaderRecompiler->TrackCompilation(shader);
+    mShaders[key] = shader;
+
+    mKeysByProgram[shader.get()] = key;
+    for (const UUID& shaderAsset : shaderAssets)
+    {
+      mProgramsByShaderAsset[shaderAsset].push_back(key);
+    }
+
+    return shader;
+  }
+
+  auto
+  ShaderRegistry::ReleaseUnused() -> size_t
+  {
+    // Programs only referenced by the registry are not used anymore, their
+    // VRAM is released with the shader
+    size_t released = std::erase_if(
+      mShaders,
+      [this](const auto& entry)
+      {
+        if (entry.second.use_count() > 1)
+        {
+          return false;
+        }
+
+        // Materials hold their programs, so only the asset edges remain
+        mKeysByProgram.erase(entry.second.get());
+        mMaterialsByProgram.erase(entry.first);
+        return true;
+      });
+
+    for (auto iterator = mProgramsByShaderAsset.begin();
+         released > 0 && iterator != mProgramsByShaderAsset.end();)
+    {
+      std::erase_if(iterator->second,
+                    [this](const ContentHash& key)
+                    { return !mShaders.contains(key); });
+      iterator = iterator->second.empty()
+                   ? mProgramsByShaderAsset.erase(iterator)
+                   : std::next(iterator);
+    }
+
+    if (released > 0)
+    {
+      mLogger->LogDebug(
+        Log(fmt::format("Released {} unused shader programs", released),
+            "ShaderRegistry"));
+    }
+
+    return released;
+  }
+
+  auto
+  ShaderRegistry::RecompileIncluding(const std::filesystem::path& includePath)
+    -> size_t
+  {
+    std::error_code       error;
+    std::filesystem::path changedFile =
+      std::filesystem::weakly_canonical(includePath, error);
+    if (error)
+    {
+      changedFile = includePath.lexically_normal();
+    }
+
+    size_t marked = 0;
+    for (const auto& [key, shader] : mShaders)
+    {
+      bool includesFile = std::ranges::any_of(
+        shader->GetIncludedFiles(),
+        [&changedFile](const std::filesystem::path& includedFile)
+        {
+          std::error_code       canonicalError;
+          std::filesystem::path canonical =
+            std::filesystem::weakly_canonical(includedFile, canonicalError);
+          return (canonicalError ? includedFile.lexically_normal()
+                                 : canonical) == changedFile;
+        });
+
+      if (includesFile)
+      {
+        mShaderRecompiler->MarkForRecompilation(shader);
+        marked++;
+
+        auto users = mMaterialsByProgram.find(key);
+        if (users != mMaterialsByProgram.end())
+        {
+          for (IMaterial* material : users->second)
+          {
+            QueueParameterPatch(material);
+          }
+        }
+      }
+    }
+
+    if (marked > 0)
+    {
+      mLogger->LogDebug(
+        Log(fmt::format("Marked {} shader programs including {} for "
+                        "recompilation",
+                        marked,
+                        includePath.string()),
+            "ShaderRegistry"));
+    }
+
+    return marked;
+  }
+
+  void
+  ShaderRegistry::AddMaterial(IMaterial& material)
+  {
+    UnlinkMaterial(&material);
+
+    std::shared_ptr<IShader> shader = material.GetShader();
+    auto iterator = mKeysByProgram.find(shader.get());
+    if (iterator == mKeysByProgram.end())
+    {
+      return;
+    }
+
+    mProgramByMaterial[&material] = iterator->second;
+    mMaterialsByProgram[iterator->second].push_back(&material);
+  }
+
+  void
+  ShaderRegistry::RemoveMaterial(IMaterial& material)
+  {
+    UnlinkMaterial(&material);
+    std::erase(mMaterialsAwaitingParameters, &material);
+  }
+
+  void
+  ShaderRegistry::UnlinkMaterial(IMaterial* material)
+  {
+    auto iterator = mProgramByMaterial.find(material);
+    if (iterator == mProgramByMaterial.end())
+    {
+      return;
+    }
+
+    auto materials = mMaterialsByProgram.find(iterator->second);
+    if (materials != mMaterialsByProgram.end())
+    {
+      std::erase(materials->second, material);
+      if (materials->second.empty())
+      {
+        mMaterialsByProgram.erase(materials);
+      }
+    }
+    mProgramByMaterial.erase(iterator);
+  }
+
+  void
+  ShaderRegistry::QueueParameterPatch(IMaterial* material)
+  {
+    if (std::ranges::find(mMaterialsAwaitingParameters, material) ==
+        mMaterialsAwaitingParameters.end())
+    {
+      mMaterialsAwaitingParameters.push_back(material);
+    }
+  }
+
+  auto
+  ShaderRegistry::ReloadShaderAsset(const UUID& shaderAsset) -> size_t
+  {
+    auto programs = mProgramsByShaderAsset.find(shaderAsset);
+    if (programs == mProgramsByShaderAsset.end())
+    {
+      return 0;
+    }
+
+    // Collected first, updating a material changes the index
+    std::vector<IMaterial*> materials;
+    for (const ContentHash& key : programs->second)
+    {
+      auto users = mMaterialsByProgram.find(key);
+      if (users != mMaterialsByProgram.end())
+      {
+        materials.insert(
+          materials.end(), users->second.begin(), users->second.end());
+      }
+    }
 
-    return mShaders[hash];
+    for (IMaterial* material : materials)
+    {
+      // Creates the program of the changed sources, materials that shared
+      // the old program share the new one
+      material->UpdateShader();
+      QueueParameterPatch(material);
+    }
+
+    // The replaced programs are not used by any material anymore
+    ReleaseUnused();
+
+    mLogger->LogDebug(Log(fmt::format("Reloaded shader asset {} for {} "
+                                      "materials",
+                                      shaderAsset.toString(),
+                                      materials.size()),
+                          "ShaderRegistry"));
+
+    return materials.size();
+  }
+
+  auto
+  ShaderRegistry::PatchReloadedMaterials() -> size_t
+  {
+    size_t patched = 0;
+    std::erase_if(mMaterialsAwaitingParameters,
+                  [&patched](IMaterial* material)
+                  {
+                    std::shared_ptr<IShader> shader = material->GetShader();
+                    if (shader != nullptr && shader->IsCompiling())
+                    {
+                      return false;
+                    }
+
+                    if (shader != nullptr && shader->IsCompiled())
+                    {
+                      material->GenerateShaderParameters();
+                      patched++;
+                    }
+                    return true;
+                  });
+    return patched;
+  }
+
+  auto
+  ShaderRegistry::GetProgramCount() const -> size_t
+  {
+    return mShaders.size();
   }
-}
\ No newline at end of file
+}
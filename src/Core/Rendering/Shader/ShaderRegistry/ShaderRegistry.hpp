@@ -1,26 +1,61 @@
 #pragma once
 
+#include "Core/Asset/Shader/IShaderRecompiler.hpp"
 #include "Core/Rendering/Shader/IShaderFactory.hpp"
 #include "IShaderRegistry.hpp"
 #include "Logging/IDwarfLogger.hpp"
+#include "Utilities/ContentHash.hpp"
 
 namespace Dwarf
 {
   class ShaderRegistry : public IShaderRegistry
   {
   private:
-    std::shared_ptr<IDwarfLogger>                        mLogger;
-    std::shared_ptr<IShaderFactory>                      mShaderFactory;
-    std::unordered_map<size_t, std::shared_ptr<IShader>> mShaders;
+    std::shared_ptr<IDwarfLogger>      mLogger;
+    std::shared_ptr<IShaderFactory>    mShaderFactory;
+    std::shared_ptr<IShaderRecompiler> mShaderRecompiler;
+    std::unordered_map<ContentHash, std::shared_ptr<IShader>, ContentHashHasher>
+      mShaders;
+
+    // Reverse dependency index: shader source asset -> programs -> materials
+    std::map<UUID, std::vector<ContentHash>>        mProgramsByShaderAsset;
+    std::unordered_map<const IShader*, ContentHash> mKeysByProgram;
+    std::unordered_map<ContentHash, std::vector<IMaterial*>, ContentHashHasher>
+                                                  mMaterialsByProgram;
+    std::unordered_map<IMaterial*, ContentHash> mProgramByMaterial;
+
+    /// @brief Materials waiting for their reloaded programs to compile.
+    std::vector<IMaterial*> mMaterialsAwaitingParameters;
+
+    /**
+     * @brief Removes a material from the program it was registered with
+     *
+     * @param material Material to unlink
+     */
+    void
+    UnlinkMaterial(IMaterial* material);
+
+    /**
+     * @brief Queues a material for patching its parameters once its program
+     * is compiled
+     *
+     * @param material Material to queue
+     */
+    void
+    QueueParameterPatch(IMaterial* material);
 
   public:
-    ShaderRegistry(std::shared_ptr<IDwarfLogger>   logger,
-                   std::shared_ptr<IShaderFactory> shaderFactory);
+    ShaderRegistry(std::shared_ptr<IDwarfLogger>      logger,
+                   std::shared_ptr<IShaderFactory>    shaderFactory,
+                   std::shared_ptr<IShaderRecompiler> shaderRecompiler);
 
     ~ShaderRegistry() override;
 
     /**
-     * @brief Gets or creates a shader program based on source files
+     * @brief Gets or creates a shader program based on source files. Programs
+     * are identified by the content hashes of their stages. New programs are
+     * compiled asynchronously, IShader::IsCompiled reports when they are
+     * ready.
      *
      * @param shaderSources Source files to create the shader program from
      * @return A shared pointer to the shader program
@@ -28,5 +63,79 @@ namespace Dwarf
     auto
     GetOrCreate(std::unique_ptr<IShaderSourceCollection> shaderSources)
       -> std::shared_ptr<IShader> override;
+
+    /**
+     * @brief Releases the programs that are only referenced by the registry
+     *
+     * @return Number of released programs
+     */
+    auto
+    ReleaseUnused() -> size_t override;
+
+    /**
+     * @brief Returns the number of programs held by the registry
+     *
+     * @return Number of programs
+     */
+    [[nodiscard]] auto
+    GetProgramCount() const -> size_t override;
+
+    /**
+     * @brief Marks the programs that include a file for recompilation. The
+     * other programs are left untouched.
+     *
+     * @param includePath Path of the changed include file
+     * @return Number of marked programs
+     */
+    auto
+    RecompileIncluding(const std::filesystem::path& includePath)
+      -> size_t override;
+
+    /**
+     * @brief Registers a material as user of its current shader program
+     *
+     * @param material Material to register
+     */
+    void
+    AddMaterial(IMaterial& material) override;
+
+    /**
+     * @brief Removes a material from the dependency index
+     *
+     * @param material Material to remove
+     */
+    void
+    RemoveMaterial(IMaterial& material) override;
+
+    /**
+     * @brief Updates the materials whose programs use a changed shader source
+     * asset. Materials sharing a program share the new program, so every
+     * affected program is only compiled once.
+     *
+     * @param shaderAsset UID of the changed shader source asset
+     * @return Number of updated materials
+     */
+    auto
+    ReloadShaderAsset(const UUID& shaderAsset) -> size_t override;
+
+    /**
+     * @brief Patches the parameters of the reloaded materials whose programs
+     * finished compiling. Materials whose program failed to compile keep
+     * their parameters.
+     *
+     * @return Number of patched materials
+     */
+    auto
+    PatchReloadedMaterials() -> size_t override;
+
+    /**
+     * @brief Computes the key of a program from the types and content hashes
+     * of its stages and the selected keywords
+     *
+     * @param shaderSources Source files of the program
+     * @return Key identifying the program
+     */
+    static auto
+    ComputeProgramKey(IShaderSourceCollection& shaderSources) -> ContentHash;
   };
 }
\ No newline at end of file
@@ -6,14 +6,17 @@
 
 namespace Dwarf
 {
-  TextureFactory::TextureFactory(GraphicsApi                       api,
-                                 std::shared_ptr<IImageFileLoader> loader,
-                                 std::shared_ptr<IDwarfLogger>     logger,
-                                 std::shared_ptr<IVramTracker>     vramTracker)
+  TextureFactory::TextureFactory(
+    GraphicsApi                          api,
+    std::shared_ptr<IImageFileLoader>    loader,
+    std::shared_ptr<IDwarfLogger>        logger,
+    std::shared_ptr<IVramTracker>        vramTracker,
+    std::shared_ptr<IOpenGLStateTracker> stateTracker)
     : mApi(api)
     , mImageFileLoader(std::move(loader))
     , mLogger(std::move(logger))
     , mVramTracker(std::move(vramTracker))
+    , mStateTracker(std::move(stateTracker))
   {
     mLogger->LogDebug(Log("TextureFactory created.", "TextureFactory"));
   }
@@ -86,7 +89,7 @@ namespace Dwarf
         {
           mLogger->LogInfo(Log("Created OpenGL texture", "TextureFactory"));
           return std::make_unique<OpenGLTexture>(
-            textureData, mLogger, mVramTracker);
+            textureData, mLogger, mVramTracker, mStateTracker);
           break;
         }
       case GraphicsApi::Vulkan:
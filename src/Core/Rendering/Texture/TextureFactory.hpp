@@ -5,6 +5,7 @@
 #include "Core/Rendering/VramTracker/IVramTracker.hpp"
 #include "ITextureFactory.hpp"
 #include "Logging/IDwarfLogger.hpp"
+#include "Platform/OpenGL/IOpenGLStateTracker.hpp"
 #include <cstdint>
 
 namespace Dwarf
@@ -12,11 +13,12 @@ namespace Dwarf
   class TextureFactory : public ITextureFactory
   {
   private:
-    GraphicsApi                       mApi;
-    std::shared_ptr<IImageFileLoader> mImageFileLoader;
-    std::shared_ptr<IDwarfLogger>     mLogger;
-    std::shared_ptr<IVramTracker>     mVramTracker;
-    std::shared_ptr<ITexture>         mPlaceholderTexture;
+    GraphicsApi                          mApi;
+    std::shared_ptr<IImageFileLoader>    mImageFileLoader;
+    std::shared_ptr<IDwarfLogger>        mLogger;
+    std::shared_ptr<IVramTracker>        mVramTracker;
+    std::shared_ptr<IOpenGLStateTracker> mStateTracker;
+    std::shared_ptr<ITexture>            mPlaceholderTexture;
 
     /**
      * @brief Helper function that calculates the pixel count of a texture
@@ -51,10 +53,11 @@ namespace Dwarf
       -> std::unique_ptr<ITexture>;
 
   public:
-    TextureFactory(GraphicsApi                       api,
-                   std::shared_ptr<IImageFileLoader> loader,
-                   std::shared_ptr<IDwarfLogger>     logger,
-                   std::shared_ptr<IVramTracker>     vramTracker);
+    TextureFactory(GraphicsApi                          api,
+                   std::shared_ptr<IImageFileLoader>    loader,
+                   std::shared_ptr<IDwarfLogger>        logger,
+                   std::shared_ptr<IVramTracker>        vramTracker,
+                   std::shared_ptr<IOpenGLStateTracker> stateTracker);
     ~TextureFactory() override;
 
     /**
@@ -0,0 +1,139 @@
+#include "pch.hpp"
+
+#include "Core/GenericComponents.hpp"
+#include "Core/Scene/ChangeTracking/SceneChangeTracker.hpp"
+#include <ranges>
+
+namespace Dwarf
+{
+  SceneChangeTracker::SceneChangeTracker(entt::registry& registry)
+    : mRegistry(registry)
+  {
+    mConnections.emplace_back(
+      registry.on_destroy<IDComponent>()
+        .connect<&SceneChangeTracker::OnRemove>(*this));
+  }
+
+  auto
+  SceneChangeTracker::GetVersion() const -> uint64_t
+  {
+    return mVersion;
+  }
+
+  auto
+  SceneChangeTracker::GetEntityVersion(entt::entity entity) const -> uint64_t
+  {
+    uint32_t index = entt::to_entity(entity);
+    if (index < mEntityVersions.size() &&
+        mEntityVersions[index].Entity == entity)
+    {
+      return mEntityVersions[index].Version;
+    }
+    return 0;
+  }
+
+  auto
+  SceneChangeTracker::GetChangedEntities(uint64_t version) const
+    -> std::vector<entt::entity>
+  {
+    const entt::registry&     registry = mRegistry.get();
+    std::vector<entt::entity> changed;
+    if (version < mDroppedVersion)
+    {
+      for (const EntityVersion& entry : mEntityVersions)
+      {
+        if (entry.Version > version && registry.valid(entry.Entity))
+        {
+          changed.push_back(entry.Entity);
+        }
+      }
+      return changed;
+    }
+
+    // Only the last change of an entity is reported, earlier ones were
+    // superseded
+    for (auto entry = std::ranges::upper_bound(
+           mChanges, version, {}, &EntityVersion::Version);
+         entry != mChanges.end();
+         ++entry)
+    {
+      if (GetEntityVersion(entry->Entity) == entry->Version &&
+          registry.valid(entry->Entity))
+      {
+        changed.push_back(entry->Entity);
+      }
+    }
+    std::ranges::sort(changed);
+    return changed;
+  }
+
+  auto
+  SceneChangeTracker::GetRemovedEntities(uint64_t version) const
+    -> std::vector<UUID>
+  {
+    auto first = std::ranges::upper_bound(
+      mRemovedEntities, version, {}, &RemovedEntity::Version);
+
+    std::vector<UUID> removed;
+    removed.reserve(std::distance(first, mRemovedEntities.end()));
+    for (auto entry = first; entry != mRemovedEntities.end(); ++entry)
+    {
+      removed.push_back(entry->Id);
+    }
+    return removed;
+  }
+
+  void
+  SceneChangeTracker::HoldVersion(const void* consumer, uint64_t version)
+  {
+    mHeldVersions.insert_or_assign(consumer, version);
+    DropChanges(std::ranges::min(mHeldVersions | std::views::values));
+  }
+
+  void
+  SceneChangeTracker::ReleaseVersion(const void* consumer)
+  {
+    mHeldVersions.erase(consumer);
+    DropChanges(mHeldVersions.empty()
+                  ? mVersion
+                  : std::ranges::min(mHeldVersions | std::views::values));
+  }
+
+  void
+  SceneChangeTracker::OnChange(entt::registry& registry, entt::entity entity)
+  {
+    uint32_t index = entt::to_entity(entity);
+    if (index >= mEntityVersions.size())
+    {
+      mEntityVersions.resize(index + 1);
+    }
+    mEntityVersions[index] = { entity, ++mVersion };
+    mChanges.push_back(mEntityVersions[index]);
+  }
+
+  void
+  SceneChangeTracker::OnRemove(entt::registry& registry, entt::entity entity)
+  {
+    mRemovedEntities.push_back(
+      { ++mVersion, registry.get<IDComponent>(entity).getId() });
+  }
+
+  void
+  SceneChangeTracker::DropChanges(uint64_t version)
+  {
+    if (version <= mDroppedVersion)
+    {
+      return;
+    }
+    mDroppedVersion = version;
+
+    mChanges.erase(mChanges.begin(),
+                   std::ranges::upper_bound(
+                     mChanges, version, {}, &EntityVersion::Version));
+    mRemovedEntities.erase(mRemovedEntities.begin(),
+                           std::ranges::upper_bound(mRemovedEntities,
+                                                    version,
+                                                    {},
+                                                    &RemovedEntity::Version));
+  }
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "Core/UUID.hpp"
+#include <entt/entt.hpp>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace Dwarf
+{
+  /// @brief Records the version at which every entity of a registry last
+  /// changed. The version is incremented for every construction, update
+  /// through the registry and destruction of a tracked component, so savers
+  /// and undo snapshots only visit the entities that changed since a version
+  /// they have seen before instead of walking the whole scene.
+  ///
+  /// Changes made to a component without going through the registry, like
+  /// writing to a reference returned by get, are not seen. Editors patch the
+  /// component after such writes.
+  ///
+  /// Changes are logged in version order, so a lookup only visits the
+  /// changes made after its version. Consumers hold the version they will
+  /// look up from next, and older log entries are dropped.
+  class SceneChangeTracker
+  {
+  public:
+    /// @brief Constructor. Entities are reported as removed when their
+    /// IDComponent is destroyed.
+    /// @param registry Registry holding the tracked components.
+    explicit SceneChangeTracker(entt::registry& registry);
+
+    SceneChangeTracker(const SceneChangeTracker&) = delete;
+    auto
+    operator=(const SceneChangeTracker&) -> SceneChangeTracker& = delete;
+
+    /// @brief Tracks the changes of a component type.
+    template<typename Component>
+    void
+    Track()
+    {
+      entt::registry& registry = mRegistry.get();
+      mConnections.emplace_back(
+        registry.on_construct<Component>()
+          .template connect<&SceneChangeTracker::OnChange>(*this));
+      mConnections.emplace_back(
+        registry.on_update<Component>()
+          .template connect<&SceneChangeTracker::OnChange>(*this));
+      mConnections.emplace_back(
+        registry.on_destroy<Component>()
+          .template connect<&SceneChangeTracker::OnChange>(*this));
+    }
+
+    /// @brief Retrieves the current version, the number of changes recorded
+    /// so far.
+    [[nodiscard]] auto
+    GetVersion() const -> uint64_t;
+
+    /// @brief Retrieves the version at which an entity last changed.
+    /// @param entity The entity.
+    /// @return The version, 0 if the entity did not change since the tracker
+    /// was created.
+    [[nodiscard]] auto
+    GetEntityVersion(entt::entity entity) const -> uint64_t;
+
+    /// @brief Retrieves the entities that changed after a version and still
+    /// exist. Versions older than the changes still logged visit every
+    /// entity.
+    /// @param version Version the changes are looked up from.
+    /// @return The changed entities, ordered by their handles.
+    [[nodiscard]] auto
+    GetChangedEntities(uint64_t version) const -> std::vector<entt::entity>;
+
+    /// @brief Retrieves the IDs of the entities that were removed after a
+    /// version. Removals older than the oldest held version are dropped.
+    /// @param version Version the removals are looked up from.
+    /// @return The IDs in the order of removal.
+    [[nodiscard]] auto
+    GetRemovedEntities(uint64_t version) const -> std::vector<UUID>;
+
+    /// @brief Keeps the changes after a version for a consumer, replacing the
+    /// version it held before. Changes no consumer holds are dropped.
+    /// @param consumer The consumer, e.g. an undo history.
+    /// @param version Version the consumer looks up the changes from next.
+    void
+    HoldVersion(const void* consumer, uint64_t version);
+
+    /// @brief Releases the version held by a consumer.
+    /// @param consumer The consumer.
+    void
+    ReleaseVersion(const void* consumer);
+
+  private:
+    struct EntityVersion
+    {
+      entt::entity Entity = entt::null;
+      uint64_t     Version = 0;
+    };
+
+    struct RemovedEntity
+    {
+      uint64_t Version = 0;
+      UUID     Id;
+    };
+
+    std::reference_wrapper<entt::registry> mRegistry;
+    uint64_t                               mVersion = 0;
+
+    /// @brief Last change of every entity, indexed by the entity number.
+    std::vector<EntityVersion> mEntityVersions;
+
+    /// @brief Changes in version order, so the changes after a version are
+    /// found by a binary search.
+    std::vector<EntityVersion> mChanges;
+
+    /// @brief Removed entities in the order of removal, so the removals after
+    /// a version are found by a binary search.
+    std::vector<RemovedEntity> mRemovedEntities;
+
+    /// @brief Changes up to this version were dropped from the log.
+    uint64_t mDroppedVersion = 0;
+
+    /// @brief Versions held by the consumers.
+    std::unordered_map<const void*, uint64_t> mHeldVersions;
+
+    std::vector<entt::scoped_connection> mConnections;
+
+    void
+    OnChange(entt::registry& registry, entt::entity entity);
+
+    void
+    OnRemove(entt::registry& registry, entt::entity entity);
+
+    /// @brief Drops the changes up to a version.
+    void
+    DropChanges(uint64_t version);
+  };
+}
\ No newline at end of file
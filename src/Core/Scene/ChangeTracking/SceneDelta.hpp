@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Core/Scene/IO/SceneBinary/SceneGraphData.hpp"
+#include <optional>
+#include <vector>
+
+namespace Dwarf
+{
+  /// @brief State of an entity captured in a scene delta.
+  struct SceneEntityRecord
+  {
+    /// @brief Components of the entity. The parent index is not used.
+    SceneEntityData Entity;
+
+    /// @brief ID of the parent, nullopt for entities attached to the root.
+    std::optional<UUIDBytes> Parent;
+
+    /// @brief IDs of the children in their order.
+    std::vector<UUIDBytes> Children;
+  };
+
+  /// @brief Entities of a scene that changed since a version of the scene.
+  /// Captured and applied by the scene, only the changed entities are stored.
+  struct SceneDelta
+  {
+    /// @brief State of the changed and created entities.
+    std::vector<SceneEntityRecord> Entities;
+
+    /// @brief IDs of the removed entities.
+    std::vector<UUIDBytes> RemovedEntities;
+
+    /// @brief Order of the entities attached to the root, set if it changed.
+    std::optional<std::vector<UUIDBytes>> RootChildren;
+
+    [[nodiscard]] auto
+    IsEmpty() const -> bool
+    {
+      return Entities.empty() && RemovedEntities.empty() &&
+             !RootChildren.has_value();
+    }
+  };
+}
\ No newline at end of file
@@ -0,0 +1,152 @@
+#include "pch.hpp"
+
+#include "Core/Scene/ChangeTracking/SceneUndoHistory.hpp"
+#include "Core/Scene/IScene.hpp"
+
+namespace Dwarf
+{
+  SceneUndoHistory::SceneUndoHistory(IScene& scene)
+    : mScene(scene)
+  {
+    Commit(scene.CaptureDelta(0));
+
+    // The root entity is created before its changes are tracked
+    for (entt::entity child : scene.GetRootEntity().GetChildren())
+    {
+      mRootChildren.push_back(
+        scene.GetRegistry().get<IDComponent>(child).getId().toBytes());
+    }
+    UpdateVersion();
+  }
+
+  SceneUndoHistory::~SceneUndoHistory()
+  {
+    mScene.get().GetChangeTracker().ReleaseVersion(this);
+  }
+
+  auto
+  SceneUndoHistory::Checkpoint() -> bool
+  {
+    IScene&    scene = mScene.get();
+    SceneDelta after = scene.CaptureDelta(mVersion);
+    UpdateVersion();
+
+    // Entities created and removed within the step are not restored
+    std::erase_if(after.RemovedEntities,
+                  [this](const UUIDBytes& id)
+                  { return !mRecords.contains(UUID(id)); });
+    if (after.IsEmpty())
+    {
+      return false;
+    }
+
+    SceneDelta before;
+    for (const SceneEntityRecord& record : after.Entities)
+    {
+      auto committed = mRecords.find(UUID(record.Entity.Id));
+      if (committed != mRecords.end())
+      {
+        before.Entities.push_back(committed->second);
+      }
+      else
+      {
+        before.RemovedEntities.push_back(record.Entity.Id);
+      }
+    }
+    for (const UUIDBytes& id : after.RemovedEntities)
+    {
+      before.Entities.push_back(mRecords.at(UUID(id)));
+    }
+    if (after.RootChildren.has_value())
+    {
+      before.RootChildren = mRootChildren;
+    }
+
+    Commit(after);
+    mUndoSteps.push_back({ std::move(before), std::move(after) });
+    if (mUndoSteps.size() > MAX_STEPS)
+    {
+      mUndoSteps.pop_front();
+    }
+    mRedoSteps.clear();
+    return true;
+  }
+
+  auto
+  SceneUndoHistory::Undo() -> bool
+  {
+    Checkpoint();
+    if (mUndoSteps.empty())
+    {
+      return false;
+    }
+
+    Apply(mUndoSteps.back().Before);
+    mRedoSteps.push_back(std::move(mUndoSteps.back()));
+    mUndoSteps.pop_back();
+    return true;
+  }
+
+  auto
+  SceneUndoHistory::Redo() -> bool
+  {
+    Checkpoint();
+    if (mRedoSteps.empty())
+    {
+      return false;
+    }
+
+    Apply(mRedoSteps.back().After);
+    mUndoSteps.push_back(std::move(mRedoSteps.back()));
+    mRedoSteps.pop_back();
+    return true;
+  }
+
+  auto
+  SceneUndoHistory::CanUndo() const -> bool
+  {
+    return !mUndoSteps.empty();
+  }
+
+  auto
+  SceneUndoHistory::CanRedo() const -> bool
+  {
+    return !mRedoSteps.empty();
+  }
+
+  void
+  SceneUndoHistory::Commit(const SceneDelta& delta)
+  {
+    for (const SceneEntityRecord& record : delta.Entities)
+    {
+      mRecords.insert_or_assign(UUID(record.Entity.Id), record);
+    }
+    for (const UUIDBytes& id : delta.RemovedEntities)
+    {
+      mRecords.erase(UUID(id));
+    }
+    if (delta.RootChildren.has_value())
+    {
+      mRootChildren = *delta.RootChildren;
+    }
+  }
+
+  void
+  SceneUndoHistory::Apply(const SceneDelta& delta)
+  {
+    IScene& scene = mScene.get();
+    scene.ApplyDelta(delta);
+    Commit(delta);
+
+    // The changes made by the delta are part of the applied step
+    UpdateVersion();
+  }
+
+  void
+  SceneUndoHistory::UpdateVersion()
+  {
+    SceneChangeTracker& tracker = mScene.get().GetChangeTracker();
+    mVersion = tracker.GetVersion();
+    tracker.HoldVersion(this, mVersion);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Core/Scene/ChangeTracking/SceneDelta.hpp"
+#include <deque>
+#include <functional>
+#include <unordered_map>
+
+namespace Dwarf
+{
+  class IScene;
+
+  /// @brief Undo and redo history of a scene. Every step stores the delta of
+  /// the entities that changed in it, before and after the change, so a
+  /// checkpoint only visits the entities reported by the change tracker.
+  class SceneUndoHistory
+  {
+  public:
+    /// @brief Maximum number of steps that can be undone.
+    static constexpr size_t MAX_STEPS = 100;
+
+    /// @brief Constructor. The current state of the scene is the first
+    /// state of the history.
+    /// @param scene The scene.
+    explicit SceneUndoHistory(IScene& scene);
+
+    /// @brief Destructor. Releases the version held at the change tracker.
+    ~SceneUndoHistory();
+
+    SceneUndoHistory(const SceneUndoHistory&) = delete;
+
+    auto
+    operator=(const SceneUndoHistory&) -> SceneUndoHistory& = delete;
+
+    /// @brief Records the changes made since the last checkpoint as a step.
+    /// @return Whether a step was recorded.
+    auto
+    Checkpoint() -> bool;
+
+    /// @brief Reverts the last step. Changes made since the last checkpoint
+    /// are recorded as a step first.
+    /// @return Whether a step was reverted.
+    auto
+    Undo() -> bool;
+
+    /// @brief Applies the last reverted step again.
+    /// @return Whether a step was applied.
+    auto
+    Redo() -> bool;
+
+    [[nodiscard]] auto
+    CanUndo() const -> bool;
+
+    [[nodiscard]] auto
+    CanRedo() const -> bool;
+
+  private:
+    struct Step
+    {
+      SceneDelta Before;
+      SceneDelta After;
+    };
+
+    std::reference_wrapper<IScene> mScene;
+
+    /// @brief Change tracker version of the last checkpoint.
+    uint64_t mVersion = 0;
+
+    /// @brief State of every entity at the last checkpoint.
+    std::unordered_map<UUID, SceneEntityRecord> mRecords;
+
+    /// @brief Order of the entities attached to the root at the last
+    /// checkpoint.
+    std::vector<UUIDBytes> mRootChildren;
+
+    std::deque<Step>  mUndoSteps;
+    std::vector<Step> mRedoSteps;
+
+    /// @brief Stores the state of the entities of a delta as the state of
+    /// the last checkpoint.
+    void
+    Commit(const SceneDelta& delta);
+
+    /// @brief Applies a delta to the scene and commits it.
+    void
+    Apply(const SceneDelta& delta);
+
+    /// @brief Moves the version of the last checkpoint to the current
+    /// version of the change tracker, so older changes can be dropped.
+    void
+    UpdateVersion();
+  };
+}
\ No newline at end of file
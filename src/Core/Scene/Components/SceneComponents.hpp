@@ -38,8 +38,14 @@ namespace Dwarf
     /// @brief List of entity handles that are child entities.
     std::vector<entt::entity> Children;
 
+    /// @brief Set when the model matrix changed, cleared by the transform
+    /// hierarchy once it recomputed the world matrix.
     bool DirtyFlag = true;
 
+    /// @brief Index of the world matrix in the transform hierarchy of the
+    /// scene, assigned when the hierarchy is rebuilt.
+    uint32_t HierarchyIndex = std::numeric_limits<uint32_t>::max();
+
     TransformComponent() = default;
 
     TransformComponent(glm::vec3 pos, glm::vec3 rot, glm::vec3 scale)
@@ -65,17 +71,34 @@ namespace Dwarf
                wrapped.z < 0 ? wrapped.z + 360.0F : wrapped.z };
     }
 
-    void
-    UpdateMatrix()
+    /// @brief Computes the model matrix from the position, rotation and
+    /// scale.
+    /// @return The model matrix as a 4x4 matrix.
+    [[nodiscard]] auto
+    ComputeMatrix() const -> glm::mat4x4
     {
       glm::mat4 rot = glm::yawPitchRoll(glm::radians(Rotation.y),
                                         glm::radians(Rotation.x),
                                         glm::radians(Rotation.z));
 
-      CachedMatrix = glm::translate(glm::mat4(1.0F), Position) * rot *
-                     glm::scale(glm::mat4(1.0F), Scale);
+      return glm::translate(glm::mat4(1.0F), Position) * rot *
+             glm::scale(glm::mat4(1.0F), Scale);
+    }
 
-      DirtyFlag = false;
+    /// @brief Caches the model matrix and clears the dirty flag. Only called
+    /// by the transform hierarchy, which finds the moved subtrees through the
+    /// dirty flag.
+    /// @return The cached model matrix.
+    auto
+    UpdateMatrix() -> const glm::mat4x4&
+    {
+      if (DirtyFlag)
+      {
+        CachedMatrix = ComputeMatrix();
+        DirtyFlag = false;
+      }
+
+      return CachedMatrix;
     }
 
     // ========== Getters ==========
@@ -129,14 +152,9 @@ namespace Dwarf
     /// translation, scale and rotation matrices.
     /// @return The model matrix as a 4x4 matrix.
     [[nodiscard]] auto
-    GetMatrix() -> glm::mat4x4
+    GetMatrix() const -> glm::mat4x4
     {
-      if (DirtyFlag)
-      {
-        UpdateMatrix();
-      }
-
-      return CachedMatrix;
+      return DirtyFlag ? ComputeMatrix() : CachedMatrix;
     }
 
     void
@@ -248,26 +266,45 @@ namespace Dwarf
     auto
     Serialize() -> nlohmann::json override
     {
-      nlohmann::json serializedMeshRendererComponent;
+      std::optional<UUID> model;
       if (ModelAsset)
       {
-        serializedMeshRendererComponent["Model"] =
-          ModelAsset->GetUID().toString();
+        model = ModelAsset->GetUID();
       }
-      else
+
+      std::map<int, std::optional<UUID>> materials;
+      for (const auto& [index, material] : MaterialAssets)
       {
-        serializedMeshRendererComponent["Model"] = "";
+        materials[index] =
+          material ? std::optional<UUID>(material->GetUID()) : std::nullopt;
       }
 
-      int materialCount = 0;
+      return SerializeAssetIds(model, materials, IsHidden);
+    }
 
-      for (const auto& [index, material] : MaterialAssets)
+    /// @brief Serializes a mesh renderer from the ids of its assets. Used by
+    /// the scene writer, whose snapshots hold ids instead of references.
+    /// @param model Id of the model, nullopt if no model is assigned.
+    /// @param materials Ids of the materials by material index, nullopt if no
+    /// material is assigned.
+    /// @param isHidden Whether the mesh renderer is hidden.
+    /// @return The serialized mesh renderer.
+    static auto
+    SerializeAssetIds(const std::optional<UUID>&                model,
+                      const std::map<int, std::optional<UUID>>& materials,
+                      bool isHidden) -> nlohmann::json
+    {
+      nlohmann::json serializedMeshRendererComponent;
+      serializedMeshRendererComponent["Model"] =
+        model.has_value() ? model->toString() : "";
+
+      for (const auto& [index, material] : materials)
       {
         serializedMeshRendererComponent["Materials"][std::to_string(index)] =
-          material ? material->GetUID().toString() : "null";
+          material.has_value() ? material->toString() : "null";
       }
 
-      serializedMeshRendererComponent["Hidden"] = IsHidden;
+      serializedMeshRendererComponent["Hidden"] = isHidden;
 
       return serializedMeshRendererComponent;
     }
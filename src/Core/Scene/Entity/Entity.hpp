@@ -112,17 +112,22 @@ namespace Dwarf
       auto& transform = GetComponent<TransformComponent>();
       auto  newParent = Entity(entity, mRegistry.get());
 
+      // The children lists of both parents change as well, so change
+      // listeners see all three entities
       if (transform.GetParent() != entt::null)
       {
         auto oldParent = Entity(transform.GetParent(), mRegistry.get());
         oldParent.RemoveChild(mEntityHandle);
+        mRegistry.get().patch<TransformComponent>(oldParent.GetHandle());
       }
 
       transform.Parent = entity;
       if (mRegistry.get().valid(entity))
       {
         newParent.AddChild(mEntityHandle);
+        mRegistry.get().patch<TransformComponent>(entity);
       }
+      mRegistry.get().patch<TransformComponent>(mEntityHandle);
     }
 
     /// @brief Adds a new child entity to this entity.
@@ -148,11 +153,13 @@ namespace Dwarf
     {
       auto& transform = GetComponent<TransformComponent>();
 
+      // Searched from the back, freshly created entities are attached to the
+      // root before they are moved to their parent
       auto iterator = std::ranges::find(
-        transform.Children.begin(), transform.Children.end(), entity);
-      if (iterator != transform.Children.end())
+        transform.Children.rbegin(), transform.Children.rend(), entity);
+      if (iterator != transform.Children.rend())
       {
-        transform.Children.erase(iterator);
+        transform.Children.erase(std::next(iterator).base());
       }
     }
 
@@ -181,6 +188,7 @@ namespace Dwarf
       {
         siblings->insert(siblings->begin() + index, mEntityHandle);
       }
+      mRegistry.get().patch<TransformComponent>(transform.GetParent());
     }
 
     /// @brief Returns the index of this entity in the list of children of this
@@ -234,33 +242,67 @@ namespace Dwarf
     auto
     Serialize() -> nlohmann::json override
     {
-      nlohmann::json serializedEntity;
-
-      serializedEntity["guid"] = GetComponent<IDComponent>().getId().toString();
-      serializedEntity["name"] = GetComponent<NameComponent>().Name;
-
-      serializedEntity["TransformComponent"] =
-        GetComponent<TransformComponent>().Serialize();
-
+      std::optional<nlohmann::json> light;
       if (HasComponent<LightComponent>())
       {
-        serializedEntity["LightComponent"] =
-          GetComponent<LightComponent>().Serialize();
+        light = GetComponent<LightComponent>().Serialize();
       }
 
+      std::optional<nlohmann::json> meshRenderer;
       if (HasComponent<MeshRendererComponent>())
       {
-        serializedEntity["MeshRendererComponent"] =
-          GetComponent<MeshRendererComponent>().Serialize();
+        meshRenderer = GetComponent<MeshRendererComponent>().Serialize();
       }
 
-      int childCount = 0;
+      nlohmann::json serializedEntity =
+        SerializeFields(GetComponent<IDComponent>().getId(),
+                        GetComponent<NameComponent>().Name,
+                        GetComponent<TransformComponent>().Serialize(),
+                        std::move(light),
+                        std::move(meshRenderer));
 
       for (const auto& child : GetChildren())
       {
-        serializedEntity["children"][childCount] =
-          Entity(child, mRegistry.get()).Serialize();
-        childCount++;
+        serializedEntity["Children"].push_back(
+          Entity(child, mRegistry.get()).Serialize());
+      }
+
+      return serializedEntity;
+    }
+
+    /// @brief Assembles a serialized entity from its serialized components,
+    /// without the children. Used by the scene writer, which serializes
+    /// snapshots instead of registry entities.
+    /// @param id The id of the entity.
+    /// @param name The name of the entity.
+    /// @param transform The serialized transform component.
+    /// @param light The serialized light component, if the entity has one.
+    /// @param meshRenderer The serialized mesh renderer component, if the
+    /// entity has one.
+    /// @return The serialized entity.
+    static auto
+    SerializeFields(const UUID&                   id,
+                    const std::string&            name,
+                    nlohmann::json                transform,
+                    std::optional<nlohmann::json> light,
+                    std::optional<nlohmann::json> meshRenderer)
+      -> nlohmann::json
+    {
+      nlohmann::json serializedEntity;
+
+      serializedEntity["guid"] = id.toString();
+      serializedEntity["name"] = name;
+      serializedEntity["TransformComponent"] = std::move(transform);
+
+      if (light.has_value())
+      {
+        serializedEntity["LightComponent"] = std::move(light.value());
+      }
+
+      if (meshRenderer.has_value())
+      {
+        serializedEntity["MeshRendererComponent"] =
+          std::move(meshRenderer.value());
       }
 
       return serializedEntity;
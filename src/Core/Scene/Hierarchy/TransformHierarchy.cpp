@@ -0,0 +1,329 @@
+#include "pch.hpp"
+
+#include "Core/Scene/Hierarchy/TransformHierarchy.hpp"
+#include <atomic>
+
+namespace Dwarf
+{
+  TransformHierarchy::TransformHierarchy(entt::registry& registry,
+                                         entt::entity    root)
+    : mRegistry(registry)
+    , mRoot(root)
+    , mConstructConnection(
+        registry.on_construct<TransformComponent>()
+          .connect<&TransformHierarchy::OnStructureChanged>(*this))
+    , mDestroyConnection(
+        registry.on_destroy<TransformComponent>()
+          .connect<&TransformHierarchy::OnStructureChanged>(*this))
+  {
+  }
+
+  auto
+  TransformHierarchy::Update() -> size_t
+  {
+    if (!mStructureChanged)
+    {
+      if (std::optional<size_t> recomputed = Propagate(false))
+      {
+        return recomputed.value();
+      }
+    }
+
+    Rebuild();
+    return Propagate(true).value();
+  }
+
+  void
+  TransformHierarchy::Invalidate()
+  {
+    mStructureChanged = true;
+  }
+
+  void
+  TransformHierarchy::SetThreadCount(uint32_t threadCount)
+  {
+    threadCount = std::max(threadCount, 1U);
+    if (threadCount != mThreadCount)
+    {
+      mThreadCount = threadCount;
+      mWorkers = nullptr;
+      mRangesChanged = true;
+    }
+  }
+
+  auto
+  TransformHierarchy::GetThreadCount() const -> uint32_t
+  {
+    return mThreadCount;
+  }
+
+  auto
+  TransformHierarchy::GetWorldMatrix(TransformComponent& transform) const
+    -> glm::mat4
+  {
+    uint32_t index = transform.HierarchyIndex;
+    if (index < mTransforms.size() && mTransforms[index] == &transform)
+    {
+      return mWorldMatrices[index];
+    }
+
+    return transform.GetMatrix();
+  }
+
+  auto
+  TransformHierarchy::GetWorldMatrix(entt::entity entity) const -> glm::mat4
+  {
+    if (!mRegistry.get().valid(entity))
+    {
+      return glm::mat4(1.0F);
+    }
+
+    return GetWorldMatrix(mRegistry.get().get<TransformComponent>(entity));
+  }
+
+  auto
+  TransformHierarchy::GetWorldMatrices() const -> std::span<const glm::mat4>
+  {
+    return mWorldMatrices;
+  }
+
+  auto
+  TransformHierarchy::GetEntities() const -> std::span<const entt::entity>
+  {
+    return mEntities;
+  }
+
+  auto
+  TransformHierarchy::GetParentIndices() const -> std::span<const uint32_t>
+  {
+    return mParents;
+  }
+
+  auto
+  TransformHierarchy::GetChangedFlags() const -> std::span<const uint8_t>
+  {
+    return mChanged;
+  }
+
+  void
+  TransformHierarchy::Rebuild()
+  {
+    mEntities.clear();
+    mTransforms.clear();
+    mParents.clear();
+    mStructureChanged = false;
+
+    entt::registry& registry = mRegistry.get();
+    std::vector<std::pair<entt::entity, uint32_t>> stack;
+    if (registry.valid(mRoot))
+    {
+      stack.emplace_back(mRoot, NO_PARENT);
+    }
+
+    while (!stack.empty())
+    {
+      auto [entity, parent] = stack.back();
+      stack.pop_back();
+
+      auto* transform = registry.try_get<TransformComponent>(entity);
+      if (transform == nullptr)
+      {
+        continue;
+      }
+
+      auto index = (uint32_t)mEntities.size();
+      transform->HierarchyIndex = index;
+      mEntities.push_back(entity);
+      mTransforms.push_back(transform);
+      mParents.push_back(parent);
+
+      // Pushed in reverse so the siblings keep their order
+      for (auto child = transform->Children.rbegin();
+           child != transform->Children.rend();
+           ++child)
+      {
+        if (registry.valid(*child))
+        {
+          stack.emplace_back(*child, index);
+        }
+      }
+    }
+
+    mWorldMatrices.resize(mEntities.size());
+    mChanged.resize(mEntities.size());
+
+    // Children follow their parent, so a subtree ends where the subtree of
+    // its last child ends
+    mSubtreeEnds.resize(mEntities.size());
+    for (uint32_t index = 0; index < mSubtreeEnds.size(); ++index)
+    {
+      mSubtreeEnds[index] = index + 1;
+    }
+    for (auto index = (uint32_t)mSubtreeEnds.size(); index-- > 1;)
+    {
+      mSubtreeEnds[mParents[index]] =
+        std::max(mSubtreeEnds[mParents[index]], mSubtreeEnds[index]);
+    }
+    mRangesChanged = true;
+  }
+
+  void
+  TransformHierarchy::BuildRanges()
+  {
+    mRanges.clear();
+    mRangeAncestors.clear();
+    mRangesChanged = false;
+
+    if (mEntities.empty())
+    {
+      return;
+    }
+
+    uint32_t rangeSize =
+      std::max(MIN_RANGE_NODES,
+               (uint32_t)mEntities.size() / (mThreadCount * RANGES_PER_THREAD));
+
+    // Subtrees that are too large are split into the subtrees of their
+    // children
+    std::vector<uint32_t> stack = { 0 };
+    while (!stack.empty())
+    {
+      uint32_t node = stack.back();
+      stack.pop_back();
+
+      if (mSubtreeEnds[node] - node <= rangeSize)
+      {
+        mRanges.push_back({ node, mSubtreeEnds[node] });
+        continue;
+      }
+
+      mRangeAncestors.push_back(node);
+      for (uint32_t child = node + 1; child < mSubtreeEnds[node];
+           child = mSubtreeEnds[child])
+      {
+        stack.push_back(child);
+      }
+    }
+
+    std::ranges::sort(mRangeAncestors);
+    std::ranges::sort(mRanges,
+                      std::ranges::greater{},
+                      [](const TransformRange& range)
+                      { return range.End - range.Begin; });
+  }
+
+  auto
+  TransformHierarchy::Propagate(bool updateAll) -> std::optional<size_t>
+  {
+    if (mThreadCount > 1 && mEntities.size() >= MIN_PARALLEL_NODES)
+    {
+      return PropagateParallel(updateAll);
+    }
+
+    return PropagateRange({ 0, (uint32_t)mEntities.size() }, updateAll);
+  }
+
+  auto
+  TransformHierarchy::PropagateParallel(bool updateAll)
+    -> std::optional<size_t>
+  {
+    if (mRangesChanged)
+    {
+      BuildRanges();
+    }
+    if (!mWorkers)
+    {
+      mWorkers = std::make_unique<TransformWorkerPool>(mThreadCount);
+    }
+
+    size_t recomputed = 0;
+    for (uint32_t node : mRangeAncestors)
+    {
+      std::optional<size_t> count =
+        PropagateRange({ node, node + 1 }, updateAll);
+      if (!count.has_value())
+      {
+        return std::nullopt;
+      }
+      recomputed += count.value();
+    }
+
+    std::atomic<uint32_t> nextRange = 0;
+    std::atomic<size_t>   rangeRecomputed = 0;
+    std::atomic<bool>     reparented = false;
+
+    mWorkers->Run(
+      [&]()
+      {
+        size_t count = 0;
+        for (uint32_t range = nextRange++;
+             range < mRanges.size() && !reparented.load();
+             range = nextRange++)
+        {
+          std::optional<size_t> rangeCount =
+            PropagateRange(mRanges[range], updateAll);
+          if (!rangeCount.has_value())
+          {
+            reparented = true;
+            break;
+          }
+          count += rangeCount.value();
+        }
+        rangeRecomputed += count;
+      });
+
+    if (reparented.load())
+    {
+      return std::nullopt;
+    }
+
+    return recomputed + rangeRecomputed.load();
+  }
+
+  auto
+  TransformHierarchy::PropagateRange(TransformRange range, bool updateAll)
+    -> std::optional<size_t>
+  {
+    size_t recomputed = 0;
+
+    for (uint32_t index = range.Begin; index < range.End; ++index)
+    {
+      TransformComponent& transform = *mTransforms[index];
+      uint32_t            parent = mParents[index];
+
+      if (parent == NO_PARENT)
+      {
+        mChanged[index] = updateAll || transform.DirtyFlag;
+        if (mChanged[index] != 0)
+        {
+          mWorldMatrices[index] = transform.UpdateMatrix();
+          ++recomputed;
+        }
+        continue;
+      }
+
+      // Reparenting only touches the children lists, it is detected here
+      if (!updateAll && transform.Parent != mEntities[parent])
+      {
+        return std::nullopt;
+      }
+
+      mChanged[index] =
+        updateAll || transform.DirtyFlag || (mChanged[parent] != 0);
+      if (mChanged[index] != 0)
+      {
+        mWorldMatrices[index] =
+          mWorldMatrices[parent] * transform.UpdateMatrix();
+        ++recomputed;
+      }
+    }
+
+    return recomputed;
+  }
+
+  void
+  TransformHierarchy::OnStructureChanged(entt::registry&, entt::entity)
+  {
+    mStructureChanged = true;
+  }
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "Core/Scene/Components/SceneComponents.hpp"
+#include "Core/Scene/Hierarchy/TransformWorkerPool.hpp"
+#include <entt/entt.hpp>
+#include <functional>
+#include <glm/glm.hpp>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Dwarf
+{
+  /// @brief Contiguous range of nodes in the hierarchy order.
+  struct TransformRange
+  {
+    uint32_t Begin = 0;
+    uint32_t End = 0;
+  };
+
+  /// @brief World matrices of all entities below a root entity. The matrices
+  /// are stored in a dense array in which every parent precedes its children,
+  /// so one linear pass propagates the dirty flags down the hierarchy and only
+  /// the dirty subtrees are recomputed.
+  ///
+  /// Subtrees occupy contiguous ranges of the array and do not depend on each
+  /// other, so large hierarchies are updated in parallel: the ancestors of the
+  /// ranges are updated first, then the threads claim the ranges, largest
+  /// first, until none are left.
+  class TransformHierarchy
+  {
+  public:
+    /// @brief Parent index of the root node.
+    static constexpr uint32_t NO_PARENT = std::numeric_limits<uint32_t>::max();
+
+    /// @brief Hierarchies with fewer nodes are always updated on the calling
+    /// thread.
+    static constexpr uint32_t MIN_PARALLEL_NODES = 4096;
+
+    /// @brief Smallest subtree that is split further into ranges.
+    static constexpr uint32_t MIN_RANGE_NODES = 256;
+
+    /// @brief Number of ranges per thread the hierarchy is split into.
+    static constexpr uint32_t RANGES_PER_THREAD = 8;
+
+    /// @brief Constructor.
+    /// @param registry Registry holding the transform components.
+    /// @param root Entity the hierarchy starts at. Its own parent is ignored.
+    TransformHierarchy(entt::registry& registry, entt::entity root);
+
+    TransformHierarchy(const TransformHierarchy&) = delete;
+    auto
+    operator=(const TransformHierarchy&) -> TransformHierarchy& = delete;
+
+    /// @brief Recomputes the world matrices of all dirty subtrees. The order is
+    /// rebuilt first if entities were added, removed or reparented since the
+    /// last update. Meant to be called once per frame.
+    /// @return Number of world matrices that were recomputed.
+    auto
+    Update() -> size_t;
+
+    /// @brief Marks the order as outdated, forcing a rebuild on the next
+    /// update.
+    void
+    Invalidate();
+
+    /// @brief Sets the number of threads the update is spread over. The
+    /// worker threads are started by the first update that needs them.
+    /// @param threadCount Number of threads including the calling thread, 1
+    /// updates deterministically on the calling thread only.
+    void
+    SetThreadCount(uint32_t threadCount);
+
+    /// @brief Retrieves the number of threads the update is spread over.
+    [[nodiscard]] auto
+    GetThreadCount() const -> uint32_t;
+
+    /// @brief Retrieves the world matrix of a transform as of the last update.
+    /// @param transform A transform component of the registry.
+    /// @return The world matrix, or the local matrix if the transform was not
+    /// part of the hierarchy at the last update.
+    [[nodiscard]] auto
+    GetWorldMatrix(TransformComponent& transform) const -> glm::mat4;
+
+    /// @brief Retrieves the world matrix of an entity as of the last update.
+    /// @param entity Handle of the entity.
+    /// @return The world matrix, identity for invalid entities.
+    [[nodiscard]] auto
+    GetWorldMatrix(entt::entity entity) const -> glm::mat4;
+
+    /// @brief Retrieves the world matrices in hierarchy order.
+    [[nodiscard]] auto
+    GetWorldMatrices() const -> std::span<const glm::mat4>;
+
+    /// @brief Retrieves the entities in hierarchy order.
+    [[nodiscard]] auto
+    GetEntities() const -> std::span<const entt::entity>;
+
+    /// @brief Retrieves the index of the parent of every node, NO_PARENT for
+    /// the root.
+    [[nodiscard]] auto
+    GetParentIndices() const -> std::span<const uint32_t>;
+
+    /// @brief Retrieves whether the world matrix of every node was recomputed
+    /// by the last update, in hierarchy order.
+    [[nodiscard]] auto
+    GetChangedFlags() const -> std::span<const uint8_t>;
+
+  private:
+    std::reference_wrapper<entt::registry> mRegistry;
+    entt::entity                           mRoot;
+
+    /// @brief Entities in depth first order, parents before their children.
+    std::vector<entt::entity> mEntities;
+
+    /// @brief Transform components of the entities. Stays valid until a
+    /// transform component is constructed or destroyed, which invalidates the
+    /// order.
+    std::vector<TransformComponent*> mTransforms;
+    std::vector<uint32_t>            mParents;
+    std::vector<glm::mat4>           mWorldMatrices;
+
+    /// @brief Index past the last node of the subtree of every node.
+    std::vector<uint32_t> mSubtreeEnds;
+
+    /// @brief Whether the world matrix of a node changed in the current
+    /// update, read by its children.
+    std::vector<uint8_t> mChanged;
+
+    /// @brief Ranges updated in parallel, sorted by size in descending
+    /// order.
+    std::vector<TransformRange> mRanges;
+
+    /// @brief Ancestors of the ranges, updated in order before the ranges.
+    std::vector<uint32_t> mRangeAncestors;
+
+    uint32_t                             mThreadCount = 1;
+    std::unique_ptr<TransformWorkerPool> mWorkers;
+
+    bool                    mStructureChanged = true;
+    bool                    mRangesChanged = true;
+    entt::scoped_connection mConstructConnection;
+    entt::scoped_connection mDestroyConnection;
+
+    /// @brief Rebuilds the order by walking the children lists from the root.
+    void
+    Rebuild();
+
+    /// @brief Splits the hierarchy into ranges for the current thread count.
+    void
+    BuildRanges();
+
+    /// @brief Propagates the dirty flags and recomputes the changed matrices.
+    /// @param updateAll Recompute every matrix regardless of the flags.
+    /// @return Number of recomputed matrices, nullopt if a reparented entity
+    /// was found and the order has to be rebuilt.
+    auto
+    Propagate(bool updateAll) -> std::optional<size_t>;
+
+    /// @brief Parallel version of Propagate.
+    auto
+    PropagateParallel(bool updateAll) -> std::optional<size_t>;
+
+    /// @brief Propagates the dirty flags through a range of nodes whose
+    /// parents outside the range are already up to date.
+    auto
+    PropagateRange(TransformRange range, bool updateAll)
+      -> std::optional<size_t>;
+
+    void
+    OnStructureChanged(entt::registry& registry, entt::entity entity);
+  };
+}
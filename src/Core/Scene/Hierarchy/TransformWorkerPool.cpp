@@ -0,0 +1,82 @@
+#include "pch.hpp"
+
+#include "Core/Scene/Hierarchy/TransformWorkerPool.hpp"
+
+namespace Dwarf
+{
+  TransformWorkerPool::TransformWorkerPool(uint32_t threadCount)
+  {
+    for (uint32_t index = 1; index < threadCount; ++index)
+    {
+      mThreads.emplace_back([this]() { WorkerThread(); });
+    }
+  }
+
+  TransformWorkerPool::~TransformWorkerPool()
+  {
+    {
+      std::scoped_lock lock(mMutex);
+      mStop = true;
+    }
+    mStartCondition.notify_all();
+
+    for (std::thread& thread : mThreads)
+    {
+      thread.join();
+    }
+  }
+
+  auto
+  TransformWorkerPool::GetThreadCount() const -> uint32_t
+  {
+    return (uint32_t)mThreads.size() + 1;
+  }
+
+  void
+  TransformWorkerPool::Run(const std::function<void()>& job)
+  {
+    {
+      std::scoped_lock lock(mMutex);
+      mJob = &job;
+      mActiveCount = (uint32_t)mThreads.size();
+      ++mGeneration;
+    }
+    mStartCondition.notify_all();
+
+    job();
+
+    std::unique_lock lock(mMutex);
+    mFinishCondition.wait(lock, [this]() { return mActiveCount == 0; });
+    mJob = nullptr;
+  }
+
+  void
+  TransformWorkerPool::WorkerThread()
+  {
+    uint64_t generation = 0;
+
+    while (true)
+    {
+      const std::function<void()>* job = nullptr;
+      {
+        std::unique_lock lock(mMutex);
+        mStartCondition.wait(
+          lock, [&]() { return mStop || mGeneration != generation; });
+        if (mStop)
+        {
+          return;
+        }
+        generation = mGeneration;
+        job = mJob;
+      }
+
+      (*job)();
+
+      {
+        std::scoped_lock lock(mMutex);
+        --mActiveCount;
+      }
+      mFinishCondition.notify_one();
+    }
+  }
+}
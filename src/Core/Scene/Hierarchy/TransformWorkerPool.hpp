@@ -0,0 +1,57 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Dwarf
+{
+  /// @brief Persistent threads that run a job together with the calling
+  /// thread. Used to spread the transform update over the cores without
+  /// starting new threads every frame.
+  class TransformWorkerPool
+  {
+  public:
+    /// @brief Constructor.
+    /// @param threadCount Number of threads running a job, including the
+    /// calling thread.
+    explicit TransformWorkerPool(uint32_t threadCount);
+
+    ~TransformWorkerPool();
+
+    TransformWorkerPool(const TransformWorkerPool&) = delete;
+    auto
+    operator=(const TransformWorkerPool&) -> TransformWorkerPool& = delete;
+
+    /// @brief Retrieves the number of threads running a job, including the
+    /// calling thread.
+    [[nodiscard]] auto
+    GetThreadCount() const -> uint32_t;
+
+    /// @brief Runs a job on every thread and returns once all of them
+    /// finished it. The job has to distribute the work itself.
+    /// @param job The job to run.
+    void
+    Run(const std::function<void()>& job);
+
+  private:
+    std::vector<std::thread> mThreads;
+    std::mutex               mMutex;
+    std::condition_variable  mStartCondition;
+    std::condition_variable  mFinishCondition;
+
+    const std::function<void()>* mJob = nullptr;
+
+    /// @brief Incremented for every job, the workers start when it changes.
+    uint64_t mGeneration = 0;
+
+    /// @brief Number of workers that did not finish the current job yet.
+    uint32_t mActiveCount = 0;
+    bool     mStop = false;
+
+    void
+    WorkerThread();
+  };
+}
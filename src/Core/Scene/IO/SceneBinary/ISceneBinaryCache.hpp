@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Core/Asset/AssetReference/IAssetReference.hpp"
+#include "Core/Scene/IO/SceneBinary/SceneGraphData.hpp"
+#include "Core/UUID.hpp"
+#include <optional>
+
+namespace Dwarf
+{
+  /**
+   * @brief Class that stores scenes cooked into the binary scene format
+   *
+   */
+  class ISceneBinaryCache
+  {
+  public:
+    virtual ~ISceneBinaryCache() = default;
+
+    /**
+     * @brief Loads the cooked binary of a scene asset
+     *
+     * @param sceneAsset The scene asset to load the cooked binary of
+     * @return The scene graph, nullopt if there is no valid cooked binary
+     * that is newer than the scene file
+     */
+    [[nodiscard]] virtual auto
+    Load(const IAssetReference& sceneAsset)
+      -> std::optional<SceneGraphData> = 0;
+
+    /**
+     * @brief Cooks a scene graph into the binary of its scene asset
+     *
+     * @param sceneId ID of the scene asset the graph was loaded from or saved
+     * to
+     * @param graph The scene graph to cook, including the settings
+     */
+    virtual void
+    Store(const UUID& sceneId, const SceneGraphData& graph) = 0;
+  };
+}
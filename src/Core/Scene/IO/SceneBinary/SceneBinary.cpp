@@ -0,0 +1,504 @@
+#include "pch.hpp"
+
+#include "Core/Scene/IO/SceneBinary/SceneBinary.hpp"
+#include <xxhash.h>
+
+namespace Dwarf
+{
+  namespace
+  {
+    constexpr auto
+    MakeChunkId(const char (&name)[5]) -> uint32_t
+    {
+      return (uint32_t)name[0] | ((uint32_t)name[1] << 8) |
+             ((uint32_t)name[2] << 16) | ((uint32_t)name[3] << 24);
+    }
+
+    /// @brief Identifies binary scene files ("DWSC").
+    constexpr uint32_t SCENE_MAGIC = MakeChunkId("DWSC");
+
+    constexpr uint32_t STRING_CHUNK = MakeChunkId("STRS");
+    constexpr uint32_t SETTINGS_CHUNK = MakeChunkId("STNG");
+    constexpr uint32_t ENTITY_CHUNK = MakeChunkId("ENTS");
+    constexpr uint32_t TRANSFORM_CHUNK = MakeChunkId("XFRM");
+    constexpr uint32_t LIGHT_CHUNK = MakeChunkId("LGHT");
+    constexpr uint32_t MESH_RENDERER_CHUNK = MakeChunkId("MESH");
+
+    constexpr uint32_t HAS_MODEL_FLAG = 1U << 0;
+    constexpr uint32_t HIDDEN_FLAG = 1U << 1;
+    constexpr uint32_t CAST_SHADOW_FLAG = 1U << 2;
+    constexpr uint32_t HAS_MATERIAL_FLAG = 1U << 0;
+
+    struct SceneBinaryHeader
+    {
+      uint32_t Magic = SCENE_MAGIC;
+      uint32_t Version = SceneBinary::FORMAT_VERSION;
+      uint32_t ChunkCount = 0;
+      uint32_t Reserved = 0;
+      uint64_t PayloadSize = 0;
+      uint64_t Checksum = 0;
+    };
+
+    struct ChunkHeader
+    {
+      uint32_t Id = 0;
+
+      /// @brief Number of records in the chunk.
+      uint32_t Count = 0;
+      uint64_t Size = 0;
+    };
+
+    struct EntityRecord
+    {
+      UUIDBytes Id = {};
+      uint32_t  Name = 0;
+      uint32_t  Parent = SceneEntityData::NO_PARENT;
+    };
+
+    struct TransformRecord
+    {
+      glm::vec3 Position = glm::vec3(0.0F);
+      glm::vec3 Rotation = glm::vec3(0.0F);
+      glm::vec3 Scale = glm::vec3(1.0F);
+    };
+
+    struct LightRecord
+    {
+      uint32_t  Entity = 0;
+      uint32_t  Type = 0;
+      glm::vec3 Color = glm::vec3(1.0F);
+      float     Attenuation = 0.0F;
+      float     Radius = 0.0F;
+      float     OpeningAngle = 0.0F;
+    };
+
+    /// @brief Followed by MaterialCount material records.
+    struct MeshRendererRecord
+    {
+      uint32_t  Entity = 0;
+      uint32_t  Flags = 0;
+      UUIDBytes Model = {};
+      uint32_t  MaterialCount = 0;
+      uint32_t  Reserved = 0;
+    };
+
+    struct MaterialRecord
+    {
+      int32_t   Index = 0;
+      uint32_t  Flags = 0;
+      UUIDBytes Material = {};
+    };
+
+    /// @brief Appends trivially copyable values to a byte buffer.
+    class BinaryWriter
+    {
+    public:
+      explicit BinaryWriter(std::vector<uint8_t>& data)
+        : mData(data)
+      {
+      }
+
+      template<typename T>
+      void
+      Write(const T& value)
+      {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+        mData.insert(mData.end(), bytes, bytes + sizeof(T));
+      }
+
+      void
+      WriteBytes(std::span<const uint8_t> bytes)
+      {
+        mData.insert(mData.end(), bytes.begin(), bytes.end());
+      }
+
+    private:
+      std::vector<uint8_t>& mData;
+    };
+
+    /// @brief Reads trivially copyable values from a byte buffer, failing
+    /// instead of reading past its end.
+    class BinaryReader
+    {
+    public:
+      explicit BinaryReader(std::span<const uint8_t> data)
+        : mData(data)
+      {
+      }
+
+      template<typename T>
+      auto
+      Read(T& value) -> bool
+      {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (mData.size() - mOffset < sizeof(T))
+        {
+          return false;
+        }
+        std::memcpy(&value, mData.data() + mOffset, sizeof(T));
+        mOffset += sizeof(T);
+        return true;
+      }
+
+      auto
+      ReadBytes(uint64_t size) -> std::optional<std::span<const uint8_t>>
+      {
+        if (mData.size() - mOffset < size)
+        {
+          return std::nullopt;
+        }
+        std::span<const uint8_t> bytes = mData.subspan(mOffset, size);
+        mOffset += size;
+        return bytes;
+      }
+
+      [[nodiscard]] auto
+      IsAtEnd() const -> bool
+      {
+        return mOffset == mData.size();
+      }
+
+    private:
+      std::span<const uint8_t> mData;
+      size_t                   mOffset = 0;
+    };
+
+    /// @brief Deduplicates the strings of a scene, entities often share
+    /// their names.
+    class StringTable
+    {
+    public:
+      auto
+      Add(std::string_view string) -> uint32_t
+      {
+        auto [iterator, inserted] =
+          mIndices.try_emplace(string, (uint32_t)mStrings.size());
+        if (inserted)
+        {
+          mStrings.push_back(string);
+        }
+        return iterator->second;
+      }
+
+      [[nodiscard]] auto
+      GetStrings() const -> const std::vector<std::string_view>&
+      {
+        return mStrings;
+      }
+
+    private:
+      std::unordered_map<std::string_view, uint32_t> mIndices;
+      std::vector<std::string_view>                  mStrings;
+    };
+
+    /// @brief Chunk contents of a file, before they are decoded.
+    struct ChunkView
+    {
+      uint32_t                 Count = 0;
+      std::span<const uint8_t> Data;
+    };
+
+    template<typename Record>
+    auto
+    ReadRecords(const ChunkView& chunk) -> std::optional<std::vector<Record>>
+    {
+      if (chunk.Data.size() != (uint64_t)chunk.Count * sizeof(Record))
+      {
+        return std::nullopt;
+      }
+
+      std::vector<Record> records(chunk.Count);
+      std::memcpy(records.data(), chunk.Data.data(), chunk.Data.size());
+      return records;
+    }
+
+    auto
+    ReadStrings(const ChunkView& chunk)
+      -> std::optional<std::vector<std::string_view>>
+    {
+      std::vector<std::string_view> strings;
+      strings.reserve(chunk.Count);
+
+      BinaryReader reader(chunk.Data);
+      for (uint32_t index = 0; index < chunk.Count; ++index)
+      {
+        uint32_t length = 0;
+        if (!reader.Read(length))
+        {
+          return std::nullopt;
+        }
+        std::optional<std::span<const uint8_t>> bytes =
+          reader.ReadBytes(length);
+        if (!bytes.has_value())
+        {
+          return std::nullopt;
+        }
+        strings.emplace_back(reinterpret_cast<const char*>(bytes->data()),
+                             bytes->size());
+      }
+
+      if (!reader.IsAtEnd())
+      {
+        return std::nullopt;
+      }
+      return strings;
+    }
+
+    auto
+    ReadMeshRenderers(const ChunkView& chunk, SceneGraphData& graph) -> bool
+    {
+      BinaryReader reader(chunk.Data);
+      for (uint32_t index = 0; index < chunk.Count; ++index)
+      {
+        MeshRendererRecord record;
+        if (!reader.Read(record) || record.Entity >= graph.Entities.size())
+        {
+          return false;
+        }
+
+        SceneMeshRendererData meshRenderer;
+        if ((record.Flags & HAS_MODEL_FLAG) != 0)
+        {
+          meshRenderer.Model = record.Model;
+        }
+        meshRenderer.IsHidden = (record.Flags & HIDDEN_FLAG) != 0;
+        meshRenderer.CastShadow = (record.Flags & CAST_SHADOW_FLAG) != 0;
+
+        for (uint32_t material = 0; material < record.MaterialCount; ++material)
+        {
+          MaterialRecord materialRecord;
+          if (!reader.Read(materialRecord))
+          {
+            return false;
+          }
+
+          SceneMaterialSlotData& slot = meshRenderer.Materials.emplace_back();
+          slot.Index = materialRecord.Index;
+          if ((materialRecord.Flags & HAS_MATERIAL_FLAG) != 0)
+          {
+            slot.Material = materialRecord.Material;
+          }
+        }
+
+        graph.Entities[record.Entity].MeshRenderer = std::move(meshRenderer);
+      }
+
+      return reader.IsAtEnd();
+    }
+  }
+
+  auto
+  SceneBinary::Write(const SceneGraphData& graph) -> std::vector<uint8_t>
+  {
+    StringTable strings;
+    uint32_t    settings = strings.Add(graph.Settings);
+
+    std::vector<uint8_t> entities;
+    std::vector<uint8_t> transforms;
+    std::vector<uint8_t> lights;
+    std::vector<uint8_t> meshRenderers;
+    uint32_t             lightCount = 0;
+    uint32_t             meshRendererCount = 0;
+    entities.reserve(graph.Entities.size() * sizeof(EntityRecord));
+    transforms.reserve(graph.Entities.size() * sizeof(TransformRecord));
+
+    for (uint32_t index = 0; index < graph.Entities.size(); ++index)
+    {
+      const SceneEntityData& entity = graph.Entities[index];
+      BinaryWriter(entities).Write(
+        EntityRecord{ entity.Id, strings.Add(entity.Name), entity.Parent });
+      BinaryWriter(transforms)
+        .Write(
+          TransformRecord{ entity.Position, entity.Rotation, entity.Scale });
+
+      if (entity.Light.has_value())
+      {
+        const SceneLightData& light = entity.Light.value();
+        BinaryWriter(lights).Write(LightRecord{ index,
+                                                (uint32_t)light.Type,
+                                                light.Color,
+                                                light.Attenuation,
+                                                light.Radius,
+                                                light.OpeningAngle });
+        ++lightCount;
+      }
+
+      if (entity.MeshRenderer.has_value())
+      {
+        const SceneMeshRendererData& meshRenderer = entity.MeshRenderer.value();
+        MeshRendererRecord           record;
+        record.Entity = index;
+        record.Flags = (meshRenderer.Model.has_value() ? HAS_MODEL_FLAG : 0) |
+                       (meshRenderer.IsHidden ? HIDDEN_FLAG : 0) |
+                       (meshRenderer.CastShadow ? CAST_SHADOW_FLAG : 0);
+        record.Model = meshRenderer.Model.value_or(UUIDBytes{});
+        record.MaterialCount = (uint32_t)meshRenderer.Materials.size();
+
+        BinaryWriter writer(meshRenderers);
+        writer.Write(record);
+        for (const SceneMaterialSlotData& slot : meshRenderer.Materials)
+        {
+          writer.Write(MaterialRecord{
+            slot.Index,
+            slot.Material.has_value() ? HAS_MATERIAL_FLAG : 0,
+            slot.Material.value_or(UUIDBytes{}) });
+        }
+        ++meshRendererCount;
+      }
+    }
+
+    std::vector<uint8_t> stringData;
+    for (std::string_view string : strings.GetStrings())
+    {
+      BinaryWriter writer(stringData);
+      writer.Write((uint32_t)string.size());
+      writer.WriteBytes({ reinterpret_cast<const uint8_t*>(string.data()),
+                          string.size() });
+    }
+
+    std::vector<uint8_t> settingsData;
+    BinaryWriter(settingsData).Write(settings);
+
+    SceneBinaryHeader    header;
+    std::vector<uint8_t> payload;
+    BinaryWriter         writer(payload);
+    auto                 writeChunk =
+      [&](uint32_t id, uint32_t count, const std::vector<uint8_t>& data)
+    {
+      writer.Write(ChunkHeader{ id, count, data.size() });
+      writer.WriteBytes(data);
+      ++header.ChunkCount;
+    };
+    writeChunk(
+      STRING_CHUNK, (uint32_t)strings.GetStrings().size(), stringData);
+    writeChunk(SETTINGS_CHUNK, 1, settingsData);
+    writeChunk(ENTITY_CHUNK, (uint32_t)graph.Entities.size(), entities);
+    writeChunk(TRANSFORM_CHUNK, (uint32_t)graph.Entities.size(), transforms);
+    writeChunk(LIGHT_CHUNK, lightCount, lights);
+    writeChunk(MESH_RENDERER_CHUNK, meshRendererCount, meshRenderers);
+
+    header.PayloadSize = payload.size();
+    header.Checksum = XXH3_64bits(payload.data(), payload.size());
+
+    std::vector<uint8_t> data;
+    data.reserve(sizeof(header) + payload.size());
+    BinaryWriter(data).Write(header);
+    data.insert(data.end(), payload.begin(), payload.end());
+    return data;
+  }
+
+  auto
+  SceneBinary::Read(std::span<const uint8_t> data)
+    -> std::optional<SceneGraphData>
+  {
+    SceneBinaryHeader header;
+    BinaryReader      reader(data);
+    if (!reader.Read(header) || header.Magic != SCENE_MAGIC ||
+        header.Version != FORMAT_VERSION ||
+        header.PayloadSize != data.size() - sizeof(header))
+    {
+      return std::nullopt;
+    }
+
+    std::span<const uint8_t> payload = data.subspan(sizeof(header));
+    if (XXH3_64bits(payload.data(), payload.size()) != header.Checksum)
+    {
+      return std::nullopt;
+    }
+
+    std::unordered_map<uint32_t, ChunkView> chunks;
+    for (uint32_t index = 0; index < header.ChunkCount; ++index)
+    {
+      ChunkHeader chunkHeader;
+      if (!reader.Read(chunkHeader))
+      {
+        return std::nullopt;
+      }
+      std::optional<std::span<const uint8_t>> chunkData =
+        reader.ReadBytes(chunkHeader.Size);
+      if (!chunkData.has_value())
+      {
+        return std::nullopt;
+      }
+      chunks[chunkHeader.Id] = { chunkHeader.Count, chunkData.value() };
+    }
+
+    if (!reader.IsAtEnd() || !chunks.contains(STRING_CHUNK) ||
+        !chunks.contains(SETTINGS_CHUNK) || !chunks.contains(ENTITY_CHUNK) ||
+        !chunks.contains(TRANSFORM_CHUNK))
+    {
+      return std::nullopt;
+    }
+
+    std::optional<std::vector<std::string_view>> strings =
+      ReadStrings(chunks[STRING_CHUNK]);
+    std::optional<std::vector<uint32_t>> settings =
+      ReadRecords<uint32_t>(chunks[SETTINGS_CHUNK]);
+    std::optional<std::vector<EntityRecord>> entities =
+      ReadRecords<EntityRecord>(chunks[ENTITY_CHUNK]);
+    std::optional<std::vector<TransformRecord>> transforms =
+      ReadRecords<TransformRecord>(chunks[TRANSFORM_CHUNK]);
+    if (!strings || !settings || settings->size() != 1 ||
+        settings->front() >= strings->size() || !entities || !transforms ||
+        transforms->size() != entities->size())
+    {
+      return std::nullopt;
+    }
+
+    SceneGraphData graph;
+    graph.Settings = strings->at(settings->front());
+    graph.Entities.resize(entities->size());
+    for (uint32_t index = 0; index < entities->size(); ++index)
+    {
+      const EntityRecord& record = entities->at(index);
+      if (record.Name >= strings->size() ||
+          (record.Parent != SceneEntityData::NO_PARENT &&
+           record.Parent >= index))
+      {
+        return std::nullopt;
+      }
+
+      SceneEntityData& entity = graph.Entities[index];
+      entity.Id = record.Id;
+      entity.Name = strings->at(record.Name);
+      entity.Parent = record.Parent;
+      entity.Position = transforms->at(index).Position;
+      entity.Rotation = transforms->at(index).Rotation;
+      entity.Scale = transforms->at(index).Scale;
+    }
+
+    if (chunks.contains(LIGHT_CHUNK))
+    {
+      std::optional<std::vector<LightRecord>> lights =
+        ReadRecords<LightRecord>(chunks[LIGHT_CHUNK]);
+      if (!lights)
+      {
+        return std::nullopt;
+      }
+
+      for (const LightRecord& record : lights.value())
+      {
+        if (record.Entity >= graph.Entities.size() ||
+            record.Type > (uint32_t)LightType::SpotLight)
+        {
+          return std::nullopt;
+        }
+        SceneLightData& light = graph.Entities[record.Entity].Light.emplace();
+        light.Type = (LightType)record.Type;
+        light.Color = record.Color;
+        light.Attenuation = record.Attenuation;
+        light.Radius = record.Radius;
+        light.OpeningAngle = record.OpeningAngle;
+      }
+    }
+
+    if (chunks.contains(MESH_RENDERER_CHUNK) &&
+        !ReadMeshRenderers(chunks[MESH_RENDERER_CHUNK], graph))
+    {
+      return std::nullopt;
+    }
+
+    return graph;
+  }
+}
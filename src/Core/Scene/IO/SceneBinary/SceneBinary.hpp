@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Core/Scene/IO/SceneBinary/SceneGraphData.hpp"
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Dwarf
+{
+  /// @brief Binary scene format. A header with a checksum is followed by
+  /// chunks of fixed size records: a string table holding the names and the
+  /// settings, the entities with their 16 byte UUIDs, their transforms, and
+  /// the light and mesh renderer components. Loading decodes the chunks in a
+  /// single pass without building a document.
+  class SceneBinary
+  {
+  public:
+    /// @brief Version of the format. Files of other versions are rejected.
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+    /// @brief Encodes a scene graph.
+    /// @param graph The scene graph to encode.
+    /// @return The encoded scene.
+    [[nodiscard]] static auto
+    Write(const SceneGraphData& graph) -> std::vector<uint8_t>;
+
+    /// @brief Decodes a scene graph. Unknown chunks are skipped.
+    /// @param data The encoded scene.
+    /// @return The scene graph, nullopt if the data is corrupted or was
+    /// written by another format version.
+    [[nodiscard]] static auto
+    Read(std::span<const uint8_t> data) -> std::optional<SceneGraphData>;
+  };
+}
@@ -0,0 +1,118 @@
+#include "pch.hpp"
+
+#include "Core/Scene/IO/SceneBinary/SceneBinary.hpp"
+#include "SceneBinaryCache.hpp"
+
+namespace Dwarf
+{
+  SceneBinaryCache::SceneBinaryCache(const ProjectPath&            projectPath,
+                                     std::shared_ptr<IDwarfLogger> logger)
+    : mLogger(std::move(logger))
+    , mCacheDirectory(projectPath.t / CACHE_DIRECTORY)
+  {
+    mLogger->LogDebug(Log("SceneBinaryCache created", "SceneBinaryCache"));
+  }
+
+  SceneBinaryCache::~SceneBinaryCache()
+  {
+    mLogger->LogDebug(Log("SceneBinaryCache destroyed", "SceneBinaryCache"));
+  }
+
+  auto
+  SceneBinaryCache::GetEntryPath(const UUID& sceneId) const
+    -> std::filesystem::path
+  {
+    return mCacheDirectory / (sceneId.toString() + ".dsceneb");
+  }
+
+  auto
+  SceneBinaryCache::Load(const IAssetReference& sceneAsset)
+    -> std::optional<SceneGraphData>
+  {
+    std::filesystem::path path = GetEntryPath(sceneAsset.GetUID());
+
+    // Edits of the scene file since the binary was cooked take precedence
+    std::error_code error;
+    auto            cookedTime = std::filesystem::last_write_time(path, error);
+    if (error)
+    {
+      return std::nullopt;
+    }
+    auto sourceTime =
+      std::filesystem::last_write_time(sceneAsset.GetPath(), error);
+    if (error || cookedTime <= sourceTime)
+    {
+      return std::nullopt;
+    }
+
+    uintmax_t     fileSize = std::filesystem::file_size(path, error);
+    std::ifstream file(path, std::ios::binary);
+    if (error || !file.is_open())
+    {
+      return std::nullopt;
+    }
+
+    std::vector<uint8_t> data(fileSize);
+    file.read(reinterpret_cast<char*>(data.data()),
+              static_cast<std::streamsize>(data.size()));
+    std::optional<SceneGraphData> graph =
+      file.good() ? SceneBinary::Read(data) : std::nullopt;
+    file.close();
+
+    if (!graph.has_value())
+    {
+      mLogger->LogWarn(
+        Log(fmt::format("Discarding invalid cooked scene {}", path.string()),
+            "SceneBinaryCache"));
+      std::filesystem::remove(path, error);
+    }
+
+    return graph;
+  }
+
+  void
+  SceneBinaryCache::Store(const UUID& sceneId, const SceneGraphData& graph)
+  {
+    std::error_code error;
+    std::filesystem::create_directories(mCacheDirectory, error);
+    if (error)
+    {
+      mLogger->LogWarn(Log(fmt::format("Failed to create {}: {}",
+                                       mCacheDirectory.string(),
+                                       error.message()),
+                           "SceneBinaryCache"));
+      return;
+    }
+
+    std::vector<uint8_t> data = SceneBinary::Write(graph);
+
+    // Write to a temporary file first so a crash never leaves a partial file
+    std::filesystem::path path = GetEntryPath(sceneId);
+    std::filesystem::path temporaryPath = path;
+    temporaryPath += ".tmp";
+    {
+      std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+      file.write(reinterpret_cast<const char*>(data.data()),
+                 static_cast<std::streamsize>(data.size()));
+      if (!file.good())
+      {
+        mLogger->LogWarn(
+          Log(fmt::format("Failed to write {}", temporaryPath.string()),
+              "SceneBinaryCache"));
+        file.close();
+        std::filesystem::remove(temporaryPath, error);
+        return;
+      }
+    }
+
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error)
+    {
+      mLogger->LogWarn(Log(fmt::format("Failed to store {}: {}",
+                                       path.string(),
+                                       error.message()),
+                           "SceneBinaryCache"));
+      std::filesystem::remove(temporaryPath, error);
+    }
+  }
+}
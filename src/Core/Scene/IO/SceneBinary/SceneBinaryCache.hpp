@@ -0,0 +1,53 @@
+#pragma once
+
+#include "ISceneBinaryCache.hpp"
+#include "Logging/IDwarfLogger.hpp"
+#include "Project/ProjectTypes.hpp"
+#include <boost/di.hpp>
+
+namespace Dwarf
+{
+  /// @brief Scene binary cache storing one cooked file per scene asset in the
+  /// cache directory of the project.
+  class SceneBinaryCache : public ISceneBinaryCache
+  {
+  private:
+    std::shared_ptr<IDwarfLogger> mLogger;
+    std::filesystem::path         mCacheDirectory;
+
+    [[nodiscard]] auto
+    GetEntryPath(const UUID& sceneId) const -> std::filesystem::path;
+
+  public:
+    /// @brief Directory of the cache relative to the project directory.
+    static constexpr const char* CACHE_DIRECTORY = "Cache/Scenes";
+
+    BOOST_DI_INJECT(SceneBinaryCache,
+                    const ProjectPath&            projectPath,
+                    std::shared_ptr<IDwarfLogger> logger);
+    ~SceneBinaryCache() override;
+
+    /**
+     * @brief Loads the cooked binary of a scene asset. Corrupted binaries or
+     * binaries of a different format version are removed.
+     *
+     * @param sceneAsset The scene asset to load the cooked binary of
+     * @return The scene graph, nullopt if there is no valid cooked binary
+     * that is newer than the scene file
+     */
+    [[nodiscard]] auto
+    Load(const IAssetReference& sceneAsset)
+      -> std::optional<SceneGraphData> override;
+
+    /**
+     * @brief Cooks a scene graph into the binary of its scene asset. Safe to
+     * call from a background thread.
+     *
+     * @param sceneId ID of the scene asset the graph was loaded from or saved
+     * to
+     * @param graph The scene graph to cook, including the settings
+     */
+    void
+    Store(const UUID& sceneId, const SceneGraphData& graph) override;
+  };
+}
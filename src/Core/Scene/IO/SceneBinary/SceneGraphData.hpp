@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Core/Rendering/LightTypes.hpp"
+#include "Core/UUID.hpp"
+#include <glm/glm.hpp>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Dwarf
+{
+  /// @brief Light properties of an entity.
+  struct SceneLightData
+  {
+    LightType Type = LightType::Directional;
+    glm::vec3 Color = glm::vec3(1.0F);
+    float     Attenuation = 4.0F;
+    float     Radius = 15.0F;
+    float     OpeningAngle = 33.0F;
+  };
+
+  /// @brief Material assigned to a material index of a mesh renderer.
+  struct SceneMaterialSlotData
+  {
+    int32_t Index = 0;
+
+    /// @brief Asset id of the material, nullopt if no material is assigned.
+    std::optional<UUIDBytes> Material;
+  };
+
+  /// @brief Model and materials of an entity.
+  struct SceneMeshRendererData
+  {
+    /// @brief Asset id of the model, nullopt if no model is assigned.
+    std::optional<UUIDBytes>           Model;
+    std::vector<SceneMaterialSlotData> Materials;
+    bool                               IsHidden = false;
+    bool                               CastShadow = true;
+  };
+
+  /// @brief An entity of the scene graph.
+  struct SceneEntityData
+  {
+    /// @brief Parent index of entities attached to the root entity.
+    static constexpr uint32_t NO_PARENT = std::numeric_limits<uint32_t>::max();
+
+    UUIDBytes   Id = {};
+    std::string Name;
+
+    /// @brief Index of the parent entity, which precedes its children.
+    uint32_t Parent = NO_PARENT;
+
+    glm::vec3 Position = glm::vec3(0.0F);
+    glm::vec3 Rotation = glm::vec3(0.0F);
+    glm::vec3 Scale = glm::vec3(1.0F);
+
+    std::optional<SceneLightData>        Light;
+    std::optional<SceneMeshRendererData> MeshRenderer;
+  };
+
+  /// @brief Flat representation of a scene, the entities are stored depth
+  /// first with every parent preceding its children.
+  struct SceneGraphData
+  {
+    /// @brief Serialized scene settings as JSON text.
+    std::string                  Settings;
+    std::vector<SceneEntityData> Entities;
+  };
+}
@@ -6,18 +6,22 @@
 
 namespace Dwarf
 {
-  SceneIO::SceneIO(const AssetDirectoryPath&         assetDirectoryPath,
-                   std::shared_ptr<IDwarfLogger>     logger,
-                   std::shared_ptr<IProjectSettings> projectSettings,
-                   std::shared_ptr<ISceneFactory>    sceneFactory,
-                   std::shared_ptr<IAssetDatabase>   assetDatabase,
-                   std::shared_ptr<IFileHandler>     fileHandler)
+  SceneIO::SceneIO(const AssetDirectoryPath&          assetDirectoryPath,
+                   std::shared_ptr<IDwarfLogger>      logger,
+                   std::shared_ptr<IProjectSettings>  projectSettings,
+                   std::shared_ptr<ISceneFactory>     sceneFactory,
+                   std::shared_ptr<IAssetDatabase>    assetDatabase,
+                   std::shared_ptr<IFileHandler>      fileHandler,
+                   std::shared_ptr<ISceneBinaryCache> sceneBinaryCache,
+                   std::shared_ptr<ISceneWriter>      sceneWriter)
     : mAssetDirectoryPath(assetDirectoryPath)
     , mLogger(std::move(logger))
     , mSceneFactory(std::move(sceneFactory))
     , mProjectSettings(std::move(projectSettings))
     , mAssetDatabase(std::move(assetDatabase))
     , mFileHandler(std::move(fileHandler))
+    , mSceneBinaryCache(std::move(sceneBinaryCache))
+    , mSceneWriter(std::move(sceneWriter))
   {
   }
 
@@ -26,19 +30,21 @@ namespace Dwarf
   {
     if (scene.GetProperties().GetAssetId() != std::nullopt)
     {
-      // TODO: Add error handling and logging.
-      nlohmann::json sceneJson = scene.Serialize();
       if (mAssetDatabase->Exists(scene.GetProperties().GetAssetId().value()))
       {
-        std::filesystem::path path =
-          mAssetDatabase->Retrieve(scene.GetProperties().GetAssetId().value())
-            ->GetPath();
-        mLogger->LogDebug(
-          Log(fmt::format("Saving serialized scene:\n{}", sceneJson.dump(2)),
-              "SceneIO"));
+        std::unique_ptr<IAssetReference> sceneAsset =
+          mAssetDatabase->Retrieve(scene.GetProperties().GetAssetId().value());
+        std::filesystem::path path = sceneAsset->GetPath();
         mLogger->LogDebug(Log(
           fmt::format("Writing scene to file: {}", path.string()), "SceneIO"));
-        WriteSceneToFile(sceneJson, path);
+
+        // Only the snapshot is taken on the calling thread, the serialization
+        // and the file access happen in the background. The scene counts as
+        // saved once the file is written.
+        mSceneWriter->Write(scene.SerializeGraph(),
+                            path,
+                            sceneAsset->GetUID(),
+                            scene.CreateSaveCallback());
       }
       else
       {
@@ -70,10 +76,6 @@ namespace Dwarf
                       mAssetDirectoryPath.t.string().c_str(),
                       scene.GetProperties().GetName().c_str());
 
-    mLogger->LogDebug(
-      Log(fmt::format("Saving serialized scene: {}", sceneJson.dump(2)),
-          "SceneIO"));
-
     if (result == NFD_OKAY)
     {
       std::filesystem::path path(savePath.get());
@@ -89,6 +91,8 @@ namespace Dwarf
       scene.GetProperties().SetName(path.stem().string());
       scene.GetProperties().SetAssetId(newId);
       mProjectSettings->UpdateLastOpenedScene(newId);
+      mSceneBinaryCache->Store(newId, scene.SerializeGraph());
+      scene.MarkSaved();
     }
     else if (result == NFD_CANCEL)
     {
@@ -107,6 +111,9 @@ namespace Dwarf
   SceneIO::LoadScene(IAssetReference& sceneAsset) const
     -> std::unique_ptr<IScene>
   {
+    // A queued save of the scene has to land before the file is read
+    mSceneWriter->Flush();
+
     if (mFileHandler->FileExists(sceneAsset.GetPath()))
     {
       mLogger->LogDebug(Log(fmt::format("Loading scene from asset: {}",
@@ -2,6 +2,8 @@
 
 #include "Core/Asset/Database/IAssetDatabase.hpp"
 #include "Core/Scene/IO/ISceneIO.hpp"
+#include "Core/Scene/IO/SceneBinary/ISceneBinaryCache.hpp"
+#include "Core/Scene/IO/SceneWriter/ISceneWriter.hpp"
 #include "Core/Scene/IScene.hpp"
 #include "Core/Scene/ISceneFactory.hpp"
 #include "Logging/IDwarfLogger.hpp"
@@ -14,12 +16,14 @@ namespace Dwarf
   class SceneIO : public ISceneIO
   {
   private:
-    AssetDirectoryPath                mAssetDirectoryPath;
-    std::shared_ptr<IDwarfLogger>     mLogger;
-    std::shared_ptr<ISceneFactory>    mSceneFactory;
-    std::shared_ptr<IProjectSettings> mProjectSettings;
-    std::shared_ptr<IAssetDatabase>   mAssetDatabase;
-    std::shared_ptr<IFileHandler>     mFileHandler;
+    AssetDirectoryPath                 mAssetDirectoryPath;
+    std::shared_ptr<IDwarfLogger>      mLogger;
+    std::shared_ptr<ISceneFactory>     mSceneFactory;
+    std::shared_ptr<IProjectSettings>  mProjectSettings;
+    std::shared_ptr<IAssetDatabase>    mAssetDatabase;
+    std::shared_ptr<IFileHandler>      mFileHandler;
+    std::shared_ptr<ISceneBinaryCache> mSceneBinaryCache;
+    std::shared_ptr<ISceneWriter>      mSceneWriter;
 
     /**
      * @brief Writes the serialized scene data to a given path
@@ -42,15 +46,18 @@ namespace Dwarf
     CreateNewSceneName(const std::filesystem::path& directory) -> std::string;
 
   public:
-    SceneIO(const AssetDirectoryPath&         assetDirectoryPath,
-            std::shared_ptr<IDwarfLogger>     logger,
-            std::shared_ptr<IProjectSettings> projectSettings,
-            std::shared_ptr<ISceneFactory>    sceneFactory,
-            std::shared_ptr<IAssetDatabase>   assetDatabase,
-            std::shared_ptr<IFileHandler>     fileHandler);
+    SceneIO(const AssetDirectoryPath&          assetDirectoryPath,
+            std::shared_ptr<IDwarfLogger>      logger,
+            std::shared_ptr<IProjectSettings>  projectSettings,
+            std::shared_ptr<ISceneFactory>     sceneFactory,
+            std::shared_ptr<IAssetDatabase>    assetDatabase,
+            std::shared_ptr<IFileHandler>      fileHandler,
+            std::shared_ptr<ISceneBinaryCache> sceneBinaryCache,
+            std::shared_ptr<ISceneWriter>      sceneWriter);
 
     /**
-     * @brief Serializes and writes a scene to it's designated path
+     * @brief Takes a snapshot of a scene and queues it to be written to it's
+     * designated path in the background
      *
      * @param scene Scene to save to disk
      */
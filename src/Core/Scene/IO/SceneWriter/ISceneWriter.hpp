@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Core/Scene/IO/SceneBinary/SceneGraphData.hpp"
+#include "Core/UUID.hpp"
+#include <filesystem>
+
+namespace Dwarf
+{
+  /**
+   * @brief Class that writes scene files without blocking the caller
+   *
+   */
+  class ISceneWriter
+  {
+  public:
+    virtual ~ISceneWriter() = default;
+
+    /**
+     * @brief Queues a snapshot of a scene to be written to its scene file. A
+     * queued write of the same file that did not start yet is replaced.
+     *
+     * @param graph Snapshot of the scene, including the settings
+     * @param scenePath Path of the scene file
+     * @param sceneId ID of the scene asset
+     * @param onWritten Called on the writer thread once the scene file is in
+     * place, not called if the write fails or is replaced
+     */
+    virtual void
+    Write(SceneGraphData               graph,
+          const std::filesystem::path& scenePath,
+          const UUID&                  sceneId,
+          std::function<void()>        onWritten) = 0;
+
+    /**
+     * @brief Blocks until all queued scene files are written
+     *
+     */
+    virtual void
+    Flush() = 0;
+  };
+}
\ No newline at end of file
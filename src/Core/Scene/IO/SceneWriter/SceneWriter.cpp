@@ -0,0 +1,292 @@
+#include "pch.hpp"
+
+#include "Core/Scene/Scene.hpp"
+#include "SceneWriter.hpp"
+#include <future>
+
+namespace Dwarf
+{
+  namespace
+  {
+    /// @brief Serializes an entity and its children with the serializers of
+    /// Entity::Serialize.
+    auto
+    SerializeEntity(const SceneGraphData&                     graph,
+                    const std::vector<std::vector<uint32_t>>& children,
+                    uint32_t index) -> nlohmann::json
+    {
+      const SceneEntityData& entity = graph.Entities[index];
+
+      std::optional<nlohmann::json> light;
+      if (entity.Light)
+      {
+        light = Scene::CreateLight(*entity.Light).Serialize();
+      }
+
+      std::optional<nlohmann::json> meshRenderer;
+      if (entity.MeshRenderer)
+      {
+        std::optional<UUID> model;
+        if (entity.MeshRenderer->Model)
+        {
+          model = UUID(*entity.MeshRenderer->Model);
+        }
+
+        std::map<int, std::optional<UUID>> materials;
+        for (const SceneMaterialSlotData& slot : entity.MeshRenderer->Materials)
+        {
+          materials[slot.Index] =
+            slot.Material ? std::optional<UUID>(UUID(*slot.Material))
+                          : std::nullopt;
+        }
+
+        meshRenderer = MeshRendererComponent::SerializeAssetIds(
+          model, materials, entity.MeshRenderer->IsHidden);
+      }
+
+      nlohmann::json serializedEntity = Entity::SerializeFields(
+        UUID(entity.Id),
+        entity.Name,
+        TransformComponent(entity.Position, entity.Rotation, entity.Scale)
+          .Serialize(),
+        std::move(light),
+        std::move(meshRenderer));
+
+      for (uint32_t child : children[index])
+      {
+        serializedEntity["Children"].push_back(
+          SerializeEntity(graph, children, child));
+      }
+
+      return serializedEntity;
+    }
+
+    /// @brief Indents every line of a dumped JSON value but the first one.
+    /// Strings are escaped by the dump, so every line break is a separator.
+    auto
+    Indent(const std::string& text, size_t indent) -> std::string
+    {
+      std::string result;
+      result.reserve(text.size());
+      for (char character : text)
+      {
+        result.push_back(character);
+        if (character == '\n')
+        {
+          result.append(indent, ' ');
+        }
+      }
+      return result;
+    }
+  }
+
+  SceneWriter::SceneWriter(const ProjectPath&                 projectPath,
+                           std::shared_ptr<IDwarfLogger>      logger,
+                           std::shared_ptr<ISceneBinaryCache> sceneBinaryCache)
+    : mLogger(std::move(logger))
+    , mSceneBinaryCache(std::move(sceneBinaryCache))
+    , mTemporaryDirectory(projectPath.t / TEMPORARY_DIRECTORY)
+  {
+    mWorkerThread = std::thread([this]() { WorkerThread(); });
+    mLogger->LogDebug(Log("SceneWriter created", "SceneWriter"));
+  }
+
+  SceneWriter::~SceneWriter()
+  {
+    {
+      std::scoped_lock lock(mMutex);
+      mStop = true;
+    }
+    mJobCondition.notify_one();
+
+    if (mWorkerThread.joinable())
+    {
+      mWorkerThread.join();
+    }
+    mLogger->LogDebug(Log("SceneWriter destroyed", "SceneWriter"));
+  }
+
+  auto
+  SceneWriter::SerializeScene(const SceneGraphData& graph,
+                              uint32_t threadCount) -> std::string
+  {
+    std::vector<std::vector<uint32_t>> children(graph.Entities.size());
+    std::vector<uint32_t>              roots;
+    for (uint32_t index = 0; index < graph.Entities.size(); ++index)
+    {
+      uint32_t parent = graph.Entities[index].Parent;
+      (parent == SceneEntityData::NO_PARENT ? roots : children[parent])
+        .push_back(index);
+    }
+
+    // Every task serializes a contiguous range of the top level entities, the
+    // first one runs on the calling thread when its result is retrieved
+    threadCount =
+      std::clamp(threadCount, 1U, std::max((uint32_t)roots.size(), 1U));
+    std::vector<std::future<std::string>> tasks;
+    for (uint32_t task = 0; task < threadCount; ++task)
+    {
+      size_t first = roots.size() * task / threadCount;
+      size_t last = roots.size() * (task + 1) / threadCount;
+      tasks.push_back(std::async(
+        task == 0 ? std::launch::deferred : std::launch::async,
+        [&graph, &children, &roots, first, last]()
+        {
+          std::string text;
+          for (size_t index = first; index < last; ++index)
+          {
+            text += index == 0 ? "\n    " : ",\n    ";
+            text += Indent(
+              SerializeEntity(graph, children, roots[index]).dump(2), 4);
+          }
+          return text;
+        }));
+    }
+
+    std::string result = "{\n  \"Graph\": [";
+    for (std::future<std::string>& task : tasks)
+    {
+      result += task.get();
+    }
+    result += roots.empty() ? "]" : "\n  ]";
+
+    nlohmann::json settings = graph.Settings.empty()
+                                ? nlohmann::json()
+                                : nlohmann::json::parse(graph.Settings);
+    result += ",\n  \"Settings\": ";
+    result += Indent(settings.dump(2), 2);
+    result += "\n}";
+    return result;
+  }
+
+  void
+  SceneWriter::Write(SceneGraphData               graph,
+                     const std::filesystem::path& scenePath,
+                     const UUID&                  sceneId,
+                     std::function<void()>        onWritten)
+  {
+    {
+      std::scoped_lock lock(mMutex);
+      auto queued = std::ranges::find(mJobs, scenePath, &WriteJob::ScenePath);
+      if (queued != mJobs.end())
+      {
+        queued->Graph = std::move(graph);
+        queued->SceneId = sceneId;
+        queued->OnWritten = std::move(onWritten);
+      }
+      else
+      {
+        mJobs.push_back(
+          { std::move(graph), scenePath, sceneId, std::move(onWritten) });
+      }
+    }
+    mJobCondition.notify_one();
+  }
+
+  void
+  SceneWriter::Flush()
+  {
+    std::unique_lock lock(mMutex);
+    mIdleCondition.wait(lock,
+                        [this]() { return mJobs.empty() && !mIsWriting; });
+  }
+
+  void
+  SceneWriter::WorkerThread()
+  {
+    while (true)
+    {
+      WriteJob job;
+      {
+        std::unique_lock lock(mMutex);
+        mJobCondition.wait(lock,
+                           [this]() { return mStop || !mJobs.empty(); });
+
+        // The queue is drained before stopping, so no save gets lost
+        if (mJobs.empty())
+        {
+          return;
+        }
+        job = std::move(mJobs.front());
+        mJobs.pop_front();
+        mIsWriting = true;
+      }
+
+      try
+      {
+        if (WriteScene(job) && job.OnWritten)
+        {
+          job.OnWritten();
+        }
+      }
+      catch (const std::exception& exception)
+      {
+        mLogger->LogError(Log(fmt::format("Failed to save {}: {}",
+                                          job.ScenePath.string(),
+                                          exception.what()),
+                              "SceneWriter"));
+      }
+
+      {
+        std::scoped_lock lock(mMutex);
+        mIsWriting = false;
+      }
+      mIdleCondition.notify_all();
+    }
+  }
+
+  auto
+  SceneWriter::WriteScene(const WriteJob& job) -> bool
+  {
+    std::string content =
+      SerializeScene(job.Graph, std::thread::hardware_concurrency());
+
+    std::error_code error;
+    std::filesystem::create_directories(mTemporaryDirectory, error);
+    if (error)
+    {
+      mLogger->LogError(Log(fmt::format("Failed to create {}: {}",
+                                        mTemporaryDirectory.string(),
+                                        error.message()),
+                            "SceneWriter"));
+      return false;
+    }
+
+    // The temporary file is kept out of the asset directory, so the asset
+    // watcher never picks it up
+    std::filesystem::path temporaryPath =
+      mTemporaryDirectory / (job.SceneId.toString() + ".dscene.tmp");
+    {
+      std::ofstream file(temporaryPath, std::ios::trunc);
+      file << content << "\n";
+      file.close();
+      if (file.fail())
+      {
+        mLogger->LogError(
+          Log(fmt::format("Failed to write {}", temporaryPath.string()),
+              "SceneWriter"));
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+      }
+    }
+
+    std::filesystem::rename(temporaryPath, job.ScenePath, error);
+    if (error)
+    {
+      mLogger->LogError(Log(fmt::format("Failed to save {}: {}",
+                                        job.ScenePath.string(),
+                                        error.message()),
+                            "SceneWriter"));
+      std::filesystem::remove(temporaryPath, error);
+      return false;
+    }
+
+    mLogger->LogDebug(
+      Log(fmt::format("Saved scene to {}", job.ScenePath.string()),
+          "SceneWriter"));
+
+    // Cooked after the scene file, so the binary is newer and used on load
+    mSceneBinaryCache->Store(job.SceneId, job.Graph);
+    return true;
+  }
+}
\ No newline at end of file
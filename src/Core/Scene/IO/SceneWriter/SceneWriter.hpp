@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Core/Scene/IO/SceneBinary/ISceneBinaryCache.hpp"
+#include "ISceneWriter.hpp"
+#include "Logging/IDwarfLogger.hpp"
+#include "Project/ProjectTypes.hpp"
+#include <boost/di.hpp>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace Dwarf
+{
+  /// @brief Scene writer serializing and writing the queued snapshots on a
+  /// background thread. A scene is written to a temporary file in the cache
+  /// directory of the project and then renamed to the scene file, so a crash
+  /// during a save never leaves a partially written scene behind.
+  class SceneWriter : public ISceneWriter
+  {
+  private:
+    struct WriteJob
+    {
+      SceneGraphData        Graph;
+      std::filesystem::path ScenePath;
+      UUID                  SceneId;
+      std::function<void()> OnWritten;
+    };
+
+    std::shared_ptr<IDwarfLogger>      mLogger;
+    std::shared_ptr<ISceneBinaryCache> mSceneBinaryCache;
+    std::filesystem::path              mTemporaryDirectory;
+
+    std::mutex              mMutex;
+    std::condition_variable mJobCondition;
+    std::condition_variable mIdleCondition;
+    std::deque<WriteJob>    mJobs;
+    bool                    mIsWriting = false;
+    bool                    mStop = false;
+    std::thread             mWorkerThread;
+
+    void
+    WorkerThread();
+
+    /// @brief Writes a scene file and cooks the binary of the scene.
+    /// @param job The queued snapshot.
+    /// @return Whether the scene file was written.
+    auto
+    WriteScene(const WriteJob& job) -> bool;
+
+  public:
+    /// @brief Directory of the temporary files relative to the project
+    /// directory.
+    static constexpr const char* TEMPORARY_DIRECTORY = "Cache/Temp";
+
+    BOOST_DI_INJECT(SceneWriter,
+                    const ProjectPath&                 projectPath,
+                    std::shared_ptr<IDwarfLogger>      logger,
+                    std::shared_ptr<ISceneBinaryCache> sceneBinaryCache);
+
+    /// @brief Writes the queued snapshots before the worker is stopped.
+    ~SceneWriter() override;
+
+    SceneWriter(const SceneWriter&) = delete;
+    auto
+    operator=(const SceneWriter&) -> SceneWriter& = delete;
+
+    /// @brief Serializes a scene graph into the JSON scene format, indented
+    /// by 2 spaces. The entities attached to the root are serialized in
+    /// parallel.
+    /// @param graph The scene graph, including the settings.
+    /// @param threadCount Number of threads serializing the entities,
+    /// including the calling thread.
+    /// @return The text of the scene file.
+    [[nodiscard]] static auto
+    SerializeScene(const SceneGraphData& graph, uint32_t threadCount)
+      -> std::string;
+
+    /**
+     * @brief Queues a snapshot of a scene to be written to its scene file. A
+     * queued write of the same file that did not start yet is replaced.
+     *
+     * @param graph Snapshot of the scene, including the settings
+     * @param scenePath Path of the scene file
+     * @param sceneId ID of the scene asset
+     * @param onWritten Called on the writer thread once the scene file is in
+     * place, not called if the write fails or is replaced
+     */
+    void
+    Write(SceneGraphData               graph,
+          const std::filesystem::path& scenePath,
+          const UUID&                  sceneId,
+          std::function<void()>        onWritten) override;
+
+    /**
+     * @brief Blocks until all queued scene files are written
+     *
+     */
+    void
+    Flush() override;
+  };
+}
\ No newline at end of file
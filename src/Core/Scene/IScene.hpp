@@ -1,7 +1,13 @@
 #pragma once
 
+#include "Core/Scene/ChangeTracking/SceneChangeTracker.hpp"
+#include "Core/Scene/ChangeTracking/SceneDelta.hpp"
 #include "Core/Scene/Entity/Entity.hpp"
+#include "Core/Scene/Hierarchy/TransformHierarchy.hpp"
+#include "Core/Scene/IO/SceneBinary/SceneGraphData.hpp"
 #include "Core/Scene/Properties/ISceneProperties.hpp"
+#include "Core/Scene/RenderProxy/RenderProxySync.hpp"
+#include "Core/Scene/Spatial/SceneSpatialIndex.hpp"
 #include "ISceneObserver.hpp"
 #include "Utilities/ISerializable.hpp"
 #include <entt/entity/fwd.hpp>
@@ -49,11 +55,86 @@ namespace Dwarf
     virtual void
     DeleteEntity(const Entity& entity) = 0;
 
+    /// @brief Creates the entities of a flat scene graph in one batch. The
+    /// components are inserted per type, and the scene observers are notified
+    /// once the batch is complete.
+    /// @param graph Entities to create, every parent preceding its children.
+    /// @param parent Entity the top level entities of the graph are attached
+    /// to.
+    /// @return Handles of the created entities in the order of the graph.
+    virtual auto
+    CreateEntities(const SceneGraphData& graph, entt::entity parent)
+      -> std::vector<entt::entity> = 0;
+
+    /// @brief Whether a batch of entities is being created. Component
+    /// listeners can skip their work until the batch is complete.
+    [[nodiscard]] virtual auto
+    IsCreatingEntities() const -> bool = 0;
+
+    /// @brief Retrieves the world transforms of the entity hierarchy.
+    /// @return The transform hierarchy.
+    virtual auto
+    GetTransformHierarchy() -> TransformHierarchy& = 0;
+
+    /// @brief Retrieves the world space bounds of the mesh renderers. Updated
+    /// after the transform hierarchy.
+    /// @return The spatial index.
+    virtual auto
+    GetSpatialIndex() -> SceneSpatialIndex& = 0;
+
+    /// @brief Retrieves the synchronization of the render proxies, which
+    /// resolve the mesh renderers for the renderer.
+    /// @return The render proxy synchronization.
+    virtual auto
+    GetRenderProxies() -> RenderProxySync& = 0;
+
     /// @brief Returns the recursive model matrix of a transform.
     /// @param transform A transform component instance.
     /// @return 4x4 model matrix composition of a transform and its full parent
-    /// chain.
+    /// chain, as of the last update of the transform hierarchy.
     virtual auto
     GetFullModelMatrix(TransformComponent& transform) -> glm::mat4 = 0;
+
+    /// @brief Serializes the entities and the settings of the scene into a
+    /// flat scene graph.
+    /// @return The scene graph.
+    virtual auto
+    SerializeGraph() -> SceneGraphData = 0;
+
+    /// @brief Retrieves the versions at which the entities last changed.
+    /// Every construction, update through the registry and destruction of a
+    /// scene component is recorded.
+    /// @return The change tracker.
+    virtual auto
+    GetChangeTracker() -> SceneChangeTracker& = 0;
+
+    /// @brief Captures the state of the entities that changed since a
+    /// version of the change tracker.
+    /// @param version Version of the change tracker.
+    /// @return The changed and removed entities.
+    virtual auto
+    CaptureDelta(uint64_t version) -> SceneDelta = 0;
+
+    /// @brief Brings the entities of a delta into the captured state.
+    /// Missing entities are created, removed entities are deleted.
+    /// @param delta The delta to apply.
+    virtual void
+    ApplyDelta(const SceneDelta& delta) = 0;
+
+    /// @brief Whether the scene components changed since the scene was
+    /// loaded or last marked as saved.
+    [[nodiscard]] virtual auto
+    HasUnsavedChanges() const -> bool = 0;
+
+    /// @brief Marks the current state of the scene as saved.
+    virtual void
+    MarkSaved() = 0;
+
+    /// @brief Creates a callback marking the current state of the scene as
+    /// saved, for writes that finish in the background. The callback can run
+    /// on any thread, even after the scene was destroyed.
+    /// @return The callback to run once the state was written.
+    virtual auto
+    CreateSaveCallback() -> std::function<void()> = 0;
   };
 }
\ No newline at end of file
@@ -10,5 +10,10 @@ namespace Dwarf
 
     virtual void
     OnEntityDeleted() = 0;
+
+    /// @brief Called once after a batch of entities has been created.
+    /// Component listeners that skipped the batch catch up here.
+    virtual void
+    OnEntitiesCreated() = 0;
   };
 }
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Core/Scene/Spatial/BoundingBox.hpp"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Dwarf
+{
+  class IMesh;
+  struct MaterialAsset;
+
+  /// @brief A submesh of a render proxy with its resolved material.
+  struct RenderProxyMesh
+  {
+    std::shared_ptr<IMesh> Mesh;
+    MaterialAsset*         Material = nullptr;
+  };
+
+  /// @brief Render data of a mesh renderer, resolved from its asset
+  /// references so the renderer does not look up models and materials every
+  /// time it gathers the scene geometry. Kept in sync by the RenderProxySync
+  /// of the scene.
+  struct RenderProxyComponent
+  {
+    static constexpr uint8_t VISIBLE = 1U << 0U;
+    static constexpr uint8_t CAST_SHADOW = 1U << 1U;
+
+    /// @brief The submeshes of the model that have a valid material assigned.
+    std::vector<RenderProxyMesh> Meshes;
+
+    /// @brief Local bounds of the whole model, empty without a valid model.
+    BoundingBox LocalBounds;
+
+    uint8_t Flags = 0;
+
+    [[nodiscard]] auto
+    IsVisible() const -> bool
+    {
+      return (Flags & VISIBLE) != 0;
+    }
+
+    [[nodiscard]] auto
+    CastsShadow() const -> bool
+    {
+      return (Flags & CAST_SHADOW) != 0;
+    }
+  };
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "pch.hpp"
+
+#include "Core/Asset/Database/AssetComponents.hpp"
+#include "Core/Scene/RenderProxy/RenderProxySync.hpp"
+
+namespace Dwarf
+{
+  RenderProxySync::RenderProxySync(entt::registry& registry)
+    : mRegistry(registry)
+  {
+    mConnections.emplace_back(
+      registry.on_construct<MeshRendererComponent>()
+        .connect<&RenderProxySync::OnMeshRendererChanged>(*this));
+    mConnections.emplace_back(
+      registry.on_update<MeshRendererComponent>()
+        .connect<&RenderProxySync::OnMeshRendererChanged>(*this));
+    mConnections.emplace_back(
+      registry.on_destroy<MeshRendererComponent>()
+        .connect<&RenderProxySync::OnMeshRendererDestroyed>(*this));
+  }
+
+  void
+  RenderProxySync::RefreshAll()
+  {
+    // Reimported models may have different bounds
+    mModelBounds.clear();
+
+    entt::registry&             registry = mRegistry.get();
+    std::lock_guard<std::mutex> lock(mMutex);
+    mIsRefreshing = true;
+    for (auto view = registry.view<MeshRendererComponent>();
+         auto [entity, meshRenderer] : view.each())
+    {
+      registry.emplace_or_replace<RenderProxyComponent>(
+        entity, CreateProxy(meshRenderer));
+    }
+    mIsRefreshing = false;
+  }
+
+  auto
+  RenderProxySync::IsRefreshing() const -> bool
+  {
+    return mIsRefreshing;
+  }
+
+  auto
+  RenderProxySync::GetMutex() -> std::mutex&
+  {
+    return mMutex;
+  }
+
+  auto
+  RenderProxySync::CreateProxy(const MeshRendererComponent& meshRenderer)
+    -> RenderProxyComponent
+  {
+    RenderProxyComponent proxy;
+    if (!meshRenderer.IsHidden)
+    {
+      proxy.Flags |= RenderProxyComponent::VISIBLE;
+    }
+    if (meshRenderer.CastShadow)
+    {
+      proxy.Flags |= RenderProxyComponent::CAST_SHADOW;
+    }
+
+    if (!meshRenderer.ModelAsset || !meshRenderer.ModelAsset->IsValid())
+    {
+      return proxy;
+    }
+
+    auto& model =
+      dynamic_cast<ModelAsset&>(meshRenderer.ModelAsset->GetAsset());
+    proxy.LocalBounds =
+      GetModelBounds(meshRenderer.ModelAsset->GetUID(), model);
+
+    proxy.Meshes.reserve(model.Meshes().size());
+    for (const auto& mesh : model.Meshes())
+    {
+      auto material = meshRenderer.MaterialAssets.find(
+        static_cast<int>(mesh->GetMaterialIndex()));
+      if (material != meshRenderer.MaterialAssets.end() && material->second &&
+          material->second->IsValid())
+      {
+        auto& materialAsset =
+          dynamic_cast<MaterialAsset&>(material->second->GetAsset());
+        proxy.Meshes.push_back({ mesh, &materialAsset });
+      }
+    }
+
+    return proxy;
+  }
+
+  auto
+  RenderProxySync::GetModelBounds(const UUID& id, const ModelAsset& model)
+    -> BoundingBox
+  {
+    auto cached = mModelBounds.find(id);
+    if (cached != mModelBounds.end())
+    {
+      return cached->second;
+    }
+
+    BoundingBox bounds;
+    for (const auto& mesh : model.Meshes())
+    {
+      for (const Vertex& vertex : mesh->GetVertices())
+      {
+        bounds.Merge(vertex.Position);
+      }
+    }
+
+    mModelBounds.emplace(id, bounds);
+    return bounds;
+  }
+
+  void
+  RenderProxySync::OnMeshRendererChanged(entt::registry& registry,
+                                         entt::entity    entity)
+  {
+    RenderProxyComponent proxy =
+      CreateProxy(registry.get<MeshRendererComponent>(entity));
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    registry.emplace_or_replace<RenderProxyComponent>(entity, std::move(proxy));
+  }
+
+  void
+  RenderProxySync::OnMeshRendererDestroyed(entt::registry& registry,
+                                           entt::entity    entity)
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    registry.remove<RenderProxyComponent>(entity);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Core/Scene/Components/SceneComponents.hpp"
+#include "Core/Scene/RenderProxy/RenderProxyComponent.hpp"
+#include <entt/entt.hpp>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Dwarf
+{
+  struct ModelAsset;
+
+  /// @brief Keeps a RenderProxyComponent next to every mesh renderer of a
+  /// registry. The proxy is rebuilt whenever the mesh renderer is constructed
+  /// or patched and removed with it.
+  ///
+  /// The proxies point into the assets, so they have to be refreshed after
+  /// assets are reimported or removed.
+  ///
+  /// Proxies are only created, replaced and removed while holding the proxy
+  /// mutex, so other threads can read them by holding it as well.
+  class RenderProxySync
+  {
+  public:
+    /// @brief Constructor.
+    /// @param registry Registry holding the mesh renderers.
+    explicit RenderProxySync(entt::registry& registry);
+
+    RenderProxySync(const RenderProxySync&) = delete;
+    auto
+    operator=(const RenderProxySync&) -> RenderProxySync& = delete;
+
+    /// @brief Resolves the proxies of all mesh renderers again. The proxies
+    /// are patched, so their listeners see an update for every entity.
+    void
+    RefreshAll();
+
+    /// @brief Whether RefreshAll is patching the proxies. Listeners that
+    /// rebuild everything anyway can skip the single updates.
+    [[nodiscard]] auto
+    IsRefreshing() const -> bool;
+
+    /// @brief Retrieves the mutex held while the proxies are changed.
+    auto
+    GetMutex() -> std::mutex&;
+
+  private:
+    std::reference_wrapper<entt::registry> mRegistry;
+    bool                                   mIsRefreshing = false;
+    std::mutex                             mMutex;
+
+    /// @brief Local bounds of the models by their asset ID.
+    std::unordered_map<UUID, BoundingBox> mModelBounds;
+
+    std::vector<entt::scoped_connection> mConnections;
+
+    /// @brief Resolves the render data of a mesh renderer.
+    auto
+    CreateProxy(const MeshRendererComponent& meshRenderer)
+      -> RenderProxyComponent;
+
+    /// @brief Retrieves the local bounds of a model, computed on first use.
+    auto
+    GetModelBounds(const UUID& id, const ModelAsset& model) -> BoundingBox;
+
+    void
+    OnMeshRendererChanged(entt::registry& registry, entt::entity entity);
+
+    void
+    OnMeshRendererDestroyed(entt::registry& registry, entt::entity entity);
+  };
+}
\ No newline at end of file
@@ -6,13 +6,44 @@
 
 namespace Dwarf
 {
+  namespace
+  {
+    /// @brief Marks a scene as creating entities while alive, also when the
+    /// creation throws.
+    class EntityBatchScope
+    {
+    private:
+      uint32_t& mDepth;
+
+    public:
+      explicit EntityBatchScope(uint32_t& depth)
+        : mDepth(depth)
+      {
+        ++mDepth;
+      }
+
+      ~EntityBatchScope() { --mDepth; }
+
+      EntityBatchScope(const EntityBatchScope&) = delete;
+      auto
+      operator=(const EntityBatchScope&) -> EntityBatchScope& = delete;
+    };
+  }
+
   Scene::Scene(std::unique_ptr<ISceneProperties> properties,
                std::shared_ptr<IAssetDatabase>   assetDatabase)
     : mRegistry(entt::registry())
     , mProperties(std::move(properties))
     , mRootEntity(CreateRootEntity())
     , mAssetDatabase(std::move(assetDatabase))
+    , mTransformHierarchy(mRegistry, mRootEntity.GetHandle())
+    , mChangeTracker(mRegistry)
+    , mRenderProxies(mRegistry)
+    , mSpatialIndex(mRegistry, mTransformHierarchy)
   {
+    mTransformHierarchy.SetThreadCount(std::thread::hardware_concurrency());
+    TrackSceneChanges();
+    IndexEntities();
   }
 
   Scene::Scene(const SerializedGraph&            serializedScene,
@@ -22,8 +53,35 @@ namespace Dwarf
     , mProperties(std::move(properties))
     , mRootEntity(CreateRootEntity())
     , mAssetDatabase(std::move(assetDatabase))
+    , mTransformHierarchy(mRegistry, mRootEntity.GetHandle())
+    , mChangeTracker(mRegistry)
+    , mRenderProxies(mRegistry)
+    , mSpatialIndex(mRegistry, mTransformHierarchy)
   {
+    mTransformHierarchy.SetThreadCount(std::thread::hardware_concurrency());
+    TrackSceneChanges();
+    IndexEntities();
     Deserialize(serializedScene.t);
+    MarkSaved();
+  }
+
+  Scene::Scene(const SceneGraphData&             sceneGraph,
+               std::unique_ptr<ISceneProperties> properties,
+               std::shared_ptr<IAssetDatabase>   assetDatabase)
+    : mRegistry(entt::registry())
+    , mProperties(std::move(properties))
+    , mRootEntity(CreateRootEntity())
+    , mAssetDatabase(std::move(assetDatabase))
+    , mTransformHierarchy(mRegistry, mRootEntity.GetHandle())
+    , mChangeTracker(mRegistry)
+    , mRenderProxies(mRegistry)
+    , mSpatialIndex(mRegistry, mTransformHierarchy)
+  {
+    mTransformHierarchy.SetThreadCount(std::thread::hardware_concurrency());
+    TrackSceneChanges();
+    IndexEntities();
+    Deserialize(sceneGraph);
+    MarkSaved();
   }
 
   Scene::~Scene()
@@ -47,90 +105,267 @@ namespace Dwarf
   void
   Scene::Deserialize(const nlohmann::json& serializedSceneGraph)
   {
+    SceneGraphData sceneGraph;
     for (auto const& element : serializedSceneGraph)
     {
-      Entity newEntity = DeserializeEntity(element);
-      newEntity.SetParent(mRootEntity.GetHandle());
+      FlattenEntity(element, SceneEntityData::NO_PARENT, sceneGraph);
     }
+
+    CreateEntities(sceneGraph, mRootEntity.GetHandle());
   }
 
-  auto
-  Scene::DeserializeEntity(const nlohmann::json& serializedEntity) -> Entity
+  void
+  Scene::FlattenEntity(const nlohmann::json& serializedEntity,
+                       uint32_t              parent,
+                       SceneGraphData&       sceneGraph)
   {
-    Entity newEntity =
-      CreateEntityWithUID(UUID(serializedEntity["guid"].get<std::string>()),
-                          serializedEntity["name"]);
-
-    auto& transformComponent = newEntity.GetComponent<TransformComponent>();
-    transformComponent.SetPosition(
-      serializedEntity["TransformComponent"]["Position"].get<glm::vec3>());
-    transformComponent.SetEulerAngles(
-      serializedEntity["TransformComponent"]["Rotation"].get<glm::vec3>());
-    transformComponent.SetScale(
-      serializedEntity["TransformComponent"]["Scale"].get<glm::vec3>());
+    auto             index = (uint32_t)sceneGraph.Entities.size();
+    SceneEntityData& data = sceneGraph.Entities.emplace_back();
+    data.Id = UUID(serializedEntity["guid"].get<std::string>()).toBytes();
+    data.Name = serializedEntity["name"].get<std::string>();
+    data.Parent = parent;
+
+    const nlohmann::json& transform = serializedEntity["TransformComponent"];
+    data.Position = transform["Position"].get<glm::vec3>();
+    data.Rotation =
+      TransformComponent::WrapEuler(transform["Rotation"].get<glm::vec3>());
+    data.Scale = transform["Scale"].get<glm::vec3>();
 
     if (serializedEntity.contains("LightComponent"))
     {
-      newEntity.AddComponent<LightComponent>(
-        serializedEntity["LightComponent"]);
+      LightComponent  light(serializedEntity["LightComponent"]);
+      SceneLightData& lightData = data.Light.emplace();
+      lightData.Type = light.Type;
+      lightData.Color = light.Color;
+      lightData.Attenuation = light.Attenuation;
+      lightData.Radius = light.Radius;
+      lightData.OpeningAngle = light.OpeningAngle;
     }
 
     if (serializedEntity.contains("MeshRendererComponent"))
     {
-      std::unique_ptr<IAssetReference> modelAsset = nullptr;
+      const nlohmann::json& meshRenderer =
+        serializedEntity["MeshRendererComponent"];
+      SceneMeshRendererData& meshRendererData = data.MeshRenderer.emplace();
 
-      if (!serializedEntity["MeshRendererComponent"]["Model"]
-             .get<std::string>()
-             .empty())
+      if (!meshRenderer["Model"].get<std::string>().empty())
       {
-        modelAsset = mAssetDatabase->Retrieve(
-          UUID(serializedEntity["MeshRendererComponent"]["Model"]
-                 .get<std::string>()));
+        meshRendererData.Model =
+          UUID(meshRenderer["Model"].get<std::string>()).toBytes();
       }
 
-      std::map<int, std::unique_ptr<IAssetReference>> materialAssets;
-
-      if (serializedEntity["MeshRendererComponent"].contains("Materials"))
+      if (meshRenderer.contains("Materials"))
       {
-        for (auto it =
-               serializedEntity["MeshRendererComponent"]["Materials"].begin();
-             it != serializedEntity["MeshRendererComponent"]["Materials"].end();
+        for (auto it = meshRenderer["Materials"].begin();
+             it != meshRenderer["Materials"].end();
              ++it)
         {
-          int index = std::stoi(it.key());
+          SceneMaterialSlotData& slot =
+            meshRendererData.Materials.emplace_back();
+          slot.Index = std::stoi(it.key());
           if (!it.value().get<std::string>().empty() &&
               (it.value().get<std::string>() != "null"))
           {
-            materialAssets[index] =
-              mAssetDatabase->Retrieve(UUID(it.value().get<std::string>()));
-          }
-          else
-          {
-            materialAssets[index] = nullptr;
+            slot.Material = UUID(it.value().get<std::string>()).toBytes();
           }
         }
       }
 
-      bool isHidden = false;
-      if (serializedEntity["MeshRendererComponent"].contains("Hidden"))
+      if (meshRenderer.contains("Hidden"))
       {
-        isHidden = serializedEntity["MeshRendererComponent"]["Hidden"];
+        meshRendererData.IsHidden = meshRenderer["Hidden"].get<bool>();
       }
-
-      auto& comp = newEntity.AddComponent<MeshRendererComponent>(
-        std::move(modelAsset), std::move(materialAssets));
     }
 
     if (serializedEntity.contains("Children"))
     {
       for (auto const& element : serializedEntity["Children"])
       {
-        Entity childEntity = DeserializeEntity(element);
-        childEntity.SetParent(newEntity.GetHandle());
+        FlattenEntity(element, index, sceneGraph);
+      }
+    }
+  }
+
+  void
+  Scene::Deserialize(const SceneGraphData& sceneGraph)
+  {
+    CreateEntities(sceneGraph, mRootEntity.GetHandle());
+  }
+
+  auto
+  Scene::CreateEntities(const SceneGraphData& graph, entt::entity parent)
+    -> std::vector<entt::entity>
+  {
+    std::vector<entt::entity> handles(graph.Entities.size());
+    if (handles.empty())
+    {
+      return handles;
+    }
+
+    mRegistry.create(handles.begin(), handles.end());
+
+    size_t count = handles.size();
+    mRegistry.storage<IDComponent>().reserve(
+      mRegistry.storage<IDComponent>().size() + count);
+    mRegistry.storage<NameComponent>().reserve(
+      mRegistry.storage<NameComponent>().size() + count);
+    mRegistry.storage<TransformComponent>().reserve(
+      mRegistry.storage<TransformComponent>().size() + count);
+
+    std::vector<IDComponent>           ids;
+    std::vector<NameComponent>         names;
+    std::vector<TransformComponent>    transforms;
+    std::vector<entt::entity>          topLevelEntities;
+    std::vector<entt::entity>          lightEntities;
+    std::vector<LightComponent>        lights;
+    std::vector<entt::entity>          meshRendererEntities;
+    std::vector<MeshRendererComponent> meshRenderers;
+    ids.reserve(count);
+    names.reserve(count);
+    transforms.reserve(count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+      const SceneEntityData& data = graph.Entities[index];
+      entt::entity           entity = handles[index];
+
+      ids.emplace_back(UUID(data.Id));
+      names.emplace_back(data.Name.empty() ? "Entity" : data.Name);
+
+      TransformComponent& transform =
+        transforms.emplace_back(data.Position, data.Rotation, data.Scale);
+      if (data.Parent < index)
+      {
+        transform.Parent = handles[data.Parent];
+        transforms[data.Parent].Children.push_back(entity);
+      }
+      else
+      {
+        transform.Parent = parent;
+        topLevelEntities.push_back(entity);
       }
+
+      if (data.Light.has_value())
+      {
+        lights.push_back(CreateLight(*data.Light));
+        lightEntities.push_back(entity);
+      }
+
+      if (data.MeshRenderer.has_value())
+      {
+        meshRenderers.push_back(CreateMeshRenderer(*data.MeshRenderer));
+        meshRendererEntities.push_back(entity);
+      }
+    }
+
+    mRegistry.insert<IDComponent>(handles.begin(), handles.end(), ids.begin());
+    mRegistry.insert<NameComponent>(
+      handles.begin(), handles.end(), names.begin());
+    mRegistry.insert<TransformComponent>(
+      handles.begin(),
+      handles.end(),
+      std::make_move_iterator(transforms.begin()));
+    mRegistry.insert<LightComponent>(
+      lightEntities.begin(), lightEntities.end(), lights.begin());
+
+    if (mRegistry.valid(parent))
+    {
+      std::vector<entt::entity>& children =
+        mRegistry.get<TransformComponent>(parent).Children;
+      children.insert(
+        children.end(), topLevelEntities.begin(), topLevelEntities.end());
+      mRegistry.patch<TransformComponent>(parent);
+    }
+
+    // Listeners skip the construction of every single mesh renderer and the
+    // observers are notified once the batch is complete
+    {
+      EntityBatchScope batch(mEntityBatchDepth);
+      mRegistry.insert<MeshRendererComponent>(
+        meshRendererEntities.begin(),
+        meshRendererEntities.end(),
+        std::make_move_iterator(meshRenderers.begin()));
+    }
+
+    for (auto* observer : mObservers)
+    {
+      observer->OnEntitiesCreated();
     }
 
-    return newEntity;
+    return handles;
+  }
+
+  auto
+  Scene::IsCreatingEntities() const -> bool
+  {
+    return mEntityBatchDepth > 0;
+  }
+
+  auto
+  Scene::GetChangeTracker() -> SceneChangeTracker&
+  {
+    return mChangeTracker;
+  }
+
+  auto
+  Scene::HasUnsavedChanges() const -> bool
+  {
+    return mChangeTracker.GetVersion() != mSavedVersion->load();
+  }
+
+  void
+  Scene::MarkSaved()
+  {
+    mSavedVersion->store(mChangeTracker.GetVersion());
+  }
+
+  auto
+  Scene::CreateSaveCallback() -> std::function<void()>
+  {
+    return [savedVersion = mSavedVersion,
+            version = mChangeTracker.GetVersion()]()
+    { savedVersion->store(version); };
+  }
+
+  void
+  Scene::TrackSceneChanges()
+  {
+    mChangeTracker.Track<NameComponent>();
+    mChangeTracker.Track<TransformComponent>();
+    mChangeTracker.Track<LightComponent>();
+    mChangeTracker.Track<MeshRendererComponent>();
+  }
+
+  void
+  Scene::IndexEntities()
+  {
+    for (entt::entity entity : mRegistry.view<IDComponent>())
+    {
+      OnIdComponentConstruct(mRegistry, entity);
+    }
+
+    mEntityIndexConnections.emplace_back(
+      mRegistry.on_construct<IDComponent>()
+        .connect<&Scene::OnIdComponentConstruct>(*this));
+    mEntityIndexConnections.emplace_back(
+      mRegistry.on_destroy<IDComponent>()
+        .connect<&Scene::OnIdComponentDestroy>(*this));
+  }
+
+  void
+  Scene::OnIdComponentConstruct(entt::registry& registry, entt::entity entity)
+  {
+    mEntityIndex[registry.get<IDComponent>(entity).getId()] = entity;
+  }
+
+  void
+  Scene::OnIdComponentDestroy(entt::registry& registry, entt::entity entity)
+  {
+    auto it = mEntityIndex.find(registry.get<IDComponent>(entity).getId());
+    if (it != mEntityIndex.end() && it->second == entity)
+    {
+      mEntityIndex.erase(it);
+    }
   }
 
   auto
@@ -182,26 +417,27 @@ namespace Dwarf
   }
 
   auto
-  Scene::GetFullModelMatrix(TransformComponent& transform) -> glm::mat4
+  Scene::GetTransformHierarchy() -> TransformHierarchy&
   {
-    auto                   parentMat = glm::mat4(1.0F);
-    std::vector<glm::mat4> matriceStack;
-
-    matriceStack.push_back(transform.GetMatrix());
+    return mTransformHierarchy;
+  }
 
-    if (entt::entity cursor = transform.GetParent(); cursor != entt::null)
-    {
-      Entity cur(cursor, mRegistry);
-      matriceStack.push_back(
-        cur.GetComponent<TransformComponent>().GetMatrix());
-    }
+  auto
+  Scene::GetSpatialIndex() -> SceneSpatialIndex&
+  {
+    return mSpatialIndex;
+  }
 
-    for (auto it = matriceStack.rbegin(); it < matriceStack.rend(); it++)
-    {
-      parentMat *= *it;
-    }
+  auto
+  Scene::GetRenderProxies() -> RenderProxySync&
+  {
+    return mRenderProxies;
+  }
 
-    return parentMat;
+  auto
+  Scene::GetFullModelMatrix(TransformComponent& transform) -> glm::mat4
+  {
+    return mTransformHierarchy.GetWorldMatrix(transform);
   }
 
   void
@@ -218,6 +454,7 @@ namespace Dwarf
       }
 
       Entity(entity.GetParent(), mRegistry).RemoveChild(entity.GetHandle());
+      mRegistry.patch<TransformComponent>(entity.GetParent());
       mRegistry.destroy(entity.GetHandle());
     }
   }
@@ -227,20 +464,303 @@ namespace Dwarf
   {
     nlohmann::json serializedScene;
 
-    serializedScene["Settings"] = mProperties->Serialize();
+    serializedScene["Settings"] =
+      mProperties ? mProperties->Serialize() : nlohmann::json();
 
-    // TODO: Serialize Scene
+    // In hierarchy order, like the scene graph the scene writer saves
     serializedScene["Graph"] = nlohmann::json::array();
+    for (entt::entity child : mRootEntity.GetChildren())
+    {
+      serializedScene["Graph"].push_back(Entity(child, mRegistry).Serialize());
+    }
 
-    for (entt::entity entity : mRegistry.view<IDComponent>())
+    return serializedScene;
+  }
+
+  auto
+  Scene::SerializeGraph() -> SceneGraphData
+  {
+    SceneGraphData graph;
+
+    // Depth first, so every parent precedes its children
+    std::vector<std::pair<entt::entity, uint32_t>> stack;
+    const std::vector<entt::entity>&               rootChildren =
+      mRootEntity.GetComponent<TransformComponent>().Children;
+    for (auto child = rootChildren.rbegin(); child != rootChildren.rend();
+         ++child)
     {
-      Entity e(entity, mRegistry);
-      if (e.GetParent() == mRootEntity.GetHandle())
+      stack.emplace_back(*child, SceneEntityData::NO_PARENT);
+    }
+
+    while (!stack.empty())
+    {
+      auto [entity, parent] = stack.back();
+      stack.pop_back();
+
+      auto             index = (uint32_t)graph.Entities.size();
+      SceneEntityData& data = graph.Entities.emplace_back();
+      data.Parent = parent;
+      CaptureEntity(entity, data);
+
+      const auto& transform = mRegistry.get<TransformComponent>(entity);
+      for (auto child = transform.Children.rbegin();
+           child != transform.Children.rend();
+           ++child)
       {
-        serializedScene["Graph"].push_back(e.Serialize());
+        stack.emplace_back(*child, index);
       }
     }
 
-    return serializedScene;
+    if (mProperties)
+    {
+      graph.Settings = mProperties->Serialize().dump();
+    }
+
+    return graph;
+  }
+
+  auto
+  Scene::CaptureDelta(uint64_t version) -> SceneDelta
+  {
+    SceneDelta delta;
+
+    for (entt::entity entity : mChangeTracker.GetChangedEntities(version))
+    {
+      if (entity == mRootEntity.GetHandle())
+      {
+        delta.RootChildren = GetChildIds(entity);
+        continue;
+      }
+
+      SceneEntityRecord& record = delta.Entities.emplace_back();
+      CaptureEntity(entity, record.Entity);
+      record.Children = GetChildIds(entity);
+
+      entt::entity parent = mRegistry.get<TransformComponent>(entity).Parent;
+      if (parent != mRootEntity.GetHandle() && mRegistry.valid(parent))
+      {
+        record.Parent = mRegistry.get<IDComponent>(parent).getId().toBytes();
+      }
+    }
+
+    for (const UUID& id : mChangeTracker.GetRemovedEntities(version))
+    {
+      delta.RemovedEntities.push_back(id.toBytes());
+    }
+
+    return delta;
+  }
+
+  void
+  Scene::ApplyDelta(const SceneDelta& delta)
+  {
+    // Created entities are added to the ID index through their ID component
+    for (const SceneEntityRecord& record : delta.Entities)
+    {
+      UUID id(record.Entity.Id);
+      if (!mEntityIndex.contains(id))
+      {
+        CreateEntityWithUID(id, record.Entity.Name);
+      }
+    }
+
+    // Components and parents first, so every child is in place before the
+    // orders of the children are restored
+    for (const SceneEntityRecord& record : delta.Entities)
+    {
+      const SceneEntityData& data = record.Entity;
+      entt::entity           entity = mEntityIndex.at(UUID(data.Id));
+
+      mRegistry.replace<NameComponent>(
+        entity, data.Name.empty() ? "Entity" : data.Name);
+      mRegistry.patch<TransformComponent>(
+        entity,
+        [&data](TransformComponent& transform)
+        {
+          transform.Position = data.Position;
+          transform.Rotation = data.Rotation;
+          transform.Scale = data.Scale;
+          transform.DirtyFlag = true;
+        });
+
+      if (data.Light.has_value())
+      {
+        mRegistry.emplace_or_replace<LightComponent>(entity,
+                                                     CreateLight(*data.Light));
+      }
+      else
+      {
+        mRegistry.remove<LightComponent>(entity);
+      }
+
+      if (data.MeshRenderer.has_value())
+      {
+        mRegistry.emplace_or_replace<MeshRendererComponent>(
+          entity, CreateMeshRenderer(*data.MeshRenderer));
+      }
+      else
+      {
+        mRegistry.remove<MeshRendererComponent>(entity);
+      }
+
+      entt::entity parent = mRootEntity.GetHandle();
+      if (record.Parent.has_value() &&
+          mEntityIndex.contains(UUID(*record.Parent)))
+      {
+        parent = mEntityIndex.at(UUID(*record.Parent));
+      }
+      if (mRegistry.get<TransformComponent>(entity).Parent != parent)
+      {
+        Entity(entity, mRegistry).SetParent(parent);
+      }
+    }
+
+    for (const SceneEntityRecord& record : delta.Entities)
+    {
+      ApplyChildOrder(mEntityIndex.at(UUID(record.Entity.Id)), record.Children);
+    }
+    if (delta.RootChildren.has_value())
+    {
+      ApplyChildOrder(mRootEntity.GetHandle(), *delta.RootChildren);
+    }
+
+    // Children that stayed with a removed entity are removed with it
+    for (const UUIDBytes& id : delta.RemovedEntities)
+    {
+      if (auto entity = mEntityIndex.find(UUID(id));
+          entity != mEntityIndex.end())
+      {
+        DeleteEntity(Entity(entity->second, mRegistry));
+      }
+    }
+  }
+
+  void
+  Scene::CaptureEntity(entt::entity entity, SceneEntityData& data)
+  {
+    data.Id = mRegistry.get<IDComponent>(entity).getId().toBytes();
+    data.Name = mRegistry.get<NameComponent>(entity).Name;
+
+    const auto& transform = mRegistry.get<TransformComponent>(entity);
+    data.Position = transform.Position;
+    data.Rotation = transform.Rotation;
+    data.Scale = transform.Scale;
+
+    if (const auto* light = mRegistry.try_get<LightComponent>(entity))
+    {
+      SceneLightData& lightData = data.Light.emplace();
+      lightData.Type = light->Type;
+      lightData.Color = light->Color;
+      lightData.Attenuation = light->Attenuation;
+      lightData.Radius = light->Radius;
+      lightData.OpeningAngle = light->OpeningAngle;
+    }
+
+    if (const auto* meshRenderer =
+          mRegistry.try_get<MeshRendererComponent>(entity))
+    {
+      SceneMeshRendererData& meshRendererData = data.MeshRenderer.emplace();
+      if (meshRenderer->ModelAsset)
+      {
+        meshRendererData.Model = meshRenderer->ModelAsset->GetUID().toBytes();
+      }
+      for (const auto& [slot, material] : meshRenderer->MaterialAssets)
+      {
+        SceneMaterialSlotData& slotData =
+          meshRendererData.Materials.emplace_back();
+        slotData.Index = slot;
+        if (material)
+        {
+          slotData.Material = material->GetUID().toBytes();
+        }
+      }
+      meshRendererData.IsHidden = meshRenderer->IsHidden;
+      meshRendererData.CastShadow = meshRenderer->CastShadow;
+    }
+  }
+
+  auto
+  Scene::CreateLight(const SceneLightData& data) -> LightComponent
+  {
+    LightComponent light;
+    light.Type = data.Type;
+    light.Color = data.Color;
+    light.Attenuation = data.Attenuation;
+    light.Radius = data.Radius;
+    light.OpeningAngle = data.OpeningAngle;
+    return light;
+  }
+
+  auto
+  Scene::CreateMeshRenderer(const SceneMeshRendererData& data)
+    -> MeshRendererComponent
+  {
+    std::unique_ptr<IAssetReference> modelAsset = nullptr;
+    if (data.Model.has_value())
+    {
+      modelAsset = mAssetDatabase->Retrieve(UUID(*data.Model));
+    }
+
+    std::map<int, std::unique_ptr<IAssetReference>> materialAssets;
+    for (const SceneMaterialSlotData& slot : data.Materials)
+    {
+      materialAssets[slot.Index] =
+        slot.Material.has_value()
+          ? mAssetDatabase->Retrieve(UUID(*slot.Material))
+          : nullptr;
+    }
+
+    return { std::move(modelAsset),
+             std::move(materialAssets),
+             data.IsHidden,
+             data.CastShadow };
+  }
+
+  auto
+  Scene::GetChildIds(entt::entity entity) -> std::vector<UUIDBytes>
+  {
+    const auto& transform = mRegistry.get<TransformComponent>(entity);
+
+    std::vector<UUIDBytes> ids;
+    ids.reserve(transform.Children.size());
+    for (entt::entity child : transform.Children)
+    {
+      ids.push_back(mRegistry.get<IDComponent>(child).getId().toBytes());
+    }
+    return ids;
+  }
+
+  void
+  Scene::ApplyChildOrder(entt::entity                  entity,
+                         const std::vector<UUIDBytes>& order)
+  {
+    std::vector<entt::entity>& children =
+      mRegistry.get<TransformComponent>(entity).Children;
+
+    std::unordered_set<entt::entity> remaining(children.begin(),
+                                               children.end());
+    std::vector<entt::entity>        ordered;
+    ordered.reserve(children.size());
+    for (const UUIDBytes& id : order)
+    {
+      auto child = mEntityIndex.find(UUID(id));
+      if (child != mEntityIndex.end() && remaining.erase(child->second) > 0)
+      {
+        ordered.push_back(child->second);
+      }
+    }
+    for (entt::entity child : children)
+    {
+      if (remaining.contains(child))
+      {
+        ordered.push_back(child);
+      }
+    }
+
+    if (ordered != children)
+    {
+      children = std::move(ordered);
+      mRegistry.patch<TransformComponent>(entity);
+    }
   }
 }
\ No newline at end of file
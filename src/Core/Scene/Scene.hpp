@@ -1,12 +1,18 @@
 #pragma once
 
 #include "Core/Asset/Database/IAssetDatabase.hpp"
+#include "Core/Scene/ChangeTracking/SceneChangeTracker.hpp"
 #include "Core/Scene/Components/SceneComponents.hpp"
 #include "Core/Scene/Entity/Entity.hpp"
+#include "Core/Scene/Hierarchy/TransformHierarchy.hpp"
 #include "Core/Scene/IScene.hpp"
 #include "Core/Scene/Properties/ISceneProperties.hpp"
+#include "Core/Scene/RenderProxy/RenderProxySync.hpp"
+#include "Core/Scene/Spatial/SceneSpatialIndex.hpp"
+#include <atomic>
 #include <boost/serialization/strong_typedef.hpp>
 #include <memory>
+#include <unordered_map>
 
 namespace Dwarf
 {
@@ -26,6 +32,31 @@ namespace Dwarf
     /// @brief The settings of the scene.
     std::unique_ptr<ISceneProperties> mProperties;
 
+    /// @brief World matrices of the entities below the root entity.
+    TransformHierarchy mTransformHierarchy;
+
+    /// @brief Versions at which the entities last changed.
+    SceneChangeTracker mChangeTracker;
+
+    /// @brief Keeps the render proxies of the mesh renderers up to date.
+    RenderProxySync mRenderProxies;
+
+    /// @brief World space bounds of the mesh renderers.
+    SceneSpatialIndex mSpatialIndex;
+
+    /// @brief Number of entity batches being created.
+    uint32_t mEntityBatchDepth = 0;
+
+    /// @brief Entities by their ID, kept in sync with the ID components of the
+    /// registry.
+    std::unordered_map<UUID, entt::entity> mEntityIndex;
+    std::vector<entt::scoped_connection>   mEntityIndexConnections;
+
+    /// @brief Change version when the scene was loaded or last saved. Shared
+    /// with the save callbacks, which report from the writer thread.
+    std::shared_ptr<std::atomic<uint64_t>> mSavedVersion =
+      std::make_shared<std::atomic<uint64_t>>(0);
+
     /// @brief Because of dependency cycle
     // friend class Entity;
 
@@ -33,6 +64,46 @@ namespace Dwarf
     auto
     CreateRootEntity() -> Entity;
 
+    /// @brief Connects the change tracker to the scene components.
+    void
+    TrackSceneChanges();
+
+    /// @brief Indexes the existing entities by their ID and keeps the index in
+    /// sync with the ID components.
+    void
+    IndexEntities();
+
+    /// @brief Adds a new entity to the ID index.
+    void
+    OnIdComponentConstruct(entt::registry& registry, entt::entity entity);
+
+    /// @brief Removes a destroyed entity from the ID index.
+    void
+    OnIdComponentDestroy(entt::registry& registry, entt::entity entity);
+
+    /// @brief Copies the components of an entity into the scene graph format.
+    /// @param entity The entity.
+    /// @param data The entity data to fill, the parent index is left as is.
+    void
+    CaptureEntity(entt::entity entity, SceneEntityData& data);
+
+    /// @brief Creates a mesh renderer component from the scene graph format,
+    /// retrieving the referenced assets.
+    auto
+    CreateMeshRenderer(const SceneMeshRendererData& data)
+      -> MeshRendererComponent;
+
+    /// @brief Collects the IDs of the children of an entity.
+    auto
+    GetChildIds(entt::entity entity) -> std::vector<UUIDBytes>;
+
+    /// @brief Replaces the order of the children of an entity. Children that
+    /// are not part of the order keep their relative order at the end.
+    /// @param entity The parent entity.
+    /// @param order IDs of the children in their new order.
+    void
+    ApplyChildOrder(entt::entity entity, const std::vector<UUIDBytes>& order);
+
     /// @brief Creates a new entity with a given name a UID.
     /// @param uid UID to use with the entity.
     /// @param name Name of the entity.
@@ -43,7 +114,7 @@ namespace Dwarf
     /// @brief Returns the recursive model matrix of a transform.
     /// @param transform A transform component instance.
     /// @return 4x4 model matrix composition of a transform and its full parent
-    /// chain.
+    /// chain, as of the last update of the transform hierarchy.
     auto
     GetFullModelMatrix(TransformComponent& transform) -> glm::mat4 override;
 
@@ -51,8 +122,19 @@ namespace Dwarf
     void
     Deserialize(const nlohmann::json& serializedSceneGraph);
 
-    auto
-    DeserializeEntity(const nlohmann::json& serializedEntity) -> Entity;
+    /// @brief Deserializes the scene from a flat scene graph.
+    void
+    Deserialize(const SceneGraphData& sceneGraph);
+
+    /// @brief Appends a serialized entity and its children to a flat scene
+    /// graph.
+    /// @param serializedEntity JSON object of the entity.
+    /// @param parent Index of the parent entity in the scene graph.
+    /// @param sceneGraph The scene graph to append to.
+    static void
+    FlattenEntity(const nlohmann::json& serializedEntity,
+                  uint32_t              parent,
+                  SceneGraphData&       sceneGraph);
 
   public:
     Scene(std::unique_ptr<ISceneProperties> properties,
@@ -62,6 +144,10 @@ namespace Dwarf
           std::unique_ptr<ISceneProperties> properties,
           std::shared_ptr<IAssetDatabase>   assetDatabase);
 
+    Scene(const SceneGraphData&             sceneGraph,
+          std::unique_ptr<ISceneProperties> properties,
+          std::shared_ptr<IAssetDatabase>   assetDatabase);
+
     ~Scene() override;
 
     void
@@ -86,6 +172,21 @@ namespace Dwarf
     auto
     GetProperties() -> ISceneProperties& override;
 
+    /// @brief Retrieves the world transforms of the entity hierarchy.
+    /// @return The transform hierarchy.
+    auto
+    GetTransformHierarchy() -> TransformHierarchy& override;
+
+    /// @brief Retrieves the world space bounds of the mesh renderers.
+    /// @return The spatial index.
+    auto
+    GetSpatialIndex() -> SceneSpatialIndex& override;
+
+    /// @brief Retrieves the synchronization of the render proxies.
+    /// @return The render proxy synchronization.
+    auto
+    GetRenderProxies() -> RenderProxySync& override;
+
     /// @brief Creates a new entity with a given name.
     /// @param name Name of the entity.
     /// @return The created entity instance.
@@ -97,9 +198,71 @@ namespace Dwarf
     void
     DeleteEntity(const Entity& entity) override;
 
+    /// @brief Creates the entities of a flat scene graph in one batch. The
+    /// storage is reserved up front, the components are inserted per type, and
+    /// the scene observers are notified once the batch is complete.
+    /// @param graph Entities to create, every parent preceding its children.
+    /// @param parent Entity the top level entities of the graph are attached
+    /// to.
+    /// @return Handles of the created entities in the order of the graph.
+    auto
+    CreateEntities(const SceneGraphData& graph, entt::entity parent)
+      -> std::vector<entt::entity> override;
+
+    /// @brief Whether a batch of entities is being created.
+    [[nodiscard]] auto
+    IsCreatingEntities() const -> bool override;
+
     /// @brief Serializes the scene to a JSON object.
     /// @return The JSON object.
     auto
     Serialize() -> nlohmann::json override;
+
+    /// @brief Serializes the entities and the settings of the scene into a
+    /// flat scene graph.
+    /// @return The scene graph, the settings are left empty if the scene has
+    /// no properties.
+    auto
+    SerializeGraph() -> SceneGraphData override;
+
+    /// @brief Retrieves the versions at which the entities last changed.
+    /// @return The change tracker.
+    auto
+    GetChangeTracker() -> SceneChangeTracker& override;
+
+    /// @brief Captures the state of the entities that changed since a
+    /// version.
+    /// @param version Version of the change tracker.
+    /// @return The changed and removed entities.
+    auto
+    CaptureDelta(uint64_t version) -> SceneDelta override;
+
+    /// @brief Brings the entities of a delta into the captured state.
+    /// Missing entities are created, removed entities are deleted.
+    /// @param delta The delta to apply.
+    void
+    ApplyDelta(const SceneDelta& delta) override;
+
+    /// @brief Whether the scene components changed since the scene was
+    /// loaded or last marked as saved.
+    [[nodiscard]] auto
+    HasUnsavedChanges() const -> bool override;
+
+    /// @brief Marks the current state of the scene as saved.
+    void
+    MarkSaved() override;
+
+    /// @brief Creates a callback marking the current state of the scene as
+    /// saved, for writes that finish in the background. The callback can run
+    /// on any thread, even after the scene was destroyed.
+    /// @return The callback to run once the state was written.
+    auto
+    CreateSaveCallback() -> std::function<void()> override;
+
+    /// @brief Creates a light component from the scene graph format.
+    /// @param data The light of a scene graph entity.
+    /// @return The light component.
+    static auto
+    CreateLight(const SceneLightData& data) -> LightComponent;
   };
 }
\ No newline at end of file
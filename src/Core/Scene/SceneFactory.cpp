@@ -10,11 +10,13 @@ namespace Dwarf
     std::shared_ptr<IDwarfLogger>            logger,
     std::shared_ptr<IScenePropertiesFactory> scenePropertiesFactory,
     std::shared_ptr<IAssetDatabase>          assetDatabase,
-    std::shared_ptr<IFileHandler>            fileHandler)
+    std::shared_ptr<IFileHandler>            fileHandler,
+    std::shared_ptr<ISceneBinaryCache>       sceneBinaryCache)
     : mLogger(std::move(logger))
     , mScenePropertiesFactory(std::move(scenePropertiesFactory))
     , mAssetDatabase(std::move(assetDatabase))
     , mFileHandler(std::move(fileHandler))
+    , mSceneBinaryCache(std::move(sceneBinaryCache))
   {
     mLogger->LogDebug(Log("SceneFactory created.", "SceneFactory"));
   }
@@ -28,12 +30,26 @@ namespace Dwarf
   SceneFactory::FromAsset(IAssetReference& sceneAsset) const
     -> std::unique_ptr<IScene>
   {
+    if (std::optional<SceneGraphData> sceneGraph =
+          mSceneBinaryCache->Load(sceneAsset))
+    {
+      return std::make_unique<Scene>(
+        sceneGraph.value(),
+        mScenePropertiesFactory->Create(
+          sceneAsset, nlohmann::json::parse(sceneGraph->Settings)),
+        mAssetDatabase);
+    }
+
     nlohmann::json serializedScene =
       nlohmann::json::parse(mFileHandler->ReadFile(sceneAsset.GetPath()));
-    return std::make_unique<Scene>(
+    std::unique_ptr<IScene> scene = std::make_unique<Scene>(
       SerializedGraph(serializedScene["Graph"]),
       mScenePropertiesFactory->Create(sceneAsset, serializedScene["Settings"]),
       mAssetDatabase);
+
+    // The next load skips the parsing
+    mSceneBinaryCache->Store(sceneAsset.GetUID(), scene->SerializeGraph());
+    return scene;
   }
 
   // TODO: Create default scene here
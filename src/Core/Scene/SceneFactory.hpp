@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Asset/Database/IAssetDatabase.hpp"
+#include "Core/Scene/IO/SceneBinary/ISceneBinaryCache.hpp"
 #include "Core/Scene/Properties/IScenePropertiesFactory.hpp"
 #include "ISceneFactory.hpp"
 #include "Logging/IDwarfLogger.hpp"
@@ -16,15 +17,22 @@ namespace Dwarf
     std::shared_ptr<IScenePropertiesFactory> mScenePropertiesFactory;
     std::shared_ptr<IAssetDatabase>          mAssetDatabase;
     std::shared_ptr<IFileHandler>            mFileHandler;
+    std::shared_ptr<ISceneBinaryCache>       mSceneBinaryCache;
 
   public:
     SceneFactory(
       std::shared_ptr<IDwarfLogger>            logger,
       std::shared_ptr<IScenePropertiesFactory> scenePropertiesFactory,
       std::shared_ptr<IAssetDatabase>          assetDatabase,
-      std::shared_ptr<IFileHandler>            fileHandler);
+      std::shared_ptr<IFileHandler>            fileHandler,
+      std::shared_ptr<ISceneBinaryCache>       sceneBinaryCache);
     virtual ~SceneFactory() override;
 
+    /// @brief Creates a scene from an asset reference. The cooked binary of
+    /// the scene is loaded if it is newer than the scene file, otherwise the
+    /// scene file is parsed and cooked.
+    /// @param sceneAsset The asset reference of the scene.
+    /// @return The created scene.
     [[nodiscard]] auto
     FromAsset(IAssetReference& sceneAsset) const
       -> std::unique_ptr<IScene> override;
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <glm/glm.hpp>
+#include <limits>
+
+namespace Dwarf
+{
+  /// @brief Axis aligned bounding box. A default constructed box is empty and
+  /// grows with every point or box merged into it.
+  struct BoundingBox
+  {
+    glm::vec3 Min = glm::vec3(std::numeric_limits<float>::max());
+    glm::vec3 Max = glm::vec3(std::numeric_limits<float>::lowest());
+
+    [[nodiscard]] auto
+    IsEmpty() const -> bool
+    {
+      return Min.x > Max.x || Min.y > Max.y || Min.z > Max.z;
+    }
+
+    void
+    Merge(glm::vec3 point)
+    {
+      Min = glm::min(Min, point);
+      Max = glm::max(Max, point);
+    }
+
+    void
+    Merge(const BoundingBox& other)
+    {
+      Min = glm::min(Min, other.Min);
+      Max = glm::max(Max, other.Max);
+    }
+
+    [[nodiscard]] static auto
+    Union(const BoundingBox& first, const BoundingBox& second) -> BoundingBox
+    {
+      return { glm::min(first.Min, second.Min),
+               glm::max(first.Max, second.Max) };
+    }
+
+    [[nodiscard]] auto
+    Contains(const BoundingBox& other) const -> bool
+    {
+      return glm::all(glm::lessThanEqual(Min, other.Min)) &&
+             glm::all(glm::greaterThanEqual(Max, other.Max));
+    }
+
+    [[nodiscard]] auto
+    Overlaps(const BoundingBox& other) const -> bool
+    {
+      return glm::all(glm::lessThanEqual(Min, other.Max)) &&
+             glm::all(glm::greaterThanEqual(Max, other.Min));
+    }
+
+    [[nodiscard]] auto
+    GetCenter() const -> glm::vec3
+    {
+      return (Min + Max) * 0.5F;
+    }
+
+    /// @brief Retrieves half of the size of the box on every axis.
+    [[nodiscard]] auto
+    GetExtents() const -> glm::vec3
+    {
+      return (Max - Min) * 0.5F;
+    }
+
+    /// @brief Retrieves the surface area, the cost of a box in the surface
+    /// area heuristic.
+    [[nodiscard]] auto
+    GetSurfaceArea() const -> float
+    {
+      glm::vec3 size = Max - Min;
+      return 2.0F * ((size.x * size.y) + (size.y * size.z) + (size.z * size.x));
+    }
+
+    /// @brief Grows the box by a margin on every side.
+    [[nodiscard]] auto
+    Expanded(glm::vec3 margin) const -> BoundingBox
+    {
+      return { Min - margin, Max + margin };
+    }
+
+    /// @brief Computes the box enclosing this box after a transformation.
+    /// @param matrix Affine transformation.
+    /// @return The transformed box, empty if this box is empty.
+    [[nodiscard]] auto
+    Transformed(const glm::mat4& matrix) const -> BoundingBox
+    {
+      if (IsEmpty())
+      {
+        return {};
+      }
+
+      // Arvo's method, the extents are transformed by the absolute matrix
+      glm::vec3 center = glm::vec3(matrix * glm::vec4(GetCenter(), 1.0F));
+      glm::vec3 extents = GetExtents();
+      glm::vec3 transformedExtents =
+        (glm::abs(glm::vec3(matrix[0])) * extents.x) +
+        (glm::abs(glm::vec3(matrix[1])) * extents.y) +
+        (glm::abs(glm::vec3(matrix[2])) * extents.z);
+      return { center - transformedExtents, center + transformedExtents };
+    }
+
+    /// @brief Intersects a ray with the box.
+    /// @param origin Origin of the ray.
+    /// @param inverseDirection Reciprocal of the ray direction.
+    /// @param maxDistance Distance along the ray after which hits are ignored.
+    /// @param distance Receives the distance at which the ray enters the box,
+    /// 0 if the origin is inside.
+    /// @return Whether the ray hits the box.
+    [[nodiscard]] auto
+    IntersectRay(glm::vec3 origin,
+                 glm::vec3 inverseDirection,
+                 float     maxDistance,
+                 float&    distance) const -> bool
+    {
+      float enter = 0.0F;
+      float exit = maxDistance;
+      for (glm::length_t axis = 0; axis < 3; ++axis)
+      {
+        // A ray parallel to a slab runs inside it or misses the box. Testing
+        // it explicitly avoids the NaN of 0 * infinity on the slab planes
+        if (std::isinf(inverseDirection[axis]))
+        {
+          if (origin[axis] < Min[axis] || origin[axis] > Max[axis])
+          {
+            return false;
+          }
+          continue;
+        }
+
+        float first = (Min[axis] - origin[axis]) * inverseDirection[axis];
+        float second = (Max[axis] - origin[axis]) * inverseDirection[axis];
+        enter = std::max(enter, std::min(first, second));
+        exit = std::min(exit, std::max(first, second));
+      }
+
+      distance = enter;
+      return enter <= exit;
+    }
+
+    /// @brief Tests the box against a sphere.
+    [[nodiscard]] auto
+    OverlapsSphere(glm::vec3 center, float radius) const -> bool
+    {
+      glm::vec3 closest = glm::clamp(center, Min, Max);
+      glm::vec3 offset = closest - center;
+      return glm::dot(offset, offset) <= radius * radius;
+    }
+  };
+}
\ No newline at end of file
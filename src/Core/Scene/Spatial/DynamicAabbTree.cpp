@@ -0,0 +1,513 @@
+#include "pch.hpp"
+
+#include "Core/Scene/Spatial/DynamicAabbTree.hpp"
+
+namespace Dwarf
+{
+  namespace
+  {
+    enum class FrustumTest
+    {
+      Outside,
+      Intersecting,
+      Inside
+    };
+
+    auto
+    TestFrustum(const CullingFrustum& frustum, const BoundingBox& box)
+      -> FrustumTest
+    {
+      glm::vec3   center = box.GetCenter();
+      glm::vec3   extents = box.GetExtents();
+      FrustumTest result = FrustumTest::Inside;
+      for (const glm::vec4& plane : frustum.Planes)
+      {
+        glm::vec3 normal = glm::vec3(plane);
+        float     distance = glm::dot(normal, center) + plane.w;
+        float     radius = glm::dot(glm::abs(normal), extents);
+        if (distance < -radius)
+        {
+          return FrustumTest::Outside;
+        }
+        if (distance < radius)
+        {
+          result = FrustumTest::Intersecting;
+        }
+      }
+      return result;
+    }
+  }
+
+  auto
+  DynamicAabbTree::CreateProxy(const BoundingBox& bounds, entt::entity entity)
+    -> uint32_t
+  {
+    uint32_t proxy = AllocateNode();
+    Node&    node = mNodes[proxy];
+    node.Bounds = bounds;
+    node.FatBounds = bounds.Expanded(GetMargin(bounds));
+    node.Entity = entity;
+    node.Height = 0;
+
+    InsertLeaf(proxy);
+    ++mProxyCount;
+    return proxy;
+  }
+
+  void
+  DynamicAabbTree::DestroyProxy(uint32_t proxy)
+  {
+    RemoveLeaf(proxy);
+    FreeNode(proxy);
+    --mProxyCount;
+  }
+
+  auto
+  DynamicAabbTree::MoveProxy(uint32_t proxy, const BoundingBox& bounds) -> bool
+  {
+    Node&     node = mNodes[proxy];
+    glm::vec3 margin = GetMargin(bounds);
+    node.Bounds = bounds;
+
+    // Fat boxes that grew far larger than the bounds are replaced, they would
+    // make every query visit the leaf
+    if (node.FatBounds.Contains(bounds) &&
+        bounds.Expanded(4.0F * margin).Contains(node.FatBounds))
+    {
+      return false;
+    }
+
+    RemoveLeaf(proxy);
+    mNodes[proxy].FatBounds = bounds.Expanded(margin);
+    InsertLeaf(proxy);
+    return true;
+  }
+
+  void
+  DynamicAabbTree::Clear()
+  {
+    mNodes.clear();
+    mRoot = NULL_NODE;
+    mFreeNodes = NULL_NODE;
+    mProxyCount = 0;
+  }
+
+  auto
+  DynamicAabbTree::GetBounds(uint32_t proxy) const -> const BoundingBox&
+  {
+    return mNodes[proxy].Bounds;
+  }
+
+  auto
+  DynamicAabbTree::GetFatBounds(uint32_t proxy) const -> const BoundingBox&
+  {
+    return mNodes[proxy].FatBounds;
+  }
+
+  auto
+  DynamicAabbTree::GetEntity(uint32_t proxy) const -> entt::entity
+  {
+    return mNodes[proxy].Entity;
+  }
+
+  auto
+  DynamicAabbTree::GetProxyCount() const -> uint32_t
+  {
+    return mProxyCount;
+  }
+
+  auto
+  DynamicAabbTree::GetHeight() const -> uint32_t
+  {
+    return mRoot == NULL_NODE ? 0 : mNodes[mRoot].Height + 1;
+  }
+
+  void
+  DynamicAabbTree::QueryBox(const BoundingBox&         box,
+                            std::vector<entt::entity>& results) const
+  {
+    results.clear();
+    if (mRoot == NULL_NODE)
+    {
+      return;
+    }
+
+    std::vector<uint32_t> stack = { mRoot };
+    while (!stack.empty())
+    {
+      const Node& node = mNodes[stack.back()];
+      stack.pop_back();
+
+      if (!node.FatBounds.Overlaps(box))
+      {
+        continue;
+      }
+
+      if (node.IsLeaf())
+      {
+        if (node.Bounds.Overlaps(box))
+        {
+          results.push_back(node.Entity);
+        }
+        continue;
+      }
+
+      stack.push_back(node.Left);
+      stack.push_back(node.Right);
+    }
+  }
+
+  void
+  DynamicAabbTree::QuerySphere(glm::vec3                  center,
+                               float                      radius,
+                               std::vector<entt::entity>& results) const
+  {
+    results.clear();
+    if (mRoot == NULL_NODE)
+    {
+      return;
+    }
+
+    std::vector<uint32_t> stack = { mRoot };
+    while (!stack.empty())
+    {
+      const Node& node = mNodes[stack.back()];
+      stack.pop_back();
+
+      if (!node.FatBounds.OverlapsSphere(center, radius))
+      {
+        continue;
+      }
+
+      if (node.IsLeaf())
+      {
+        if (node.Bounds.OverlapsSphere(center, radius))
+        {
+          results.push_back(node.Entity);
+        }
+        continue;
+      }
+
+      stack.push_back(node.Left);
+      stack.push_back(node.Right);
+    }
+  }
+
+  void
+  DynamicAabbTree::QueryFrustum(const CullingFrustum&      frustum,
+                                std::vector<entt::entity>& results) const
+  {
+    results.clear();
+    if (mRoot == NULL_NODE)
+    {
+      return;
+    }
+
+    std::vector<uint32_t> stack = { mRoot };
+    std::vector<uint32_t> inside;
+    while (!stack.empty())
+    {
+      uint32_t    index = stack.back();
+      const Node& node = mNodes[index];
+      stack.pop_back();
+
+      if (node.IsLeaf())
+      {
+        if (TestFrustum(frustum, node.Bounds) != FrustumTest::Outside)
+        {
+          results.push_back(node.Entity);
+        }
+        continue;
+      }
+
+      FrustumTest test = TestFrustum(frustum, node.FatBounds);
+      if (test == FrustumTest::Inside)
+      {
+        inside.push_back(index);
+      }
+      else if (test == FrustumTest::Intersecting)
+      {
+        stack.push_back(node.Left);
+        stack.push_back(node.Right);
+      }
+    }
+
+    // The bounds of the leaves lie within the box of their ancestors
+    while (!inside.empty())
+    {
+      const Node& node = mNodes[inside.back()];
+      inside.pop_back();
+
+      if (node.IsLeaf())
+      {
+        results.push_back(node.Entity);
+        continue;
+      }
+
+      inside.push_back(node.Left);
+      inside.push_back(node.Right);
+    }
+  }
+
+  void
+  DynamicAabbTree::QueryRay(glm::vec3                   origin,
+                            glm::vec3                   direction,
+                            float                       maxDistance,
+                            std::vector<SpatialRayHit>& results) const
+  {
+    results.clear();
+    if (mRoot == NULL_NODE)
+    {
+      return;
+    }
+
+    glm::vec3             inverseDirection = 1.0F / direction;
+    float                 distance = 0.0F;
+    std::vector<uint32_t> stack = { mRoot };
+    while (!stack.empty())
+    {
+      const Node& node = mNodes[stack.back()];
+      stack.pop_back();
+
+      if (!node.FatBounds.IntersectRay(
+            origin, inverseDirection, maxDistance, distance))
+      {
+        continue;
+      }
+
+      if (node.IsLeaf())
+      {
+        if (node.Bounds.IntersectRay(
+              origin, inverseDirection, maxDistance, distance))
+        {
+          results.push_back({ node.Entity, distance });
+        }
+        continue;
+      }
+
+      stack.push_back(node.Left);
+      stack.push_back(node.Right);
+    }
+
+    std::ranges::sort(results, {}, &SpatialRayHit::Distance);
+  }
+
+  auto
+  DynamicAabbTree::AllocateNode() -> uint32_t
+  {
+    if (mFreeNodes == NULL_NODE)
+    {
+      mNodes.emplace_back();
+      return (uint32_t)mNodes.size() - 1;
+    }
+
+    uint32_t node = mFreeNodes;
+    mFreeNodes = mNodes[node].Parent;
+    mNodes[node] = Node();
+    return node;
+  }
+
+  void
+  DynamicAabbTree::FreeNode(uint32_t node)
+  {
+    mNodes[node] = Node();
+    mNodes[node].Parent = mFreeNodes;
+    mFreeNodes = node;
+  }
+
+  auto
+  DynamicAabbTree::GetMargin(const BoundingBox& bounds) -> glm::vec3
+  {
+    return glm::max((bounds.Max - bounds.Min) * FAT_MARGIN_RATIO,
+                    glm::vec3(MIN_FAT_MARGIN));
+  }
+
+  void
+  DynamicAabbTree::InsertLeaf(uint32_t leaf)
+  {
+    if (mRoot == NULL_NODE)
+    {
+      mRoot = leaf;
+      mNodes[leaf].Parent = NULL_NODE;
+      return;
+    }
+
+    // Descends towards the sibling with the lowest cost, the area of the new
+    // parent plus the area every ancestor grows by
+    BoundingBox leafBounds = mNodes[leaf].FatBounds;
+    uint32_t    index = mRoot;
+    while (!mNodes[index].IsLeaf())
+    {
+      const Node& node = mNodes[index];
+      float       area = node.FatBounds.GetSurfaceArea();
+      float       combinedArea =
+        BoundingBox::Union(node.FatBounds, leafBounds).GetSurfaceArea();
+
+      float cost = 2.0F * combinedArea;
+      float inheritanceCost = 2.0F * (combinedArea - area);
+
+      auto childCost = [&](uint32_t child)
+      {
+        const Node& childNode = mNodes[child];
+        float       childArea =
+          BoundingBox::Union(childNode.FatBounds, leafBounds).GetSurfaceArea();
+        if (!childNode.IsLeaf())
+        {
+          childArea -= childNode.FatBounds.GetSurfaceArea();
+        }
+        return childArea + inheritanceCost;
+      };
+
+      float leftCost = childCost(node.Left);
+      float rightCost = childCost(node.Right);
+      if (cost < leftCost && cost < rightCost)
+      {
+        break;
+      }
+
+      index = leftCost < rightCost ? node.Left : node.Right;
+    }
+
+    uint32_t sibling = index;
+    uint32_t parent = AllocateNode();
+    uint32_t oldParent = mNodes[sibling].Parent;
+
+    Node& parentNode = mNodes[parent];
+    parentNode.Parent = oldParent;
+    parentNode.FatBounds =
+      BoundingBox::Union(leafBounds, mNodes[sibling].FatBounds);
+    parentNode.Height = mNodes[sibling].Height + 1;
+    parentNode.Left = sibling;
+    parentNode.Right = leaf;
+
+    if (oldParent == NULL_NODE)
+    {
+      mRoot = parent;
+    }
+    else if (mNodes[oldParent].Left == sibling)
+    {
+      mNodes[oldParent].Left = parent;
+    }
+    else
+    {
+      mNodes[oldParent].Right = parent;
+    }
+    mNodes[sibling].Parent = parent;
+    mNodes[leaf].Parent = parent;
+
+    RefitAncestors(parent);
+  }
+
+  void
+  DynamicAabbTree::RemoveLeaf(uint32_t leaf)
+  {
+    if (leaf == mRoot)
+    {
+      mRoot = NULL_NODE;
+      return;
+    }
+
+    uint32_t parent = mNodes[leaf].Parent;
+    uint32_t grandParent = mNodes[parent].Parent;
+    uint32_t sibling = mNodes[parent].Left == leaf ? mNodes[parent].Right
+                                                   : mNodes[parent].Left;
+
+    mNodes[sibling].Parent = grandParent;
+    FreeNode(parent);
+    if (grandParent == NULL_NODE)
+    {
+      mRoot = sibling;
+      return;
+    }
+
+    if (mNodes[grandParent].Left == parent)
+    {
+      mNodes[grandParent].Left = sibling;
+    }
+    else
+    {
+      mNodes[grandParent].Right = sibling;
+    }
+    RefitAncestors(grandParent);
+  }
+
+  void
+  DynamicAabbTree::RefitAncestors(uint32_t node)
+  {
+    while (node != NULL_NODE)
+    {
+      node = Balance(node);
+
+      Node&       current = mNodes[node];
+      const Node& left = mNodes[current.Left];
+      const Node& right = mNodes[current.Right];
+      current.Height = 1 + std::max(left.Height, right.Height);
+      current.FatBounds = BoundingBox::Union(left.FatBounds, right.FatBounds);
+
+      node = current.Parent;
+    }
+  }
+
+  auto
+  DynamicAabbTree::Balance(uint32_t node) -> uint32_t
+  {
+    Node& top = mNodes[node];
+    if (top.IsLeaf() || top.Height < 2)
+    {
+      return node;
+    }
+
+    int32_t balance = mNodes[top.Right].Height - mNodes[top.Left].Height;
+    if (balance >= -1 && balance <= 1)
+    {
+      return node;
+    }
+
+    // The higher child takes the place of the node, the node keeps the lower
+    // child and receives the lower grandchild
+    bool     rightHigher = balance > 1;
+    uint32_t raised = rightHigher ? top.Right : top.Left;
+    uint32_t kept = rightHigher ? top.Left : top.Right;
+    Node&    raisedNode = mNodes[raised];
+
+    uint32_t first = raisedNode.Left;
+    uint32_t second = raisedNode.Right;
+    if (mNodes[first].Height < mNodes[second].Height)
+    {
+      std::swap(first, second);
+    }
+
+    // The raised node keeps the higher grandchild
+    raisedNode.Left = node;
+    raisedNode.Right = first;
+    raisedNode.Parent = top.Parent;
+    top.Parent = raised;
+
+    if (raisedNode.Parent == NULL_NODE)
+    {
+      mRoot = raised;
+    }
+    else if (mNodes[raisedNode.Parent].Left == node)
+    {
+      mNodes[raisedNode.Parent].Left = raised;
+    }
+    else
+    {
+      mNodes[raisedNode.Parent].Right = raised;
+    }
+
+    top.Left = kept;
+    top.Right = second;
+    mNodes[second].Parent = node;
+
+    top.FatBounds =
+      BoundingBox::Union(mNodes[kept].FatBounds, mNodes[second].FatBounds);
+    top.Height =
+      1 + std::max(mNodes[kept].Height, mNodes[second].Height);
+    raisedNode.FatBounds =
+      BoundingBox::Union(top.FatBounds, mNodes[first].FatBounds);
+    raisedNode.Height = 1 + std::max(top.Height, mNodes[first].Height);
+
+    return raised;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "Core/Rendering/Mesh/ClusterCuller/ClusterCuller.hpp"
+#include "Core/Scene/Spatial/BoundingBox.hpp"
+#include <entt/entt.hpp>
+#include <limits>
+#include <vector>
+
+namespace Dwarf
+{
+  /// @brief Entity hit by a ray query.
+  struct SpatialRayHit
+  {
+    entt::entity Entity = entt::null;
+
+    /// @brief Distance along the ray at which it enters the bounds.
+    float Distance = 0.0F;
+  };
+
+  /// @brief Bounding volume hierarchy over the bounds of entities that is
+  /// updated incrementally. Every leaf stores a fat box, enlarged by a margin,
+  /// so small movements do not change the tree. Leaves are inserted next to
+  /// the sibling that increases the surface area the least and the tree is
+  /// kept balanced by rotations, as in the dynamic tree of Box2D.
+  ///
+  /// Queries test the exact bounds of the leaves and write the entities into
+  /// a buffer of the caller, which can be reused from frame to frame.
+  class DynamicAabbTree
+  {
+  public:
+    /// @brief Index of a missing node.
+    static constexpr uint32_t NULL_NODE = std::numeric_limits<uint32_t>::max();
+
+    /// @brief Margin added to every side of a leaf, relative to its size.
+    static constexpr float FAT_MARGIN_RATIO = 0.1F;
+
+    /// @brief Smallest margin added to every side of a leaf.
+    static constexpr float MIN_FAT_MARGIN = 0.05F;
+
+    /// @brief Inserts the bounds of an entity.
+    /// @param bounds The bounds.
+    /// @param entity Entity reported by the queries.
+    /// @return ID of the proxy.
+    auto
+    CreateProxy(const BoundingBox& bounds, entt::entity entity) -> uint32_t;
+
+    /// @brief Removes a proxy.
+    /// @param proxy ID of the proxy.
+    void
+    DestroyProxy(uint32_t proxy);
+
+    /// @brief Updates the bounds of a proxy. The leaf is only reinserted if
+    /// the bounds left its fat box, or shrank far below it.
+    /// @param proxy ID of the proxy.
+    /// @param bounds The new bounds.
+    /// @return Whether the leaf was reinserted.
+    auto
+    MoveProxy(uint32_t proxy, const BoundingBox& bounds) -> bool;
+
+    /// @brief Removes all proxies.
+    void
+    Clear();
+
+    [[nodiscard]] auto
+    GetBounds(uint32_t proxy) const -> const BoundingBox&;
+
+    [[nodiscard]] auto
+    GetFatBounds(uint32_t proxy) const -> const BoundingBox&;
+
+    [[nodiscard]] auto
+    GetEntity(uint32_t proxy) const -> entt::entity;
+
+    [[nodiscard]] auto
+    GetProxyCount() const -> uint32_t;
+
+    /// @brief Retrieves the height of the tree, 0 for an empty tree.
+    [[nodiscard]] auto
+    GetHeight() const -> uint32_t;
+
+    /// @brief Collects the entities whose bounds overlap a box.
+    /// @param box The box.
+    /// @param results Receives the entities, cleared first.
+    void
+    QueryBox(const BoundingBox& box, std::vector<entt::entity>& results) const;
+
+    /// @brief Collects the entities whose bounds overlap a sphere.
+    /// @param center Center of the sphere.
+    /// @param radius Radius of the sphere.
+    /// @param results Receives the entities, cleared first.
+    void
+    QuerySphere(glm::vec3                  center,
+                float                      radius,
+                std::vector<entt::entity>& results) const;
+
+    /// @brief Collects the entities whose bounds are not fully outside one of
+    /// the frustum planes. Subtrees fully inside the frustum are collected
+    /// without further tests.
+    /// @param frustum The frustum.
+    /// @param results Receives the entities, cleared first.
+    void
+    QueryFrustum(const CullingFrustum&      frustum,
+                 std::vector<entt::entity>& results) const;
+
+    /// @brief Collects the entities whose bounds are hit by a ray.
+    /// @param origin Origin of the ray.
+    /// @param direction Direction of the ray, does not need to be normalized.
+    /// @param maxDistance Distance along the ray, in multiples of the
+    /// direction, after which hits are ignored.
+    /// @param results Receives the hits ordered by distance, cleared first.
+    void
+    QueryRay(glm::vec3                   origin,
+             glm::vec3                   direction,
+             float                       maxDistance,
+             std::vector<SpatialRayHit>& results) const;
+
+  private:
+    struct Node
+    {
+      /// @brief Fat box of a leaf, union of the children otherwise.
+      BoundingBox FatBounds;
+
+      /// @brief Exact bounds of a leaf.
+      BoundingBox Bounds;
+
+      entt::entity Entity = entt::null;
+
+      /// @brief Parent, or the next free node of unused nodes.
+      uint32_t Parent = NULL_NODE;
+      uint32_t Left = NULL_NODE;
+      uint32_t Right = NULL_NODE;
+
+      /// @brief Height of the subtree, 0 for leaves, -1 for unused nodes.
+      int32_t Height = -1;
+
+      [[nodiscard]] auto
+      IsLeaf() const -> bool
+      {
+        return Left == NULL_NODE;
+      }
+    };
+
+    std::vector<Node> mNodes;
+    uint32_t          mRoot = NULL_NODE;
+    uint32_t          mFreeNodes = NULL_NODE;
+    uint32_t          mProxyCount = 0;
+
+    auto
+    AllocateNode() -> uint32_t;
+
+    void
+    FreeNode(uint32_t node);
+
+    /// @brief Retrieves the margin of the fat box of a leaf.
+    static auto
+    GetMargin(const BoundingBox& bounds) -> glm::vec3;
+
+    void
+    InsertLeaf(uint32_t leaf);
+
+    void
+    RemoveLeaf(uint32_t leaf);
+
+    /// @brief Refits and balances the ancestors of a node up to the root.
+    void
+    RefitAncestors(uint32_t node);
+
+    /// @brief Rotates a node if its subtrees are unbalanced.
+    /// @return The node that took its place.
+    auto
+    Balance(uint32_t node) -> uint32_t;
+  };
+}
\ No newline at end of file
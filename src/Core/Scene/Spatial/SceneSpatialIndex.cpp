@@ -0,0 +1,175 @@
+#include "pch.hpp"
+
+#include "Core/Scene/Spatial/SceneSpatialIndex.hpp"
+
+namespace Dwarf
+{
+  SceneSpatialIndex::SceneSpatialIndex(entt::registry&     registry,
+                                       TransformHierarchy& hierarchy)
+    : mRegistry(registry)
+    , mHierarchy(hierarchy)
+  {
+    mConnections.emplace_back(
+      registry.on_construct<RenderProxyComponent>()
+        .connect<&SceneSpatialIndex::OnRenderProxyChanged>(*this));
+    mConnections.emplace_back(
+      registry.on_update<RenderProxyComponent>()
+        .connect<&SceneSpatialIndex::OnRenderProxyChanged>(*this));
+    mConnections.emplace_back(
+      registry.on_destroy<RenderProxyComponent>()
+        .connect<&SceneSpatialIndex::OnRenderProxyDestroyed>(*this));
+  }
+
+  void
+  SceneSpatialIndex::Update()
+  {
+    entt::registry& registry = mRegistry.get();
+    for (entt::entity entity : mChangedProxies)
+    {
+      if (registry.valid(entity) &&
+          registry.all_of<RenderProxyComponent>(entity))
+      {
+        UpdateProxy(entity);
+      }
+    }
+    mChangedProxies.clear();
+
+    const TransformHierarchy&     hierarchy = mHierarchy.get();
+    std::span<const uint8_t>      changed = hierarchy.GetChangedFlags();
+    std::span<const entt::entity> entities = hierarchy.GetEntities();
+    std::span<const glm::mat4>    worldMatrices = hierarchy.GetWorldMatrices();
+    for (size_t index = 0; index < changed.size(); ++index)
+    {
+      if (changed[index] == 0)
+      {
+        continue;
+      }
+
+      uint32_t number = entt::to_entity(entities[index]);
+      if (number < mEntities.size() &&
+          mEntities[number].Entity == entities[index] &&
+          mEntities[number].Proxy != DynamicAabbTree::NULL_NODE)
+      {
+        IndexedEntity& indexed = mEntities[number];
+        mTree.MoveProxy(indexed.Proxy,
+                        indexed.LocalBounds.Transformed(worldMatrices[index]));
+      }
+    }
+  }
+
+  auto
+  SceneSpatialIndex::GetBounds(entt::entity entity) const -> BoundingBox
+  {
+    uint32_t number = entt::to_entity(entity);
+    if (number < mEntities.size() && mEntities[number].Entity == entity &&
+        mEntities[number].Proxy != DynamicAabbTree::NULL_NODE)
+    {
+      return mTree.GetBounds(mEntities[number].Proxy);
+    }
+    return {};
+  }
+
+  auto
+  SceneSpatialIndex::GetTree() const -> const DynamicAabbTree&
+  {
+    return mTree;
+  }
+
+  void
+  SceneSpatialIndex::QueryBox(const BoundingBox&         box,
+                              std::vector<entt::entity>& results) const
+  {
+    mTree.QueryBox(box, results);
+  }
+
+  void
+  SceneSpatialIndex::QuerySphere(glm::vec3                  center,
+                                 float                      radius,
+                                 std::vector<entt::entity>& results) const
+  {
+    mTree.QuerySphere(center, radius, results);
+  }
+
+  void
+  SceneSpatialIndex::QueryFrustum(const CullingFrustum&      frustum,
+                                  std::vector<entt::entity>& results) const
+  {
+    mTree.QueryFrustum(frustum, results);
+  }
+
+  void
+  SceneSpatialIndex::QueryRay(glm::vec3                   origin,
+                              glm::vec3                   direction,
+                              float                       maxDistance,
+                              std::vector<SpatialRayHit>& results) const
+  {
+    mTree.QueryRay(origin, direction, maxDistance, results);
+  }
+
+  void
+  SceneSpatialIndex::UpdateProxy(entt::entity entity)
+  {
+    entt::registry& registry = mRegistry.get();
+    BoundingBox     localBounds =
+      registry.get<RenderProxyComponent>(entity).LocalBounds;
+    if (localBounds.IsEmpty())
+    {
+      RemoveProxy(entity);
+      return;
+    }
+
+    uint32_t number = entt::to_entity(entity);
+    if (number >= mEntities.size())
+    {
+      mEntities.resize(number + 1);
+    }
+
+    IndexedEntity& indexed = mEntities[number];
+    if (indexed.Entity != entity &&
+        indexed.Proxy != DynamicAabbTree::NULL_NODE)
+    {
+      mTree.DestroyProxy(indexed.Proxy);
+      indexed.Proxy = DynamicAabbTree::NULL_NODE;
+    }
+
+    indexed.Entity = entity;
+    indexed.LocalBounds = localBounds;
+    auto&       transform = registry.get<TransformComponent>(entity);
+    BoundingBox bounds =
+      localBounds.Transformed(mHierarchy.get().GetWorldMatrix(transform));
+    if (indexed.Proxy == DynamicAabbTree::NULL_NODE)
+    {
+      indexed.Proxy = mTree.CreateProxy(bounds, entity);
+    }
+    else
+    {
+      mTree.MoveProxy(indexed.Proxy, bounds);
+    }
+  }
+
+  void
+  SceneSpatialIndex::RemoveProxy(entt::entity entity)
+  {
+    uint32_t number = entt::to_entity(entity);
+    if (number < mEntities.size() && mEntities[number].Entity == entity &&
+        mEntities[number].Proxy != DynamicAabbTree::NULL_NODE)
+    {
+      mTree.DestroyProxy(mEntities[number].Proxy);
+      mEntities[number] = {};
+    }
+  }
+
+  void
+  SceneSpatialIndex::OnRenderProxyChanged(entt::registry& registry,
+                                          entt::entity    entity)
+  {
+    mChangedProxies.push_back(entity);
+  }
+
+  void
+  SceneSpatialIndex::OnRenderProxyDestroyed(entt::registry& registry,
+                                            entt::entity    entity)
+  {
+    RemoveProxy(entity);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Core/Scene/Hierarchy/TransformHierarchy.hpp"
+#include "Core/Scene/RenderProxy/RenderProxyComponent.hpp"
+#include "Core/Scene/Spatial/DynamicAabbTree.hpp"
+#include <entt/entt.hpp>
+#include <functional>
+#include <vector>
+
+namespace Dwarf
+{
+  /// @brief World space bounds of the entities with a mesh renderer, kept in
+  /// a dynamic AABB tree so culling, picking and other scene queries do not
+  /// scan every mesh renderer.
+  ///
+  /// The update only visits the entities whose world matrices were
+  /// recomputed by the last transform hierarchy update and the render proxies
+  /// that changed since the last update. The local bounds are taken from the
+  /// render proxies.
+  class SceneSpatialIndex
+  {
+  public:
+    /// @brief Constructor.
+    /// @param registry Registry holding the mesh renderers.
+    /// @param hierarchy Hierarchy providing the world matrices.
+    SceneSpatialIndex(entt::registry& registry, TransformHierarchy& hierarchy);
+
+    SceneSpatialIndex(const SceneSpatialIndex&) = delete;
+    auto
+    operator=(const SceneSpatialIndex&) -> SceneSpatialIndex& = delete;
+
+    /// @brief Refits the bounds of the moved entities and inserts the changed
+    /// render proxies. Meant to be called once per frame after the transform
+    /// hierarchy update.
+    void
+    Update();
+
+    /// @brief Retrieves the world space bounds of an entity.
+    /// @param entity The entity.
+    /// @return The bounds, empty if the entity is not indexed.
+    [[nodiscard]] auto
+    GetBounds(entt::entity entity) const -> BoundingBox;
+
+    /// @brief Retrieves the tree holding the bounds.
+    [[nodiscard]] auto
+    GetTree() const -> const DynamicAabbTree&;
+
+    /// @brief Collects the entities whose bounds overlap a box.
+    void
+    QueryBox(const BoundingBox& box, std::vector<entt::entity>& results) const;
+
+    /// @brief Collects the entities whose bounds overlap a sphere.
+    void
+    QuerySphere(glm::vec3                  center,
+                float                      radius,
+                std::vector<entt::entity>& results) const;
+
+    /// @brief Collects the entities whose bounds intersect a frustum.
+    void
+    QueryFrustum(const CullingFrustum&      frustum,
+                 std::vector<entt::entity>& results) const;
+
+    /// @brief Collects the entities whose bounds are hit by a ray, ordered
+    /// by distance.
+    void
+    QueryRay(glm::vec3                   origin,
+             glm::vec3                   direction,
+             float                       maxDistance,
+             std::vector<SpatialRayHit>& results) const;
+
+  private:
+    struct IndexedEntity
+    {
+      entt::entity Entity = entt::null;
+      uint32_t     Proxy = DynamicAabbTree::NULL_NODE;
+      BoundingBox  LocalBounds;
+    };
+
+    std::reference_wrapper<entt::registry>     mRegistry;
+    std::reference_wrapper<TransformHierarchy> mHierarchy;
+    DynamicAabbTree                            mTree;
+
+    /// @brief Indexed entities by their entity number.
+    std::vector<IndexedEntity> mEntities;
+
+    /// @brief Render proxies constructed or updated since the last update.
+    std::vector<entt::entity> mChangedProxies;
+
+    std::vector<entt::scoped_connection> mConnections;
+
+    /// @brief Inserts, moves or removes the tree proxy of a render proxy.
+    void
+    UpdateProxy(entt::entity entity);
+
+    void
+    RemoveProxy(entt::entity entity);
+
+    void
+    OnRenderProxyChanged(entt::registry& registry, entt::entity entity);
+
+    void
+    OnRenderProxyDestroyed(entt::registry& registry, entt::entity entity);
+  };
+}
\ No newline at end of file
@@ -1,62 +1,204 @@
 #pragma once
 
-#include "Utilities/ISerializable.hpp"
-#include <boost/uuid/uuid.hpp>
-#include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_io.hpp>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <random>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 namespace Dwarf
 {
+  /// @brief Binary representation of a UUID.
+  using UUIDBytes = std::array<uint8_t, 16>;
 
-  class UUID : public ISerializable
+  /// @brief Random (version 4) UUID stored as 16 plain bytes, so it can be
+  /// copied, compared and hashed without any allocation.
+  class UUID
   {
   private:
-    boost::uuids::uuid mUuid;
+    UUIDBytes mBytes = {};
+
+    /// @brief Returns 64 random bits from a xoshiro256** generator of the
+    /// calling thread. Each thread seeds its generator once from the random
+    /// device.
+    static auto
+    NextRandom() -> uint64_t
+    {
+      thread_local std::array<uint64_t, 4> state = []()
+      {
+        std::random_device                      device;
+        std::array<uint64_t, 4>                 seed;
+        std::uniform_int_distribution<uint64_t> distribution;
+        for (uint64_t& value : seed)
+        {
+          value = distribution(device);
+        }
+        return seed;
+      }();
+
+      uint64_t result = std::rotl(state[1] * 5, 7) * 9;
+      uint64_t shifted = state[1] << 17;
+      state[2] ^= state[0];
+      state[3] ^= state[1];
+      state[1] ^= state[2];
+      state[0] ^= state[3];
+      state[2] ^= shifted;
+      state[3] = std::rotl(state[3], 45);
+      return result;
+    }
+
+    static auto
+    HexValue(char character) -> int
+    {
+      if (character >= '0' && character <= '9')
+      {
+        return character - '0';
+      }
+      if (character >= 'a' && character <= 'f')
+      {
+        return character - 'a' + 10;
+      }
+      if (character >= 'A' && character <= 'F')
+      {
+        return character - 'A' + 10;
+      }
+      return -1;
+    }
 
   public:
+    /// @brief Creates a new random UUID.
     UUID()
     {
-      boost::uuids::random_generator generator;
-      mUuid = generator();
+      uint64_t high = NextRandom();
+      uint64_t low = NextRandom();
+      std::memcpy(mBytes.data(), &high, sizeof(high));
+      std::memcpy(mBytes.data() + sizeof(high), &low, sizeof(low));
+
+      // Version 4, variant 1
+      mBytes[6] = (mBytes[6] & 0x0F) | 0x40;
+      mBytes[8] = (mBytes[8] & 0x3F) | 0x80;
     }
 
     UUID(const std::string& serializedUUID) { deserialize(serializedUUID); }
 
+    explicit UUID(const UUIDBytes& bytes)
+      : mBytes(bytes)
+    {
+    }
+
+    /// @brief Returns the binary representation of the UUID.
+    /// @return The 16 bytes of the UUID.
+    [[nodiscard]] auto
+    toBytes() const -> UUIDBytes
+    {
+      return mBytes;
+    }
+
     [[nodiscard]] auto
     toString() const -> std::string
     {
-      return boost::uuids::to_string(mUuid);
+      constexpr std::string_view DIGITS = "0123456789abcdef";
+
+      std::string result;
+      result.reserve(36);
+      for (size_t index = 0; index < mBytes.size(); ++index)
+      {
+        if (index == 4 || index == 6 || index == 8 || index == 10)
+        {
+          result.push_back('-');
+        }
+        result.push_back(DIGITS[mBytes[index] >> 4]);
+        result.push_back(DIGITS[mBytes[index] & 0x0F]);
+      }
+      return result;
     }
 
     auto
     operator==(const UUID& other) const -> bool
     {
-      return mUuid == other.mUuid;
+      return mBytes == other.mBytes;
     }
 
     auto
     operator!=(const UUID& other) const -> bool
     {
-      return mUuid != other.mUuid;
+      return mBytes != other.mBytes;
     }
 
     auto
     operator<(const UUID& other) const -> bool
     {
-      return mUuid < other.mUuid;
+      return mBytes < other.mBytes;
+    }
+
+    /// @brief Returns a hash of the UUID. The bytes are random, so folding
+    /// them is enough.
+    [[nodiscard]] auto
+    Hash() const -> size_t
+    {
+      uint64_t high = 0;
+      uint64_t low = 0;
+      std::memcpy(&high, mBytes.data(), sizeof(high));
+      std::memcpy(&low, mBytes.data() + sizeof(high), sizeof(low));
+      return high ^ (low * 0x9E3779B97F4A7C15ULL);
     }
 
     auto
-    Serialize() -> nlohmann::json override
+    Serialize() -> nlohmann::json
     {
-      return boost::uuids::to_string(mUuid);
+      return toString();
     }
 
+    /// @brief Parses a UUID of 32 hex digits, optionally separated by dashes
+    /// and enclosed in braces.
+    /// @param data The UUID string.
+    /// @throws std::runtime_error If the string is not a valid UUID.
     void
     deserialize(const std::string& data)
     {
-      mUuid = boost::uuids::string_generator()(data);
+      std::string_view text = data;
+      if (text.size() >= 2 && text.front() == '{' && text.back() == '}')
+      {
+        text = text.substr(1, text.size() - 2);
+      }
+
+      size_t digits = 0;
+      for (char character : text)
+      {
+        if (character == '-')
+        {
+          continue;
+        }
+
+        int value = HexValue(character);
+        if (value < 0 || digits == 2 * mBytes.size())
+        {
+          throw std::runtime_error("invalid uuid string");
+        }
+
+        uint8_t& byte = mBytes[digits / 2];
+        byte = (digits % 2 == 0) ? (uint8_t)(value << 4) : byte | value;
+        ++digits;
+      }
+
+      if (digits != 2 * mBytes.size())
+      {
+        throw std::runtime_error("invalid uuid string");
+      }
     }
   };
-}
\ No newline at end of file
+}
+
+template<>
+struct std::hash<Dwarf::UUID>
+{
+  auto
+  operator()(const Dwarf::UUID& uuid) const noexcept -> size_t
+  {
+    return uuid.Hash();
+  }
+};
\ No newline at end of file
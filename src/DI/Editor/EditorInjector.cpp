@@ -14,6 +14,7 @@
 #include "Core/Asset/Metadata/AssetMetadata.hpp"
 #include "Core/Asset/Metadata/IAssetMetadata.hpp"
 #include "Core/Asset/Model/ModelImporter.hpp"
+#include "Core/Asset/Shader/ShaderPreprocessor/ShaderPreprocessor.hpp"
 #include "Core/Asset/Shader/ShaderRecompiler.hpp"
 #include "Core/Asset/Shader/ShaderSourceCollection/IShaderSourceCollectionFactory.hpp"
 #include "Core/Asset/Shader/ShaderSourceCollection/ShaderSourceCollectionFactory.hpp"
@@ -26,8 +27,10 @@
 #include "Core/Rendering/DrawCall/DrawCallList/DrawCallListFactory.hpp"
 #include "Core/Rendering/DrawCall/DrawCallWorker/DrawCallWorkerFactory.hpp"
 #include "Core/Rendering/Framebuffer/FramebufferFactory.hpp"
+#include "Core/Rendering/DebugLayer/IGraphicsDebugLayer.hpp"
 #include "Core/Rendering/GraphicsContext/GraphicsContextFactory.hpp"
 #include "Core/Rendering/GraphicsContext/IGraphicsContextFactory.hpp"
+#include "Core/Rendering/IndirectDraw/IndirectDrawBackendFactory.hpp"
 #include "Core/Rendering/Material/IO/MaterialIO.hpp"
 #include "Core/Rendering/Material/MaterialFactory.hpp"
 #include "Core/Rendering/Material/ShaderAssetSourceContainer/ShaderAssetSourceContainerFactory.hpp"
@@ -41,6 +44,7 @@
 #include "Core/Rendering/PreviewRenderer/ModelPreview/IModelPreview.hpp"
 #include "Core/Rendering/PreviewRenderer/ModelPreview/ModelPreview.hpp"
 #include "Core/Rendering/RendererApi/RendererApiFactory.hpp"
+#include "Core/Rendering/Shader/ProgramBinaryCache/ProgramBinaryCache.hpp"
 #include "Core/Rendering/Shader/ShaderFactory.hpp"
 #include "Core/Rendering/Shader/ShaderParameterCollection/IShaderParameterCollectionFactory.hpp"
 #include "Core/Rendering/Shader/ShaderParameterCollection/ShaderParameterCollectionFactory.hpp"
@@ -52,7 +56,9 @@
 #include "Core/Rendering/VramTracker/VramTracker.hpp"
 #include "Core/Scene/Camera/CameraFactory.hpp"
 #include "Core/Scene/Camera/ICameraFactory.hpp"
+#include "Core/Scene/IO/SceneBinary/SceneBinaryCache.hpp"
 #include "Core/Scene/IO/SceneIO.hpp"
+#include "Core/Scene/IO/SceneWriter/SceneWriter.hpp"
 #include "Core/Scene/ISceneFactory.hpp"
 #include "Core/Scene/Properties/IScenePropertiesFactory.hpp"
 #include "Core/Scene/Properties/ScenePropertiesFactory.hpp"
@@ -91,6 +97,8 @@
 #include "Editor/Modules/SceneSettings/SceneSettingsWindowFactory.hpp"
 #include "Editor/Modules/SceneViewer/ISceneViewerWindowFactory.hpp"
 #include "Editor/Modules/SceneViewer/SceneViewerWindowFactory.hpp"
+#include "Editor/SceneAutosave/SceneAutosave.hpp"
+#include "Editor/SceneUndo/SceneUndo.hpp"
 #include "Editor/Selection/EditorSelection.hpp"
 #include "Editor/Selection/IEditorSelection.hpp"
 #include "Editor/Stats/EditorStats.hpp"
@@ -98,6 +106,7 @@
 #include "Input/InputManager.hpp"
 #include "Logging/DwarfLogger.hpp"
 #include "Platform/OpenGL/IOpenGLStateTracker.hpp"
+#include "Platform/OpenGL/OpenGLDebugLayer.hpp"
 #include "Platform/OpenGL/OpenGLStateTracker.hpp"
 #include "Project/ProjectSettings.hpp"
 #include "Project/ProjectSettingsIO.hpp"
@@ -132,6 +141,8 @@ namespace Dwarf
           boost::di::extension::shared),
           boost::di::bind<IOpenGLStateTracker>.to<OpenGLStateTracker>().in(
           boost::di::extension::shared),
+          boost::di::bind<IGraphicsDebugLayer>.to<OpenGLDebugLayer>().in(
+          boost::di::extension::shared),
           boost::di::bind<IDrawCallListFactory>.to<DrawCallListFactory>().in(
           boost::di::extension::shared),
           boost::di::bind<IDrawCallFactory>.to<DrawCallFactory>().in(
@@ -146,6 +157,8 @@ namespace Dwarf
           boost::di::extension::shared),
           boost::di::bind<IMeshBufferFactory>.to<MeshBufferFactory>().in(
           boost::di::extension::shared),
+          boost::di::bind<IIndirectDrawBackendFactory>.to<IndirectDrawBackendFactory>().in(
+          boost::di::extension::shared),
           boost::di::bind<IMeshBufferRequestList>.to<MeshBufferRequestList>().in(
           boost::di::extension::shared),
           boost::di::bind<IMeshFactory>.to<MeshFactory>().in(
@@ -176,6 +189,8 @@ namespace Dwarf
           boost::di::bind<IPingPongBufferFactory>.to<PingPongBufferFactory>().in(boost::di::extension::shared),
           boost::di::bind<IShaderParameterCollectionFactory>.to<ShaderParameterCollectionFactory>().in(boost::di::extension::shared),
           boost::di::bind<IShaderSourceCollectionFactory>.to<ShaderSourceCollectionFactory>().in(boost::di::extension::shared),
+          boost::di::bind<IProgramBinaryCache>.to<ProgramBinaryCache>().in(boost::di::extension::shared),
+          boost::di::bind<IShaderPreprocessor>.to<ShaderPreprocessor>().in(boost::di::extension::shared),
           boost::di::bind<IShaderFactory>.to<ShaderFactory>().in(boost::di::extension::shared),
           boost::di::bind<IShaderRegistry>.to<ShaderRegistry>().in(boost::di::extension::shared),
           boost::di::bind<IMaterialFactory>.to<MaterialFactory>().in(boost::di::extension::shared),
@@ -199,6 +214,10 @@ namespace Dwarf
           boost::di::bind<IDrawCallWorkerFactory>.to<DrawCallWorkerFactory>().in(
           boost::di::extension::shared),
           boost::di::bind<ISceneIO>.to<SceneIO>().in(boost::di::extension::shared),
+          boost::di::bind<ISceneBinaryCache>.to<SceneBinaryCache>().in(boost::di::extension::shared),
+          boost::di::bind<ISceneWriter>.to<SceneWriter>().in(boost::di::extension::shared),
+          boost::di::bind<ISceneAutosave>.to<SceneAutosave>().in(boost::di::extension::shared),
+          boost::di::bind<ISceneUndo>.to<SceneUndo>().in(boost::di::extension::shared),
           boost::di::bind<IMaterialCreator>.to<MaterialCreator>().in(boost::di::extension::shared),
           boost::di::bind<IShaderCreator>.to<ShaderCreator>().in(boost::di::extension::shared),
           boost::di::bind<IRendererApiFactory>.to<RendererApiFactory>().in(boost::di::extension::shared),
@@ -42,6 +42,8 @@
 #include "Launcher/View/ProjectNotFoundModal/IProjectNotFoundModal.hpp"
 #include "Launcher/View/ProjectNotFoundModal/ProjectNotFoundModal.hpp"
 #include "Logging/DwarfLogger.hpp"
+#include "Platform/OpenGL/IOpenGLStateTracker.hpp"
+#include "Platform/OpenGL/OpenGLStateTracker.hpp"
 #include "Project/ProjectSettingsIO.hpp"
 #include "UI/IImGuiLayerFactory.hpp"
 #include "UI/ImGuiLayerFactory.hpp"
@@ -71,6 +73,8 @@ namespace Dwarf
         boost::di::extension::shared),
       boost::di::bind<IVramTracker>.to<VramTracker>().in(
         boost::di::extension::shared),
+      boost::di::bind<IOpenGLStateTracker>.to<OpenGLStateTracker>().in(
+        boost::di::extension::shared),
       boost::di::bind<IEditorStats>.to<EditorStats>().in(
         boost::di::extension::shared),
       boost::di::bind<WindowProps>.to(
@@ -19,9 +19,12 @@ namespace Dwarf
                  std::shared_ptr<IEditorView>            view,
                  std::shared_ptr<IAssetDatabase>         assetDatabase,
                  std::shared_ptr<IShaderRecompiler>      shaderRecompiler,
+                 std::shared_ptr<IShaderRegistry>        shaderRegistry,
                  std::shared_ptr<IAssetReimporter>       assetReimporter,
                  std::shared_ptr<ITextureLoadingWorker>  textureLoadingWorker,
-                 std::shared_ptr<IMeshBufferRequestList> MeshBufferRequestList)
+                 std::shared_ptr<IMeshBufferRequestList> MeshBufferRequestList,
+                 std::shared_ptr<ISceneAutosave>         sceneAutosave,
+                 std::shared_ptr<ISceneUndo>             sceneUndo)
     : mLogger(std::move(logger))
     , mEditorStats(std::move(stats))
     , mInputManager(std::move(inputManager))
@@ -33,9 +36,12 @@ namespace Dwarf
     , mLoadedScene(std::move(loadedScene))
     , mAssetDatabase(std::move(assetDatabase))
     , mShaderRecompiler(std::move(shaderRecompiler))
+    , mShaderRegistry(std::move(shaderRegistry))
     , mAssetReimporter(std::move(assetReimporter))
     , mTextureLoadingWorker(std::move(textureLoadingWorker))
     , mMeshBufferRequestList(std::move(MeshBufferRequestList))
+    , mSceneAutosave(std::move(sceneAutosave))
+    , mSceneUndo(std::move(sceneUndo))
   {
     mLogger->LogDebug(Log("Editor created", "Editor"));
   }
@@ -91,11 +97,14 @@ namespace Dwarf
       mInputManager->OnUpdate();
       mAssetReimporter->ReimportQueuedAssets();
       mShaderRecompiler->Recompile();
+      mShaderRegistry->PatchReloadedMaterials();
       mTextureLoadingWorker->ProcessTextureJobs();
       mMeshBufferRequestList->ProcessRequests();
       mView->OnUpdate();
       mView->OnImGuiRender();
+      mSceneUndo->Update();
       mWindow->EndFrame();
+      mSceneAutosave->Update();
 
       /*while (TimeUtilities::GetDifferenceInSeconds(
                TimeUtilities::GetCurrent(),
@@ -5,11 +5,14 @@
 #include "Core/Asset/Shader/IShaderRecompiler.hpp"
 #include "Core/Asset/Texture/TextureWorker/ITextureLoadingWorker.hpp"
 #include "Core/Rendering/MeshBuffer/MeshBufferRequestList/IMeshBufferRequestList.hpp"
+#include "Core/Rendering/Shader/ShaderRegistry/IShaderRegistry.hpp"
 #include "Core/Scene/IO/ISceneIO.hpp"
 #include "Core/Scene/ISceneFactory.hpp"
 #include "Editor/EditorView/IEditorView.hpp"
 #include "Editor/IEditor.hpp"
 #include "Editor/LoadedScene/ILoadedScene.hpp"
+#include "Editor/SceneAutosave/ISceneAutosave.hpp"
+#include "Editor/SceneUndo/ISceneUndo.hpp"
 #include "Editor/Stats/IEditorStats.hpp"
 #include "Input/IInputManager.hpp"
 #include "Logging/IDwarfLogger.hpp"
@@ -33,9 +36,12 @@ namespace Dwarf
     std::shared_ptr<IProjectSettings>       mProjectSettings;
     std::shared_ptr<IAssetDatabase>         mAssetDatabase;
     std::shared_ptr<IShaderRecompiler>      mShaderRecompiler;
+    std::shared_ptr<IShaderRegistry>        mShaderRegistry;
     std::shared_ptr<IAssetReimporter>       mAssetReimporter;
     std::shared_ptr<ITextureLoadingWorker>  mTextureLoadingWorker;
     std::shared_ptr<IMeshBufferRequestList> mMeshBufferRequestList;
+    std::shared_ptr<ISceneAutosave>         mSceneAutosave;
+    std::shared_ptr<ISceneUndo>             mSceneUndo;
 
   public:
     Editor(std::shared_ptr<IDwarfLogger>           logger,
@@ -49,9 +55,12 @@ namespace Dwarf
            std::shared_ptr<IEditorView>            view,
            std::shared_ptr<IAssetDatabase>         assetDatabase,
            std::shared_ptr<IShaderRecompiler>      shaderRecompiler,
+           std::shared_ptr<IShaderRegistry>        shaderRegistry,
            std::shared_ptr<IAssetReimporter>       assetReimporter,
            std::shared_ptr<ITextureLoadingWorker>  textureLoadingWorker,
-           std::shared_ptr<IMeshBufferRequestList> MeshBufferRequestList);
+           std::shared_ptr<IMeshBufferRequestList> MeshBufferRequestList,
+           std::shared_ptr<ISceneAutosave>         sceneAutosave,
+           std::shared_ptr<ISceneUndo>             sceneUndo);
 
     ~Editor() override;
 
@@ -74,8 +74,13 @@ namespace Dwarf
               lock,
               std::chrono::seconds(EDITOR_VIEW_SERIALIZATION_INTERVAL_SECONDS),
               [this] { return !mRunViewSaveThread.load(); });
-            mProjectSettings->UpdateSerializedView(Serialize());
-            mProjectSettings->Save();
+            // The project settings are only written when the view changed
+            nlohmann::json serializedView = Serialize();
+            if (serializedView != mProjectSettings->GetSerializedView())
+            {
+              mProjectSettings->UpdateSerializedView(serializedView);
+              mProjectSettings->Save();
+            }
           }
         }
       });
@@ -7,26 +7,30 @@
 namespace Dwarf
 {
 
-  DebugWindow::DebugWindow(std::shared_ptr<IDwarfLogger>   logger,
-                           std::shared_ptr<IAssetDatabase> assetDatabase)
+  DebugWindow::DebugWindow(std::shared_ptr<IDwarfLogger>        logger,
+                           std::shared_ptr<IAssetDatabase>      assetDatabase,
+                           std::shared_ptr<IGraphicsDebugLayer> debugLayer)
     : IGuiModule(ModuleLabel("Debug"),
                  ModuleType(MODULE_TYPE::DEBUG),
                  ModuleID(std::make_shared<UUID>()))
     , mLogger(std::move(logger))
     , mAssetDatabase(std::move(assetDatabase))
+    , mDebugLayer(std::move(debugLayer))
   {
     mLogger->LogDebug(Log("DebugWindow created", "DebugWindow"));
   }
 
-  DebugWindow::DebugWindow(std::shared_ptr<IDwarfLogger>   logger,
-                           std::shared_ptr<IAssetDatabase> assetDatabase,
-                           SerializedModule                serializedModule)
+  DebugWindow::DebugWindow(std::shared_ptr<IDwarfLogger>        logger,
+                           std::shared_ptr<IAssetDatabase>      assetDatabase,
+                           std::shared_ptr<IGraphicsDebugLayer> debugLayer,
+                           SerializedModule serializedModule)
     : IGuiModule(ModuleLabel("Debug"),
                  ModuleType(MODULE_TYPE::DEBUG),
                  ModuleID(std::make_shared<UUID>(
                    serializedModule.t["id"].get<std::string>())))
     , mLogger(std::move(logger))
     , mAssetDatabase(std::move(assetDatabase))
+    , mDebugLayer(std::move(debugLayer))
   {
     Deserialize(serializedModule.t);
     mLogger->LogDebug(Log("DebugWindow created", "DebugWindow"));
@@ -55,6 +59,17 @@ namespace Dwarf
       return;
     }
 
+    if (ImGui::CollapsingHeader("Graphics Debugging"))
+    {
+      bool debugLayerEnabled = mDebugLayer->IsEnabled();
+      if (ImGui::Checkbox("Debug output and debug groups", &debugLayerEnabled))
+      {
+        mDebugLayer->SetEnabled(debugLayerEnabled);
+      }
+      ImGui::TextWrapped("Reports graphics API errors to the log and labels "
+                         "the render passes for graphics debuggers.");
+    }
+
     if (ImGui::CollapsingHeader("Asset Database"))
     {
       ImGui::Text("Listing all imported assets and their UID's");
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Asset/Database/IAssetDatabase.hpp"
+#include "Core/Rendering/DebugLayer/IGraphicsDebugLayer.hpp"
 #include "Editor/Modules/IGuiModule.hpp"
 #include "Logging/IDwarfLogger.hpp"
 #include <boost/serialization/strong_typedef.hpp>
@@ -11,16 +12,19 @@ namespace Dwarf
   class DebugWindow : public IGuiModule
   {
   private:
-    std::shared_ptr<IDwarfLogger>   mLogger;
-    std::shared_ptr<IAssetDatabase> mAssetDatabase;
+    std::shared_ptr<IDwarfLogger>        mLogger;
+    std::shared_ptr<IAssetDatabase>      mAssetDatabase;
+    std::shared_ptr<IGraphicsDebugLayer> mDebugLayer;
 
   public:
-    DebugWindow(std::shared_ptr<IDwarfLogger>   logger,
-                std::shared_ptr<IAssetDatabase> assetDatabase);
-
-    DebugWindow(std::shared_ptr<IDwarfLogger>   logger,
-                std::shared_ptr<IAssetDatabase> assetDatabase,
-                SerializedModule                serializedModule);
+    DebugWindow(std::shared_ptr<IDwarfLogger>        logger,
+                std::shared_ptr<IAssetDatabase>      assetDatabase,
+                std::shared_ptr<IGraphicsDebugLayer> debugLayer);
+
+    DebugWindow(std::shared_ptr<IDwarfLogger>        logger,
+                std::shared_ptr<IAssetDatabase>      assetDatabase,
+                std::shared_ptr<IGraphicsDebugLayer> debugLayer,
+                SerializedModule                     serializedModule);
 
     ~DebugWindow() override;
 
@@ -5,10 +5,12 @@
 namespace Dwarf
 {
   DebugWindowFactory::DebugWindowFactory(
-    std::shared_ptr<IDwarfLogger>   logger,
-    std::shared_ptr<IAssetDatabase> assetDatabase)
+    std::shared_ptr<IDwarfLogger>        logger,
+    std::shared_ptr<IAssetDatabase>      assetDatabase,
+    std::shared_ptr<IGraphicsDebugLayer> debugLayer)
     : mLogger(std::move(logger))
     , mAssetDatabase(std::move(assetDatabase))
+    , mDebugLayer(std::move(debugLayer))
 
   {
     mLogger->LogDebug(Log("DebugWindowFactory created", "DebugWindowFactory"));
@@ -23,7 +25,7 @@ namespace Dwarf
   auto
   DebugWindowFactory::Create() const -> std::unique_ptr<DebugWindow>
   {
-    return std::make_unique<DebugWindow>(mLogger, mAssetDatabase);
+    return std::make_unique<DebugWindow>(mLogger, mAssetDatabase, mDebugLayer);
   }
 
   auto
@@ -31,6 +33,6 @@ namespace Dwarf
     -> std::unique_ptr<DebugWindow>
   {
     return std::make_unique<DebugWindow>(
-      mLogger, mAssetDatabase, serializedModule);
+      mLogger, mAssetDatabase, mDebugLayer, serializedModule);
   }
 }
\ No newline at end of file
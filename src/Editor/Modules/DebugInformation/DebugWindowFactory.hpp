@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Core/Asset/Database/IAssetDatabase.hpp"
+#include "Core/Rendering/DebugLayer/IGraphicsDebugLayer.hpp"
 #include "Editor/Modules/DebugInformation/IDebugWindowFactory.hpp"
 #include "Logging/IDwarfLogger.hpp"
 #include <boost/di.hpp>
@@ -10,12 +11,14 @@ namespace Dwarf
   class DebugWindowFactory : public IDebugWindowFactory
   {
   private:
-    std::shared_ptr<IDwarfLogger>   mLogger;
-    std::shared_ptr<IAssetDatabase> mAssetDatabase;
+    std::shared_ptr<IDwarfLogger>        mLogger;
+    std::shared_ptr<IAssetDatabase>      mAssetDatabase;
+    std::shared_ptr<IGraphicsDebugLayer> mDebugLayer;
 
   public:
-    DebugWindowFactory(std::shared_ptr<IDwarfLogger>   logger,
-                       std::shared_ptr<IAssetDatabase> assetDatabase);
+    DebugWindowFactory(std::shared_ptr<IDwarfLogger>        logger,
+                       std::shared_ptr<IAssetDatabase>      assetDatabase,
+                       std::shared_ptr<IGraphicsDebugLayer> debugLayer);
     ~DebugWindowFactory() override;
 
     /**
@@ -1,6 +1,7 @@
 #include "pch.hpp"
 
 #include "Core/Asset/AssetTypes.hpp"
+#include "Core/Rendering/IndirectDraw/IndirectDrawTypes.hpp"
 #include "Core/Rendering/PreviewRenderer/MaterialPreview/IMaterialPreview.hpp"
 #include "MaterialAssetInspector.hpp"
 #include "UI/DwarfUI.hpp"
@@ -339,7 +340,8 @@ namespace Dwarf
         //   mShaderAssetSelector->GetCurrentSelection()));
         // mShaderAssetSelector->SetCurrentShader(material.GetShader());
         material.UpdateShader();
-        if (!material.GetShader()->IsCompiled())
+        if (!material.GetShader()->IsCompiled() &&
+            !material.GetShader()->IsCompiling())
         {
           material.GetShader()->Compile();
         }
@@ -347,9 +349,55 @@ namespace Dwarf
 
       ImGui::SameLine();
 
-      ImGui::TextWrapped(material.GetShader()->IsCompiled()
-                           ? "Successfully Compiled"
-                           : "Couldn't compile");
+      if (material.GetShader()->IsCompiling())
+      {
+        ImGui::TextWrapped("Compiling...");
+      }
+      else
+      {
+        ImGui::TextWrapped(material.GetShader()->IsCompiled()
+                             ? "Successfully Compiled"
+                             : "Couldn't compile");
+      }
+
+      // Keywords declared by the shader with "#pragma keywords", each
+      // combination is compiled as a separate variant. The indirect draw
+      // keyword is selected by the renderer and not offered here
+      std::vector<std::string> declaredKeywords =
+        material.GetShader()->GetDeclaredKeywords();
+      std::erase(declaredKeywords, INDIRECT_DRAW_KEYWORD);
+      if (!declaredKeywords.empty())
+      {
+        ImGui::SetCursorPosY(ImGui::GetCursorPosY() + 10);
+        ImGui::TextWrapped("Keywords");
+
+        std::vector<std::string> keywords = material.GetKeywords();
+        bool                     keywordsChanged = false;
+        for (const std::string& keyword : declaredKeywords)
+        {
+          auto iterator = std::ranges::find(keywords, keyword);
+          bool enabled = iterator != keywords.end();
+          if (ImGui::Checkbox(keyword.c_str(), &enabled))
+          {
+            keywordsChanged = true;
+            if (enabled)
+            {
+              keywords.push_back(keyword);
+            }
+            else
+            {
+              keywords.erase(iterator);
+            }
+          }
+        }
+
+        if (keywordsChanged)
+        {
+          // Applied after the loop, switching the variant replaces the shader
+          // owning the declared keywords
+          material.SetKeywords(std::move(keywords));
+        }
+      }
       ImGui::Unindent(15.0f);
     }
   }
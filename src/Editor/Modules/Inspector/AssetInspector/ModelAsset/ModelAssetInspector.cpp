@@ -12,19 +12,36 @@ namespace Dwarf
     std::shared_ptr<IAssetReimporter> assetReimporter,
     std::shared_ptr<IModelPreview>    modelPreview,
     std::shared_ptr<IInputManager>    inputManager,
-    std::shared_ptr<IEditorStats>     editorStats)
+    std::shared_ptr<IEditorStats>     editorStats,
+    std::shared_ptr<IAssetMetadata>   assetMetadata)
     : mGraphicsApi(graphicsApi)
     , mAssetDatabase(std::move(assetDatabase))
     , mAssetReimporter(std::move(assetReimporter))
     , mModelPreview(std::move(modelPreview))
     , mInputManager(std::move(inputManager))
     , mEditorStats(std::move(editorStats))
+    , mAssetMetadata(std::move(assetMetadata))
   {
   }
 
   void
   ModelAssetInspector::Render(IAssetReference& asset)
   {
+    if (asset.GetPath() != mCurrentModelPath)
+    {
+      mCurrentModelPath = asset.GetPath();
+      mCurrentMetadata = mAssetMetadata->GetMetadata(mCurrentModelPath);
+      if (mCurrentMetadata.contains("ImportSettings"))
+      {
+        mCurrentImportSettings =
+          ModelImportSettings(mCurrentMetadata["ImportSettings"]);
+      }
+      else
+      {
+        mCurrentImportSettings = ModelImportSettings();
+      }
+    }
+
     ImDrawList* drawList = ImGui::GetWindowDrawList();
     drawList->ChannelsSplit(2);
     drawList->ChannelsSetCurrent(1);
@@ -56,6 +73,81 @@ namespace Dwarf
       mAssetReimporter->QueueReimport(asset.GetPath());
     }
 
+    ImGui::SameLine();
+
+    if (ImGui::Button("Save Settings"))
+    {
+      mCurrentMetadata["ImportSettings"] = mCurrentImportSettings.Serialize();
+      mAssetMetadata->SetMetadata(mCurrentModelPath, mCurrentMetadata);
+    }
+
+    ImGui::TextWrapped("Import Settings: ");
+
+    ImGui::Checkbox("Optimize Vertex Cache",
+                    &mCurrentImportSettings.mOptimizeVertexCache);
+
+    ImGui::Checkbox("Optimize Overdraw",
+                    &mCurrentImportSettings.mOptimizeOverdraw);
+
+    ImGui::Checkbox("Optimize Vertex Fetch",
+                    &mCurrentImportSettings.mOptimizeVertexFetch);
+
+    {
+      int cacheSize = static_cast<int>(mCurrentImportSettings.mVertexCacheSize);
+      if (ImGui::SliderInt("Vertex Cache Size", &cacheSize, 8, 64))
+      {
+        mCurrentImportSettings.mVertexCacheSize =
+          static_cast<uint32_t>(cacheSize);
+      }
+    }
+
+    ImGui::SliderFloat("Overdraw Threshold",
+                       &mCurrentImportSettings.mOverdrawThreshold,
+                       1.0F,
+                       3.0F);
+
+    {
+      bool isCompact =
+        mCurrentImportSettings.mVertexFormat == VertexFormat::Compact;
+      if (ImGui::Checkbox("Compact Vertex Format", &isCompact))
+      {
+        mCurrentImportSettings.mVertexFormat =
+          isCompact ? VertexFormat::Compact : VertexFormat::Standard;
+      }
+    }
+
+    ImGui::Checkbox("Split For 16 Bit Indices",
+                    &mCurrentImportSettings.mSplitForUInt16Indices);
+
+    ImGui::Checkbox("Generate LODs", &mCurrentImportSettings.mGenerateLods);
+
+    if (mCurrentImportSettings.mGenerateLods)
+    {
+      int lodCount = static_cast<int>(mCurrentImportSettings.mLodCount);
+      if (ImGui::SliderInt("LOD Count", &lodCount, 1, 8))
+      {
+        mCurrentImportSettings.mLodCount = static_cast<uint32_t>(lodCount);
+      }
+
+      ImGui::SliderFloat("LOD Reduction",
+                         &mCurrentImportSettings.mLodReduction,
+                         0.1F,
+                         0.9F);
+
+      ImGui::SliderFloat("LOD Max Error",
+                         &mCurrentImportSettings.mLodMaxError,
+                         0.001F,
+                         0.2F);
+
+      ImGui::SliderFloat("LOD Screen Size",
+                         &mCurrentImportSettings.mLodScreenSize,
+                         0.05F,
+                         1.0F);
+    }
+
+    ImGui::Checkbox("Generate Meshlets",
+                    &mCurrentImportSettings.mGenerateMeshlets);
+
     ImGui::SetCursorPosY(ImGui::GetCursorPosY() + 10);
 
     auto separatorMin =
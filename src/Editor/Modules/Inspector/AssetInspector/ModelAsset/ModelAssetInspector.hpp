@@ -2,6 +2,8 @@
 
 #include "Core/Asset/AssetReimporter/IAssetReimporter.hpp"
 #include "Core/Asset/Database/IAssetDatabase.hpp"
+#include "Core/Asset/Metadata/IAssetMetadata.hpp"
+#include "Core/Asset/Model/ModelImportSettings.hpp"
 #include "Core/Base.hpp"
 #include "Core/Rendering/PreviewRenderer/ModelPreview/IModelPreview.hpp"
 #include "Editor/Modules/Inspector/AssetInspector/ModelAsset/IModelAssetInspector.hpp"
@@ -19,6 +21,10 @@ namespace Dwarf
     std::shared_ptr<IModelPreview>    mModelPreview;
     std::shared_ptr<IInputManager>    mInputManager;
     std::shared_ptr<IEditorStats>     mEditorStats;
+    std::shared_ptr<IAssetMetadata>   mAssetMetadata;
+    std::filesystem::path             mCurrentModelPath;
+    nlohmann::json                    mCurrentMetadata;
+    ModelImportSettings               mCurrentImportSettings;
 
   public:
     ModelAssetInspector(GraphicsApi                       graphicsApi,
@@ -26,7 +32,8 @@ namespace Dwarf
                         std::shared_ptr<IAssetReimporter> assetReimporter,
                         std::shared_ptr<IModelPreview>    modelPreview,
                         std::shared_ptr<IInputManager>    inputManager,
-                        std::shared_ptr<IEditorStats>     editorStats);
+                        std::shared_ptr<IEditorStats>     editorStats,
+                        std::shared_ptr<IAssetMetadata>   assetMetadata);
     ~ModelAssetInspector() override = default;
 
     /**
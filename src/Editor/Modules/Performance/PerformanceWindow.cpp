@@ -141,6 +141,40 @@ namespace Dwarf
     ImGui::Text("Compute Shader Memory: %s", computeShaderMemoryString.c_str());
     ImGui::Text("Shader Memory: %s", shaderMemoryString.c_str());
 
+    // The statistics are reset after every display, so they cover the
+    // frame that was rendered since the previous one
+    StateChangeStatistics stateChanges =
+      mRendererApi->GetStateChangeStatistics();
+    mRendererApi->ResetStateChangeStatistics();
+
+    if (ImGui::BeginTable("StateChanges", 3, ImGuiTableFlags_Borders))
+    {
+      ImGui::TableSetupColumn("State changes");
+      ImGui::TableSetupColumn("Issued");
+      ImGui::TableSetupColumn("Skipped");
+      ImGui::TableHeadersRow();
+
+      const std::array<std::pair<const char*, StateChangeCounter>, 6>
+        counters = { { { "Programs", stateChanges.Programs },
+                       { "Textures", stateChanges.Textures },
+                       { "Vertex arrays", stateChanges.VertexArrays },
+                       { "Framebuffers", stateChanges.Framebuffers },
+                       { "Viewports", stateChanges.Viewports },
+                       { "Raster state", stateChanges.RasterState } } };
+
+      for (const auto& [name, counter] : counters)
+      {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(name);
+        ImGui::TableNextColumn();
+        ImGui::Text("%u", counter.Issued);
+        ImGui::TableNextColumn();
+        ImGui::Text("%u", counter.Skipped);
+      }
+      ImGui::EndTable();
+    }
+
     ImGui::Text("Device information:\n%s",
                 mEditorStats->GetDeviceInfo().c_str());
 
@@ -99,6 +99,11 @@ namespace Dwarf
       mWindow->SetMouseVisibility(true);
     }
 
+    // World matrices of the moved subtrees and the bounds of the moved mesh
+    // renderers, read by rendering, picking and the gizmo
+    mLoadedScene->GetScene().GetTransformHierarchy().Update();
+    mLoadedScene->GetScene().GetSpatialIndex().Update();
+
     // Render scene to the framebuffer with the camera
     mRenderingPipeline->RenderScene(*mCamera, mSettings.GridSettings);
 
@@ -489,6 +494,11 @@ namespace Dwarf
 
     if (ImGui::BeginPopup("override_settings"))
     {
+      bool indirectDraw = mRenderingPipeline->IsIndirectDrawEnabled();
+      if (ImGui::Checkbox("Multi Draw Indirect", &indirectDraw))
+      {
+        mRenderingPipeline->SetIndirectDrawEnabled(indirectDraw);
+      }
       ImGui::EndPopup();
     }
   }
@@ -556,10 +566,12 @@ namespace Dwarf
     ImGuizmo::SetRect(
       minRect.x, minRect.y, maxRect.x - minRect.x, maxRect.y - minRect.y);
 
-    Entity    entity(mEditorSelection->GetSelectedEntities().at(0),
+    Entity entity(mEditorSelection->GetSelectedEntities().at(0),
                   mLoadedScene->GetScene().GetRegistry());
+    TransformHierarchy& hierarchy =
+      mLoadedScene->GetScene().GetTransformHierarchy();
     auto&     transformComponent = entity.GetComponent<TransformComponent>();
-    glm::mat4 transform = transformComponent.GetMatrix();
+    glm::mat4 transform = hierarchy.GetWorldMatrix(transformComponent);
 
     ImGuizmo::Manipulate(glm::value_ptr(mCamera->GetViewMatrix()),
                          glm::value_ptr(mCamera->GetProjectionMatrix()),
@@ -568,6 +580,12 @@ namespace Dwarf
                          glm::value_ptr(transform));
     if (ImGuizmo::IsUsing())
     {
+      // The gizmo works in world space, the transform is relative to the
+      // parent
+      transform =
+        glm::inverse(hierarchy.GetWorldMatrix(transformComponent.GetParent())) *
+        transform;
+
       // transformComponent.SetMatrix(transform);
       transformComponent.SetPosition(glm::vec3(transform[3]));
       transformComponent.SetScale(
@@ -585,6 +603,8 @@ namespace Dwarf
       glm::quat rotationQuat(rotationMatrix);
       transformComponent.SetEulerAngles(glm::degrees(
         glm::eulerAngles(rotationQuat))); // Convert to Euler angles in degrees
+      mLoadedScene->GetScene().GetRegistry().patch<TransformComponent>(
+        entity.GetHandle());
     }
   }
 
@@ -0,0 +1,22 @@
+#pragma once
+
+namespace Dwarf
+{
+  /**
+   * @brief Class that periodically saves the loaded scene
+   *
+   */
+  class ISceneAutosave
+  {
+  public:
+    virtual ~ISceneAutosave() = default;
+
+    /**
+     * @brief Saves the loaded scene if the autosave interval passed and the
+     * scene changed since it was last saved. Called once per frame.
+     *
+     */
+    virtual void
+    Update() = 0;
+  };
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#include "pch.hpp"
+
+#include "Editor/SceneAutosave/SceneAutosave.hpp"
+
+namespace Dwarf
+{
+  SceneAutosave::SceneAutosave(std::shared_ptr<IDwarfLogger> logger,
+                               std::shared_ptr<ILoadedScene> loadedScene,
+                               std::shared_ptr<ISceneIO>     sceneIO)
+    : mLogger(std::move(logger))
+    , mLoadedScene(std::move(loadedScene))
+    , mSceneIO(std::move(sceneIO))
+    , mLastCheck(std::chrono::steady_clock::now())
+  {
+    mLogger->LogDebug(Log("SceneAutosave created", "SceneAutosave"));
+  }
+
+  SceneAutosave::~SceneAutosave()
+  {
+    mLogger->LogDebug(Log("SceneAutosave destroyed", "SceneAutosave"));
+  }
+
+  void
+  SceneAutosave::Update()
+  {
+    auto now = std::chrono::steady_clock::now();
+    if (now - mLastCheck < AUTOSAVE_INTERVAL)
+    {
+      return;
+    }
+    mLastCheck = now;
+
+    if (!mLoadedScene->HasLoadedScene())
+    {
+      return;
+    }
+
+    // The change counter of the scene is compared, so an unchanged scene is
+    // never serialized
+    IScene& scene = mLoadedScene->GetScene();
+    if (scene.GetProperties().GetAssetId().has_value() &&
+        scene.HasUnsavedChanges())
+    {
+      mLogger->LogDebug(Log("Autosaving the loaded scene", "SceneAutosave"));
+      mSceneIO->SaveScene(scene);
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Core/Scene/IO/ISceneIO.hpp"
+#include "Editor/LoadedScene/ILoadedScene.hpp"
+#include "ISceneAutosave.hpp"
+#include "Logging/IDwarfLogger.hpp"
+#include <chrono>
+
+namespace Dwarf
+{
+  class SceneAutosave : public ISceneAutosave
+  {
+  private:
+    std::shared_ptr<IDwarfLogger>         mLogger;
+    std::shared_ptr<ILoadedScene>         mLoadedScene;
+    std::shared_ptr<ISceneIO>             mSceneIO;
+    std::chrono::steady_clock::time_point mLastCheck;
+
+  public:
+    /// @brief Time between two checks for unsaved changes.
+    static constexpr std::chrono::seconds AUTOSAVE_INTERVAL =
+      std::chrono::seconds(60);
+
+    SceneAutosave(std::shared_ptr<IDwarfLogger> logger,
+                  std::shared_ptr<ILoadedScene> loadedScene,
+                  std::shared_ptr<ISceneIO>     sceneIO);
+    ~SceneAutosave() override;
+
+    /**
+     * @brief Saves the loaded scene if the autosave interval passed and the
+     * scene changed since it was last saved. Scenes that were never saved to
+     * an asset are skipped, saving them would open a dialog.
+     *
+     */
+    void
+    Update() override;
+  };
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+
+namespace Dwarf
+{
+  /**
+   * @brief Class that records the changes to the loaded scene and reverts
+   * them on Ctrl+Z and Ctrl+Y
+   *
+   */
+  class ISceneUndo
+  {
+  public:
+    virtual ~ISceneUndo() = default;
+
+    /**
+     * @brief Records the changes made this frame and handles the undo and redo
+     * shortcuts. Called once per frame after the editor view was rendered.
+     *
+     */
+    virtual void
+    Update() = 0;
+  };
+}
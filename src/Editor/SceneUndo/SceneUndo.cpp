@@ -0,0 +1,94 @@
+#include "pch.hpp"
+
+#include "Editor/SceneUndo/SceneUndo.hpp"
+#include <imgui.h>
+
+namespace Dwarf
+{
+  SceneUndo::SceneUndo(std::shared_ptr<IDwarfLogger>     logger,
+                       std::shared_ptr<ILoadedScene>     loadedScene,
+                       std::shared_ptr<IInputManager>    inputManager,
+                       std::shared_ptr<IEditorSelection> editorSelection)
+    : mLogger(std::move(logger))
+    , mLoadedScene(std::move(loadedScene))
+    , mInputManager(std::move(inputManager))
+    , mEditorSelection(std::move(editorSelection))
+  {
+    mLoadedScene->RegisterLoadedSceneObserver(this);
+    if (mLoadedScene->HasLoadedScene())
+    {
+      OnSceneLoad();
+    }
+    mLogger->LogDebug(Log("SceneUndo created", "SceneUndo"));
+  }
+
+  SceneUndo::~SceneUndo()
+  {
+    mLoadedScene->UnregisterLoadedSceneObserver(this);
+    mLogger->LogDebug(Log("SceneUndo destroyed", "SceneUndo"));
+  }
+
+  void
+  SceneUndo::Update()
+  {
+    if (!mHistory)
+    {
+      return;
+    }
+
+    // Text fields handle the shortcuts themselves
+    bool control = mInputManager->GetKey(KEYCODE::LEFT_CONTROL) &&
+                   !ImGui::GetIO().WantTextInput;
+    bool undoHeld = control && mInputManager->GetKey(KEYCODE::Z);
+    bool redoHeld = control && mInputManager->GetKey(KEYCODE::Y);
+
+    if (undoHeld && !mUndoHeld && mHistory->Undo())
+    {
+      mLogger->LogDebug(Log("Undo", "SceneUndo"));
+      ValidateSelection();
+    }
+    else if (redoHeld && !mRedoHeld && mHistory->Redo())
+    {
+      mLogger->LogDebug(Log("Redo", "SceneUndo"));
+      ValidateSelection();
+    }
+    else if (!ImGui::IsAnyItemActive() &&
+             !mInputManager->GetMouseButton(MOUSE_BUTTON::LEFT))
+    {
+      // Only the entities changed since the last checkpoint are visited
+      mHistory->Checkpoint();
+    }
+
+    mUndoHeld = undoHeld;
+    mRedoHeld = redoHeld;
+  }
+
+  void
+  SceneUndo::OnSceneLoad()
+  {
+    mHistory = std::make_unique<SceneUndoHistory>(mLoadedScene->GetScene());
+  }
+
+  void
+  SceneUndo::OnSceneUnload()
+  {
+    mHistory.reset();
+  }
+
+  void
+  SceneUndo::ValidateSelection()
+  {
+    entt::registry& registry = mLoadedScene->GetScene().GetRegistry();
+
+    // Copied, removing entities changes the selection
+    std::vector<entt::entity> selected =
+      mEditorSelection->GetSelectedEntities();
+    for (entt::entity entity : selected)
+    {
+      if (!registry.valid(entity))
+      {
+        mEditorSelection->RemoveEntityFromSelection(entity);
+      }
+    }
+  }
+}
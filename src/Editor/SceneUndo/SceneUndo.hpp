@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Core/Scene/ChangeTracking/SceneUndoHistory.hpp"
+#include "Editor/LoadedScene/ILoadedScene.hpp"
+#include "Editor/LoadedScene/ILoadedSceneObserver.h"
+#include "Editor/Selection/IEditorSelection.hpp"
+#include "ISceneUndo.hpp"
+#include "Input/IInputManager.hpp"
+#include "Logging/IDwarfLogger.hpp"
+
+namespace Dwarf
+{
+  class SceneUndo
+    : public ISceneUndo
+    , public ILoadedSceneObserver
+  {
+  private:
+    std::shared_ptr<IDwarfLogger>     mLogger;
+    std::shared_ptr<ILoadedScene>     mLoadedScene;
+    std::shared_ptr<IInputManager>    mInputManager;
+    std::shared_ptr<IEditorSelection> mEditorSelection;
+
+    /// @brief History of the loaded scene, none while no scene is loaded.
+    std::unique_ptr<SceneUndoHistory> mHistory;
+
+    /// @brief Whether the shortcuts were held in the last frame, so holding
+    /// them reverts a single step.
+    bool mUndoHeld = false;
+    bool mRedoHeld = false;
+
+    /**
+     * @brief Removes the entities that were deleted by an undo or redo step
+     * from the selection
+     *
+     */
+    void
+    ValidateSelection();
+
+  public:
+    SceneUndo(std::shared_ptr<IDwarfLogger>     logger,
+              std::shared_ptr<ILoadedScene>     loadedScene,
+              std::shared_ptr<IInputManager>    inputManager,
+              std::shared_ptr<IEditorSelection> editorSelection);
+    ~SceneUndo() override;
+
+    /**
+     * @brief Records the changes made this frame as a step once no mouse
+     * button or widget is held, so dragging a value or a gizmo is undone as a
+     * whole. Ctrl+Z reverts the last step and Ctrl+Y applies it again.
+     *
+     */
+    void
+    Update() override;
+
+    void
+    OnSceneLoad() override;
+
+    void
+    OnSceneUnload() override;
+  };
+}
@@ -13,6 +13,8 @@ namespace Dwarf
     { SDL_SCANCODE_E, KEYCODE::E },
     { SDL_SCANCODE_Q, KEYCODE::Q },
     { SDL_SCANCODE_R, KEYCODE::R },
+    { SDL_SCANCODE_Y, KEYCODE::Y },
+    { SDL_SCANCODE_Z, KEYCODE::Z },
     { SDL_SCANCODE_LSHIFT, KEYCODE::LEFT_SHIFT },
     { SDL_SCANCODE_LCTRL, KEYCODE::LEFT_CONTROL }
   };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Core/Rendering/RendererApi/StateChangeStatistics.hpp"
 #include "Platform/OpenGL/OpenGLShader.hpp"
 #include <glad/glad.h>
 
@@ -18,12 +19,42 @@ namespace Dwarf
     virtual void
     SetShaderProgram(OpenGLShader& program) = 0;
 
+    /**
+     * @brief Binds a framebuffer for reading and drawing
+     *
+     * @param framebuffer The framebuffer to bind, 0 for the default one
+     */
     virtual void
     BindFramebuffer(GLuint framebuffer) = 0;
 
+    /**
+     * @brief Binds the framebuffer blits and pixel reads read from
+     *
+     * @param framebuffer The framebuffer to bind
+     */
+    virtual void
+    BindReadFramebuffer(GLuint framebuffer) = 0;
+
+    /**
+     * @brief Binds the framebuffer draws and blits write to
+     *
+     * @param framebuffer The framebuffer to bind
+     */
+    virtual void
+    BindDrawFramebuffer(GLuint framebuffer) = 0;
+
     virtual void
     BindVertexArray(GLuint vao) = 0;
 
+    /**
+     * @brief Binds a texture to a texture unit
+     *
+     * @param unit The texture unit to bind to
+     * @param texture The texture to bind
+     */
+    virtual void
+    BindTexture(uint32_t unit, GLuint texture) = 0;
+
     virtual void
     BindBuffer(GLuint buffer) = 0;
 
@@ -55,5 +86,45 @@ namespace Dwarf
 
     virtual void
     SetClearColor(const glm::vec4& color) = 0;
+
+    /**
+     * @brief Forgets the bindings of a deleted texture. OpenGL unbinds deleted
+     * objects and reuses their names.
+     *
+     * @param texture The deleted texture
+     */
+    virtual void
+    OnTextureDeleted(GLuint texture) = 0;
+
+    /**
+     * @brief Forgets the binding of a deleted vertex array
+     *
+     * @param vao The deleted vertex array
+     */
+    virtual void
+    OnVertexArrayDeleted(GLuint vao) = 0;
+
+    /**
+     * @brief Forgets the bindings of a deleted framebuffer
+     *
+     * @param framebuffer The deleted framebuffer
+     */
+    virtual void
+    OnFramebufferDeleted(GLuint framebuffer) = 0;
+
+    /**
+     * @brief Returns the state changes requested since the last reset
+     *
+     * @return Issued and skipped state changes by kind
+     */
+    [[nodiscard]] virtual auto
+    GetStatistics() const -> const StateChangeStatistics& = 0;
+
+    /**
+     * @brief Resets the state change statistics
+     *
+     */
+    virtual void
+    ResetStatistics() = 0;
   };
 }
\ No newline at end of file
@@ -7,21 +7,36 @@
 
 namespace Dwarf
 {
-  void
-  debugCallback(GLenum        source,
-                GLenum        type,
-                GLuint        id,
-                GLenum        severity,
-                GLsizei       length,
-                const GLchar* message,
-                const void*   userParam)
+  namespace
   {
-    std::cout << "OpenGL Debug Message:" << '\n';
-    std::cout << "    Source: " << source << '\n';
-    std::cout << "    Type: " << type << '\n';
-    std::cout << "    ID: " << id << '\n';
-    std::cout << "    Severity: " << severity << '\n';
-    std::cout << "    Message: " << message << '\n';
+    /// @brief Routes the messages of the OpenGL debug output to the logger
+    /// passed as the user parameter.
+    void GLAPIENTRY
+    DebugMessageCallback(GLenum source,
+                         GLenum type,
+                         GLuint id,
+                         GLenum severity,
+                         GLsizei /*length*/,
+                         const GLchar* message,
+                         const void*   userParam)
+    {
+      const auto* logger = static_cast<const IDwarfLogger*>(userParam);
+      Log         log(
+        fmt::format("OpenGL debug message {} (source {:#x}, type {:#x}): {}",
+                    id,
+                    source,
+                    type,
+                    message),
+        "OpenGLContext");
+
+      switch (severity)
+      {
+        case GL_DEBUG_SEVERITY_HIGH: logger->LogError(log); break;
+        case GL_DEBUG_SEVERITY_MEDIUM: logger->LogWarn(log); break;
+        case GL_DEBUG_SEVERITY_LOW: logger->LogInfo(log); break;
+        default: logger->LogDebug(log); break;
+      }
+    }
   }
 
   OpenGLContext::OpenGLContext(std::shared_ptr<IDwarfLogger> logger,
@@ -56,17 +71,39 @@ namespace Dwarf
 
     SDL_GL_MakeCurrent(mWindowHandle, mContext);
     gladLoadGLLoader((GLADloadproc)SDL_GL_GetProcAddress);
-    // Enable OpenGL debug output
-    glEnable(GL_DEBUG_OUTPUT);
-    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
-    glDebugMessageCallback(debugCallback, nullptr);
+
+    // The debug output reports errors through the logger. It starts enabled
+    // in debug builds and can be toggled at runtime by the debug layer.
+    if (OpenGLUtilities::SupportsDebugOutput())
+    {
+      glDebugMessageCallback(DebugMessageCallback, mLogger.get());
+      if (OpenGLUtilities::ErrorChecksEnabled)
+      {
+        glEnable(GL_DEBUG_OUTPUT);
+        glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+      }
+      else
+      {
+        glDisable(GL_DEBUG_OUTPUT);
+      }
+    }
     glEnable(GL_MULTISAMPLE);
 
+    // Let the driver choose how many threads compile shaders in parallel
+    if (GLAD_GL_KHR_parallel_shader_compile != 0)
+    {
+      glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    }
+    else if (GLAD_GL_ARB_parallel_shader_compile != 0)
+    {
+      glMaxShaderCompilerThreadsARB(0xFFFFFFFF);
+    }
+
     GLint maxColorSamples = 0;
     GLint maxDepthSamples = 0;
     glGetIntegerv(GL_MAX_SAMPLES, &maxColorSamples);
     glGetIntegerv(GL_MAX_DEPTH_TEXTURE_SAMPLES, &maxDepthSamples);
-    OpenGLUtilities::CheckOpenGLError("Init() End", "OpenGLContext", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("Init() End", "OpenGLContext", mLogger);
   }
 
   void
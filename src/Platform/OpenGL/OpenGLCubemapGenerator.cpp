@@ -18,10 +18,12 @@ namespace Dwarf
     const std::shared_ptr<IMeshFactory>&        meshFactory,
     const std::shared_ptr<IMeshBufferFactory>&  meshBufferFactory,
     const std::shared_ptr<IFramebufferFactory>  framebufferFactory,
-    const std::shared_ptr<IRendererApiFactory>& rendererApiFactory)
+    const std::shared_ptr<IRendererApiFactory>& rendererApiFactory,
+    std::shared_ptr<IOpenGLStateTracker>        stateTracker)
     : mLogger(std::move(logger))
     , mTextureFactory(std::move(textureFactory))
     , mRendererApi(rendererApiFactory->Create())
+    , mStateTracker(std::move(stateTracker))
   {
     std::shared_ptr<IMesh> cubeMesh = meshFactory->CreateSkyboxCube();
     mCubeMeshBuffer = meshBufferFactory->Create(cubeMesh);
@@ -69,44 +71,39 @@ namespace Dwarf
     // Create and set up framebuffer
     GLuint fbo, rbo;
     glCreateFramebuffers(1, &fbo);
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "glCreateFramebuffers", "OpenGLCubemapGenerator", mLogger);
     glCreateRenderbuffers(1, &rbo);
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "glCreateRenderbuffers", "OpenGLCubemapGenerator", mLogger);
     glNamedRenderbufferStorage(
       rbo, GL_DEPTH_COMPONENT24, resolution, resolution);
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "glNamedRenderbufferStorage", "OpenGLCubemapGenerator", mLogger);
     glNamedFramebufferRenderbuffer(
       fbo, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rbo);
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "glNamedFramebufferRenderbuffer", "OpenGLCubemapGenerator", mLogger);
 
+    // The registry compiles in the background, the conversion can't wait
+    if (!mConvertShader->IsCompiled())
+    {
+      mConvertShader->Compile();
+    }
+
     auto* shader = dynamic_cast<OpenGLShader*>(mConvertShader.get());
-    glUseProgram(shader->GetID());
-    OpenGLUtilities::CheckOpenGLError(
-      "glUseProgram", "OpenGLCubemapGenerator", mLogger);
+    mStateTracker->SetShaderProgram(*shader);
     glUniform1i(glGetUniformLocation(shader->GetID(), "equirectangularMap"), 0);
-    OpenGLUtilities::CheckOpenGLError(
-      "glUniform1i", "OpenGLCubemapGenerator", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glUniform1i", "OpenGLCubemapGenerator", mLogger);
     glUniformMatrix4fv(glGetUniformLocation(shader->GetID(), "projection"),
                        1,
                        GL_FALSE,
                        glm::value_ptr(captureProjection));
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "glUniformMatrix4fv", "OpenGLCubemapGenerator", mLogger);
 
-    glActiveTexture(GL_TEXTURE0);
-    OpenGLUtilities::CheckOpenGLError(
-      "glActiveTexture", "OpenGLCubemapGenerator", mLogger);
-    glBindTexture(GL_TEXTURE_2D, texture->GetTextureID());
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindTexture", "OpenGLCubemapGenerator", mLogger);
-
-    glViewport(0, 0, resolution, resolution);
-    OpenGLUtilities::CheckOpenGLError(
-      "glViewport", "OpenGLCubemapGenerator", mLogger);
+    mStateTracker->BindTexture(0, texture->GetTextureID());
+    mStateTracker->SetViewport(0, 0, resolution, resolution);
     // glDisable(GL_CULL_FACE);
     // glDisable(GL_DEPTH_TEST); // <- Try this if depth is not needed
 
@@ -116,36 +113,33 @@ namespace Dwarf
                          1,
                          GL_FALSE,
                          glm::value_ptr(captureViews[i]));
-      OpenGLUtilities::CheckOpenGLError(
+      DWARF_CHECK_OPENGL_ERROR(
         "glUniformMatrix4fv", "OpenGLCubemapGenerator", mLogger);
 
       // Attach face
       glNamedFramebufferTextureLayer(
         fbo, GL_COLOR_ATTACHMENT0, cubeMap->GetTextureID(), 0, i);
-      OpenGLUtilities::CheckOpenGLError(
+      DWARF_CHECK_OPENGL_ERROR(
         "glNamedFramebufferTextureLayer", "OpenGLCubemapGenerator", mLogger);
-      glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-      OpenGLUtilities::CheckOpenGLError(
-        "glBindFramebuffer", "OpenGLCubemapGenerator", mLogger);
+      mStateTracker->BindFramebuffer(fbo);
       glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-      OpenGLUtilities::CheckOpenGLError(
-        "glClear", "OpenGLCubemapGenerator", mLogger);
+      DWARF_CHECK_OPENGL_ERROR("glClear", "OpenGLCubemapGenerator", mLogger);
 
       // Draw cube (assumes cubeVAO is bound to a unit cube with in vec3 aPos)
       auto* oglMesh = dynamic_cast<OpenGLMeshBuffer*>(mCubeMeshBuffer.get());
       oglMesh->Bind();
-      glDrawElements(
-        GL_TRIANGLES, oglMesh->GetIndexCount(), GL_UNSIGNED_INT, 0);
-      OpenGLUtilities::CheckOpenGLError(
+      glDrawElements(GL_TRIANGLES,
+                     static_cast<GLsizei>(oglMesh->GetIndexCount()),
+                     oglMesh->GetGLIndexType(),
+                     nullptr);
+      DWARF_CHECK_OPENGL_ERROR(
         "glDrawArrays", "OpenGLCubemapGenerator", mLogger);
-      oglMesh->Unbind();
     }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindFramebuffer Unbind", "OpenGLCubemapGenerator", mLogger);
+    mStateTracker->BindFramebuffer(0);
 
     glDeleteFramebuffers(1, &fbo);
+    mStateTracker->OnFramebufferDeleted(fbo);
     glDeleteRenderbuffers(1, &rbo);
 
     return std::move(cubeMap);
@@ -13,15 +13,17 @@
 #include "Core/Rendering/Texture/ITexture.hpp"
 #include "Core/Rendering/Texture/ITextureFactory.hpp"
 #include "Logging/IDwarfLogger.hpp"
+#include "Platform/OpenGL/IOpenGLStateTracker.hpp"
 
 namespace Dwarf
 {
   class OpenGLCubemapGenerator : public ICubemapGenerator
   {
   private:
-    std::shared_ptr<IDwarfLogger>    mLogger;
-    std::shared_ptr<ITextureFactory> mTextureFactory;
-    std::shared_ptr<IRendererApi>    mRendererApi;
+    std::shared_ptr<IDwarfLogger>        mLogger;
+    std::shared_ptr<ITextureFactory>     mTextureFactory;
+    std::shared_ptr<IRendererApi>        mRendererApi;
+    std::shared_ptr<IOpenGLStateTracker> mStateTracker;
 
     std::shared_ptr<IShader>      mConvertShader;
     std::shared_ptr<IMeshBuffer>  mCubeMeshBuffer;
@@ -37,7 +39,8 @@ namespace Dwarf
       const std::shared_ptr<IMeshFactory>&        meshFactory,
       const std::shared_ptr<IMeshBufferFactory>&  meshBufferFactory,
       const std::shared_ptr<IFramebufferFactory>  framebufferFactory,
-      const std::shared_ptr<IRendererApiFactory>& rendererApiFactory);
+      const std::shared_ptr<IRendererApiFactory>& rendererApiFactory,
+      std::shared_ptr<IOpenGLStateTracker>        stateTracker);
     ~OpenGLCubemapGenerator() override = default;
 
     [[nodiscard]] auto
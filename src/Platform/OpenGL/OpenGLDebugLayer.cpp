@@ -0,0 +1,89 @@
+#include "pch.hpp"
+
+#include "OpenGLDebugLayer.hpp"
+#include "OpenGLUtilities.hpp"
+#include <glad/glad.h>
+
+namespace Dwarf
+{
+  OpenGLDebugLayer::OpenGLDebugLayer(std::shared_ptr<IDwarfLogger> logger)
+    : mLogger(std::move(logger))
+    , mEnabled(OpenGLUtilities::ErrorChecksEnabled)
+  {
+    mLogger->LogDebug(Log("OpenGLDebugLayer created", "OpenGLDebugLayer"));
+  }
+
+  OpenGLDebugLayer::~OpenGLDebugLayer()
+  {
+    mLogger->LogDebug(Log("OpenGLDebugLayer destroyed", "OpenGLDebugLayer"));
+  }
+
+  void
+  OpenGLDebugLayer::SetEnabled(bool enabled)
+  {
+    if (enabled == mEnabled)
+    {
+      return;
+    }
+
+    if (!OpenGLUtilities::SupportsDebugOutput())
+    {
+      mLogger->LogWarn(Log("GL_KHR_debug is not supported by the driver",
+                           "OpenGLDebugLayer"));
+      return;
+    }
+
+    if (enabled)
+    {
+      glEnable(GL_DEBUG_OUTPUT);
+      glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    }
+    else
+    {
+      glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+      glDisable(GL_DEBUG_OUTPUT);
+    }
+
+    mEnabled = enabled;
+    mLogger->LogInfo(Log(fmt::format("OpenGL debug output {}",
+                                     enabled ? "enabled" : "disabled"),
+                         "OpenGLDebugLayer"));
+  }
+
+  auto
+  OpenGLDebugLayer::IsEnabled() const -> bool
+  {
+    return mEnabled;
+  }
+
+  void
+  OpenGLDebugLayer::PushGroup(std::string_view name)
+  {
+    bool push = mEnabled && OpenGLUtilities::SupportsDebugOutput();
+    mGroupStack.push_back(push);
+    if (push)
+    {
+      glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION,
+                       0,
+                       static_cast<GLsizei>(name.size()),
+                       name.data());
+    }
+  }
+
+  void
+  OpenGLDebugLayer::PopGroup()
+  {
+    if (mGroupStack.empty())
+    {
+      mLogger->LogWarn(
+        Log("PopGroup called without an open group", "OpenGLDebugLayer"));
+      return;
+    }
+
+    if (mGroupStack.back())
+    {
+      glPopDebugGroup();
+    }
+    mGroupStack.pop_back();
+  }
+}
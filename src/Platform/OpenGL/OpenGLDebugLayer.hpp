@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Core/Rendering/DebugLayer/IGraphicsDebugLayer.hpp"
+#include "Logging/IDwarfLogger.hpp"
+#include <vector>
+
+namespace Dwarf
+{
+  /**
+   * @brief Debug layer based on GL_KHR_debug. The message callback is
+   * installed by the OpenGLContext, this class toggles the debug output and
+   * issues the debug groups.
+   *
+   */
+  class OpenGLDebugLayer : public IGraphicsDebugLayer
+  {
+  private:
+    std::shared_ptr<IDwarfLogger> mLogger;
+    bool                          mEnabled;
+
+    /// @brief Whether each open group has been pushed to OpenGL, so groups
+    /// opened before toggling the layer are closed correctly.
+    std::vector<bool> mGroupStack;
+
+  public:
+    OpenGLDebugLayer(std::shared_ptr<IDwarfLogger> logger);
+    ~OpenGLDebugLayer() override;
+
+    void
+    SetEnabled(bool enabled) override;
+
+    [[nodiscard]] auto
+    IsEnabled() const -> bool override;
+
+    void
+    PushGroup(std::string_view name) override;
+
+    void
+    PopGroup() override;
+  };
+}
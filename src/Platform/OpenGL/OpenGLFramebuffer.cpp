@@ -109,14 +109,16 @@ namespace Dwarf
 
   // @brief: Constructs an OpenGL framebuffer with the given specification
   OpenGLFramebuffer::OpenGLFramebuffer(
-    std::shared_ptr<IDwarfLogger>    logger,
-    FramebufferSpecification         spec,
-    std::shared_ptr<ITextureFactory> textureFactory,
-    std::shared_ptr<IVramTracker>    vramTracker)
+    std::shared_ptr<IDwarfLogger>        logger,
+    FramebufferSpecification             spec,
+    std::shared_ptr<ITextureFactory>     textureFactory,
+    std::shared_ptr<IVramTracker>        vramTracker,
+    std::shared_ptr<IOpenGLStateTracker> stateTracker)
     : mLogger(std::move(logger))
     , mSpecification(std::move(spec))
     , mTextureFactory(std::move(textureFactory))
     , mVramTracker(std::move(vramTracker))
+    , mStateTracker(std::move(stateTracker))
   {
     mLogger->LogDebug(Log("OpenGLFramebuffer created.", "OpenGLFramebuffer"));
     for (auto attachments : mSpecification.Attachments.Attachments)
@@ -144,7 +146,7 @@ namespace Dwarf
   void
   OpenGLFramebuffer::Invalidate()
   {
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "Before OpenGLFramebuffer Invalidate", "OpenGLFramebuffer", mLogger);
     // If the renderer ID is not 0, delete the framebuffer and its attachments
     if (mRendererID != 0U)
@@ -154,13 +156,17 @@ namespace Dwarf
 
     // Create the framebuffer
     glCreateFramebuffers(1, &mRendererID);
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "glCreateFramebuffer", "OpenGLFramebuffer", mLogger);
+    OpenGLUtilities::SetObjectLabel(GL_FRAMEBUFFER,
+                                    mRendererID,
+                                    fmt::format("Framebuffer {}x{} ({}x)",
+                                                mSpecification.Width,
+                                                mSpecification.Height,
+                                                mSpecification.Samples));
 
     // Bind the framebuffer
-    glBindFramebuffer(GL_FRAMEBUFFER, mRendererID);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindFramebuffer", "OpenGLFramebuffer", mLogger);
+    mStateTracker->BindFramebuffer(mRendererID);
 
     GenerateAttachments();
 
@@ -175,8 +181,7 @@ namespace Dwarf
         buffers.push_back(GL_COLOR_ATTACHMENT0 + buffers.size());
       }
       glDrawBuffers(buffers.size(), buffers.data());
-      OpenGLUtilities::CheckOpenGLError(
-        "glDrawBuffers", "OpenGLFramebuffer", mLogger);
+      DWARF_CHECK_OPENGL_ERROR("glDrawBuffers", "OpenGLFramebuffer", mLogger);
     }
     else if (mColorAttachments.empty())
     {
@@ -197,34 +202,23 @@ namespace Dwarf
     }
 
     // Unbind the framebuffer
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindFramebuffer Invalidate() end", "OpenGLFramebuffer", mLogger);
+    mStateTracker->BindFramebuffer(0);
   }
 
   // @brief: Binds the framebuffer
   void
   OpenGLFramebuffer::Bind()
   {
-    OpenGLUtilities::CheckOpenGLError(
-      "Before Bind()", "OpenGLFramebuffer", mLogger);
-    glBindFramebuffer(GL_FRAMEBUFFER, mRendererID);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindFramebuffer Bind()", "OpenGLFramebuffer", mLogger);
-    glViewport(0, 0, mSpecification.Width, mSpecification.Height);
-    OpenGLUtilities::CheckOpenGLError(
-      "glViewport", "OpenGLFramebuffer", mLogger);
+    mStateTracker->BindFramebuffer(mRendererID);
+    mStateTracker->SetViewport(
+      0, 0, mSpecification.Width, mSpecification.Height);
   }
 
   // @brief: Unbinds the framebuffer
   void
   OpenGLFramebuffer::Unbind()
   {
-    OpenGLUtilities::CheckOpenGLError(
-      "Before Unbind()", "OpenGLFramebuffer", mLogger);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindFramebuffer Unbind()", "OpenGLFramebuffer", mLogger);
+    mStateTracker->BindFramebuffer(0);
   }
 
   // @brief: Resizes the framebuffer
@@ -239,9 +233,9 @@ namespace Dwarf
     mSpecification.Width = width;
     mSpecification.Height = height;
 
-    glBindFramebuffer(GL_FRAMEBUFFER, mRendererID);
+    mStateTracker->BindFramebuffer(mRendererID);
     GenerateAttachments();
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    mStateTracker->BindFramebuffer(0);
 
     mVramTracker->RemoveFramebufferMemory(mCurrentVramMemory);
     mCurrentVramMemory = mVramTracker->AddFramebufferMemory(mSpecification);
@@ -318,7 +312,7 @@ namespace Dwarf
           textarget,
           mColorAttachments[i]->GetTextureID(),
           0);
-        OpenGLUtilities::CheckOpenGLError(
+        DWARF_CHECK_OPENGL_ERROR(
           "glFramebufferTexture2D color attachment",
           "OpenGLFramebuffer",
           mLogger);
@@ -343,7 +337,7 @@ namespace Dwarf
                              mDepthAttachment->GetTextureID(),
                              0);
 
-      OpenGLUtilities::CheckOpenGLError(
+      DWARF_CHECK_OPENGL_ERROR(
         "glFramebufferTexture2D depth attachment",
         "OpenGLFramebuffer",
         mLogger);
@@ -379,8 +373,7 @@ namespace Dwarf
     glm::ivec2 convertedCoords =
       Utils::ConvertToOpenGLCoords({ x, y }, mSpecification.Height);
     glReadBuffer(GL_COLOR_ATTACHMENT0 + attachmentIndex);
-    OpenGLUtilities::CheckOpenGLError(
-      "glReadBuffer", "OpenGLFramebuffer", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glReadBuffer", "OpenGLFramebuffer", mLogger);
 
     GLuint pixel = 0;
     glReadPixels(convertedCoords.x,
@@ -390,8 +383,7 @@ namespace Dwarf
                  GL_RED_INTEGER,
                  GL_UNSIGNED_INT,
                  &pixel);
-    OpenGLUtilities::CheckOpenGLError(
-      "glReadPixels", "OpenGLFramebuffer", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glReadPixels", "OpenGLFramebuffer", mLogger);
 
     Unbind();
     return pixel;
@@ -407,8 +399,7 @@ namespace Dwarf
                     Utils::DwarfFBTextureFormatToGL(spec.TextureFormat),
                     GL_INT,
                     &value);
-    OpenGLUtilities::CheckOpenGLError(
-      "glClearTexImage", "OpenGLFramebuffer", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glClearTexImage", "OpenGLFramebuffer", mLogger);
   }
 
   auto
@@ -447,7 +438,7 @@ namespace Dwarf
   {
     Bind();
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    OpenGLUtilities::CheckOpenGLError("glClear", "OpenGLFramebuffer", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glClear", "OpenGLFramebuffer", mLogger);
     Unbind();
   }
 
@@ -458,8 +449,7 @@ namespace Dwarf
     Bind();
     glClearBufferfv(
       GL_COLOR, GL_COLOR_ATTACHMENT0 + index, glm::value_ptr(clearColor));
-    OpenGLUtilities::CheckOpenGLError(
-      "glClearBufferfv", "OpenGLFramebuffer", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glClearBufferfv", "OpenGLFramebuffer", mLogger);
     Unbind();
   }
 
@@ -468,8 +458,9 @@ namespace Dwarf
   {
     mLogger->LogDebug(Log("Deleting framebuffer", "OpenGLFramebuffer"));
     glDeleteFramebuffers(1, &mRendererID);
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "glDeleteFramebuffers", "OpenGLFramebuffer", mLogger);
+    mStateTracker->OnFramebufferDeleted(mRendererID);
     mColorAttachments.clear();
     mDepthAttachment = nullptr;
     mVramTracker->RemoveFramebufferMemory(mCurrentVramMemory);
@@ -4,15 +4,17 @@
 #include "Core/Rendering/Texture/ITextureFactory.hpp"
 #include "Core/Rendering/VramTracker/IVramTracker.hpp"
 #include "Logging/IDwarfLogger.hpp"
+#include "Platform/OpenGL/IOpenGLStateTracker.hpp"
 
 namespace Dwarf
 {
   class OpenGLFramebuffer : public IFramebuffer
   {
   private:
-    std::shared_ptr<IDwarfLogger>    mLogger;
-    std::shared_ptr<ITextureFactory> mTextureFactory;
-    std::shared_ptr<IVramTracker>    mVramTracker;
+    std::shared_ptr<IDwarfLogger>        mLogger;
+    std::shared_ptr<ITextureFactory>     mTextureFactory;
+    std::shared_ptr<IVramTracker>        mVramTracker;
+    std::shared_ptr<IOpenGLStateTracker> mStateTracker;
 
     uint32_t                                     mRendererID = 0;
     FramebufferSpecification                     mSpecification;
@@ -32,10 +34,12 @@ namespace Dwarf
     GenerateAttachments();
 
   public:
-    explicit OpenGLFramebuffer(std::shared_ptr<IDwarfLogger>    logger,
-                               FramebufferSpecification         spec,
-                               std::shared_ptr<ITextureFactory> textureFactory,
-                               std::shared_ptr<IVramTracker>    vramTracker);
+    explicit OpenGLFramebuffer(
+      std::shared_ptr<IDwarfLogger>        logger,
+      FramebufferSpecification             spec,
+      std::shared_ptr<ITextureFactory>     textureFactory,
+      std::shared_ptr<IVramTracker>        vramTracker,
+      std::shared_ptr<IOpenGLStateTracker> stateTracker);
     ~OpenGLFramebuffer() override;
 
     /**
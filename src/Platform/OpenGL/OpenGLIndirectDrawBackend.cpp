@@ -0,0 +1,434 @@
+#include "pch.hpp"
+
+#include "OpenGLIndirectDrawBackend.hpp"
+#include "Platform/OpenGL/OpenGLMeshBuffer.hpp"
+#include "Platform/OpenGL/OpenGLShader.hpp"
+#include "Platform/OpenGL/OpenGLUtilities.hpp"
+#include <numeric>
+
+namespace Dwarf
+{
+  namespace
+  {
+    /// @brief Binding point of the per draw data storage buffer, has to
+    /// match indirect_draw.glsl.
+    constexpr GLuint DRAW_DATA_BINDING = 0;
+
+    /// @brief Attribute location of the draw index, has to match
+    /// indirect_draw.glsl.
+    constexpr GLuint DRAW_INDEX_LOCATION = 5;
+
+    constexpr GLuint VERTEX_BUFFER_BINDING = 0;
+    constexpr GLuint DRAW_INDEX_BUFFER_BINDING = 1;
+
+    /// @brief Smallest size of a newly allocated arena buffer.
+    constexpr size_t MIN_ARENA_CAPACITY = 1024 * 1024;
+
+    auto
+    ToGLType(VertexAttributeType type) -> GLenum
+    {
+      switch (type)
+      {
+        using enum VertexAttributeType;
+        case Float: return GL_FLOAT;
+        case Short: return GL_SHORT;
+        case HalfFloat: return GL_HALF_FLOAT;
+      }
+      return GL_FLOAT;
+    }
+  }
+
+  OpenGLIndirectDrawBackend::OpenGLIndirectDrawBackend(
+    std::shared_ptr<IRendererApi>        rendererApi,
+    std::shared_ptr<IDwarfLogger>        logger,
+    std::shared_ptr<IVramTracker>        vramTracker,
+    std::shared_ptr<IOpenGLStateTracker> stateTracker)
+    : mRendererApi(
+        std::dynamic_pointer_cast<OpenGLRendererApi>(std::move(rendererApi)))
+    , mLogger(std::move(logger))
+    , mVramTracker(std::move(vramTracker))
+    , mStateTracker(std::move(stateTracker))
+  {
+    mLogger->LogDebug(
+      Log("OpenGLIndirectDrawBackend created.", "OpenGLIndirectDrawBackend"));
+  }
+
+  OpenGLIndirectDrawBackend::~OpenGLIndirectDrawBackend()
+  {
+    mLogger->LogDebug(
+      Log("OpenGLIndirectDrawBackend destroyed.", "OpenGLIndirectDrawBackend"));
+
+    size_t memory = mDrawDataCapacity + mCommandCapacity + mDrawIndexCapacity;
+    for (OpenGLIndirectDrawArena& arena : mArenas)
+    {
+      glDeleteVertexArrays(1, &arena.VertexArray);
+      mStateTracker->OnVertexArrayDeleted(arena.VertexArray);
+      glDeleteBuffers(1, &arena.VertexBuffer);
+      glDeleteBuffers(1, &arena.IndexBuffer);
+      memory += arena.VertexCapacity + arena.IndexCapacity;
+    }
+    for (auto& [program, materialBuffer] : mMaterialBuffers)
+    {
+      glDeleteBuffers(1, &materialBuffer.Buffer);
+      memory += materialBuffer.Capacity;
+    }
+    glDeleteBuffers(1, &mDrawDataBuffer);
+    glDeleteBuffers(1, &mCommandBuffer);
+    glDeleteBuffers(1, &mDrawIndexBuffer);
+    DWARF_CHECK_OPENGL_ERROR(
+      "glDeleteBuffers", "OpenGLIndirectDrawBackend", mLogger);
+    mVramTracker->RemoveBufferMemory(memory);
+  }
+
+  void
+  OpenGLIndirectDrawBackend::GrowBuffer(GLuint&          buffer,
+                                        size_t&          capacity,
+                                        size_t           used,
+                                        size_t           required,
+                                        std::string_view label)
+  {
+    size_t newCapacity = std::max({ required, capacity * 2, size_t(64) });
+    GLuint newBuffer = 0;
+    glCreateBuffers(1, &newBuffer);
+    glNamedBufferData(newBuffer,
+                      static_cast<GLsizeiptr>(newCapacity),
+                      nullptr,
+                      GL_DYNAMIC_DRAW);
+    DWARF_CHECK_OPENGL_ERROR(
+      "glNamedBufferData", "OpenGLIndirectDrawBackend", mLogger);
+    OpenGLUtilities::SetObjectLabel(GL_BUFFER, newBuffer, label);
+
+    if (buffer != 0)
+    {
+      if (used > 0)
+      {
+        glCopyNamedBufferSubData(
+          buffer, newBuffer, 0, 0, static_cast<GLsizeiptr>(used));
+        DWARF_CHECK_OPENGL_ERROR(
+          "glCopyNamedBufferSubData", "OpenGLIndirectDrawBackend", mLogger);
+      }
+      glDeleteBuffers(1, &buffer);
+    }
+
+    mVramTracker->RemoveBufferMemory(capacity);
+    mVramTracker->AddBufferMemory(newCapacity);
+    buffer = newBuffer;
+    capacity = newCapacity;
+  }
+
+  void
+  OpenGLIndirectDrawBackend::UpdateVertexArray(
+    const OpenGLIndirectDrawArena& arena) const
+  {
+    const VertexLayout& layout = VertexLayout::Get(arena.Format);
+    glVertexArrayVertexBuffer(arena.VertexArray,
+                              VERTEX_BUFFER_BINDING,
+                              arena.VertexBuffer,
+                              0,
+                              static_cast<GLsizei>(layout.Stride));
+    glVertexArrayElementBuffer(arena.VertexArray, arena.IndexBuffer);
+    glVertexArrayVertexBuffer(arena.VertexArray,
+                              DRAW_INDEX_BUFFER_BINDING,
+                              mDrawIndexBuffer,
+                              0,
+                              sizeof(uint32_t));
+    DWARF_CHECK_OPENGL_ERROR(
+      "glVertexArrayVertexBuffer", "OpenGLIndirectDrawBackend", mLogger);
+  }
+
+  auto
+  OpenGLIndirectDrawBackend::GetArena(VertexFormat format, IndexType type)
+    -> uint32_t
+  {
+    for (uint32_t i = 0; i < mArenas.size(); i++)
+    {
+      if (mArenas[i].Format == format && mArenas[i].Type == type)
+      {
+        return i;
+      }
+    }
+
+    OpenGLIndirectDrawArena& arena = mArenas.emplace_back();
+    arena.Format = format;
+    arena.Type = type;
+
+    glCreateVertexArrays(1, &arena.VertexArray);
+    OpenGLUtilities::SetObjectLabel(
+      GL_VERTEX_ARRAY,
+      arena.VertexArray,
+      fmt::format("Indirect draw arena ({}, {})",
+                  magic_enum::enum_name(format),
+                  magic_enum::enum_name(type)));
+
+    for (const VertexAttribute& attribute :
+         VertexLayout::Get(format).Attributes)
+    {
+      glEnableVertexArrayAttrib(arena.VertexArray, attribute.Location);
+      glVertexArrayAttribFormat(arena.VertexArray,
+                                attribute.Location,
+                                attribute.ComponentCount,
+                                ToGLType(attribute.Type),
+                                attribute.Normalized ? GL_TRUE : GL_FALSE,
+                                attribute.Offset);
+      glVertexArrayAttribBinding(
+        arena.VertexArray, attribute.Location, VERTEX_BUFFER_BINDING);
+    }
+
+    // One draw index per instance, offset by the base instance of a command
+    glEnableVertexArrayAttrib(arena.VertexArray, DRAW_INDEX_LOCATION);
+    glVertexArrayAttribIFormat(
+      arena.VertexArray, DRAW_INDEX_LOCATION, 1, GL_UNSIGNED_INT, 0);
+    glVertexArrayAttribBinding(
+      arena.VertexArray, DRAW_INDEX_LOCATION, DRAW_INDEX_BUFFER_BINDING);
+    glVertexArrayBindingDivisor(
+      arena.VertexArray, DRAW_INDEX_BUFFER_BINDING, 1);
+    DWARF_CHECK_OPENGL_ERROR(
+      "Creating arena vertex array", "OpenGLIndirectDrawBackend", mLogger);
+
+    return static_cast<uint32_t>(mArenas.size() - 1);
+  }
+
+  void
+  OpenGLIndirectDrawBackend::ClearMeshes()
+  {
+    for (OpenGLIndirectDrawArena& arena : mArenas)
+    {
+      arena.VertexSize = 0;
+      arena.IndexSize = 0;
+    }
+  }
+
+  auto
+  OpenGLIndirectDrawBackend::AddMesh(const IMeshBuffer& meshBuffer)
+    -> std::optional<IndirectMeshPlacement>
+  {
+    const auto* mesh = dynamic_cast<const OpenGLMeshBuffer*>(&meshBuffer);
+    if (mesh == nullptr || mRendererApi == nullptr)
+    {
+      return std::nullopt;
+    }
+
+    uint32_t index =
+      GetArena(mesh->GetVertexLayout().Format, mesh->GetIndexType());
+    OpenGLIndirectDrawArena& arena = mArenas[index];
+
+    uint32_t stride = mesh->GetVertexLayout().Stride;
+    size_t   vertexBytes = static_cast<size_t>(stride) * mesh->GetVertexCount();
+    size_t   indexBytes = mesh->GetIndexBufferSize();
+
+    bool reallocated = false;
+    if (arena.VertexSize + vertexBytes > arena.VertexCapacity)
+    {
+      GrowBuffer(arena.VertexBuffer,
+                 arena.VertexCapacity,
+                 arena.VertexSize,
+                 std::max(arena.VertexSize + vertexBytes, MIN_ARENA_CAPACITY),
+                 "Indirect draw vertices");
+      reallocated = true;
+    }
+    if (arena.IndexSize + indexBytes > arena.IndexCapacity)
+    {
+      GrowBuffer(arena.IndexBuffer,
+                 arena.IndexCapacity,
+                 arena.IndexSize,
+                 std::max(arena.IndexSize + indexBytes, MIN_ARENA_CAPACITY),
+                 "Indirect draw indices");
+      reallocated = true;
+    }
+    if (reallocated)
+    {
+      UpdateVertexArray(arena);
+    }
+
+    glCopyNamedBufferSubData(mesh->GetVertexBuffer(),
+                             arena.VertexBuffer,
+                             0,
+                             static_cast<GLintptr>(arena.VertexSize),
+                             static_cast<GLsizeiptr>(vertexBytes));
+    glCopyNamedBufferSubData(mesh->GetIndexBuffer(),
+                             arena.IndexBuffer,
+                             0,
+                             static_cast<GLintptr>(arena.IndexSize),
+                             static_cast<GLsizeiptr>(indexBytes));
+    DWARF_CHECK_OPENGL_ERROR(
+      "glCopyNamedBufferSubData", "OpenGLIndirectDrawBackend", mLogger);
+
+    IndirectMeshPlacement placement{
+      index,
+      static_cast<uint32_t>(arena.IndexSize / GetIndexSize(arena.Type)),
+      static_cast<int32_t>(arena.VertexSize / stride)
+    };
+    arena.VertexSize += vertexBytes;
+    arena.IndexSize += indexBytes;
+    return placement;
+  }
+
+  void
+  OpenGLIndirectDrawBackend::ReleaseExpiredMaterialBuffers()
+  {
+    size_t memory = 0;
+    std::erase_if(mMaterialBuffers,
+                  [&memory](const auto& entry)
+                  {
+                    const OpenGLIndirectMaterialBuffer& materialBuffer =
+                      entry.second;
+                    if (!materialBuffer.Reflection.expired())
+                    {
+                      return false;
+                    }
+                    glDeleteBuffers(1, &materialBuffer.Buffer);
+                    memory += materialBuffer.Capacity;
+                    return true;
+                  });
+    if (memory > 0)
+    {
+      DWARF_CHECK_OPENGL_ERROR(
+        "glDeleteBuffers", "OpenGLIndirectDrawBackend", mLogger);
+      mVramTracker->RemoveBufferMemory(memory);
+    }
+  }
+
+  void
+  OpenGLIndirectDrawBackend::Upload(
+    std::span<const IndirectDrawData>    drawData,
+    std::span<const IndirectDrawCommand> commands)
+  {
+    // Once per frame, before the material buffers of the frame are updated
+    ReleaseExpiredMaterialBuffers();
+
+    size_t drawDataBytes = drawData.size_bytes();
+    if (drawDataBytes > mDrawDataCapacity)
+    {
+      GrowBuffer(mDrawDataBuffer,
+                 mDrawDataCapacity,
+                 0,
+                 drawDataBytes,
+                 "Indirect draw data");
+    }
+    glNamedBufferSubData(mDrawDataBuffer,
+                         0,
+                         static_cast<GLsizeiptr>(drawDataBytes),
+                         drawData.data());
+
+    size_t commandBytes = commands.size_bytes();
+    if (commandBytes > mCommandCapacity)
+    {
+      GrowBuffer(mCommandBuffer,
+                 mCommandCapacity,
+                 0,
+                 commandBytes,
+                 "Indirect draw commands");
+    }
+    glNamedBufferSubData(mCommandBuffer,
+                         0,
+                         static_cast<GLsizeiptr>(commandBytes),
+                         commands.data());
+    DWARF_CHECK_OPENGL_ERROR(
+      "glNamedBufferSubData", "OpenGLIndirectDrawBackend", mLogger);
+
+    // The draw indices only change when more draws than before are submitted
+    size_t drawIndexBytes = drawData.size() * sizeof(uint32_t);
+    if (drawIndexBytes > mDrawIndexCapacity)
+    {
+      GrowBuffer(mDrawIndexBuffer,
+                 mDrawIndexCapacity,
+                 0,
+                 drawIndexBytes,
+                 "Indirect draw indices");
+      std::vector<uint32_t> drawIndices(mDrawIndexCapacity /
+                                        sizeof(uint32_t));
+      std::iota(drawIndices.begin(), drawIndices.end(), 0);
+      glNamedBufferSubData(
+        mDrawIndexBuffer,
+        0,
+        static_cast<GLsizeiptr>(drawIndices.size() * sizeof(uint32_t)),
+        drawIndices.data());
+      for (const OpenGLIndirectDrawArena& arena : mArenas)
+      {
+        UpdateVertexArray(arena);
+      }
+    }
+  }
+
+  void
+  OpenGLIndirectDrawBackend::UploadMaterials(
+    IShader&                    shader,
+    std::span<IMaterial* const> materials)
+  {
+    auto& oglShader = dynamic_cast<OpenGLShader&>(shader);
+    const std::optional<MaterialBlockLayout>& layout =
+      oglShader.GetMaterialBlockLayout();
+    if (!layout.has_value())
+    {
+      return;
+    }
+
+    const std::shared_ptr<const ShaderReflection>& reflection =
+      oglShader.GetReflection();
+    OpenGLIndirectMaterialBuffer& materialBuffer =
+      mMaterialBuffers[oglShader.GetID()];
+
+    // Each program gets its own reflection, so a reused program name is
+    // never mistaken for the program it replaced
+    if (materialBuffer.Reflection.lock() != reflection)
+    {
+      materialBuffer.Reflection = reflection;
+      materialBuffer.Blocks.emplace(layout.value());
+    }
+
+    std::optional<MaterialBlockRange> changed =
+      materialBuffer.Blocks->Update(materials);
+    if (!changed.has_value())
+    {
+      return;
+    }
+
+    std::span<const std::byte> data = materialBuffer.Blocks->GetData();
+    if (data.size() > materialBuffer.Capacity)
+    {
+      GrowBuffer(materialBuffer.Buffer,
+                 materialBuffer.Capacity,
+                 0,
+                 data.size(),
+                 "Indirect draw materials");
+      changed = MaterialBlockRange{ 0, static_cast<uint32_t>(data.size()) };
+    }
+    glNamedBufferSubData(materialBuffer.Buffer,
+                         changed->Offset,
+                         changed->Size,
+                         data.data() + changed->Offset);
+    DWARF_CHECK_OPENGL_ERROR(
+      "glNamedBufferSubData", "OpenGLIndirectDrawBackend", mLogger);
+  }
+
+  void
+  OpenGLIndirectDrawBackend::Draw(const IndirectDrawBatch& batch,
+                                  ICamera&                 camera)
+  {
+    const OpenGLIndirectDrawArena& arena = mArenas[batch.Arena];
+
+    mRendererApi->PrepareIndirectDraw(*batch.Shader, *batch.Material, camera);
+    mStateTracker->BindVertexArray(arena.VertexArray);
+    glBindBufferBase(
+      GL_SHADER_STORAGE_BUFFER, DRAW_DATA_BINDING, mDrawDataBuffer);
+    if (auto materialBuffer = mMaterialBuffers.find(
+          dynamic_cast<OpenGLShader&>(*batch.Shader).GetID());
+        materialBuffer != mMaterialBuffers.end())
+    {
+      glBindBufferBase(GL_SHADER_STORAGE_BUFFER,
+                       MATERIAL_BLOCK_BINDING,
+                       materialBuffer->second.Buffer);
+    }
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mCommandBuffer);
+
+    glMultiDrawElementsIndirect(
+      GL_TRIANGLES,
+      arena.Type == IndexType::UInt16 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT,
+      (const void*)(static_cast<uintptr_t>(batch.FirstCommand) *
+                    sizeof(IndirectDrawCommand)),
+      static_cast<GLsizei>(batch.CommandCount),
+      0);
+    DWARF_CHECK_OPENGL_ERROR(
+      "glMultiDrawElementsIndirect", "OpenGLIndirectDrawBackend", mLogger);
+  }
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "Core/Rendering/IndirectDraw/IIndirectDrawBackend.hpp"
+#include "Core/Rendering/Shader/MaterialBlock/MaterialBlockBuffer.hpp"
+#include "Core/Rendering/Shader/ShaderReflection/ShaderReflection.hpp"
+#include "Core/Rendering/VramTracker/IVramTracker.hpp"
+#include "Logging/IDwarfLogger.hpp"
+#include "Platform/OpenGL/IOpenGLStateTracker.hpp"
+#include "Platform/OpenGL/OpenGLRendererApi.hpp"
+#include <glad/glad.h>
+#include <unordered_map>
+
+namespace Dwarf
+{
+  /// @brief Shared vertex and index buffers of all meshes with the same
+  /// vertex format and index type.
+  struct OpenGLIndirectDrawArena
+  {
+    VertexFormat Format = VertexFormat::Standard;
+    IndexType    Type = IndexType::UInt32;
+    GLuint       VertexArray = 0;
+    GLuint       VertexBuffer = 0;
+    GLuint       IndexBuffer = 0;
+    size_t       VertexCapacity = 0;
+    size_t       VertexSize = 0;
+    size_t       IndexCapacity = 0;
+    size_t       IndexSize = 0;
+  };
+
+  /// @brief Material parameter buffer of a compiled shader variant.
+  struct OpenGLIndirectMaterialBuffer
+  {
+    /// @brief Reflection of the program the layout was read from. Programs
+    /// drop their reflection when they are released, which frees the buffer.
+    std::weak_ptr<const ShaderReflection> Reflection;
+    GLuint                                Buffer = 0;
+    size_t                                Capacity = 0;
+    std::optional<MaterialBlockBuffer>    Blocks;
+  };
+
+  /// @brief Submits indirect draw batches with glMultiDrawElementsIndirect.
+  /// The per draw data is stored in a shader storage buffer which the
+  /// shaders index with a per instance draw index attribute, so the base
+  /// instance of a command selects its data. Shaders declaring a material
+  /// block read their material parameters from a per shader storage buffer
+  /// through the material index of the draw data.
+  class OpenGLIndirectDrawBackend : public IIndirectDrawBackend
+  {
+  private:
+    std::shared_ptr<OpenGLRendererApi>   mRendererApi;
+    std::shared_ptr<IDwarfLogger>        mLogger;
+    std::shared_ptr<IVramTracker>        mVramTracker;
+    std::shared_ptr<IOpenGLStateTracker> mStateTracker;
+
+    std::vector<OpenGLIndirectDrawArena> mArenas;
+
+    /// @brief Material buffers by program name. A name is only reused after
+    /// its program was released.
+    std::unordered_map<GLuint, OpenGLIndirectMaterialBuffer> mMaterialBuffers;
+
+    GLuint mDrawDataBuffer = 0;
+    size_t mDrawDataCapacity = 0;
+    GLuint mCommandBuffer = 0;
+    size_t mCommandCapacity = 0;
+    GLuint mDrawIndexBuffer = 0;
+    size_t mDrawIndexCapacity = 0;
+
+    /**
+     * @brief Finds or creates the arena of a vertex format and index type
+     *
+     * @param format Vertex format of the arena
+     * @param type Index type of the arena
+     * @return Index of the arena
+     */
+    auto
+    GetArena(VertexFormat format, IndexType type) -> uint32_t;
+
+    /**
+     * @brief Reallocates a buffer with at least the required size, keeping
+     * the used part of its content
+     *
+     * @param buffer The buffer to grow, replaced by the new buffer
+     * @param capacity Capacity of the buffer, updated to the new capacity
+     * @param used Number of bytes to keep
+     * @param required Required capacity in bytes
+     * @param label Debug label of the buffer
+     */
+    void
+    GrowBuffer(GLuint&          buffer,
+               size_t&          capacity,
+               size_t           used,
+               size_t           required,
+               std::string_view label);
+
+    /**
+     * @brief Binds the vertex and index buffers of an arena and the draw
+     * index buffer to the vertex array of the arena
+     *
+     * @param arena The arena to update
+     */
+    void
+    UpdateVertexArray(const OpenGLIndirectDrawArena& arena) const;
+
+    /**
+     * @brief Deletes the material buffers of released programs
+     *
+     */
+    void
+    ReleaseExpiredMaterialBuffers();
+
+  public:
+    OpenGLIndirectDrawBackend(
+      std::shared_ptr<IRendererApi>        rendererApi,
+      std::shared_ptr<IDwarfLogger>        logger,
+      std::shared_ptr<IVramTracker>        vramTracker,
+      std::shared_ptr<IOpenGLStateTracker> stateTracker);
+    ~OpenGLIndirectDrawBackend() override;
+
+    /**
+     * @brief Removes all meshes from the arenas, the buffers are kept for
+     * reuse
+     *
+     */
+    void
+    ClearMeshes() override;
+
+    /**
+     * @brief Copies a mesh into the arena matching its vertex format and
+     * index type
+     *
+     * @param meshBuffer The mesh to add
+     * @return Placement of the mesh, empty if it can't be drawn indirectly
+     */
+    auto
+    AddMesh(const IMeshBuffer& meshBuffer)
+      -> std::optional<IndirectMeshPlacement> override;
+
+    /**
+     * @brief Uploads the per draw data and the commands of a frame
+     *
+     * @param drawData Per draw data, indexed by the base instance
+     * @param commands Draw commands of all batches
+     */
+    void
+    Upload(std::span<const IndirectDrawData>    drawData,
+           std::span<const IndirectDrawCommand> commands) override;
+
+    /**
+     * @brief Packs the parameter blocks of the materials and uploads the
+     * ones that changed to the material buffer of the shader
+     *
+     * @param shader Shader variant the materials are drawn with
+     * @param materials Materials, indexed by the material index of the draws
+     */
+    void
+    UploadMaterials(IShader&                    shader,
+                    std::span<IMaterial* const> materials) override;
+
+    /**
+     * @brief Draws the commands of a batch with a single multi draw call
+     *
+     * @param batch The batch to draw
+     * @param camera The camera to render with
+     */
+    void
+    Draw(const IndirectDrawBatch& batch, ICamera& camera) override;
+  };
+}
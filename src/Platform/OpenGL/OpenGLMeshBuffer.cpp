@@ -1,110 +1,138 @@
 #include "pch.hpp"
 
+#include "Core/Rendering/Mesh/VertexCompression/VertexCompression.hpp"
 #include "OpenGLMeshBuffer.hpp"
 #include "Platform/OpenGL/OpenGLUtilities.hpp"
 
 namespace Dwarf
 {
-  OpenGLMeshBuffer::OpenGLMeshBuffer(const std::vector<Vertex>&    vertices,
-                                     const std::vector<uint32_t>&  indices,
-                                     std::shared_ptr<IDwarfLogger> logger,
-                                     std::shared_ptr<IVramTracker> vramTracker)
+  namespace
+  {
+    auto
+    ToGLType(VertexAttributeType type) -> GLenum
+    {
+      switch (type)
+      {
+        using enum VertexAttributeType;
+        case Float: return GL_FLOAT;
+        case Short: return GL_SHORT;
+        case HalfFloat: return GL_HALF_FLOAT;
+      }
+      return GL_FLOAT;
+    }
+  }
+
+  OpenGLMeshBuffer::OpenGLMeshBuffer(
+    const std::vector<Vertex>&           vertices,
+    const std::vector<uint32_t>&         indices,
+    const std::vector<MeshLod>&          lods,
+    VertexFormat                         vertexFormat,
+    IndexType                            indexType,
+    std::shared_ptr<IDwarfLogger>        logger,
+    std::shared_ptr<IVramTracker>        vramTracker,
+    std::shared_ptr<IOpenGLStateTracker> stateTracker)
     : mLogger(std::move(logger))
     , mVramTracker(std::move(vramTracker))
+    , mStateTracker(std::move(stateTracker))
     , mVertexCount(vertices.size())
     , mIndexCount(indices.size())
+    , mIndexType(indexType)
+    , mVertexLayout(VertexLayout::Get(vertexFormat))
   {
     mLogger->LogDebug(Log("OpenGLMeshBuffer created.", "OpenGLMeshBuffer"));
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "Before creating mesh", "OpenGLMeshBuffer", mLogger);
     glGenVertexArrays(1, &VAO);
-    OpenGLUtilities::CheckOpenGLError(
-      "glGenVertexArrays", "OpenGLMeshBuffer", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glGenVertexArrays", "OpenGLMeshBuffer", mLogger);
     glGenBuffers(1, &VBO);
-    OpenGLUtilities::CheckOpenGLError(
-      "glGenBuffers VBO", "OpenGLMeshBuffer", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glGenBuffers VBO", "OpenGLMeshBuffer", mLogger);
     glGenBuffers(1, &EBO);
-    OpenGLUtilities::CheckOpenGLError(
-      "glGenBuffers EBO", "OpenGLMeshBuffer", mLogger);
-    glBindVertexArray(VAO);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindVertexArray", "OpenGLMeshBuffer", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glGenBuffers EBO", "OpenGLMeshBuffer", mLogger);
+    mStateTracker->BindVertexArray(VAO);
+    OpenGLUtilities::SetObjectLabel(
+      GL_VERTEX_ARRAY, VAO, fmt::format("Mesh ({} vertices)", mVertexCount));
 
     glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindBuffer VBO", "OpenGLMeshBuffer", mLogger);
-    glBufferData(GL_ARRAY_BUFFER,
-                 vertices.size() * sizeof(Vertex),
-                 &(vertices[0]),
-                 GL_STATIC_DRAW);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBufferData VBO", "OpenGLMeshBuffer", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glBindBuffer VBO", "OpenGLMeshBuffer", mLogger);
+    OpenGLUtilities::SetObjectLabel(GL_BUFFER, VBO, "Mesh vertices");
+
+    size_t vertexBufferSize =
+      static_cast<size_t>(mVertexLayout.Stride) * vertices.size();
+    if (mVertexLayout.Format == VertexFormat::Compact)
+    {
+      mVertexQuantization = VertexCompression::ComputeQuantization(vertices);
+      std::vector<CompactVertex> compactVertices =
+        VertexCompression::Compress(vertices, mVertexQuantization);
+      glBufferData(GL_ARRAY_BUFFER,
+                   vertexBufferSize,
+                   compactVertices.data(),
+                   GL_STATIC_DRAW);
+    }
+    else
+    {
+      glBufferData(
+        GL_ARRAY_BUFFER, vertexBufferSize, vertices.data(), GL_STATIC_DRAW);
+    }
+    DWARF_CHECK_OPENGL_ERROR("glBufferData VBO", "OpenGLMeshBuffer", mLogger);
 
-    mVramMemory += vertices.size() * sizeof(Vertex);
+    mVramMemory += vertexBufferSize;
 
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindBuffer EBO", "OpenGLMeshBuffer", mLogger);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-                 indices.size() * sizeof(uint32_t),
-                 &(indices[0]),
-                 GL_STATIC_DRAW);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBufferData EBO", "OpenGLMeshBuffer", mLogger);
-
-    mVramMemory += indices.size() * sizeof(uint32_t);
-
-    // vertex positions
-    glEnableVertexAttribArray(0);
-    OpenGLUtilities::CheckOpenGLError(
-      "glEnableVertexAttribArray 0", "OpenGLMeshBuffer", mLogger);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), nullptr);
-    OpenGLUtilities::CheckOpenGLError(
-      "glVertexAttribPointer 0", "OpenGLMeshBuffer", mLogger);
-    // vertex normals
-    glEnableVertexAttribArray(1);
-    OpenGLUtilities::CheckOpenGLError(
-      "glEnableVertexAttribArray 1", "OpenGLMeshBuffer", mLogger);
-    glVertexAttribPointer(1,
-                          3,
-                          GL_FLOAT,
-                          GL_FALSE,
-                          sizeof(Vertex),
-                          (void*)offsetof(Vertex, Normal));
-    OpenGLUtilities::CheckOpenGLError(
-      "glVertexAttribPointer 1", "OpenGLMeshBuffer", mLogger);
-    // vertex tangents
-    glEnableVertexAttribArray(2);
-    OpenGLUtilities::CheckOpenGLError(
-      "glEnableVertexAttribArray 2", "OpenGLMeshBuffer", mLogger);
-    glVertexAttribPointer(2,
-                          3,
-                          GL_FLOAT,
-                          GL_FALSE,
-                          sizeof(Vertex),
-                          (void*)offsetof(Vertex, Tangent));
-    OpenGLUtilities::CheckOpenGLError(
-      "glVertexAttribPointer 2", "OpenGLMeshBuffer", mLogger);
-    // vertex biTangent
-    glEnableVertexAttribArray(3);
-    OpenGLUtilities::CheckOpenGLError(
-      "glEnableVertexAttribArray 3", "OpenGLMeshBuffer", mLogger);
-    glVertexAttribPointer(3,
-                          3,
-                          GL_FLOAT,
-                          GL_FALSE,
-                          sizeof(Vertex),
-                          (void*)offsetof(Vertex, BiTangent));
-    OpenGLUtilities::CheckOpenGLError(
-      "glVertexAttribPointer 3", "OpenGLMeshBuffer", mLogger);
-    // vertex texture coords
-    glEnableVertexAttribArray(4);
-    OpenGLUtilities::CheckOpenGLError(
-      "glEnableVertexAttribArray 4", "OpenGLMeshBuffer", mLogger);
-    glVertexAttribPointer(
-      4, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, UV));
-    OpenGLUtilities::CheckOpenGLError(
-      "glVertexAttribPointer 4", "OpenGLMeshBuffer", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glBindBuffer EBO", "OpenGLMeshBuffer", mLogger);
+    OpenGLUtilities::SetObjectLabel(GL_BUFFER, EBO, "Mesh indices");
+
+    // All detail levels share the vertices, their indices are appended to
+    // the full detail indices
+    std::vector<uint32_t> lodIndices = indices;
+    mLodIndexRanges.push_back({ 0, mIndexCount });
+    for (const MeshLod& lod : lods)
+    {
+      mLodIndexRanges.push_back(
+        { static_cast<uint32_t>(lodIndices.size()),
+          static_cast<uint32_t>(lod.Indices.size()) });
+      lodIndices.insert(
+        lodIndices.end(), lod.Indices.begin(), lod.Indices.end());
+    }
+
+    size_t indexBufferSize = lodIndices.size() * GetIndexSize(mIndexType);
+    mIndexBufferSize = indexBufferSize;
+    if (mIndexType == IndexType::UInt16)
+    {
+      std::vector<uint16_t> shortIndices(lodIndices.begin(), lodIndices.end());
+      glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                   indexBufferSize,
+                   shortIndices.data(),
+                   GL_STATIC_DRAW);
+    }
+    else
+    {
+      glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                   indexBufferSize,
+                   lodIndices.data(),
+                   GL_STATIC_DRAW);
+    }
+    DWARF_CHECK_OPENGL_ERROR("glBufferData EBO", "OpenGLMeshBuffer", mLogger);
+
+    mVramMemory += indexBufferSize;
+
+    for (const VertexAttribute& attribute : mVertexLayout.Attributes)
+    {
+      glEnableVertexAttribArray(attribute.Location);
+      DWARF_CHECK_OPENGL_ERROR(
+        fmt::format("glEnableVertexAttribArray {}", attribute.Location),
+        "OpenGLMeshBuffer",
+        mLogger);
+      glVertexAttribPointer(attribute.Location,
+                            attribute.ComponentCount,
+                            ToGLType(attribute.Type),
+                            attribute.Normalized ? GL_TRUE : GL_FALSE,
+                            static_cast<GLsizei>(mVertexLayout.Stride),
+                            (void*)(uintptr_t)attribute.Offset);
+      DWARF_CHECK_OPENGL_ERROR(
+        fmt::format("glVertexAttribPointer {}", attribute.Location),
+        "OpenGLMeshBuffer",
+        mLogger);
+    }
 
     mVramTracker->AddBufferMemory(mVramMemory);
     Unbind();
@@ -113,42 +141,32 @@ namespace Dwarf
   OpenGLMeshBuffer::~OpenGLMeshBuffer()
   {
     mLogger->LogDebug(Log("OpenGLMeshBuffer destroyed.", "OpenGLMeshBuffer"));
-    Unbind();
     glDeleteVertexArrays(1, &VAO);
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "glDeleteVertexArrays", "OpenGLMeshBuffer", mLogger);
+    mStateTracker->OnVertexArrayDeleted(VAO);
     glDeleteBuffers(1, &VBO);
-    OpenGLUtilities::CheckOpenGLError(
-      "glDeleteBuffers", "OpenGLMeshBuffer", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glDeleteBuffers", "OpenGLMeshBuffer", mLogger);
     glDeleteBuffers(1, &EBO);
-    OpenGLUtilities::CheckOpenGLError(
-      "glDeleteBuffers", "OpenGLMeshBuffer", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glDeleteBuffers", "OpenGLMeshBuffer", mLogger);
     mVramTracker->RemoveBufferMemory(mVramMemory);
   }
 
   void
   OpenGLMeshBuffer::Bind() const
   {
-    OpenGLUtilities::CheckOpenGLError(
-      "Before binding mesh", "OpenGLMeshBuffer", mLogger);
-    glBindVertexArray(VAO);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindVertexArray", "OpenGLMeshBuffer", mLogger);
+    mStateTracker->BindVertexArray(VAO);
   }
 
   void
   OpenGLMeshBuffer::Unbind() const
   {
-    OpenGLUtilities::CheckOpenGLError(
-      "Before unbinding mesh", "OpenGLMeshBuffer", mLogger);
-    glBindVertexArray(0);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindVertexArray 0", "OpenGLMeshBuffer", mLogger);
+    mStateTracker->BindVertexArray(0);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "glBindBuffer GL_ARRAY_BUFFER 0", "OpenGLMeshBuffer", mLogger);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "glBindBuffer GL_ELEMENT_ARRAY_BUFFER 0", "OpenGLMeshBuffer", mLogger);
   }
 
@@ -163,4 +181,66 @@ namespace Dwarf
   {
     return mIndexCount;
   }
+
+  auto
+  OpenGLMeshBuffer::GetIndexType() const -> IndexType
+  {
+    return mIndexType;
+  }
+
+  auto
+  OpenGLMeshBuffer::GetGLIndexType() const -> GLenum
+  {
+    return mIndexType == IndexType::UInt16 ? GL_UNSIGNED_SHORT
+                                           : GL_UNSIGNED_INT;
+  }
+
+  auto
+  OpenGLMeshBuffer::GetIndexByteOffset(IndexRange range) const -> const void*
+  {
+    return (const void*)(static_cast<uintptr_t>(range.Offset) *
+                         GetIndexSize(mIndexType));
+  }
+
+  auto
+  OpenGLMeshBuffer::GetLodCount() const -> uint32_t
+  {
+    return static_cast<uint32_t>(mLodIndexRanges.size());
+  }
+
+  auto
+  OpenGLMeshBuffer::GetLodIndexRange(uint32_t lod) const -> IndexRange
+  {
+    return mLodIndexRanges[std::min<size_t>(lod, mLodIndexRanges.size() - 1)];
+  }
+
+  auto
+  OpenGLMeshBuffer::GetVertexLayout() const -> const VertexLayout&
+  {
+    return mVertexLayout;
+  }
+
+  auto
+  OpenGLMeshBuffer::GetVertexQuantization() const -> const VertexQuantization&
+  {
+    return mVertexQuantization;
+  }
+
+  auto
+  OpenGLMeshBuffer::GetVertexBuffer() const -> GLuint
+  {
+    return VBO;
+  }
+
+  auto
+  OpenGLMeshBuffer::GetIndexBuffer() const -> GLuint
+  {
+    return EBO;
+  }
+
+  auto
+  OpenGLMeshBuffer::GetIndexBufferSize() const -> size_t
+  {
+    return mIndexBufferSize;
+  }
 }
\ No newline at end of file
@@ -1,9 +1,11 @@
 #pragma once
 
+#include "Core/Rendering/Mesh/MeshLod.hpp"
 #include "Core/Rendering/Mesh/Vertex.hpp"
 #include "Core/Rendering/MeshBuffer/IMeshBuffer.hpp"
 #include "Core/Rendering/VramTracker/IVramTracker.hpp"
 #include "Logging/IDwarfLogger.hpp"
+#include "Platform/OpenGL/IOpenGLStateTracker.hpp"
 #include <glad/glad.h>
 
 namespace Dwarf
@@ -11,21 +13,31 @@ namespace Dwarf
   class OpenGLMeshBuffer : public IMeshBuffer
   {
   private:
-    std::shared_ptr<IDwarfLogger> mLogger;
-    std::shared_ptr<IVramTracker> mVramTracker;
-    size_t                        mVramMemory = 0;
-    uint32_t                      mVertexCount = 0;
-    uint32_t                      mIndexCount = 0;
+    std::shared_ptr<IDwarfLogger>        mLogger;
+    std::shared_ptr<IVramTracker>        mVramTracker;
+    std::shared_ptr<IOpenGLStateTracker> mStateTracker;
+    size_t                               mVramMemory = 0;
+    size_t                               mIndexBufferSize = 0;
+    uint32_t                             mVertexCount = 0;
+    uint32_t                             mIndexCount = 0;
+    IndexType                            mIndexType = IndexType::UInt32;
+    const VertexLayout&                  mVertexLayout;
+    VertexQuantization                   mVertexQuantization;
+    std::vector<IndexRange>              mLodIndexRanges;
 
   public:
-    OpenGLMeshBuffer(const std::vector<Vertex>&    vertices,
-                     const std::vector<uint32_t>&  indices,
-                     std::shared_ptr<IDwarfLogger> logger,
-                     std::shared_ptr<IVramTracker> vramTracker);
+    OpenGLMeshBuffer(const std::vector<Vertex>&           vertices,
+                     const std::vector<uint32_t>&         indices,
+                     const std::vector<MeshLod>&          lods,
+                     VertexFormat                         vertexFormat,
+                     IndexType                            indexType,
+                     std::shared_ptr<IDwarfLogger>        logger,
+                     std::shared_ptr<IVramTracker>        vramTracker,
+                     std::shared_ptr<IOpenGLStateTracker> stateTracker);
     ~OpenGLMeshBuffer() override;
 
     /**
-     * @brief Binds the OpenGL mesh
+     * @brief Binds the OpenGL mesh, skipped if it is already bound
      *
      */
     void
@@ -54,6 +66,92 @@ namespace Dwarf
     [[nodiscard]] auto
     GetIndexCount() const -> uint32_t override;
 
+    /**
+     * @brief Returns the type of the uploaded indices
+     *
+     * @return Index type of the mesh
+     */
+    [[nodiscard]] auto
+    GetIndexType() const -> IndexType override;
+
+    /**
+     * @brief Returns the number of detail levels stored in the index buffer,
+     * including the full detail level
+     *
+     * @return Detail level count, at least 1
+     */
+    [[nodiscard]] auto
+    GetLodCount() const -> uint32_t override;
+
+    /**
+     * @brief Returns the index range of a detail level. Levels past the
+     * coarsest one are clamped to it.
+     *
+     * @param lod Detail level, 0 being the full detail mesh
+     * @return Index range of the detail level
+     */
+    [[nodiscard]] auto
+    GetLodIndexRange(uint32_t lod) const -> IndexRange override;
+
+    /**
+     * @brief Returns the OpenGL type of the uploaded indices
+     *
+     * @return GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+     */
+    [[nodiscard]] auto
+    GetGLIndexType() const -> GLenum;
+
+    /**
+     * @brief Returns the byte offset of an index range for glDrawElements
+     *
+     * @param range The index range
+     * @return Byte offset into the index buffer
+     */
+    [[nodiscard]] auto
+    GetIndexByteOffset(IndexRange range) const -> const void*;
+
+    /**
+     * @brief Returns the layout the vertices were uploaded with
+     *
+     * @return Vertex layout of the mesh
+     */
+    [[nodiscard]] auto
+    GetVertexLayout() const -> const VertexLayout& override;
+
+    /**
+     * @brief Returns the transformation from quantized to object space
+     * positions
+     *
+     * @return Position quantization of the mesh
+     */
+    [[nodiscard]] auto
+    GetVertexQuantization() const -> const VertexQuantization& override;
+
+    /**
+     * @brief Returns the OpenGL vertex buffer of the mesh
+     *
+     * @return Name of the vertex buffer
+     */
+    [[nodiscard]] auto
+    GetVertexBuffer() const -> GLuint;
+
+    /**
+     * @brief Returns the OpenGL index buffer of the mesh
+     *
+     * @return Name of the index buffer
+     */
+    [[nodiscard]] auto
+    GetIndexBuffer() const -> GLuint;
+
+    /**
+     * @brief Returns the size of the index buffer, including the indices of
+     * all detail levels
+     *
+     * @return Size in bytes
+     */
+    [[nodiscard]] auto
+    GetIndexBufferSize() const -> size_t;
+
   private:
     GLuint VAO;
     GLuint VBO;
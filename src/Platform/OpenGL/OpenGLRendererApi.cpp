@@ -45,7 +45,7 @@ namespace Dwarf
     mStateTracker->SetDepthTest(true);
     mStateTracker->SetDepthFunction(GL_LESS);
     glEnable(GL_LINE_SMOOTH);
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "glEnable GL_LINE_SMOOTH", "OpenGLRendererApi", mLogger);
   }
 
@@ -72,40 +72,38 @@ namespace Dwarf
   void
   OpenGLRendererApi::Clear()
   {
-    OpenGLUtilities::CheckOpenGLError(
-      "Before clearing", "OpenGLRendererApi", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("Before clearing", "OpenGLRendererApi", mLogger);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    OpenGLUtilities::CheckOpenGLError("glClear", "OpenGLRendererApi", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glClear", "OpenGLRendererApi", mLogger);
   }
 
   void
   OpenGLRendererApi::Clear(uint32_t value)
   {
-    OpenGLUtilities::CheckOpenGLError(
-      "Before clearing", "OpenGLRendererApi", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("Before clearing", "OpenGLRendererApi", mLogger);
     glClearBufferuiv(
       GL_COLOR, 0, &value); // Use glClearBufferuiv for integer types
-    OpenGLUtilities::CheckOpenGLError(
-      "glClearBufferuiv", "OpenGLRendererApi", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glClearBufferuiv", "OpenGLRendererApi", mLogger);
     glClear(GL_DEPTH_BUFFER_BIT);
-    OpenGLUtilities::CheckOpenGLError("glClear", "OpenGLRendererApi", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glClear", "OpenGLRendererApi", mLogger);
   }
 
   void
-  OpenGLRendererApi::RenderIndexed(const IMeshBuffer* mesh,
-                                   IMaterial&         material,
-                                   ICamera&           camera,
-                                   glm::mat4          modelMatrix)
+  OpenGLRendererApi::UploadParameters(OpenGLShader& shader)
   {
-    OpenGLUtilities::CheckOpenGLError(
-      "Before rendering", "OpenGLRendererApi", mLogger);
-    const auto*   oglMesh = dynamic_cast<const OpenGLMeshBuffer*>(mesh);
-    IShader&      baseShader = *material.GetShader();
-    OpenGLShader& shader = baseShader.IsCompiled()
-                             ? dynamic_cast<OpenGLShader&>(baseShader)
-                             : dynamic_cast<OpenGLShader&>(*mErrorShader);
-    int           textureInputCounter = 0;
+    shader.UploadParameters();
+
+    for (const auto& [unit, texture] : shader.GetTextureBindings())
+    {
+      mStateTracker->BindTexture(unit, static_cast<GLuint>(texture));
+    }
+  }
 
+  void
+  OpenGLRendererApi::ApplyMaterial(OpenGLShader& shader,
+                                   IMaterial&    material,
+                                   ICamera&      camera)
+  {
     mStateTracker->SetShaderProgram(shader);
 
     mStateTracker->SetBlendMode(material.GetMaterialProperties().IsTransparent);
@@ -119,9 +117,20 @@ namespace Dwarf
       !material.GetMaterialProperties().IsTransparent);
     mStateTracker->SetDepthFunction(GL_LESS);
 
+    const std::optional<MaterialBlockLayout>& materialBlock =
+      shader.GetMaterialBlockLayout();
     for (auto const& identifier :
          material.GetShaderParameters()->GetParameterIdentifiers())
     {
+      // Parameters in the material block are read from the material buffer
+      if (materialBlock.has_value() &&
+          std::ranges::any_of(materialBlock->Members,
+                              [&identifier](const MaterialBlockMember& member)
+                              { return member.Name == identifier; }))
+      {
+        continue;
+      }
+
       if (material.GetShaderParameters()->HasParameter(identifier))
       {
         std::visit(
@@ -146,24 +155,113 @@ namespace Dwarf
               shader.SetParameter(identifier, value);
             }
           },
-          material.GetShaderParameters()->GetParameter(identifier));
+          *material.GetShaderParameters()->FindParameter(identifier));
       }
     }
 
-    shader.SetParameter("modelMatrix", modelMatrix);
     shader.SetParameter("viewMatrix", camera.GetViewMatrix());
     shader.SetParameter("projectionMatrix", camera.GetProjectionMatrix());
     shader.SetParameter("_Time", (float)mEditorStats->GetTimeSinceStart());
     shader.SetParameter("viewPosition",
                         camera.GetProperties().Transform.GetPosition());
+  }
 
-    shader.UploadParameters();
+  void
+  OpenGLRendererApi::PrepareMaterialDraw(const IMeshBuffer* mesh,
+                                         IMaterial&         material,
+                                         ICamera&           camera,
+                                         glm::mat4          modelMatrix)
+  {
+    DWARF_CHECK_OPENGL_ERROR("Before rendering", "OpenGLRendererApi", mLogger);
+    const auto*   oglMesh = dynamic_cast<const OpenGLMeshBuffer*>(mesh);
+    IShader&      baseShader = *material.GetShader();
+    OpenGLShader& shader = baseShader.IsCompiled()
+                             ? dynamic_cast<OpenGLShader&>(baseShader)
+                             : dynamic_cast<OpenGLShader&>(*mErrorShader);
+
+    ApplyMaterial(shader, material, camera);
+
+    shader.SetParameter("modelMatrix", modelMatrix);
+    shader.SetParameter("_VertexCompression",
+                        oglMesh->GetVertexLayout().Format ==
+                          VertexFormat::Compact);
+    shader.SetParameter("_PositionScale",
+                        oglMesh->GetVertexQuantization().Scale);
+    shader.SetParameter("_PositionOffset",
+                        oglMesh->GetVertexQuantization().Offset);
+
+    UploadParameters(shader);
 
     oglMesh->Bind();
+  }
 
-    glDrawElements(GL_TRIANGLES, oglMesh->GetIndexCount(), GL_UNSIGNED_INT, 0);
-    OpenGLUtilities::CheckOpenGLError(
-      "glDrawElements", "OpenGLRendererApi", mLogger);
+  void
+  OpenGLRendererApi::PrepareIndirectDraw(IShader&   shader,
+                                         IMaterial& material,
+                                         ICamera&   camera)
+  {
+    DWARF_CHECK_OPENGL_ERROR(
+      "Before indirect rendering", "OpenGLRendererApi", mLogger);
+    auto& oglShader = dynamic_cast<OpenGLShader&>(shader);
+
+    // The model matrix and vertex quantization are read from the per draw
+    // data of the indirect draw backend
+    ApplyMaterial(oglShader, material, camera);
+
+    UploadParameters(oglShader);
+  }
+
+  void
+  OpenGLRendererApi::RenderIndexed(const IMeshBuffer* mesh,
+                                   IMaterial&         material,
+                                   ICamera&           camera,
+                                   glm::mat4          modelMatrix,
+                                   uint32_t           lod)
+  {
+    PrepareMaterialDraw(mesh, material, camera, modelMatrix);
+
+    const auto* oglMesh = dynamic_cast<const OpenGLMeshBuffer*>(mesh);
+    IndexRange  range = oglMesh->GetLodIndexRange(lod);
+    glDrawElements(GL_TRIANGLES,
+                   static_cast<GLsizei>(range.Count),
+                   oglMesh->GetGLIndexType(),
+                   oglMesh->GetIndexByteOffset(range));
+    DWARF_CHECK_OPENGL_ERROR("glDrawElements", "OpenGLRendererApi", mLogger);
+  }
+
+  void
+  OpenGLRendererApi::RenderIndexedRanges(
+    const IMeshBuffer*             mesh,
+    IMaterial&                     material,
+    ICamera&                       camera,
+    glm::mat4                      modelMatrix,
+    const std::vector<IndexRange>& ranges)
+  {
+    if (ranges.empty())
+    {
+      return;
+    }
+
+    PrepareMaterialDraw(mesh, material, camera, modelMatrix);
+
+    const auto* oglMesh = dynamic_cast<const OpenGLMeshBuffer*>(mesh);
+    std::vector<GLsizei>     counts;
+    std::vector<const void*> offsets;
+    counts.reserve(ranges.size());
+    offsets.reserve(ranges.size());
+    for (const IndexRange& range : ranges)
+    {
+      counts.push_back(static_cast<GLsizei>(range.Count));
+      offsets.push_back(oglMesh->GetIndexByteOffset(range));
+    }
+
+    glMultiDrawElements(GL_TRIANGLES,
+                        counts.data(),
+                        oglMesh->GetGLIndexType(),
+                        offsets.data(),
+                        static_cast<GLsizei>(ranges.size()));
+    DWARF_CHECK_OPENGL_ERROR(
+      "glMultiDrawElements", "OpenGLRendererApi", mLogger);
   }
 
   void
@@ -171,8 +269,7 @@ namespace Dwarf
                                          IMaterial&         material,
                                          ICamera&           camera)
   {
-    OpenGLUtilities::CheckOpenGLError(
-      "Before rendering", "OpenGLRendererApi", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("Before rendering", "OpenGLRendererApi", mLogger);
     const auto*   oglMesh = dynamic_cast<const OpenGLMeshBuffer*>(mesh);
     IShader&      baseShader = *material.GetShader();
     OpenGLShader& oglShader = baseShader.IsCompiled()
@@ -216,7 +313,7 @@ namespace Dwarf
               baseShader.SetParameter(identifier, value);
             }
           },
-          material.GetShaderParameters()->GetParameter(identifier));
+          *material.GetShaderParameters()->FindParameter(identifier));
       }
     }
 
@@ -228,13 +325,15 @@ namespace Dwarf
     // shader.SetParameter("viewPosition",
     //                     camera.GetProperties().Transform.GetPosition());
 
-    oglShader.UploadParameters();
+    UploadParameters(oglShader);
 
     oglMesh->Bind();
 
-    glDrawElements(GL_TRIANGLES, oglMesh->GetIndexCount(), GL_UNSIGNED_INT, 0);
-    OpenGLUtilities::CheckOpenGLError(
-      "glDrawElements", "OpenGLRendererApi", mLogger);
+    glDrawElements(GL_TRIANGLES,
+                   static_cast<GLsizei>(oglMesh->GetIndexCount()),
+                   oglMesh->GetGLIndexType(),
+                   nullptr);
+    DWARF_CHECK_OPENGL_ERROR("glDrawElements", "OpenGLRendererApi", mLogger);
   }
 
   void
@@ -242,8 +341,7 @@ namespace Dwarf
                                          IShader&           shader,
                                          ICamera&           camera)
   {
-    OpenGLUtilities::CheckOpenGLError(
-      "Before rendering", "OpenGLRendererApi", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("Before rendering", "OpenGLRendererApi", mLogger);
     const auto* oglMesh = dynamic_cast<const OpenGLMeshBuffer*>(mesh);
     // IShader&      baseShader = *material.GetShader();
     OpenGLShader& oglShader = shader.IsCompiled()
@@ -268,13 +366,15 @@ namespace Dwarf
     // shader.SetParameter("viewPosition",
     //                     camera.GetProperties().Transform.GetPosition());
 
-    oglShader.UploadParameters();
+    UploadParameters(oglShader);
 
     oglMesh->Bind();
 
-    glDrawElements(GL_TRIANGLES, oglMesh->GetIndexCount(), GL_UNSIGNED_INT, 0);
-    OpenGLUtilities::CheckOpenGLError(
-      "glDrawElements", "OpenGLRendererApi", mLogger);
+    glDrawElements(GL_TRIANGLES,
+                   static_cast<GLsizei>(oglMesh->GetIndexCount()),
+                   oglMesh->GetGLIndexType(),
+                   nullptr);
+    DWARF_CHECK_OPENGL_ERROR("glDrawElements", "OpenGLRendererApi", mLogger);
   }
 
   void
@@ -324,18 +424,15 @@ namespace Dwarf
   {
     auto* sourceFB = dynamic_cast<OpenGLFramebuffer*>(&source);
     auto* destinationFB = dynamic_cast<OpenGLFramebuffer*>(&destination);
-    glBindFramebuffer(GL_READ_FRAMEBUFFER,
-                      sourceFB->GetFramebufferRendererID());
+    mStateTracker->BindReadFramebuffer(sourceFB->GetFramebufferRendererID());
     glReadBuffer(GL_COLOR_ATTACHMENT0 +
                  sourceAttachment); // Select the second attachment for reading
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindFramebuffer GL_READ_FRAMEBUFFER", "OpenGLRendererApi", mLogger);
-    glBindFramebuffer(GL_DRAW_FRAMEBUFFER,
-                      destinationFB->GetFramebufferRendererID());
+    DWARF_CHECK_OPENGL_ERROR("glReadBuffer", "OpenGLRendererApi", mLogger);
+    mStateTracker->BindDrawFramebuffer(
+      destinationFB->GetFramebufferRendererID());
     glDrawBuffer(GL_COLOR_ATTACHMENT0 +
                  destinationAttachment); // Usually the default for framebufferB
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindFramebuffer GL_DRAW_FRAMEBUFFER", "OpenGLRendererApi", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glDrawBuffer", "OpenGLRendererApi", mLogger);
     glBlitFramebuffer(0,
                       0,
                       width,
@@ -346,11 +443,8 @@ namespace Dwarf
                       height,
                       GL_COLOR_BUFFER_BIT,
                       GL_NEAREST);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBlitFramebuffer", "OpenGLRendererApi", mLogger);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindFramebuffer Unbind", "OpenGLRendererApi", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glBlitFramebuffer", "OpenGLRendererApi", mLogger);
+    mStateTracker->BindFramebuffer(0);
   }
 
   void
@@ -367,16 +461,9 @@ namespace Dwarf
 
     auto* sourceFB = dynamic_cast<OpenGLFramebuffer*>(&source);
     auto* destinationFB = dynamic_cast<OpenGLFramebuffer*>(&destination);
-    glBindFramebuffer(GL_READ_FRAMEBUFFER,
-                      sourceFB->GetFramebufferRendererID());
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindFramebuffer GL_READ_FRAMEBUFFER", "OpenGLRendererApi", mLogger);
-    OpenGLUtilities::CheckOpenGLError(
-      "glReadBuffer GL_DEPTH_ATTACHMENT", "OpenGLRendererApi", mLogger);
-    glBindFramebuffer(GL_DRAW_FRAMEBUFFER,
-                      destinationFB->GetFramebufferRendererID());
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindFramebuffer GL_DRAW_FRAMEBUFFER", "OpenGLRendererApi", mLogger);
+    mStateTracker->BindReadFramebuffer(sourceFB->GetFramebufferRendererID());
+    mStateTracker->BindDrawFramebuffer(
+      destinationFB->GetFramebufferRendererID());
     glBlitFramebuffer(0,
                       0,
                       width,
@@ -387,11 +474,8 @@ namespace Dwarf
                       height,
                       GL_DEPTH_BUFFER_BIT,
                       GL_NEAREST);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBlitFramebuffer", "OpenGLRendererApi", mLogger);
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    OpenGLUtilities::CheckOpenGLError(
-      "glBindFramebuffer Unbind", "OpenGLRendererApi", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glBlitFramebuffer", "OpenGLRendererApi", mLogger);
+    mStateTracker->BindFramebuffer(0);
   }
 
   void
@@ -418,23 +502,23 @@ namespace Dwarf
                                destination.GetSpecification().Width,
                                destination.GetSpecification().Height);
 
-    OpenGLUtilities::CheckOpenGLError("glClear", "OpenGLRendererApi", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glClear", "OpenGLRendererApi", mLogger);
     mStateTracker->SetShaderProgram(oglShader);
 
-    OpenGLUtilities::CheckOpenGLError(
-      "glUseProgram", "OpenGLRendererApi", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glUseProgram", "OpenGLRendererApi", mLogger);
 
-    oglShader.UploadParameters();
+    UploadParameters(oglShader);
 
     oglMesh.Bind();
-    glDrawElements(GL_TRIANGLES, oglMesh.GetIndexCount(), GL_UNSIGNED_INT, 0);
-    OpenGLUtilities::CheckOpenGLError(
-      "glDrawElements", "OpenGLRendererApi", mLogger);
+    glDrawElements(GL_TRIANGLES,
+                   static_cast<GLsizei>(oglMesh.GetIndexCount()),
+                   oglMesh.GetGLIndexType(),
+                   nullptr);
+    DWARF_CHECK_OPENGL_ERROR("glDrawElements", "OpenGLRendererApi", mLogger);
     if (srgb)
     {
       glDisable(GL_FRAMEBUFFER_SRGB);
     }
-    oglMesh.Unbind();
     destination.Unbind();
   }
 
@@ -451,7 +535,7 @@ namespace Dwarf
     if (srgb)
     {
       glEnable(GL_FRAMEBUFFER_SRGB);
-      OpenGLUtilities::CheckOpenGLError(
+      DWARF_CHECK_OPENGL_ERROR(
         "glEnable GL_FRAMEBUFFER_SRGB", "OpenGLRendererApi", mLogger);
     }
     mStateTracker->SetViewport(
@@ -460,18 +544,19 @@ namespace Dwarf
       buffer.GetReadFramebuffer().lock()->GetSpecification().Width,
       buffer.GetReadFramebuffer().lock()->GetSpecification().Height);
     mStateTracker->SetShaderProgram(oglShader);
-    oglShader.UploadParameters();
+    UploadParameters(oglShader);
     buffer.GetWriteFramebuffer().lock()->Bind();
     oglMesh.Bind();
-    glDrawElements(GL_TRIANGLES, oglMesh.GetIndexCount(), GL_UNSIGNED_INT, 0);
-    OpenGLUtilities::CheckOpenGLError(
-      "glDrawElements", "OpenGLRendererApi", mLogger);
-    oglMesh.Unbind();
+    glDrawElements(GL_TRIANGLES,
+                   static_cast<GLsizei>(oglMesh.GetIndexCount()),
+                   oglMesh.GetGLIndexType(),
+                   nullptr);
+    DWARF_CHECK_OPENGL_ERROR("glDrawElements", "OpenGLRendererApi", mLogger);
 
     if (srgb)
     {
       glDisable(GL_FRAMEBUFFER_SRGB);
-      OpenGLUtilities::CheckOpenGLError(
+      DWARF_CHECK_OPENGL_ERROR(
         "glDisable GL_FRAMEBUFFER_SRGB", "OpenGLRendererApi", mLogger);
     }
     buffer.GetWriteFramebuffer().lock()->Unbind();
@@ -540,4 +625,16 @@ namespace Dwarf
     }
     return static_cast<uint8_t>(maxAniso);
   }
+
+  auto
+  OpenGLRendererApi::GetStateChangeStatistics() const -> StateChangeStatistics
+  {
+    return mStateTracker->GetStatistics();
+  }
+
+  void
+  OpenGLRendererApi::ResetStateChangeStatistics()
+  {
+    mStateTracker->ResetStatistics();
+  }
 }
\ No newline at end of file
@@ -30,6 +30,24 @@ namespace Dwarf
     std::shared_ptr<IShader>     mErrorShader;
     std::shared_ptr<IMeshBuffer> mScreenQuad;
 
+    /// @brief Uploads the parameters of a shader and binds the textures its
+    /// samplers expect through the state tracker.
+    void
+    UploadParameters(OpenGLShader& shader);
+
+    /// @brief Binds the shader and render state of a material and sets its
+    /// parameters and the camera uniforms on the shader.
+    void
+    ApplyMaterial(OpenGLShader& shader, IMaterial& material, ICamera& camera);
+
+    /// @brief Binds the shader, render state, parameters and vertex array
+    /// used to draw a mesh buffer with a material.
+    void
+    PrepareMaterialDraw(const IMeshBuffer* mesh,
+                        IMaterial&         material,
+                        ICamera&           camera,
+                        glm::mat4          modelMatrix);
+
   public:
     OpenGLRendererApi(std::shared_ptr<IAssetDatabase>      assetDatabase,
                       std::shared_ptr<IShaderRegistry>     shaderRegistry,
@@ -42,6 +60,18 @@ namespace Dwarf
                       std::shared_ptr<IMeshBufferFactory> meshBufferFactory);
     ~OpenGLRendererApi() override;
 
+    /**
+     * @brief Binds the shader and render state of a material and uploads its
+     * parameters for an indirect draw. The vertex array and the per draw
+     * data are bound by the indirect draw backend.
+     *
+     * @param shader Shader variant compiled for indirect drawing
+     * @param material Material whose parameters are applied
+     * @param camera Camera to render with
+     */
+    void
+    PrepareIndirectDraw(IShader& shader, IMaterial& material, ICamera& camera);
+
     /**
      * @brief Sets the viewport
      *
@@ -86,12 +116,31 @@ namespace Dwarf
      * @param material Material to render with
      * @param camera Camera to use
      * @param modelMatrix Model matrix of the mesh buffer
+     * @param lod Detail level of the mesh buffer to draw
      */
     void
     RenderIndexed(const IMeshBuffer* mesh,
                   IMaterial&         material,
                   ICamera&           camera,
-                  glm::mat4          modelMatrix) override;
+                  glm::mat4          modelMatrix,
+                  uint32_t           lod) override;
+
+    /**
+     * @brief Renders multiple index ranges of the full detail level of a mesh
+     * buffer with a single multi draw
+     *
+     * @param mesh Mesh buffer to render
+     * @param material Material to render with
+     * @param camera Camera to use
+     * @param modelMatrix Model matrix of the mesh buffer
+     * @param ranges Index ranges to draw, e.g. the visible meshlets
+     */
+    void
+    RenderIndexedRanges(const IMeshBuffer*             mesh,
+                        IMaterial&                     material,
+                        ICamera&                       camera,
+                        glm::mat4                      modelMatrix,
+                        const std::vector<IndexRange>& ranges) override;
 
     void
     RenderSkyboxIndexed(const IMeshBuffer* mesh,
@@ -207,5 +256,21 @@ namespace Dwarf
 
     auto
     GetMaxAnisoLevel() -> uint8_t override;
+
+    /**
+     * @brief Returns the state changes requested since the statistics have
+     * been reset
+     *
+     * @return Issued and skipped state changes by kind
+     */
+    [[nodiscard]] auto
+    GetStateChangeStatistics() const -> StateChangeStatistics override;
+
+    /**
+     * @brief Resets the state change statistics
+     *
+     */
+    void
+    ResetStateChangeStatistics() override;
   };
 }
\ No newline at end of file
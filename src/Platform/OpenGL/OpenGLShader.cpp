@@ -6,6 +6,7 @@
 #include "Core/Asset/Database/IAssetDatabase.hpp"
 #include "Core/Base.hpp"
 #include "Core/Rendering/Shader/ShaderParameterCollection/IShaderParameterCollection.hpp"
+#include "Core/Rendering/Shader/ProgramBinaryCache/ProgramBinaryCache.hpp"
 #include "Core/Rendering/Shader/ShaderParameterCollection/IShaderParameterCollectionFactory.hpp"
 #include "OpenGLShader.hpp"
 #include "OpenGLUtilities.hpp"
@@ -18,16 +19,148 @@
 
 namespace Dwarf
 {
+  namespace
+  {
+    /// @brief Identifies the driver, program binaries of other drivers or
+    /// driver versions are rejected by glProgramBinary.
+    auto
+    GetDriverIdentification() -> const std::string&
+    {
+      static const std::string identification = []()
+      {
+        std::string result;
+        for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+        {
+          const auto* value =
+            reinterpret_cast<const char*>(glGetString(name));
+          result += value != nullptr ? value : "";
+          result += '\n';
+        }
+        return result;
+      }();
+      return identification;
+    }
+
+    /// @brief Whether the driver supports retrieving program binaries.
+    auto
+    SupportsProgramBinaries() -> bool
+    {
+      static const bool supported = []()
+      {
+        GLint formatCount = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+        return formatCount > 0;
+      }();
+      return supported;
+    }
+
+    /// @brief Maps a GL uniform type to the parameter type a material stores
+    /// for it.
+    auto
+    ToShaderParameterType(GLenum type) -> std::optional<ShaderParameterType>
+    {
+      switch (type)
+      {
+        case GL_FLOAT: return ShaderParameterType::FLOAT;
+        case GL_FLOAT_VEC2: return ShaderParameterType::VEC2;
+        case GL_FLOAT_VEC3: return ShaderParameterType::VEC3;
+        case GL_FLOAT_VEC4: return ShaderParameterType::VEC4;
+        case GL_INT: return ShaderParameterType::INTEGER;
+        case GL_INT_VEC2: return ShaderParameterType::IVEC2;
+        case GL_INT_VEC3: return ShaderParameterType::IVEC3;
+        case GL_INT_VEC4: return ShaderParameterType::IVEC4;
+        case GL_UNSIGNED_INT: return ShaderParameterType::UNSIGNED_INTEGER;
+        case GL_UNSIGNED_INT_VEC2: return ShaderParameterType::UVEC2;
+        case GL_UNSIGNED_INT_VEC3: return ShaderParameterType::UVEC3;
+        case GL_UNSIGNED_INT_VEC4: return ShaderParameterType::UVEC4;
+        case GL_BOOL: return ShaderParameterType::BOOLEAN;
+        case GL_FLOAT_MAT3: return ShaderParameterType::MAT3;
+        case GL_FLOAT_MAT4: return ShaderParameterType::MAT4;
+        case GL_SAMPLER_2D:
+        case GL_SAMPLER_2D_MULTISAMPLE: return ShaderParameterType::TEX2D;
+        default: return std::nullopt;
+      }
+    }
+
+    /// @brief Whether a uniform type is a sampler and needs a texture unit.
+    auto
+    IsSamplerType(GLenum type) -> bool
+    {
+      switch (type)
+      {
+        case GL_SAMPLER_1D:
+        case GL_SAMPLER_2D:
+        case GL_SAMPLER_3D:
+        case GL_SAMPLER_CUBE:
+        case GL_SAMPLER_1D_SHADOW:
+        case GL_SAMPLER_2D_SHADOW:
+        case GL_SAMPLER_1D_ARRAY:
+        case GL_SAMPLER_2D_ARRAY:
+        case GL_SAMPLER_2D_ARRAY_SHADOW:
+        case GL_SAMPLER_2D_MULTISAMPLE:
+        case GL_SAMPLER_2D_MULTISAMPLE_ARRAY:
+        case GL_SAMPLER_CUBE_SHADOW:
+        case GL_SAMPLER_CUBE_MAP_ARRAY:
+        case GL_SAMPLER_BUFFER:
+        case GL_INT_SAMPLER_2D:
+        case GL_INT_SAMPLER_3D:
+        case GL_INT_SAMPLER_CUBE:
+        case GL_INT_SAMPLER_2D_ARRAY:
+        case GL_UNSIGNED_INT_SAMPLER_2D:
+        case GL_UNSIGNED_INT_SAMPLER_3D:
+        case GL_UNSIGNED_INT_SAMPLER_CUBE:
+        case GL_UNSIGNED_INT_SAMPLER_2D_ARRAY: return true;
+        default: return false;
+      }
+    }
+
+    /// @brief Reads the name of a program resource without truncating it.
+    auto
+    GetResourceName(GLuint program, GLenum interface, GLuint index)
+      -> std::string
+    {
+      GLint        nameLength = 0;
+      const GLenum property = GL_NAME_LENGTH;
+      glGetProgramResourceiv(
+        program, interface, index, 1, &property, 1, nullptr, &nameLength);
+
+      // The length includes the terminating null character
+      std::string name(std::max(nameLength, 1), '\0');
+      GLsizei     length = 0;
+      glGetProgramResourceName(
+        program, interface, index, nameLength, &length, name.data());
+      name.resize(length);
+      return name;
+    }
+
+    auto
+    GetStageName(GLenum type) -> const char*
+    {
+      switch (type)
+      {
+        case GL_VERTEX_SHADER: return "Vertex shader";
+        case GL_FRAGMENT_SHADER: return "Fragment shader";
+        case GL_GEOMETRY_SHADER: return "Geometry shader";
+        default: return "Shader";
+      }
+    }
+  }
+
   OpenGLShader::OpenGLShader(
     std::unique_ptr<IShaderSourceCollection> shaderSources,
     std::shared_ptr<IShaderParameterCollectionFactory>
                                   shaderParameterCollectionFactory,
-    std::shared_ptr<IDwarfLogger> logger,
-    std::shared_ptr<IVramTracker> vramTracker)
+    std::shared_ptr<IDwarfLogger>        logger,
+    std::shared_ptr<IVramTracker>        vramTracker,
+    std::shared_ptr<IProgramBinaryCache> programBinaryCache,
+    std::shared_ptr<IShaderPreprocessor> shaderPreprocessor)
     : mShaderParameterCollectionFactory(
         std::move(shaderParameterCollectionFactory))
     , mLogger(std::move(logger))
     , mVramTracker(std::move(vramTracker))
+    , mProgramBinaryCache(std::move(programBinaryCache))
+    , mShaderPreprocessor(std::move(shaderPreprocessor))
+    , mKeywords(shaderSources->GetKeywords())
   {
     for (std::unique_ptr<IAssetReference>& shaderSource :
          shaderSources->GetShaderSources())
@@ -56,52 +189,43 @@ namespace Dwarf
 
   OpenGLShader::~OpenGLShader()
   {
-    GLint binaryLength = 0;
-    glGetProgramiv(mID, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
-    mVramTracker->RemoveShaderMemory(binaryLength);
-    OpenGLUtilities::CheckOpenGLError(
-      "Errors before deleting shader", "OpenGLShader", mLogger);
-    glDeleteProgram(mID);
-    OpenGLUtilities::CheckOpenGLError(
-      "glDeleteProgram", "OpenGLShader", mLogger);
+    DiscardPendingCompilation();
+    ReleaseProgram();
   }
 
-  const std::array<std::string, 5> OpenGLShader::ReservedUniformNames = {
+  const std::array<std::string, 8> OpenGLShader::ReservedUniformNames = {
     "modelMatrix",
     "viewMatrix",
     "projectionMatrix",
     "_Time",
-    "viewPosition"
-  };
-
-  const std::map<GLenum, ShaderParameterType> glTypeToDwarfShaderType = {
-    { GL_FLOAT, ShaderParameterType::FLOAT },
-    { GL_FLOAT_VEC2, ShaderParameterType::VEC2 },
-    { GL_FLOAT_VEC3, ShaderParameterType::VEC3 },
-    { GL_FLOAT_VEC4, ShaderParameterType::VEC4 },
-    { GL_INT, ShaderParameterType::INTEGER },
-    { GL_INT_VEC2, ShaderParameterType::IVEC2 },
-    { GL_INT_VEC3, ShaderParameterType::IVEC3 },
-    { GL_INT_VEC4, ShaderParameterType::IVEC4 },
-    { GL_UNSIGNED_INT, ShaderParameterType::UNSIGNED_INTEGER },
-    { GL_UNSIGNED_INT_VEC2, ShaderParameterType::UVEC2 },
-    { GL_UNSIGNED_INT_VEC3, ShaderParameterType::UVEC3 },
-    { GL_UNSIGNED_INT_VEC4, ShaderParameterType::UVEC4 },
-    { GL_BOOL, ShaderParameterType::BOOLEAN },
-    { GL_FLOAT_MAT3, ShaderParameterType::MAT3 },
-    { GL_FLOAT_MAT4, ShaderParameterType::MAT4 },
-    { GL_SAMPLER_2D, ShaderParameterType::TEX2D },
-    { GL_SAMPLER_2D_MULTISAMPLE, ShaderParameterType::TEX2D }
+    "viewPosition",
+    "_VertexCompression",
+    "_PositionScale",
+    "_PositionOffset"
   };
 
   void
   OpenGLShader::Compile()
   {
-    mSuccessfullyCompiled = false;
-    mUniformLocations.clear();
+    if (!mPendingCompilation.has_value())
+    {
+      SubmitCompilation();
+    }
+
+    if (mPendingCompilation.has_value())
+    {
+      FinishCompilation();
+    }
+  }
+
+  void
+  OpenGLShader::SubmitCompilation()
+  {
+    DiscardPendingCompilation();
 
     if (!mVertexShaderAsset.has_value() || !mFragmentShaderAsset.has_value())
     {
+      ReleaseProgram();
       return;
     }
 
@@ -111,221 +235,544 @@ namespace Dwarf
     auto& fragmentShaderAsset = dynamic_cast<FragmentShaderAsset&>(
       mFragmentShaderAsset.value()->GetAsset());
 
-    if (vertexShaderAsset.GetFileContent().length() > 0 &&
-        fragmentShaderAsset.GetFileContent().length() > 0)
-    {
-      const char* vertexSource = vertexShaderAsset.GetFileContent().c_str();
-      const char* fragmentSource = fragmentShaderAsset.GetFileContent().c_str();
-
-      GLsizei vertLogLength = 0;
-      GLchar  vertMessage[1024] = "";
-
-      GLsizei fragLogLength = 0;
-      GLchar  fragMessage[1024] = "";
-
-      OpenGLUtilities::CheckOpenGLError(
-        "Errors before compiling shader", "OpenGLShader", mLogger);
-      GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-      OpenGLUtilities::CheckOpenGLError(
-        "glCreateShader vertex shader", "OpenGLShader", mLogger);
-      glShaderSource(vertexShader, 1, &vertexSource, nullptr);
-      OpenGLUtilities::CheckOpenGLError(
-        "glShaderSource vertex shader", "OpenGLShader", mLogger);
-      glCompileShader(vertexShader);
-      OpenGLUtilities::CheckOpenGLError(
-        "glCompileShader vertex shader", "OpenGLShader", mLogger);
-
-      GLint vertexCompiled = 0;
-      glGetShaderInfoLog(vertexShader, 1024, &vertLogLength, vertMessage);
-      OpenGLUtilities::CheckOpenGLError(
-        "glGetShaderInfoLog vertex shader", "OpenGLShader", mLogger);
-      glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &vertexCompiled);
-      OpenGLUtilities::CheckOpenGLError(
-        "glGetShaderiv vertex shader", "OpenGLShader", mLogger);
-
-      if (vertLogLength > 0)
+    if (vertexShaderAsset.GetFileContent().empty() ||
+        fragmentShaderAsset.GetFileContent().empty())
+    {
+      // TODO: log missing shader error
+      ReleaseProgram();
+      return;
+    }
+
+    mDeclaredKeywords.clear();
+    mIncludedFiles.clear();
+    std::string vertexSource = PreprocessStage(
+      *mVertexShaderAsset.value(), vertexShaderAsset.GetFileContent());
+    std::string fragmentSource = PreprocessStage(
+      *mFragmentShaderAsset.value(), fragmentShaderAsset.GetFileContent());
+    std::string geometrySource =
+      mGeometryShaderAsset.has_value()
+        ? PreprocessStage(*mGeometryShaderAsset.value(),
+                          dynamic_cast<GeometryShaderAsset&>(
+                            mGeometryShaderAsset.value()->GetAsset())
+                            .GetFileContent())
+        : std::string();
+
+    // The preprocessed sources contain the includes and keyword defines, so
+    // every variant gets its own binary
+    PendingCompilation compilation;
+    compilation.Start = std::chrono::steady_clock::now();
+    compilation.StoreBinary = SupportsProgramBinaries();
+    compilation.BinaryKey =
+      ProgramBinaryCache::ComputeKey({ GetDriverIdentification(),
+                                       vertexSource,
+                                       fragmentSource,
+                                       geometrySource });
+    if (compilation.StoreBinary && LoadProgramBinary(compilation.BinaryKey))
+    {
+      return;
+    }
+
+    DWARF_CHECK_OPENGL_ERROR(
+      "Errors before compiling shader", "OpenGLShader", mLogger);
+
+    // Only hands the work to the driver, no status is queried here so drivers
+    // supporting parallel compilation can compile in the background
+    compilation.Stages.emplace_back(
+      GL_VERTEX_SHADER, CompileStage(GL_VERTEX_SHADER, vertexSource));
+    compilation.Stages.emplace_back(
+      GL_FRAGMENT_SHADER, CompileStage(GL_FRAGMENT_SHADER, fragmentSource));
+    if (mGeometryShaderAsset.has_value())
+    {
+      compilation.Stages.emplace_back(
+        GL_GEOMETRY_SHADER, CompileStage(GL_GEOMETRY_SHADER, geometrySource));
+    }
+
+    compilation.Program = glCreateProgram();
+    DWARF_CHECK_OPENGL_ERROR("glCreateProgram", "OpenGLShader", mLogger);
+
+    for (const auto& [type, stage] : compilation.Stages)
+    {
+      glAttachShader(compilation.Program, stage);
+    }
+    DWARF_CHECK_OPENGL_ERROR("glAttachShader", "OpenGLShader", mLogger);
+
+    if (compilation.StoreBinary)
+    {
+      glProgramParameteri(
+        compilation.Program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+      DWARF_CHECK_OPENGL_ERROR("glProgramParameteri", "OpenGLShader", mLogger);
+    }
+
+    glLinkProgram(compilation.Program);
+    DWARF_CHECK_OPENGL_ERROR("glLinkProgram", "OpenGLShader", mLogger);
+
+    mPendingCompilation = std::move(compilation);
+  }
+
+  auto
+  OpenGLShader::PollCompilation() -> bool
+  {
+    if (!mPendingCompilation.has_value())
+    {
+      return true;
+    }
+
+    // Without the extension the status queries block, the compilation is
+    // finished at the first poll instead
+    if (OpenGLUtilities::SupportsParallelShaderCompile())
+    {
+      GLint completed = GL_FALSE;
+      glGetProgramiv(
+        mPendingCompilation->Program, GL_COMPLETION_STATUS_KHR, &completed);
+      if (completed != GL_TRUE)
       {
-        mShaderLogs.mVertexShaderLog = std::string(vertMessage);
+        return false;
       }
+    }
+
+    FinishCompilation();
+    return true;
+  }
+
+  auto
+  OpenGLShader::IsCompiling() const -> bool
+  {
+    return mPendingCompilation.has_value();
+  }
+
+  auto
+  OpenGLShader::PreprocessStage(const IAssetReference& asset,
+                                std::string_view       source) -> std::string
+  {
+    PreprocessedShaderSource result =
+      mShaderPreprocessor->Preprocess(source, asset.GetPath(), mKeywords);
+
+    for (const std::string& error : result.Errors)
+    {
+      mLogger->LogWarn(Log(error, "OpenGLShader"));
+    }
 
-      if (vertexCompiled != GL_TRUE)
+    for (std::string& keyword : result.DeclaredKeywords)
+    {
+      if (std::ranges::find(mDeclaredKeywords, keyword) ==
+          mDeclaredKeywords.end())
       {
-        glDeleteShader(vertexShader);
-        OpenGLUtilities::CheckOpenGLError(
-          "glDeleteShader vertex shader", "OpenGLShader", mLogger);
-        return;
+        mDeclaredKeywords.push_back(std::move(keyword));
       }
+    }
 
-      mLogger->LogDebug(
-        Log("Vertex shader compiled successfully", "OpenGLShader"));
-
-      GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-      OpenGLUtilities::CheckOpenGLError(
-        "glCreateShader fragment shader", "OpenGLShader", mLogger);
-      glShaderSource(fragmentShader, 1, &fragmentSource, nullptr);
-      OpenGLUtilities::CheckOpenGLError(
-        "glShaderSource fragment shader", "OpenGLShader", mLogger);
-      glCompileShader(fragmentShader);
-      OpenGLUtilities::CheckOpenGLError(
-        "glCompileShader fragment shader", "OpenGLShader", mLogger);
-
-      GLint fragmentCompiled = 0;
-      glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &fragmentCompiled);
-      OpenGLUtilities::CheckOpenGLError(
-        "glGetShaderiv fragment shader", "OpenGLShader", mLogger);
-      glGetShaderInfoLog(fragmentShader, 1024, &fragLogLength, fragMessage);
-      OpenGLUtilities::CheckOpenGLError(
-        "glGetShaderInfoLog fragment shader", "OpenGLShader", mLogger);
-
-      if (fragLogLength > 0)
+    for (std::filesystem::path& includedFile : result.IncludedFiles)
+    {
+      if (std::ranges::find(mIncludedFiles, includedFile) ==
+          mIncludedFiles.end())
       {
-        mShaderLogs.mFragmentShaderLog = std::string(fragMessage);
+        mIncludedFiles.push_back(std::move(includedFile));
       }
+    }
+
+    return std::move(result.Source);
+  }
+
+  auto
+  OpenGLShader::CompileStage(GLenum type, std::string_view source) -> GLuint
+  {
+    const GLchar* sourceData = source.data();
+    auto          sourceLength = static_cast<GLint>(source.size());
+
+    GLuint stage = glCreateShader(type);
+    DWARF_CHECK_OPENGL_ERROR(
+      fmt::format("glCreateShader {}", GetStageName(type)),
+      "OpenGLShader",
+      mLogger);
+    glShaderSource(stage, 1, &sourceData, &sourceLength);
+    DWARF_CHECK_OPENGL_ERROR(
+      fmt::format("glShaderSource {}", GetStageName(type)),
+      "OpenGLShader",
+      mLogger);
+    glCompileShader(stage);
+    DWARF_CHECK_OPENGL_ERROR(
+      fmt::format("glCompileShader {}", GetStageName(type)),
+      "OpenGLShader",
+      mLogger);
+    return stage;
+  }
+
+  auto
+  OpenGLShader::CheckStageCompilation(GLenum type, GLuint stage) -> bool
+  {
+    GLint   compiled = GL_FALSE;
+    GLsizei logLength = 0;
+    GLchar  message[GL_SHADER_LOG_LENGTH] = "";
+
+    glGetShaderiv(stage, GL_COMPILE_STATUS, &compiled);
+    glGetShaderInfoLog(stage, GL_SHADER_LOG_LENGTH, &logLength, message);
+    DWARF_CHECK_OPENGL_ERROR(
+      fmt::format("glGetShaderInfoLog {}", GetStageName(type)),
+      "OpenGLShader",
+      mLogger);
+
+    std::string log = logLength > 0 ? std::string(message) : std::string();
+    switch (type)
+    {
+      case GL_VERTEX_SHADER: mShaderLogs.mVertexShaderLog = log; break;
+      case GL_FRAGMENT_SHADER: mShaderLogs.mFragmentShaderLog = log; break;
+      case GL_GEOMETRY_SHADER: mShaderLogs.mGeometryShaderLog = log; break;
+      default: break;
+    }
+
+    if (compiled == GL_TRUE)
+    {
+      mLogger->LogDebug(Log(
+        fmt::format("{} compiled successfully", GetStageName(type)),
+        "OpenGLShader"));
+    }
+
+    return compiled == GL_TRUE;
+  }
+
+  void
+  OpenGLShader::FinishCompilation()
+  {
+    PendingCompilation compilation = std::move(mPendingCompilation.value());
+    mPendingCompilation.reset();
 
-      if (fragmentCompiled != GL_TRUE)
+    bool stagesCompiled = true;
+    for (const auto& [type, stage] : compilation.Stages)
+    {
+      stagesCompiled &= CheckStageCompilation(type, stage);
+    }
+
+    GLint programLinked = GL_FALSE;
+    if (stagesCompiled)
+    {
+      glGetProgramiv(compilation.Program, GL_LINK_STATUS, &programLinked);
+      DWARF_CHECK_OPENGL_ERROR("glGetProgramiv", "OpenGLShader", mLogger);
+
+      if (programLinked != GL_TRUE)
       {
-        glDeleteShader(vertexShader);
-        OpenGLUtilities::CheckOpenGLError(
-          "glDeleteShader vertex shader", "OpenGLShader", mLogger);
-        glDeleteShader(fragmentShader);
-        OpenGLUtilities::CheckOpenGLError(
-          "glDeleteShader fragment shader", "OpenGLShader", mLogger);
-        return;
+        mLogger->LogError(Log("Shader program failed to link", "OpenGLShader"));
+        GLint logLength = 0;
+        glGetProgramiv(compilation.Program, GL_INFO_LOG_LENGTH, &logLength);
+
+        std::vector<GLchar> infoLog(std::max(logLength, 1));
+        glGetProgramInfoLog(
+          compilation.Program, logLength, nullptr, infoLog.data());
+
+        mLogger->LogInfo(Log(infoLog.data(), "OpenGLShader"));
       }
+    }
 
-      mLogger->LogDebug(
-        Log("Fragment shader compiled successfully", "OpenGLShader"));
+    for (const auto& [type, stage] : compilation.Stages)
+    {
+      glDeleteShader(stage);
+    }
+    DWARF_CHECK_OPENGL_ERROR("glDeleteShader", "OpenGLShader", mLogger);
 
-      mID = glCreateProgram();
+    if (programLinked != GL_TRUE)
+    {
+      glDeleteProgram(compilation.Program);
+      DWARF_CHECK_OPENGL_ERROR("glDeleteProgram", "OpenGLShader", mLogger);
+      ReleaseProgram();
+      return;
+    }
 
-      OpenGLUtilities::CheckOpenGLError(
-        "glCreateProgram", "OpenGLShader", mLogger);
+    ActivateProgram(compilation.Program, std::nullopt);
 
-      glAttachShader(mID, vertexShader);
+    if (compilation.StoreBinary)
+    {
+      // Includes the time until the compilation was polled
+      StoreProgramBinary(
+        compilation.BinaryKey,
+        std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - compilation.Start));
+    }
+  }
 
-      OpenGLUtilities::CheckOpenGLError(
-        "glAttachShader vertex shader", "OpenGLShader", mLogger);
+  void
+  OpenGLShader::DiscardPendingCompilation()
+  {
+    if (!mPendingCompilation.has_value())
+    {
+      return;
+    }
 
-      glAttachShader(mID, fragmentShader);
+    for (const auto& [type, stage] : mPendingCompilation->Stages)
+    {
+      glDeleteShader(stage);
+    }
+    glDeleteProgram(mPendingCompilation->Program);
+    DWARF_CHECK_OPENGL_ERROR(
+      "Discarding pending compilation", "OpenGLShader", mLogger);
+    mPendingCompilation.reset();
+  }
 
-      OpenGLUtilities::CheckOpenGLError(
-        "glAttachShader fragment shader", "OpenGLShader", mLogger);
+  void
+  OpenGLShader::ActivateProgram(GLuint                          program,
+                                std::optional<ShaderReflection> reflection)
+  {
+    ReleaseProgram();
 
-      GLuint geometryShader = -1;
+    mID = program;
+    mReflection = std::make_shared<const ShaderReflection>(
+      reflection.has_value() ? std::move(reflection.value())
+                             : ReflectProgram());
+    ApplyReflection();
+    ResetUniformBindings();
+    mSuccessfullyCompiled = true;
 
-      if (mGeometryShaderAsset.has_value())
+    if (mFragmentShaderAsset.has_value())
+    {
+      std::string label =
+        mFragmentShaderAsset.value()->GetPath().filename().string();
+      for (const std::string& keyword : mKeywords)
       {
-        const char* geometrySource =
-          (dynamic_cast<GeometryShaderAsset&>(
-             mGeometryShaderAsset.value()->GetAsset()))
-            .GetFileContent()
-            .c_str();
-
-        GLsizei geomLogLength = 0;
-        GLchar  geomMessage[1024] = "";
-
-        geometryShader = glCreateShader(GL_GEOMETRY_SHADER);
-        OpenGLUtilities::CheckOpenGLError(
-          "glCreateShader GL_GEOMETRY_SHADER", "OpenGLShader", mLogger);
-        glShaderSource(geometryShader, 1, &geometrySource, nullptr);
-        OpenGLUtilities::CheckOpenGLError(
-          "glShaderSource", "OpenGLShader", mLogger);
-        glCompileShader(geometryShader);
-        OpenGLUtilities::CheckOpenGLError(
-          "glCompileShader", "OpenGLShader", mLogger);
-
-        GLint geometry_compiled = 0;
-        glGetShaderiv(geometryShader, GL_COMPILE_STATUS, &geometry_compiled);
-        OpenGLUtilities::CheckOpenGLError(
-          "glGetShaderiv", "OpenGLShader", mLogger);
-        glGetShaderInfoLog(geometryShader, 1024, &geomLogLength, geomMessage);
-        OpenGLUtilities::CheckOpenGLError(
-          "glGetShaderInfoLog", "OpenGLShader", mLogger);
-
-        if (geomLogLength > 0)
-        {
-          mShaderLogs.mGeometryShaderLog = std::string(geomMessage);
-        }
-
-        if (geometry_compiled != GL_TRUE)
-        {
-          glDeleteShader(vertexShader);
-          OpenGLUtilities::CheckOpenGLError(
-            "glDeleteShader vertexShader", "OpenGLShader", mLogger);
-          glDeleteShader(fragmentShader);
-          OpenGLUtilities::CheckOpenGLError(
-            "glDeleteShader fragmentShader", "OpenGLShader", mLogger);
-          glDeleteShader(geometryShader);
-          OpenGLUtilities::CheckOpenGLError(
-            "glDeleteShader geometryShader", "OpenGLShader", mLogger);
-          return;
-        }
+        label += " " + keyword;
       }
+      OpenGLUtilities::SetObjectLabel(GL_PROGRAM, mID, label);
+    }
 
-      glLinkProgram(mID);
-      OpenGLUtilities::CheckOpenGLError(
-        "glLinkProgram", "OpenGLShader", mLogger);
+    GLint binaryLength = 0;
+    glGetProgramiv(mID, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    DWARF_CHECK_OPENGL_ERROR("glGetProgramiv", "OpenGLShader", mLogger);
+    mVramTracker->AddShaderMemory(binaryLength);
+  }
 
-      GLint programLinked = 0;
-      glGetProgramiv(mID, GL_LINK_STATUS, &programLinked);
+  auto
+  OpenGLShader::ReflectProgram() const -> ShaderReflection
+  {
+    ShaderReflection reflection;
 
-      OpenGLUtilities::CheckOpenGLError(
-        "glGetProgramiv", "OpenGLShader", mLogger);
+    GLint uniformCount = 0;
+    glGetProgramInterfaceiv(
+      mID, GL_UNIFORM, GL_ACTIVE_RESOURCES, &uniformCount);
 
-      if (programLinked != GL_TRUE)
+    for (GLint index = 0; index < uniformCount; index++)
+    {
+      const std::array<GLenum, 3> properties = { GL_TYPE,
+                                                 GL_LOCATION,
+                                                 GL_BLOCK_INDEX };
+      std::array<GLint, 3>        values = { 0, -1, -1 };
+      glGetProgramResourceiv(mID,
+                             GL_UNIFORM,
+                             index,
+                             properties.size(),
+                             properties.data(),
+                             values.size(),
+                             nullptr,
+                             values.data());
+
+      // Members of uniform blocks are not set through locations
+      if (values[2] != -1)
       {
-        mLogger->LogError(Log("Shader program failed to link", "OpenGLShader"));
-        GLint logLength = 0;
-        glGetProgramiv(mID, GL_INFO_LOG_LENGTH, &logLength);
+        continue;
+      }
 
-        std::vector<GLchar> infoLog(logLength);
-        glGetProgramInfoLog(mID, logLength, nullptr, infoLog.data());
+      ShaderUniform& uniform = reflection.Uniforms.emplace_back();
+      uniform.Name = GetResourceName(mID, GL_UNIFORM, index);
+      uniform.Type = ToShaderParameterType(values[0]);
+      uniform.Location = values[1];
+      uniform.TextureUnit = IsSamplerType(values[0]) ? 0 : -1;
+    }
+    DWARF_CHECK_OPENGL_ERROR(
+      "glGetProgramResourceiv GL_UNIFORM", "OpenGLShader", mLogger);
+
+    // Sorted for the lookup by name, the samplers get their units in the
+    // same order
+    std::ranges::sort(reflection.Uniforms, {}, &ShaderUniform::Name);
+    int32_t nextTextureUnit = 0;
+    for (ShaderUniform& uniform : reflection.Uniforms)
+    {
+      if (uniform.TextureUnit != -1)
+      {
+        uniform.TextureUnit = nextTextureUnit++;
+      }
+    }
 
-        mLogger->LogInfo(Log(infoLog.data(), "OpenGLShader"));
-        glDeleteShader(vertexShader);
-        OpenGLUtilities::CheckOpenGLError(
-          "glDeleteShader vertex shader", "OpenGLShader", mLogger);
-        glDeleteShader(fragmentShader);
-        OpenGLUtilities::CheckOpenGLError(
-          "glDeleteShader fragment shader", "OpenGLShader", mLogger);
-
-        if (geometryShader != -1)
-        {
-          glDeleteShader(geometryShader);
-          OpenGLUtilities::CheckOpenGLError(
-            "glDeleteShader geometry shader", "OpenGLShader", mLogger);
-        }
-        glDeleteProgram(mID);
-        OpenGLUtilities::CheckOpenGLError(
-          "glDeleteProgram", "OpenGLShader", mLogger);
-        return;
+    GLuint blockIndex = glGetProgramResourceIndex(
+      mID, GL_SHADER_STORAGE_BLOCK, MATERIAL_BLOCK_NAME.data());
+    if (blockIndex == GL_INVALID_INDEX)
+    {
+      return reflection;
+    }
+
+    const GLenum variableCountProperty = GL_NUM_ACTIVE_VARIABLES;
+    GLint        variableCount = 0;
+    glGetProgramResourceiv(mID,
+                           GL_SHADER_STORAGE_BLOCK,
+                           blockIndex,
+                           1,
+                           &variableCountProperty,
+                           1,
+                           nullptr,
+                           &variableCount);
+
+    std::vector<GLint> variables(variableCount);
+    const GLenum       variablesProperty = GL_ACTIVE_VARIABLES;
+    glGetProgramResourceiv(mID,
+                           GL_SHADER_STORAGE_BLOCK,
+                           blockIndex,
+                           1,
+                           &variablesProperty,
+                           variableCount,
+                           nullptr,
+                           variables.data());
+    DWARF_CHECK_OPENGL_ERROR(
+      "glGetProgramResourceiv GL_ACTIVE_VARIABLES", "OpenGLShader", mLogger);
+
+    MaterialBlockLayout& layout = reflection.MaterialBlock.emplace();
+    for (GLint variable : variables)
+    {
+      const std::array<GLenum, 3> properties = { GL_TYPE,
+                                                 GL_OFFSET,
+                                                 GL_TOP_LEVEL_ARRAY_STRIDE };
+      std::array<GLint, 3>        values = { 0, 0, 0 };
+      glGetProgramResourceiv(mID,
+                             GL_BUFFER_VARIABLE,
+                             variable,
+                             properties.size(),
+                             properties.data(),
+                             values.size(),
+                             nullptr,
+                             values.data());
+
+      // Members are reported as "dwarfMaterials[0].tint"
+      std::string name = GetResourceName(mID, GL_BUFFER_VARIABLE, variable);
+      name.erase(0, name.rfind('.') + 1);
+
+      std::optional<ShaderParameterType> type =
+        ToShaderParameterType(values[0]);
+      if (!type.has_value())
+      {
+        mLogger->LogWarn(Log(
+          fmt::format("Material block member {} has an unsupported type", name),
+          "OpenGLShader"));
+        continue;
       }
 
-      glDeleteShader(vertexShader);
-      OpenGLUtilities::CheckOpenGLError(
-        "glDeleteShader vertex shader", "OpenGLShader", mLogger);
-      glDeleteShader(fragmentShader);
-      OpenGLUtilities::CheckOpenGLError(
-        "glDeleteShader fragment shader", "OpenGLShader", mLogger);
+      layout.Members.push_back(
+        { std::move(name), type.value(), static_cast<uint32_t>(values[1]) });
+      layout.Stride = static_cast<uint32_t>(values[2]);
+    }
+    DWARF_CHECK_OPENGL_ERROR(
+      "glGetProgramResourceiv GL_BUFFER_VARIABLE", "OpenGLShader", mLogger);
+
+    return reflection;
+  }
+
+  void
+  OpenGLShader::ApplyReflection()
+  {
+    mUniformLocations.clear();
+    for (const ShaderUniform& uniform : mReflection->Uniforms)
+    {
+      mUniformLocations[uniform.Name] = uniform.Location;
 
-      if (geometryShader != -1)
+      // Every sampler keeps the unit of the reflection for the lifetime of
+      // the program
+      if (uniform.TextureUnit != -1)
       {
-        glDeleteShader(geometryShader);
-        OpenGLUtilities::CheckOpenGLError(
-          "glDeleteShader geometry shader", "OpenGLShader", mLogger);
+        glProgramUniform1i(mID, uniform.Location, uniform.TextureUnit);
       }
+    }
+    DWARF_CHECK_OPENGL_ERROR("glProgramUniform1i", "OpenGLShader", mLogger);
+  }
 
-      mSuccessfullyCompiled = true;
-      GLint binaryLength = 0;
-      glGetProgramiv(mID, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
-      OpenGLUtilities::CheckOpenGLError(
-        "glGetProgramiv", "OpenGLShader", mLogger);
-      mVramTracker->AddShaderMemory(binaryLength);
+  void
+  OpenGLShader::ReleaseProgram()
+  {
+    mSuccessfullyCompiled = false;
+    mReflection.reset();
+    if (mID == 0)
+    {
+      return;
     }
-    else
+
+    GLint binaryLength = 0;
+    glGetProgramiv(mID, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    mVramTracker->RemoveShaderMemory(binaryLength);
+    DWARF_CHECK_OPENGL_ERROR(
+      "Errors before deleting shader", "OpenGLShader", mLogger);
+    glDeleteProgram(mID);
+    DWARF_CHECK_OPENGL_ERROR("glDeleteProgram", "OpenGLShader", mLogger);
+    mID = 0;
+  }
+
+  auto
+  OpenGLShader::LoadProgramBinary(const ProgramBinaryKey& key) -> bool
+  {
+    std::optional<ProgramBinary> binary = mProgramBinaryCache->Load(key);
+    if (!binary.has_value())
     {
-      // TODO: log missing shader error
+      return false;
+    }
+
+    auto loadStart = std::chrono::steady_clock::now();
+
+    GLuint program = glCreateProgram();
+    DWARF_CHECK_OPENGL_ERROR("glCreateProgram", "OpenGLShader", mLogger);
+    glProgramBinary(program,
+                    binary->Format,
+                    binary->Data.data(),
+                    static_cast<GLsizei>(binary->Data.size()));
+
+    // Drivers reject binaries after updates, which is not an error
+    GLint programLinked = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &programLinked);
+    if (programLinked != GL_TRUE)
+    {
+      mLogger->LogDebug(Log(
+        "Cached program binary was rejected, compiling from source",
+        "OpenGLShader"));
+      glDeleteProgram(program);
+      mProgramBinaryCache->Remove(key);
+      return false;
+    }
+
+    mProgramBinaryCache->RecordHit(
+      *binary,
+      std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - loadStart));
+
+    std::optional<ShaderReflection> reflection =
+      ShaderReflection::Deserialize(binary->Reflection);
+    bool reflectionValid = reflection.has_value();
+    ActivateProgram(program, std::move(reflection));
+
+    // Entries without a valid reflection are reflected again, and the fresh
+    // reflection is written back so the next load can skip it
+    if (!reflectionValid)
+    {
+      binary->Reflection = mReflection->Serialize();
+      mProgramBinaryCache->Store(key, *binary);
+    }
+    return true;
+  }
+
+  void
+  OpenGLShader::StoreProgramBinary(const ProgramBinaryKey&   key,
+                                   std::chrono::microseconds compileTime)
+  {
+    mProgramBinaryCache->RecordMiss();
+
+    GLint binaryLength = 0;
+    glGetProgramiv(mID, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    if (binaryLength <= 0)
+    {
+      return;
     }
+
+    ProgramBinary binary;
+    binary.CompileTime = compileTime;
+    binary.Data.resize(binaryLength);
+
+    GLenum format = 0;
+    glGetProgramBinary(
+      mID, binaryLength, nullptr, &format, binary.Data.data());
+    DWARF_CHECK_OPENGL_ERROR("glGetProgramBinary", "OpenGLShader", mLogger);
+    binary.Format = format;
+    binary.Reflection = mReflection->Serialize();
+
+    mProgramBinaryCache->Store(key, binary);
   }
 
   auto
@@ -334,6 +781,19 @@ namespace Dwarf
     return mSuccessfullyCompiled;
   }
 
+  auto
+  OpenGLShader::GetDeclaredKeywords() const -> const std::vector<std::string>&
+  {
+    return mDeclaredKeywords;
+  }
+
+  auto
+  OpenGLShader::GetIncludedFiles() const
+    -> const std::vector<std::filesystem::path>&
+  {
+    return mIncludedFiles;
+  }
+
   auto
   OpenGLShader::GetID() const -> GLuint
   {
@@ -349,34 +809,17 @@ namespace Dwarf
       return nullptr;
     }
 
+    // Built from the reflection of the program, creating the parameters of
+    // a material doesn't query the driver
     std::unique_ptr<IShaderParameterCollection> parameters =
       std::move(mShaderParameterCollectionFactory->Create());
-    GLint parameterIndex = 0;
-    GLint count = 0;
-
-    GLint  size = 0; // size of the variable
-    GLenum type = 0; // type of the variable (float, vec3 or mat4, etc)
-
-    const GLsizei bufSize = 64;  // maximum name length
-    GLchar        name[bufSize]; // variable name in GLSL
-    GLsizei       length = 0;    // name length
-
-    glGetProgramiv(mID, GL_ACTIVE_UNIFORMS, &count);
-    OpenGLUtilities::CheckOpenGLError(
-      "glGetProgramiv GL_ACTIVE_UNIFORMS", "OpenGLShader", mLogger);
-
-    for (parameterIndex = 0; parameterIndex < count; parameterIndex++)
+    for (const ShaderUniform& uniform : mReflection->Uniforms)
     {
-      glGetActiveUniform(
-        mID, (GLuint)parameterIndex, bufSize, &length, &size, &type, name);
-      OpenGLUtilities::CheckOpenGLError(
-        "glGetActiveUniform", "OpenGLShader", mLogger);
-
-      if (std::ranges::find(ReservedUniformNames, name) ==
-          ReservedUniformNames.end())
+      if (uniform.Type.has_value() &&
+          std::ranges::find(ReservedUniformNames, uniform.Name) ==
+            ReservedUniformNames.end())
       {
-        parameters->mDefaultValueAdders.at(glTypeToDwarfShaderType.at(type))(
-          name);
+        parameters->mDefaultValueAdders.at(uniform.Type.value())(uniform.Name);
       }
     }
 
@@ -397,6 +840,22 @@ namespace Dwarf
     mUniformStates.erase(identifier);
   }
 
+  auto
+  OpenGLShader::GetMaterialBlockLayout() const
+    -> const std::optional<MaterialBlockLayout>&
+  {
+    static const std::optional<MaterialBlockLayout> noMaterialBlock;
+    return mReflection != nullptr ? mReflection->MaterialBlock
+                                  : noMaterialBlock;
+  }
+
+  auto
+  OpenGLShader::GetReflection() const
+    -> const std::shared_ptr<const ShaderReflection>&
+  {
+    return mReflection;
+  }
+
   auto
   OpenGLShader::GetShaderLogs() const -> const ShaderLogs&
   {
@@ -408,12 +867,32 @@ namespace Dwarf
   {
     mUniformStates.clear();
     mTextureStates.clear();
+    mTextureUnits.clear();
+    mNextTextureSlot = 0;
+
+    if (mReflection != nullptr)
+    {
+      for (const ShaderUniform& uniform : mReflection->Uniforms)
+      {
+        if (uniform.TextureUnit != -1)
+        {
+          mTextureUnits[uniform.Name] = uniform.TextureUnit;
+          mNextTextureSlot =
+            std::max(mNextTextureSlot, uniform.TextureUnit + 1);
+        }
+      }
+    }
+  }
+
+  auto
+  OpenGLShader::GetTextureBindings() const -> const std::map<int, uintptr_t>&
+  {
+    return mTextureStates;
   }
 
   void
   OpenGLShader::UploadParameters()
   {
-    int textureCount = 0;
     for (const auto& pair : mUniformStatesDraft)
     {
       auto it = mUniformStates.find(pair.first);
@@ -432,7 +911,7 @@ namespace Dwarf
           if constexpr (std::is_same_v<T, float>)
           {
             glUniform1f(uniformLocation, static_cast<GLfloat>(val));
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniform1f", "OpenGLRendererApi", mLogger);
           }
           // Vec2 parameter
@@ -440,7 +919,7 @@ namespace Dwarf
           {
             auto param(static_cast<glm::vec2>(val));
             glUniform2f(uniformLocation, param.x, param.y);
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniform2f", "OpenGLRendererApi", mLogger);
           }
           // Vec3 parameter
@@ -448,7 +927,7 @@ namespace Dwarf
           {
             auto param(static_cast<glm::vec3>(val));
             glUniform3f(uniformLocation, param.x, param.y, param.z);
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniform3f", "OpenGLRendererApi", mLogger);
           }
           // Vec4 parameter
@@ -456,7 +935,7 @@ namespace Dwarf
           {
             auto param(static_cast<glm::vec4>(val));
             glUniform4f(uniformLocation, param.x, param.y, param.z, param.w);
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniform4f", "OpenGLRendererApi", mLogger);
           }
           // Int parameter
@@ -464,7 +943,7 @@ namespace Dwarf
           {
             auto param(static_cast<int>(val));
             glUniform1i(uniformLocation, param);
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniform1i", "OpenGLRendererApi", mLogger);
           }
           // iVec2 parameter
@@ -472,7 +951,7 @@ namespace Dwarf
           {
             auto param(static_cast<glm::ivec2>(val));
             glUniform2i(uniformLocation, param.x, param.y);
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniform2i", "OpenGLRendererApi", mLogger);
           }
           // iVec3 parameter
@@ -480,7 +959,7 @@ namespace Dwarf
           {
             auto param(static_cast<glm::ivec3>(val));
             glUniform3i(uniformLocation, param.x, param.y, param.z);
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniform3i", "OpenGLRendererApi", mLogger);
           }
           // iVec4 parameter
@@ -488,7 +967,7 @@ namespace Dwarf
           {
             auto param(static_cast<glm::ivec4>(val));
             glUniform4i(uniformLocation, param.x, param.y, param.z, param.w);
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniform4i", "OpenGLRendererApi", mLogger);
           }
           // unsigned int parameter
@@ -496,7 +975,7 @@ namespace Dwarf
           {
             auto param(static_cast<uint32_t>(val));
             glUniform1ui(uniformLocation, param);
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniform1ui", "OpenGLRendererApi", mLogger);
           }
           // uvec2 parameter
@@ -504,7 +983,7 @@ namespace Dwarf
           {
             auto param(static_cast<glm::uvec2>(val));
             glUniform2ui(uniformLocation, param.x, param.y);
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniform2ui", "OpenGLRendererApi", mLogger);
           }
           // uvec3 parameter
@@ -512,7 +991,7 @@ namespace Dwarf
           {
             auto param(static_cast<glm::uvec3>(val));
             glUniform3ui(uniformLocation, param.x, param.y, param.z);
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniform3ui", "OpenGLRendererApi", mLogger);
           }
           // uvec4 parameter
@@ -520,14 +999,14 @@ namespace Dwarf
           {
             auto param(static_cast<glm::uvec4>(val));
             glUniform4ui(uniformLocation, param.x, param.y, param.z, param.w);
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniform4ui", "OpenGLRendererApi", mLogger);
           }
           // Bool parameter
           if constexpr (std::is_same_v<T, bool>)
           {
             glUniform1f(uniformLocation, static_cast<GLfloat>(val));
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniform1f", "OpenGLRendererApi", mLogger);
           }
           // Mat3 parameter
@@ -536,7 +1015,7 @@ namespace Dwarf
             auto param(static_cast<glm::mat3>(val));
             glUniformMatrix3fv(
               uniformLocation, 1, GL_FALSE, glm::value_ptr(param));
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniformMatrix3fv", "OpenGLRendererApi", mLogger);
           }
           // Mat4 parameter
@@ -545,7 +1024,7 @@ namespace Dwarf
             auto param(static_cast<glm::mat4>(val));
             glUniformMatrix4fv(
               uniformLocation, 1, GL_FALSE, glm::value_ptr(param));
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glUniformMatrix4fv", "OpenGLRendererApi", mLogger);
           }
           // Texture2D parameter
@@ -553,26 +1032,18 @@ namespace Dwarf
           {
             auto param(dynamic_cast<OpenGLTexture*>(
               static_cast<std::shared_ptr<ITexture>>(val).get()));
-            glActiveTexture(GL_TEXTURE0 + textureCount);
-            OpenGLUtilities::CheckOpenGLError(
-              "glActiveTexture", "OpenGLRendererApi", mLogger);
-            glBindTexture(param->GetType(), param->GetTextureID());
-            OpenGLUtilities::CheckOpenGLError(
-              "glBindTexture", "OpenGLShader", mLogger);
-            mTextureStates[textureCount] = param->GetTextureID();
-
-            /*if (mUniformStates.contains(pair.first) &&
-                (std::get<int>(mUniformStates[pair.first]) ==
-                 static_cast<GLint>(textureCount)))
+            auto [unit, assigned] =
+              mTextureUnits.try_emplace(pair.first, mNextTextureSlot);
+            if (assigned)
             {
-              return;
-            }*/
-
-            glUniform1i(uniformLocation, static_cast<GLint>(textureCount));
-            OpenGLUtilities::CheckOpenGLError(
-              "glUniform1i", "OpenGLRendererApi", mLogger);
-            mUniformStates[pair.first] = static_cast<GLint>(textureCount);
-            textureCount++;
+              // The sampler keeps its unit, binding the texture to it is left
+              // to the state tracker
+              mNextTextureSlot++;
+              glUniform1i(uniformLocation, static_cast<GLint>(unit->second));
+              DWARF_CHECK_OPENGL_ERROR(
+                "glUniform1i", "OpenGLRendererApi", mLogger);
+            }
+            mTextureStates[unit->second] = param->GetTextureID();
           }
         },
         pair.second);
@@ -584,12 +1055,13 @@ namespace Dwarf
   auto
   OpenGLShader::GetUniformLocation(std::string uniformName) -> GLint
   {
+    // The active uniforms are known from the reflection, only names like
+    // elements of arrays are looked up
     if (!mUniformLocations.contains(uniformName))
     {
       mUniformLocations[uniformName] =
         glGetUniformLocation(mID, uniformName.c_str());
-      OpenGLUtilities::CheckOpenGLError(
-        "glGetUniformLocation", "OpenGLShader", mLogger);
+      DWARF_CHECK_OPENGL_ERROR("glGetUniformLocation", "OpenGLShader", mLogger);
     }
 
     return mUniformLocations[uniformName];
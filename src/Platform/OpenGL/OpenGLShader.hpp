@@ -1,10 +1,13 @@
 #pragma once
 
 #include "Core/Asset/AssetReference/IAssetReference.hpp"
+#include "Core/Asset/Shader/ShaderPreprocessor/IShaderPreprocessor.hpp"
 #include "Core/Asset/Shader/ShaderSourceCollection/IShaderSourceCollection.hpp"
 #include "Core/Rendering/Shader/IShader.hpp"
+#include "Core/Rendering/Shader/ProgramBinaryCache/IProgramBinaryCache.hpp"
 #include "Core/Rendering/Shader/ShaderParameterCollection/IShaderParameterCollection.hpp"
 #include "Core/Rendering/Shader/ShaderParameterCollection/IShaderParameterCollectionFactory.hpp"
+#include "Core/Rendering/Shader/ShaderReflection/ShaderReflection.hpp"
 #include "Core/Rendering/VramTracker/IVramTracker.hpp"
 #include "Logging/IDwarfLogger.hpp"
 #include <boost/di.hpp>
@@ -27,11 +30,13 @@ namespace Dwarf
   class OpenGLShader : public IShader
   {
   private:
-    std::shared_ptr<IDwarfLogger> mLogger;
-    std::shared_ptr<IVramTracker> mVramTracker;
+    std::shared_ptr<IDwarfLogger>        mLogger;
+    std::shared_ptr<IVramTracker>        mVramTracker;
+    std::shared_ptr<IProgramBinaryCache> mProgramBinaryCache;
+    std::shared_ptr<IShaderPreprocessor> mShaderPreprocessor;
     std::shared_ptr<IShaderParameterCollectionFactory>
                mShaderParameterCollectionFactory;
-    GLuint     mID = -1;
+    GLuint     mID = 0;
     int        mNextTextureSlot = 0;
     ShaderLogs mShaderLogs;
     bool       mSuccessfullyCompiled = false;
@@ -41,6 +46,9 @@ namespace Dwarf
     std::map<std::string, ShaderParameterValue> mUniformStatesDraft;
     std::map<int, uintptr_t>                    mTextureStates;
     std::map<int, uintptr_t>                    mTextureStatesDraft;
+    std::map<std::string, int>                  mTextureUnits;
+
+    std::shared_ptr<const ShaderReflection> mReflection;
 
     std::optional<std::unique_ptr<IAssetReference>> mVertexShaderAsset;
     std::optional<std::unique_ptr<IAssetReference>> mGeometryShaderAsset;
@@ -50,16 +58,135 @@ namespace Dwarf
       mTessellationEvaluationShaderAsset;
     std::optional<std::unique_ptr<IAssetReference>> mFragmentShaderAsset;
 
+    std::vector<std::string>           mKeywords;
+    std::vector<std::string>           mDeclaredKeywords;
+    std::vector<std::filesystem::path> mIncludedFiles;
+
     struct HandleShaderSourceVisitor;
     friend struct HandleShaderSourceVisitor;
 
+    /// @brief A compilation that was handed to the driver and not yet
+    /// finished.
+    struct PendingCompilation
+    {
+      GLuint                                 Program = 0;
+      std::vector<std::pair<GLenum, GLuint>> Stages;
+      ProgramBinaryKey                       BinaryKey;
+      bool                                   StoreBinary = false;
+      std::chrono::steady_clock::time_point  Start;
+    };
+
+    std::optional<PendingCompilation> mPendingCompilation;
+
+    /**
+     * @brief Resolves the includes of a shader stage and defines the selected
+     * keywords it declares
+     *
+     * @param asset Asset reference of the shader stage
+     * @param source Source code of the stage
+     * @return Source code that is handed to the driver
+     */
+    auto
+    PreprocessStage(const IAssetReference& asset, std::string_view source)
+      -> std::string;
+
+    /**
+     * @brief Submits the compilation of a single shader stage
+     *
+     * @param type Type of the shader stage
+     * @param source Source code of the stage
+     * @return Id of the created shader object
+     */
+    auto
+    CompileStage(GLenum type, std::string_view source) -> GLuint;
+
+    /**
+     * @brief Reads the compile status and log of a shader stage
+     *
+     * @param type Type of the shader stage
+     * @param stage Id of the shader object
+     * @return True if the stage compiled successfully
+     */
+    auto
+    CheckStageCompilation(GLenum type, GLuint stage) -> bool;
+
+    /**
+     * @brief Reads the results of the pending compilation and activates the
+     * program if it linked successfully. Blocks if the driver is not done.
+     *
+     */
+    void
+    FinishCompilation();
+
+    /**
+     * @brief Deletes the objects of the pending compilation
+     *
+     */
+    void
+    DiscardPendingCompilation();
+
+    /**
+     * @brief Replaces the current program with a successfully linked one
+     *
+     * @param program Id of the linked program
+     * @param reflection Reflection of the program from the binary cache,
+     * the program is reflected if empty
+     */
+    void
+    ActivateProgram(GLuint program, std::optional<ShaderReflection> reflection);
+
+    /**
+     * @brief Queries the uniforms and the material block of the current
+     * program from the driver
+     *
+     * @return The reflection of the program
+     */
+    [[nodiscard]] auto
+    ReflectProgram() const -> ShaderReflection;
+
+    /**
+     * @brief Takes the uniform locations from the reflection and binds every
+     * sampler to its texture unit
+     *
+     */
+    void
+    ApplyReflection();
+
+    /**
+     * @brief Deletes the current program
+     *
+     */
+    void
+    ReleaseProgram();
+
+    /**
+     * @brief Creates the program from a cached binary
+     *
+     * @param key Key of the program in the program binary cache
+     * @return True if the program was created from the cache
+     */
+    auto
+    LoadProgramBinary(const ProgramBinaryKey& key) -> bool;
+
+    /**
+     * @brief Stores the binary of the linked program in the cache
+     *
+     * @param key Key of the program in the program binary cache
+     * @param compileTime Time it took to compile and link the program
+     */
+    void
+    StoreProgramBinary(const ProgramBinaryKey&   key,
+                       std::chrono::microseconds compileTime);
+
   public:
     BOOST_DI_INJECT(OpenGLShader,
                     std::unique_ptr<IShaderSourceCollection> shaderSources,
                     std::shared_ptr<IShaderParameterCollectionFactory>
                       shaderParameterCollectionFactory,
                     std::shared_ptr<IDwarfLogger> logger,
-                    std::shared_ptr<IVramTracker> vramTracker);
+                    std::shared_ptr<IVramTracker> vramTracker,
+                    std::shared_ptr<IProgramBinaryCache> programBinaryCache,
+                    std::shared_ptr<IShaderPreprocessor> shaderPreprocessor);
     ~OpenGLShader() override;
 
     [[nodiscard]] auto
@@ -68,16 +195,71 @@ namespace Dwarf
     void
     ResetUniformBindings();
 
+    /**
+     * @brief Uploads the changed parameters. Every sampler keeps the texture
+     * unit it was assigned first, so its uniform is only set once per link.
+     *
+     */
     void
     UploadParameters();
 
     /**
-     * @brief Compiles the shader program
+     * @brief Gets the textures the samplers of the program expect per unit
+     *
+     * @return Map from texture unit to texture id
+     */
+    [[nodiscard]] auto
+    GetTextureBindings() const -> const std::map<int, uintptr_t>&;
+
+    /**
+     * @brief Gets the layout of the material storage block of the program
+     *
+     * @return The reflected layout, empty if the program reads its material
+     * parameters from uniforms
+     */
+    [[nodiscard]] auto
+    GetMaterialBlockLayout() const -> const std::optional<MaterialBlockLayout>&;
+
+    /**
+     * @brief Gets the reflection of the current program, shared by all
+     * materials using the shader
+     *
+     * @return The reflection, nullptr if the shader isn't compiled
+     */
+    [[nodiscard]] auto
+    GetReflection() const -> const std::shared_ptr<const ShaderReflection>&;
+
+    /**
+     * @brief Compiles the shader program and waits for the result
      *
      */
     void
     Compile() override;
 
+    /**
+     * @brief Hands the compilation to the driver without waiting for it. The
+     * previous program stays in use until the new one is finished.
+     *
+     */
+    void
+    SubmitCompilation() override;
+
+    /**
+     * @brief Finishes the submitted compilation if the driver is done with it
+     *
+     * @return True if no compilation is pending anymore
+     */
+    auto
+    PollCompilation() -> bool override;
+
+    /**
+     * @brief Returns whether a submitted compilation is not finished yet
+     *
+     * @return True if a compilation is pending
+     */
+    [[nodiscard]] auto
+    IsCompiling() const -> bool override;
+
     /**
      * @brief Returns the compilation status of the shader.
      *
@@ -86,6 +268,23 @@ namespace Dwarf
     [[nodiscard]] auto
     IsCompiled() const -> bool override;
 
+    /**
+     * @brief Returns the keywords the shader sources declare
+     *
+     * @return List of the declared keywords
+     */
+    [[nodiscard]] auto
+    GetDeclaredKeywords() const -> const std::vector<std::string>& override;
+
+    /**
+     * @brief Returns the files included by the shader sources
+     *
+     * @return List of the included files
+     */
+    [[nodiscard]] auto
+    GetIncludedFiles() const
+      -> const std::vector<std::filesystem::path>& override;
+
     /**
      * @brief Creates a ShaderParameterCollection that contains all the shader
      * parameters that the shader uses
@@ -108,7 +307,7 @@ namespace Dwarf
     auto
     GetUniformLocation(std::string uniformName) -> GLint;
 
-    static const std::array<std::string, 5> ReservedUniformNames;
+    static const std::array<std::string, 8> ReservedUniformNames;
 
     [[nodiscard]] auto
     CompareTo(const IShader& other) const -> bool;
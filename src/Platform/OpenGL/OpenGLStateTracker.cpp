@@ -21,25 +21,92 @@ namespace Dwarf
   void
   OpenGLStateTracker::SetShaderProgram(OpenGLShader& program)
   {
-    if (mCurrentShaderProgram != program.GetID())
+    bool changed = mCurrentShaderProgram != program.GetID();
+    Count(mStatistics.Programs, changed);
+    if (changed)
     {
       glUseProgram(program.GetID());
       mCurrentShaderProgram = program.GetID();
 
-      OpenGLUtilities::CheckOpenGLError(
-        "glUseProgram", "OpenGLRendererApi", mLogger);
-      program.ResetUniformBindings();
+      DWARF_CHECK_OPENGL_ERROR("glUseProgram", "OpenGLRendererApi", mLogger);
     }
   }
 
   void
   OpenGLStateTracker::BindFramebuffer(GLuint framebuffer)
   {
+    bool changed =
+      mReadFramebuffer != framebuffer || mDrawFramebuffer != framebuffer;
+    Count(mStatistics.Framebuffers, changed);
+    if (changed)
+    {
+      glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+      DWARF_CHECK_OPENGL_ERROR(
+        "glBindFramebuffer", "OpenGLStateTracker", mLogger);
+      mReadFramebuffer = framebuffer;
+      mDrawFramebuffer = framebuffer;
+    }
+  }
+
+  void
+  OpenGLStateTracker::BindReadFramebuffer(GLuint framebuffer)
+  {
+    bool changed = mReadFramebuffer != framebuffer;
+    Count(mStatistics.Framebuffers, changed);
+    if (changed)
+    {
+      glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+      DWARF_CHECK_OPENGL_ERROR(
+        "glBindFramebuffer GL_READ_FRAMEBUFFER", "OpenGLStateTracker", mLogger);
+      mReadFramebuffer = framebuffer;
+    }
+  }
+
+  void
+  OpenGLStateTracker::BindDrawFramebuffer(GLuint framebuffer)
+  {
+    bool changed = mDrawFramebuffer != framebuffer;
+    Count(mStatistics.Framebuffers, changed);
+    if (changed)
+    {
+      glBindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+      DWARF_CHECK_OPENGL_ERROR(
+        "glBindFramebuffer GL_DRAW_FRAMEBUFFER", "OpenGLStateTracker", mLogger);
+      mDrawFramebuffer = framebuffer;
+    }
   }
 
   void
   OpenGLStateTracker::BindVertexArray(GLuint vao)
   {
+    bool changed = mVertexArray != vao;
+    Count(mStatistics.VertexArrays, changed);
+    if (changed)
+    {
+      glBindVertexArray(vao);
+      DWARF_CHECK_OPENGL_ERROR(
+        "glBindVertexArray", "OpenGLStateTracker", mLogger);
+      mVertexArray = vao;
+    }
+  }
+
+  void
+  OpenGLStateTracker::BindTexture(uint32_t unit, GLuint texture)
+  {
+    if (unit >= mTextureUnits.size())
+    {
+      mTextureUnits.resize(unit + 1, 0);
+    }
+
+    bool changed = mTextureUnits[unit] != texture;
+    Count(mStatistics.Textures, changed);
+    if (changed)
+    {
+      glBindTextureUnit(unit, texture);
+      DWARF_CHECK_OPENGL_ERROR(
+        "glBindTextureUnit", "OpenGLStateTracker", mLogger);
+      mTextureUnits[unit] = texture;
+    }
   }
 
   void
@@ -50,18 +117,20 @@ namespace Dwarf
   void
   OpenGLStateTracker::SetBlendMode(bool enabled)
   {
-    if (mBlendMode != enabled)
+    bool changed = mBlendMode != enabled;
+    Count(mStatistics.RasterState, changed);
+    if (changed)
     {
       if (enabled)
       {
         glEnable(GL_BLEND);
-        OpenGLUtilities::CheckOpenGLError(
+        DWARF_CHECK_OPENGL_ERROR(
           "glEnable GL_BLEND", "OpenGLRendererApi", mLogger);
       }
       else
       {
         glDisable(GL_BLEND);
-        OpenGLUtilities::CheckOpenGLError(
+        DWARF_CHECK_OPENGL_ERROR(
           "glDisable GL_BLEND", "OpenGLRendererApi", mLogger);
       }
 
@@ -72,11 +141,13 @@ namespace Dwarf
   void
   OpenGLStateTracker::SetBlendFunction(GLenum source, GLenum destination)
   {
-    if ((mBlendSource != source) || (mBlendDestination != destination))
+    bool changed =
+      (mBlendSource != source) || (mBlendDestination != destination);
+    Count(mStatistics.RasterState, changed);
+    if (changed)
     {
       glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-      OpenGLUtilities::CheckOpenGLError(
-        "glBlendFunc", "OpenGLRendererApi", mLogger);
+      DWARF_CHECK_OPENGL_ERROR("glBlendFunc", "OpenGLRendererApi", mLogger);
 
       mBlendSource = source;
       mBlendDestination = destination;
@@ -86,18 +157,20 @@ namespace Dwarf
   void
   OpenGLStateTracker::SetDepthWrite(bool enabled)
   {
-    if (enabled != mDepthWrite)
+    bool changed = enabled != mDepthWrite;
+    Count(mStatistics.RasterState, changed);
+    if (changed)
     {
       if (enabled)
       {
         glDepthMask(GL_TRUE);
-        OpenGLUtilities::CheckOpenGLError(
+        DWARF_CHECK_OPENGL_ERROR(
           "glDepthMask GL_TRUE", "OpenGLRendererApi", mLogger);
       }
       else
       {
         glDepthMask(GL_FALSE);
-        OpenGLUtilities::CheckOpenGLError(
+        DWARF_CHECK_OPENGL_ERROR(
           "glDepthMask GL_FALSE", "OpenGLRendererApi", mLogger);
       }
 
@@ -108,18 +181,20 @@ namespace Dwarf
   void
   OpenGLStateTracker::SetDepthTest(bool enabled)
   {
-    if (enabled != mDepthMode)
+    bool changed = enabled != mDepthMode;
+    Count(mStatistics.RasterState, changed);
+    if (changed)
     {
       if (enabled)
       {
         glEnable(GL_DEPTH_TEST);
-        OpenGLUtilities::CheckOpenGLError(
+        DWARF_CHECK_OPENGL_ERROR(
           "glEnable GL_DEPTH_TEST", "OpenGLRendererApi", mLogger);
       }
       else
       {
         glDisable(GL_DEPTH_TEST);
-        OpenGLUtilities::CheckOpenGLError(
+        DWARF_CHECK_OPENGL_ERROR(
           "glDisable GL_DEPTH_TEST", "OpenGLRendererApi", mLogger);
       }
 
@@ -130,11 +205,12 @@ namespace Dwarf
   void
   OpenGLStateTracker::SetDepthFunction(GLenum depthFunc)
   {
-    if (mDepthFunc != depthFunc)
+    bool changed = mDepthFunc != depthFunc;
+    Count(mStatistics.RasterState, changed);
+    if (changed)
     {
       glDepthFunc(depthFunc);
-      OpenGLUtilities::CheckOpenGLError(
-        "glDepthFunc", "OpenGLRendererApi", mLogger);
+      DWARF_CHECK_OPENGL_ERROR("glDepthFunc", "OpenGLRendererApi", mLogger);
 
       mDepthFunc = depthFunc;
     }
@@ -148,18 +224,20 @@ namespace Dwarf
   void
   OpenGLStateTracker::SetCullMode(bool enabled)
   {
-    if (mCullMode != enabled)
+    bool changed = mCullMode != enabled;
+    Count(mStatistics.RasterState, changed);
+    if (changed)
     {
       if (enabled)
       {
         glEnable(GL_CULL_FACE);
-        OpenGLUtilities::CheckOpenGLError(
+        DWARF_CHECK_OPENGL_ERROR(
           "glEnable GL_CULL_FACE", "OpenGLRendererApi", mLogger);
       }
       else
       {
         glDisable(GL_CULL_FACE);
-        OpenGLUtilities::CheckOpenGLError(
+        DWARF_CHECK_OPENGL_ERROR(
           "glDisable GL_CULL_FACE", "OpenGLRendererApi", mLogger);
       }
 
@@ -170,11 +248,12 @@ namespace Dwarf
   void
   OpenGLStateTracker::SetCullFace(GLenum face)
   {
-    if (mCullFace != face)
+    bool changed = mCullFace != face;
+    Count(mStatistics.RasterState, changed);
+    if (changed)
     {
       glCullFace(face);
-      OpenGLUtilities::CheckOpenGLError(
-        "glCullFace", "OpenGLRendererApi", mLogger);
+      DWARF_CHECK_OPENGL_ERROR("glCullFace", "OpenGLRendererApi", mLogger);
 
       mCullFace = face;
     }
@@ -186,13 +265,14 @@ namespace Dwarf
                                   uint32_t width,
                                   uint32_t height)
   {
-    if (mViewportState != ViewportState(x, y, width, height))
+    bool changed = mViewportState != ViewportState(x, y, width, height);
+    Count(mStatistics.Viewports, changed);
+    if (changed)
     {
-      OpenGLUtilities::CheckOpenGLError(
+      DWARF_CHECK_OPENGL_ERROR(
         "Before setting viewport", "OpenGLRendererApi", mLogger);
       glViewport(x, y, width, height);
-      OpenGLUtilities::CheckOpenGLError(
-        "glViewport", "OpenGLRendererApi", mLogger);
+      DWARF_CHECK_OPENGL_ERROR("glViewport", "OpenGLRendererApi", mLogger);
       mViewportState = { .x = x, .y = y, .width = width, .height = height };
     }
   }
@@ -200,15 +280,69 @@ namespace Dwarf
   void
   OpenGLStateTracker::SetClearColor(const glm::vec4& color)
   {
-    if (mClearColor != color)
+    bool changed = mClearColor != color;
+    Count(mStatistics.RasterState, changed);
+    if (changed)
     {
       mClearColor = color;
 
-      OpenGLUtilities::CheckOpenGLError(
+      DWARF_CHECK_OPENGL_ERROR(
         "Before setting clear color", "OpenGLRendererApi", mLogger);
       glClearColor(color.r, color.g, color.b, color.a);
-      OpenGLUtilities::CheckOpenGLError(
-        "glClearColor", "OpenGLRendererApi", mLogger);
+      DWARF_CHECK_OPENGL_ERROR("glClearColor", "OpenGLRendererApi", mLogger);
+    }
+  }
+
+  void
+  OpenGLStateTracker::OnTextureDeleted(GLuint texture)
+  {
+    std::ranges::replace(mTextureUnits, texture, 0U);
+  }
+
+  void
+  OpenGLStateTracker::OnVertexArrayDeleted(GLuint vao)
+  {
+    if (mVertexArray == vao)
+    {
+      mVertexArray = 0;
+    }
+  }
+
+  void
+  OpenGLStateTracker::OnFramebufferDeleted(GLuint framebuffer)
+  {
+    if (mReadFramebuffer == framebuffer)
+    {
+      mReadFramebuffer = 0;
+    }
+    if (mDrawFramebuffer == framebuffer)
+    {
+      mDrawFramebuffer = 0;
+    }
+  }
+
+  auto
+  OpenGLStateTracker::GetStatistics() const -> const StateChangeStatistics&
+  {
+    return mStatistics;
+  }
+
+  void
+  OpenGLStateTracker::ResetStatistics()
+  {
+    mStatistics = {};
+  }
+
+  void
+  OpenGLStateTracker::Count(StateChangeCounter& counter, bool issued)
+  {
+    if (issued)
+    {
+      counter.Issued++;
+    }
+    else
+    {
+      counter.Skipped++;
     }
   }
 }
\ No newline at end of file
@@ -36,6 +36,23 @@ namespace Dwarf
     bool                          mDepthMode = false;
     GLenum                        mDepthFunc = 0;
     bool                          mDepthWrite = true;
+    GLuint                        mReadFramebuffer = 0;
+    GLuint                        mDrawFramebuffer = 0;
+    GLuint                        mVertexArray = 0;
+
+    /// @brief Texture bound to each texture unit, indexed by the unit.
+    std::vector<GLuint> mTextureUnits;
+
+    StateChangeStatistics mStatistics;
+
+    /**
+     * @brief Counts a requested state change
+     *
+     * @param counter The counter of the kind of state
+     * @param issued Whether the change was sent to OpenGL or skipped
+     */
+    static void
+    Count(StateChangeCounter& counter, bool issued);
 
   public:
     OpenGLStateTracker(std::shared_ptr<IDwarfLogger> logger);
@@ -47,9 +64,18 @@ namespace Dwarf
     void
     BindFramebuffer(GLuint framebuffer) override;
 
+    void
+    BindReadFramebuffer(GLuint framebuffer) override;
+
+    void
+    BindDrawFramebuffer(GLuint framebuffer) override;
+
     void
     BindVertexArray(GLuint vao) override;
 
+    void
+    BindTexture(uint32_t unit, GLuint texture) override;
+
     void
     BindBuffer(GLuint buffer) override;
 
@@ -84,5 +110,20 @@ namespace Dwarf
 
     void
     SetClearColor(const glm::vec4& color) override;
+
+    void
+    OnTextureDeleted(GLuint texture) override;
+
+    void
+    OnVertexArrayDeleted(GLuint vao) override;
+
+    void
+    OnFramebufferDeleted(GLuint framebuffer) override;
+
+    [[nodiscard]] auto
+    GetStatistics() const -> const StateChangeStatistics& override;
+
+    void
+    ResetStatistics() override;
   };
 }
\ No newline at end of file
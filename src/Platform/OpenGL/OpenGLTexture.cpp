@@ -327,11 +327,14 @@ namespace Dwarf
 
   // A map that maps
   // Constructor without meta data
-  OpenGLTexture::OpenGLTexture(const std::shared_ptr<TextureContainer>& data,
-                               std::shared_ptr<IDwarfLogger>            logger,
-                               std::shared_ptr<IVramTracker> vramTracker)
+  OpenGLTexture::OpenGLTexture(
+    const std::shared_ptr<TextureContainer>& data,
+    std::shared_ptr<IDwarfLogger>            logger,
+    std::shared_ptr<IVramTracker>            vramTracker,
+    std::shared_ptr<IOpenGLStateTracker>     stateTracker)
     : mLogger(std::move(logger))
     , mVramTracker(std::move(vramTracker))
+    , mStateTracker(std::move(stateTracker))
     , mTextureType(GetTextureType(data->Type, data->Samples))
   {
     GLuint textureDataType = GetTextureDataType(data->DataType);
@@ -356,18 +359,19 @@ namespace Dwarf
     mLogger->LogDebug(Log("Internal format: " + GLenumToString(internalFormat),
                           "OpenGLTexture"));
 
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "Before creating texture", "OpenGLTexture", mLogger);
     glCreateTextures(mTextureType, 1, &mId);
-    OpenGLUtilities::CheckOpenGLError(
-      "glCreateTextures", "OpenGLTexture", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glCreateTextures", "OpenGLTexture", mLogger);
+    OpenGLUtilities::SetObjectLabel(
+      GL_TEXTURE, mId, "Texture " + GLenumToString(internalFormat));
 
     glTextureParameteri(mId, GL_TEXTURE_MIN_FILTER, textureMinFilter);
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "glTextureParameteri MIN FILTER", "OpenGLTexture", mLogger);
 
     glTextureParameteri(mId, GL_TEXTURE_MAG_FILTER, textureMagFilter);
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "glTextureParameteri MAG FILTER", "OpenGLTexture", mLogger);
 
     switch (data->Type)
@@ -377,11 +381,11 @@ namespace Dwarf
           mLogger->LogDebug(Log("Creating 1D texture", "OpenGLTexture"));
           glm::ivec1 size = std::get<glm::ivec1>(data->Size);
           glTextureParameteri(mId, GL_TEXTURE_WRAP_S, textureWrapS);
-          OpenGLUtilities::CheckOpenGLError(
+          DWARF_CHECK_OPENGL_ERROR(
             "glTextureParameteri WRAP S", "OpenGLTexture", mLogger);
 
           glTextureStorage1D(mId, 1, internalFormat, size.x);
-          OpenGLUtilities::CheckOpenGLError(
+          DWARF_CHECK_OPENGL_ERROR(
             "glTextureStorage1D", "OpenGLTexture", mLogger);
           glTextureSubImage1D(mId,
                               0,
@@ -390,7 +394,7 @@ namespace Dwarf
                               textureFormat,
                               textureDataType,
                               GetPixelPointer(*data));
-          OpenGLUtilities::CheckOpenGLError(
+          DWARF_CHECK_OPENGL_ERROR(
             "glTextureSubImage1D", "OpenGLTexture", mLogger);
           break;
         }
@@ -399,17 +403,17 @@ namespace Dwarf
           mLogger->LogDebug(Log("Creating 2D texture", "OpenGLTexture"));
           glm::ivec2 size = std::get<glm::ivec2>(data->Size);
           glTextureParameteri(mId, GL_TEXTURE_WRAP_S, textureWrapS);
-          OpenGLUtilities::CheckOpenGLError(
+          DWARF_CHECK_OPENGL_ERROR(
             "glTextureParameteri WRAP S", "OpenGLTexture", mLogger);
           glTextureParameteri(mId, GL_TEXTURE_WRAP_T, textureWrapT);
-          OpenGLUtilities::CheckOpenGLError(
+          DWARF_CHECK_OPENGL_ERROR(
             "glTextureParameteri WRAP T", "OpenGLTexture", mLogger);
 
           if (data->Samples > 1)
           {
             glTextureStorage2DMultisample(
               mId, data->Samples, internalFormat, size.x, size.y, GL_FALSE);
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glTextureStorage2DMultisample", "OpenGLTexture", mLogger);
           }
           else
@@ -417,7 +421,7 @@ namespace Dwarf
             int mipLevels =
               data->Parameters.MipMapped ? (int)CalculateMipLevels(size) : 1;
             glTextureStorage2D(mId, mipLevels, internalFormat, size.x, size.y);
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glTextureStorage2D", "OpenGLTexture", mLogger);
           }
 
@@ -434,13 +438,13 @@ namespace Dwarf
           if (data->Parameters.MipMapped)
           {
             glGenerateTextureMipmap(mId);
-            OpenGLUtilities::CheckOpenGLError(
+            DWARF_CHECK_OPENGL_ERROR(
               "glGenerateTextureMipmap", "OpenGLTexture", mLogger);
           }
 
           SetAnisoLevel(data->Parameters.AnisoLevel);
 
-          OpenGLUtilities::CheckOpenGLError(
+          DWARF_CHECK_OPENGL_ERROR(
             "glTextureSubImage2D", "OpenGLTexture", mLogger);
           break;
         }
@@ -449,17 +453,17 @@ namespace Dwarf
           mLogger->LogDebug(Log("Creating 3D texture", "OpenGLTexture"));
           glm::ivec3 size = std::get<glm::ivec3>(data->Size);
           glTextureParameteri(mId, GL_TEXTURE_WRAP_S, textureWrapS);
-          OpenGLUtilities::CheckOpenGLError(
+          DWARF_CHECK_OPENGL_ERROR(
             "glTextureParameteri GL_TEXTURE_WRAP_S", "OpenGLTexture", mLogger);
           glTextureParameteri(mId, GL_TEXTURE_WRAP_T, textureWrapT);
-          OpenGLUtilities::CheckOpenGLError(
+          DWARF_CHECK_OPENGL_ERROR(
             "glTextureParameteri GL_TEXTURE_WRAP_T", "OpenGLTexture", mLogger);
           glTextureParameteri(mId, GL_TEXTURE_WRAP_R, textureWrapR);
-          OpenGLUtilities::CheckOpenGLError(
+          DWARF_CHECK_OPENGL_ERROR(
             "glTextureParameteri GL_TEXTURE_WRAP_R", "OpenGLTexture", mLogger);
 
           glTextureStorage3D(mId, 1, internalFormat, size.x, size.y, size.z);
-          OpenGLUtilities::CheckOpenGLError(
+          DWARF_CHECK_OPENGL_ERROR(
             "glTextureStorage3D", "OpenGLTexture", mLogger);
 
           glTextureSubImage3D(mId,
@@ -473,7 +477,7 @@ namespace Dwarf
                               textureFormat,
                               textureDataType,
                               GetPixelPointer(*data));
-          OpenGLUtilities::CheckOpenGLError(
+          DWARF_CHECK_OPENGL_ERROR(
             "glTextureSubImage3D", "OpenGLTexture", mLogger);
           break;
         }
@@ -481,13 +485,13 @@ namespace Dwarf
         {
           mLogger->LogDebug(Log("Creating cube map texture", "OpenGLTexture"));
           glTextureParameteri(mId, GL_TEXTURE_WRAP_S, textureWrapS);
-          OpenGLUtilities::CheckOpenGLError(
+          DWARF_CHECK_OPENGL_ERROR(
             "glTextureParameteri GL_TEXTURE_WRAP_S", "OpenGLTexture", mLogger);
           glTextureParameteri(mId, GL_TEXTURE_WRAP_T, textureWrapT);
-          OpenGLUtilities::CheckOpenGLError(
+          DWARF_CHECK_OPENGL_ERROR(
             "glTextureParameteri GL_TEXTURE_WRAP_T", "OpenGLTexture", mLogger);
           glTextureParameteri(mId, GL_TEXTURE_WRAP_R, textureWrapR);
-          OpenGLUtilities::CheckOpenGLError(
+          DWARF_CHECK_OPENGL_ERROR(
             "glTextureParameteri GL_TEXTURE_WRAP_R", "OpenGLTexture", mLogger);
 
           // TODO: Implement cube map texture
@@ -508,11 +512,11 @@ namespace Dwarf
   OpenGLTexture::~OpenGLTexture()
   {
     mLogger->LogDebug(Log("Deleting OpenGL texture", "OpenGLTexture"));
-    OpenGLUtilities::CheckOpenGLError(
+    DWARF_CHECK_OPENGL_ERROR(
       "Before deleting texture", "OpenGLTexture", mLogger);
     glDeleteTextures(1, &mId);
-    OpenGLUtilities::CheckOpenGLError(
-      "glDeleteTextures", "OpenGLTexture", mLogger);
+    DWARF_CHECK_OPENGL_ERROR("glDeleteTextures", "OpenGLTexture", mLogger);
+    mStateTracker->OnTextureDeleted(mId);
     mVramTracker->RemoveTextureMemory(mVramMemory);
   }
 
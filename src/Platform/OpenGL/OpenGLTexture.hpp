@@ -3,6 +3,7 @@
 #include "Core/Rendering/Texture/ITexture.hpp"
 #include "Core/Rendering/VramTracker/IVramTracker.hpp"
 #include "Logging/IDwarfLogger.hpp"
+#include "Platform/OpenGL/IOpenGLStateTracker.hpp"
 #include <glad/glad.h>
 
 namespace Dwarf
@@ -11,17 +12,19 @@ namespace Dwarf
   {
   private:
     /// @brief The OpenGL texture handle.
-    GLuint                        mId = 0;
-    TextureResolution             mSize;
-    std::shared_ptr<IDwarfLogger> mLogger;
-    std::shared_ptr<IVramTracker> mVramTracker;
-    size_t                        mVramMemory;
-    GLuint                        mTextureType;
+    GLuint                               mId = 0;
+    TextureResolution                    mSize;
+    std::shared_ptr<IDwarfLogger>        mLogger;
+    std::shared_ptr<IVramTracker>        mVramTracker;
+    std::shared_ptr<IOpenGLStateTracker> mStateTracker;
+    size_t                               mVramMemory;
+    GLuint                               mTextureType;
 
   public:
     explicit OpenGLTexture(const std::shared_ptr<TextureContainer>& data,
                            std::shared_ptr<IDwarfLogger>            logger,
-                           std::shared_ptr<IVramTracker> vramTracker);
+                           std::shared_ptr<IVramTracker>            vramTracker,
+                           std::shared_ptr<IOpenGLStateTracker> stateTracker);
     ~OpenGLTexture() override;
 
     /**
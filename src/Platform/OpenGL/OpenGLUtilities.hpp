@@ -10,9 +10,27 @@ namespace Dwarf
   class OpenGLUtilities
   {
   public:
+    /// @brief Whether the glGetError checks after the OpenGL calls are
+    /// compiled in. Optimized builds do not check, the debug output reports
+    /// errors without stalling the driver.
+#ifdef DWARF_OPENGL_ERROR_CHECKS
+    static constexpr bool ErrorChecksEnabled = true;
+#else
+    static constexpr bool ErrorChecksEnabled = false;
+#endif
+
+    /**
+     * @brief Logs all pending OpenGL errors. Called through
+     * DWARF_CHECK_OPENGL_ERROR, which drops the call and its arguments unless
+     * the error checks are enabled
+     *
+     * @param functionName The OpenGL call that has been checked
+     * @param scope The scope to log the errors with
+     * @param logger The logger to log the errors to
+     */
     static void
-    CheckOpenGLError(const std::string&                   functionName,
-                     const std::string&                   scope,
+    CheckOpenGLError(std::string_view                     functionName,
+                     std::string_view                     scope,
                      const std::shared_ptr<IDwarfLogger>& logger)
     {
       GLenum errorCode = 0;
@@ -31,11 +49,64 @@ namespace Dwarf
             error = "INVALID_FRAMEBUFFER_OPERATION";
             break;
         }
-        logger->LogError(Log(
-          fmt::format("OpenGL Error ({}): {}", error, functionName), scope));
+        logger->LogError(
+          Log(fmt::format("OpenGL Error ({}): {}", error, functionName),
+              std::string(scope)));
       }
     }
 
+    /**
+     * @brief Whether GL_KHR_debug (core since OpenGL 4.3) is available for
+     * the debug output, object labels and debug groups
+     */
+    static auto
+    SupportsDebugOutput() -> bool
+    {
+      return GLAD_GL_KHR_debug != 0 || GLAD_GL_VERSION_4_3 != 0;
+    }
+
+    /**
+     * @brief Names an OpenGL object for the debug output and graphics
+     * debuggers
+     *
+     * @param identifier The namespace of the object, e.g. GL_TEXTURE
+     * @param name The OpenGL name of the object
+     * @param label The label to show
+     */
+    static void
+    SetObjectLabel(GLenum identifier, GLuint name, std::string_view label)
+    {
+      if (name == 0 || label.empty() || !SupportsDebugOutput())
+      {
+        return;
+      }
+
+      glObjectLabel(identifier,
+                    name,
+                    static_cast<GLsizei>(label.size()),
+                    label.data());
+    }
+
+    /**
+     * @brief Whether the driver compiles shaders in the background and
+     * reports their completion status
+     *
+     * @return True if GL_KHR_parallel_shader_compile or its ARB variant is
+     * supported
+     */
+    static auto
+    SupportsParallelShaderCompile() -> bool
+    {
+      return GLAD_GL_KHR_parallel_shader_compile != 0 ||
+             GLAD_GL_ARB_parallel_shader_compile != 0;
+    }
+
+    static auto
+    GetShaderIncludePath() -> std::filesystem::path
+    {
+      return "data/engine/shaders/include/opengl";
+    }
+
     static auto
     GetDefaultShaderPath() -> std::filesystem::path
     {
@@ -139,4 +210,13 @@ namespace Dwarf
       return deviceInfo;
     }
   };
-}
\ No newline at end of file
+}
+
+// The arguments are not evaluated when the checks are disabled, so formatting
+// the function name costs nothing in release builds
+#ifdef DWARF_OPENGL_ERROR_CHECKS
+#define DWARF_CHECK_OPENGL_ERROR(functionName, scope, logger)                  \
+  ::Dwarf::OpenGLUtilities::CheckOpenGLError(functionName, scope, logger)
+#else
+#define DWARF_CHECK_OPENGL_ERROR(functionName, scope, logger) ((void)0)
+#endif
\ No newline at end of file
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+// Exposes XXH3_state_t, so hash states can live on the stack
+#ifndef XXH_STATIC_LINKING_ONLY
+#define XXH_STATIC_LINKING_ONLY
+#endif
+#include <xxhash.h>
+
+namespace Dwarf
+{
+  /// @brief 128 bit xxHash identifying a piece of content.
+  struct ContentHash
+  {
+    uint64_t High = 0;
+    uint64_t Low = 0;
+
+    /**
+     * @brief Hashes the given content
+     *
+     * @param content Content to hash
+     * @return The hash of the content
+     */
+    static auto
+    Compute(std::string_view content) -> ContentHash
+    {
+      XXH128_hash_t hash = XXH3_128bits(content.data(), content.size());
+      return { hash.high64, hash.low64 };
+    }
+
+    auto
+    operator==(const ContentHash& other) const -> bool = default;
+  };
+
+  /// @brief Builds a ContentHash from a sequence of parts without allocating.
+  class ContentHashBuilder
+  {
+  private:
+    XXH3_state_t mState;
+
+  public:
+    ContentHashBuilder() { XXH3_128bits_reset(&mState); }
+
+    /**
+     * @brief Appends a part of variable length. The part is prefixed with its
+     * length, so moving bytes between neighbouring parts changes the hash
+     *
+     * @param part Part to append
+     * @return The builder
+     */
+    auto
+    Add(std::string_view part) -> ContentHashBuilder&
+    {
+      uint64_t length = part.size();
+      XXH3_128bits_update(&mState, &length, sizeof(length));
+      XXH3_128bits_update(&mState, part.data(), part.size());
+      return *this;
+    }
+
+    /**
+     * @brief Appends the bytes of a fixed size value
+     *
+     * @param value Value to append
+     * @return The builder
+     */
+    template<typename T>
+    auto
+    AddValue(const T& value) -> ContentHashBuilder&
+    {
+      static_assert(std::is_trivially_copyable_v<T>);
+      XXH3_128bits_update(&mState, &value, sizeof(value));
+      return *this;
+    }
+
+    /**
+     * @brief Computes the hash of the parts appended so far
+     *
+     * @return The hash of the parts
+     */
+    [[nodiscard]] auto
+    GetHash() const -> ContentHash
+    {
+      XXH128_hash_t hash = XXH3_128bits_digest(&mState);
+      return { hash.high64, hash.low64 };
+    }
+  };
+
+  /// @brief Hash functor to use ContentHash as key of unordered containers.
+  struct ContentHashHasher
+  {
+    auto
+    operator()(const ContentHash& hash) const -> size_t
+    {
+      // Both halves are already uniformly distributed
+      return static_cast<size_t>(hash.Low);
+    }
+  };
+}
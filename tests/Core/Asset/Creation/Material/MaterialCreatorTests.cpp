@@ -25,6 +25,14 @@ public:
               (override));
   MOCK_METHOD(void, GenerateShaderParameters, (), (override));
   MOCK_METHOD(void, UpdateShader, (), (override));
+  MOCK_METHOD(const std::vector<std::string>&,
+              GetKeywords,
+              (),
+              (const, override));
+  MOCK_METHOD(void,
+              SetKeywords,
+              (std::vector<std::string> keywords),
+              (override));
   MOCK_METHOD(std::unique_ptr<IShaderAssetSourceContainer>&,
               GetShaderAssetSources,
               (),
@@ -0,0 +1,137 @@
+#include "Core/Asset/Shader/ShaderPreprocessor/ShaderPreprocessor.hpp"
+#include <gtest/gtest.h>
+#include <map>
+
+using namespace Dwarf;
+
+namespace
+{
+  class ShaderPreprocessorTest : public testing::Test
+  {
+  protected:
+    std::map<std::filesystem::path, std::string> mFiles;
+    std::vector<std::filesystem::path>           mIncludeDirectories = {
+      "engine/include"
+    };
+    int mReads = 0;
+
+    auto
+    Preprocess(std::string_view                source,
+               const std::vector<std::string>& keywords = {})
+      -> PreprocessedShaderSource
+    {
+      return ShaderPreprocessor::Preprocess(
+        source,
+        "shaders/test.frag",
+        keywords,
+        mIncludeDirectories,
+        [this](const std::filesystem::path& path) -> std::optional<std::string>
+        {
+          mReads++;
+          auto iterator = mFiles.find(path);
+          if (iterator == mFiles.end())
+          {
+            return std::nullopt;
+          }
+          return iterator->second;
+        });
+    }
+  };
+
+  auto
+  Contains(const std::string& text, std::string_view part) -> bool
+  {
+    return text.find(part) != std::string::npos;
+  }
+}
+
+TEST_F(ShaderPreprocessorTest, ResolvesIncludesRelativeToSourceFirst)
+{
+  mFiles["shaders/common.glsl"] = "float local();";
+  mFiles["engine/include/common.glsl"] = "float engine();";
+  mFiles["engine/include/lighting.glsl"] = "float lighting();";
+
+  PreprocessedShaderSource result = Preprocess(
+    "#version 450\n#include \"common.glsl\"\n#include <lighting.glsl>\n");
+
+  EXPECT_TRUE(result.Errors.empty());
+  EXPECT_TRUE(Contains(result.Source, "float local();"));
+  EXPECT_FALSE(Contains(result.Source, "float engine();"));
+  EXPECT_TRUE(Contains(result.Source, "float lighting();"));
+  EXPECT_FALSE(Contains(result.Source, "#include"));
+  ASSERT_EQ(result.IncludedFiles.size(), 2);
+  EXPECT_EQ(result.IncludedFiles[0], "shaders/common.glsl");
+  EXPECT_EQ(result.IncludedFiles[1], "engine/include/lighting.glsl");
+}
+
+TEST_F(ShaderPreprocessorTest, TracksNestedIncludesOnce)
+{
+  mFiles["engine/include/a.glsl"] = "#include \"b.glsl\"\nfloat a();";
+  mFiles["engine/include/b.glsl"] = "#include \"a.glsl\"\nfloat b();";
+
+  PreprocessedShaderSource result = Preprocess(
+    "#version 450\n#include \"a.glsl\"\n#include \"b.glsl\"\nvoid main(){}");
+
+  // The cycle and the second include of b.glsl are skipped
+  EXPECT_TRUE(result.Errors.empty());
+  ASSERT_EQ(result.IncludedFiles.size(), 2);
+  EXPECT_EQ(result.IncludedFiles[0], "engine/include/a.glsl");
+  EXPECT_EQ(result.IncludedFiles[1], "engine/include/b.glsl");
+  EXPECT_LT(result.Source.find("float b();"), result.Source.find("float a();"));
+  EXPECT_EQ(result.Source.find("float b();"),
+            result.Source.rfind("float b();"));
+}
+
+TEST_F(ShaderPreprocessorTest, KeepsLineNumbersWithLineDirectives)
+{
+  mFiles["engine/include/a.glsl"] = "float a();\nfloat a2();";
+
+  PreprocessedShaderSource result =
+    Preprocess("#version 450\n#include \"a.glsl\"\nvoid main(){}");
+
+  EXPECT_TRUE(Contains(result.Source,
+                       "#line 1 1\nfloat a();\nfloat a2();\n#line 3 0\n"
+                       "void main(){}"));
+}
+
+TEST_F(ShaderPreprocessorTest, ReportsUnresolvedIncludes)
+{
+  PreprocessedShaderSource result =
+    Preprocess("#version 450\n#include \"missing.glsl\"\n#include missing\n");
+
+  EXPECT_EQ(result.Errors.size(), 2);
+  EXPECT_TRUE(result.IncludedFiles.empty());
+}
+
+TEST_F(ShaderPreprocessorTest, DefinesDeclaredKeywordsAfterVersion)
+{
+  mFiles["engine/include/a.glsl"] = "#pragma keywords HAS_AO_MAP\n";
+
+  PreprocessedShaderSource result = Preprocess(
+    "#version 450 core\n"
+    "#pragma keywords HAS_ALBEDO_MAP HAS_NORMAL_MAP\n"
+    "#include \"a.glsl\"\n"
+    "void main(){}",
+    { "HAS_NORMAL_MAP", "HAS_AO_MAP", "UNDECLARED" });
+
+  EXPECT_EQ(result.DeclaredKeywords,
+            (std::vector<std::string>{
+              "HAS_ALBEDO_MAP", "HAS_NORMAL_MAP", "HAS_AO_MAP" }));
+  EXPECT_TRUE(result.Source.starts_with("#version 450 core\n"
+                                        "#define HAS_NORMAL_MAP\n"
+                                        "#define HAS_AO_MAP\n"
+                                        "#line 2 0\n"));
+  EXPECT_FALSE(Contains(result.Source, "HAS_ALBEDO_MAP"));
+  EXPECT_FALSE(Contains(result.Source, "UNDECLARED"));
+  EXPECT_FALSE(Contains(result.Source, "#pragma keywords"));
+}
+
+TEST_F(ShaderPreprocessorTest, LeavesSourcesWithoutDirectivesUntouched)
+{
+  std::string source = "#version 450\nvoid main(){}\n";
+
+  PreprocessedShaderSource result = Preprocess(source, { "HAS_NORMAL_MAP" });
+
+  EXPECT_EQ(result.Source, source);
+  EXPECT_EQ(mReads, 0);
+}
@@ -11,7 +11,18 @@ class MockShader : public IShader
 {
 public:
   MOCK_METHOD(void, Compile, (), (override));
+  MOCK_METHOD(void, SubmitCompilation, (), (override));
+  MOCK_METHOD(bool, PollCompilation, (), (override));
+  MOCK_METHOD(bool, IsCompiling, (), (const, override));
   MOCK_METHOD(bool, IsCompiled, (), (const, override));
+  MOCK_METHOD(const std::vector<std::string>&,
+              GetDeclaredKeywords,
+              (),
+              (const, override));
+  MOCK_METHOD(const std::vector<std::filesystem::path>&,
+              GetIncludedFiles,
+              (),
+              (const, override));
   MOCK_METHOD(void,
               SetParameter,
               (std::string identifier, Dwarf::ShaderParameterValue parameter),
@@ -56,11 +67,15 @@ TEST_F(ShaderRecompilerTest, MarkForRecompilation)
 
   // Verify the shader is marked for recompilation
   // Since mShadersToRecompile is private, we can't directly access it.
-  // We will verify it indirectly by calling Recompile and checking if Compile
-  // is called.
-  EXPECT_CALL(*mockShader, Compile()).Times(1);
+  // We will verify it indirectly by calling Recompile and checking if the
+  // compilation is submitted without waiting for it.
+  EXPECT_CALL(*mockShader, SubmitCompilation()).Times(1);
+  EXPECT_CALL(*mockShader, PollCompilation()).Times(0);
+  EXPECT_CALL(*mockShader, Compile()).Times(0);
 
   recompiler->Recompile();
+
+  EXPECT_EQ(recompiler->GetPendingCompilationCount(), 1);
 }
 
 TEST_F(ShaderRecompilerTest, Recompile)
@@ -73,15 +88,47 @@ TEST_F(ShaderRecompilerTest, Recompile)
   recompiler->MarkForRecompilation(mockShader2);
 
   // Set expectations
-  EXPECT_CALL(*mockShader1, Compile()).Times(1);
-  EXPECT_CALL(*mockShader2, Compile()).Times(1);
+  EXPECT_CALL(*mockShader1, SubmitCompilation()).Times(1);
+  EXPECT_CALL(*mockShader2, SubmitCompilation()).Times(1);
+  EXPECT_CALL(*mockShader1, PollCompilation()).WillOnce(Return(true));
+  EXPECT_CALL(*mockShader2, PollCompilation()).WillOnce(Return(true));
 
   // Call the method under test
   recompiler->Recompile();
 
-  // Verify that the shaders are recompiled and the list is cleared
-  // Since mShadersToRecompile is private, we can't directly access it.
+  // The next call finishes the compilations
+  recompiler->Recompile();
+
+  // Verify that the shaders are recompiled and the lists are cleared
+  // Since the lists are private, we can't directly access them.
   // We will verify it indirectly by calling Recompile again and checking if
-  // Compile is not called.
+  // the shaders are not submitted or polled again.
   recompiler->Recompile();
-}
\ No newline at end of file
+
+  EXPECT_EQ(recompiler->GetPendingCompilationCount(), 0);
+}
+
+TEST_F(ShaderRecompilerTest, PollsTrackedCompilationUntilFinished)
+{
+  auto mockShader = std::make_shared<MockShader>();
+
+  recompiler->TrackCompilation(mockShader);
+  EXPECT_EQ(recompiler->GetPendingCompilationCount(), 1);
+
+  // The driver needs three frames for the compilation
+  EXPECT_CALL(*mockShader, SubmitCompilation()).Times(0);
+  EXPECT_CALL(*mockShader, Compile()).Times(0);
+  EXPECT_CALL(*mockShader, PollCompilation())
+    .WillOnce(Return(false))
+    .WillOnce(Return(false))
+    .WillOnce(Return(true));
+
+  recompiler->Recompile();
+  recompiler->Recompile();
+  EXPECT_EQ(recompiler->GetPendingCompilationCount(), 1);
+
+  recompiler->Recompile();
+  EXPECT_EQ(recompiler->GetPendingCompilationCount(), 0);
+
+  recompiler->Recompile();
+}
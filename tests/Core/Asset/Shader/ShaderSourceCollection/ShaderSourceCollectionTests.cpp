@@ -53,4 +53,16 @@ TEST_F(ShaderSourceCollectionTest, GetShaderSources)
   // Verify the shader sources
   auto& sources = shaderSourceCollection.GetShaderSources();
   ASSERT_EQ(sources.size(), 2);
-}
\ No newline at end of file
+}
+
+TEST_F(ShaderSourceCollectionTest, SetKeywordsSortsAndRemovesDuplicates)
+{
+  ShaderSourceCollection shaderSourceCollection(shaderSources);
+  ASSERT_TRUE(shaderSourceCollection.GetKeywords().empty());
+
+  shaderSourceCollection.SetKeywords(
+    { "HAS_NORMAL_MAP", "HAS_ALBEDO_MAP", "HAS_NORMAL_MAP" });
+
+  EXPECT_EQ(shaderSourceCollection.GetKeywords(),
+            (std::vector<std::string>{ "HAS_ALBEDO_MAP", "HAS_NORMAL_MAP" }));
+}
@@ -0,0 +1,196 @@
+#include "Core/Rendering/DrawCall/DrawCallList/DrawCallList.hpp"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+
+using namespace Dwarf;
+using namespace testing;
+
+namespace
+{
+  class MockLogger : public IDwarfLogger
+  {
+  public:
+    MOCK_METHOD(void, LogDebug, (const Log logMessage), (const, override));
+    MOCK_METHOD(void, LogInfo, (const Log logMessage), (const, override));
+    MOCK_METHOD(void, LogWarn, (const Log logMessage), (const, override));
+    MOCK_METHOD(void, LogError, (const Log logMessage), (const, override));
+  };
+
+  /// @brief Records the threads the draw calls are released on.
+  struct ReleaseLog
+  {
+    std::mutex                   Mutex;
+    std::vector<std::thread::id> Threads;
+  };
+
+  class MockDrawCall : public IDrawCall
+  {
+  public:
+    explicit MockDrawCall(ReleaseLog& releaseLog)
+      : mReleaseLog(releaseLog)
+    {
+    }
+
+    ~MockDrawCall() override
+    {
+      std::lock_guard<std::mutex> lock(mReleaseLog.Mutex);
+      mReleaseLog.Threads.push_back(std::this_thread::get_id());
+    }
+
+    MOCK_METHOD(const IMeshBuffer*, GetMeshBuffer, (), (override));
+    MOCK_METHOD(void,
+                SetMeshBuffer,
+                (std::unique_ptr<IMeshBuffer> && meshBuffer),
+                (override));
+    MOCK_METHOD(MaterialAsset&, GetMaterialAsset, (), (override));
+    MOCK_METHOD(TransformComponent&, GetTransform, (), (override));
+    MOCK_METHOD(LodSelection&, GetLodSelection, (), (override));
+    MOCK_METHOD(const std::vector<Meshlet>&, GetMeshlets, (), (override));
+
+  private:
+    ReleaseLog& mReleaseLog;
+  };
+
+  class DrawCallListTests : public Test
+  {
+  protected:
+    ReleaseLog   mReleaseLog;
+    DrawCallList mDrawCallList =
+      DrawCallList(std::make_shared<NiceMock<MockLogger>>());
+
+    auto
+    CreateDrawCalls(size_t count) -> std::vector<std::shared_ptr<IDrawCall>>
+    {
+      std::vector<std::shared_ptr<IDrawCall>> drawCalls;
+      for (size_t index = 0; index < count; ++index)
+      {
+        drawCalls.push_back(std::make_shared<MockDrawCall>(mReleaseLog));
+      }
+      return drawCalls;
+    }
+
+    static auto
+    CreateStats(uint32_t vertexCount) -> DrawCallStatistics
+    {
+      DrawCallStatistics stats;
+      stats.VertexCount = vertexCount;
+      stats.TriangleCount = vertexCount / 3;
+      return stats;
+    }
+  };
+}
+
+TEST_F(DrawCallListTests, AcquiresTheLatestPublishedList)
+{
+  EXPECT_TRUE(mDrawCallList.AcquireDrawCalls().DrawCalls.empty());
+
+  mDrawCallList.SubmitDrawCalls(CreateDrawCalls(2), CreateStats(30));
+  mDrawCallList.SubmitDrawCalls(CreateDrawCalls(3), CreateStats(60));
+
+  // The statistics are the ones of the acquired list
+  EXPECT_EQ(0, mDrawCallList.GetStats().DrawCallCount);
+  const DrawCallListSnapshot& snapshot = mDrawCallList.AcquireDrawCalls();
+  EXPECT_EQ(3, snapshot.DrawCalls.size());
+  EXPECT_EQ(3, mDrawCallList.GetStats().DrawCallCount);
+  EXPECT_EQ(60, mDrawCallList.GetStats().VertexCount);
+  EXPECT_EQ(20, mDrawCallList.GetStats().TriangleCount);
+
+  // Nothing new was published
+  uint64_t version = snapshot.Version;
+  EXPECT_EQ(version, mDrawCallList.AcquireDrawCalls().Version);
+  EXPECT_EQ(3, mDrawCallList.AcquireDrawCalls().DrawCalls.size());
+
+  mDrawCallList.SubmitDrawCalls(CreateDrawCalls(1), CreateStats(3));
+  EXPECT_NE(version, mDrawCallList.AcquireDrawCalls().Version);
+  EXPECT_EQ(1, mDrawCallList.AcquireDrawCalls().DrawCalls.size());
+}
+
+TEST_F(DrawCallListTests, ClearDropsPublishedLists)
+{
+  mDrawCallList.SubmitDrawCalls(CreateDrawCalls(2), CreateStats(30));
+  uint64_t version = mDrawCallList.AcquireDrawCalls().Version;
+  mDrawCallList.SubmitDrawCalls(CreateDrawCalls(2), CreateStats(30));
+
+  mDrawCallList.Clear();
+  EXPECT_EQ(4, mReleaseLog.Threads.size());
+  EXPECT_EQ(0, mDrawCallList.GetStats().DrawCallCount);
+
+  const DrawCallListSnapshot& snapshot = mDrawCallList.AcquireDrawCalls();
+  EXPECT_TRUE(snapshot.DrawCalls.empty());
+  EXPECT_NE(version, snapshot.Version);
+}
+
+TEST_F(DrawCallListTests, ReleasesDrawCallsOnTheRenderThread)
+{
+  // Lists replaced by the worker before the render thread acquired them
+  auto submit = [this](uint32_t first, uint32_t last)
+  {
+    std::thread worker(
+      [this, first, last]()
+      {
+        for (uint32_t index = first; index < last; ++index)
+        {
+          mDrawCallList.SubmitDrawCalls(CreateDrawCalls(4),
+                                        CreateStats(index));
+        }
+      });
+    worker.join();
+  };
+
+  submit(0, 10);
+  EXPECT_TRUE(mReleaseLog.Threads.empty());
+  EXPECT_EQ(9, mDrawCallList.AcquireDrawCalls().Stats.VertexCount);
+  mDrawCallList.Clear();
+
+  // The lists left in the slot of the worker follow with its next list
+  submit(10, 11);
+  EXPECT_EQ(10, mDrawCallList.AcquireDrawCalls().Stats.VertexCount);
+  mDrawCallList.Clear();
+  ASSERT_EQ(44, mReleaseLog.Threads.size());
+  for (std::thread::id thread : mReleaseLog.Threads)
+  {
+    EXPECT_EQ(std::this_thread::get_id(), thread);
+  }
+}
+
+TEST_F(DrawCallListTests, RenderThreadSeesCompleteListsInOrder)
+{
+  constexpr uint32_t LIST_COUNT = 2000;
+
+  // Joined when leaving the test, also on a failed assertion
+  std::jthread worker(
+    [this]()
+    {
+      for (uint32_t index = 1; index <= LIST_COUNT; ++index)
+      {
+        mDrawCallList.SubmitDrawCalls(CreateDrawCalls(index % 8),
+                                      CreateStats(index));
+      }
+    });
+
+  uint32_t lastList = 0;
+  while (lastList < LIST_COUNT)
+  {
+    const DrawCallListSnapshot& snapshot = mDrawCallList.AcquireDrawCalls();
+    ASSERT_GE(snapshot.Stats.VertexCount, lastList);
+    ASSERT_EQ(snapshot.Stats.VertexCount % 8, snapshot.DrawCalls.size());
+    ASSERT_EQ(snapshot.DrawCalls.size(), snapshot.Stats.DrawCallCount);
+    lastList = snapshot.Stats.VertexCount;
+  }
+}
+TEST_F(DrawCallListTests, ReportsPendingListsUntilAcquired)
+{
+  EXPECT_FALSE(mDrawCallList.HasPendingDrawCalls());
+
+  mDrawCallList.SubmitDrawCalls(CreateDrawCalls(2), CreateStats(30));
+  EXPECT_TRUE(mDrawCallList.HasPendingDrawCalls());
+
+  mDrawCallList.AcquireDrawCalls();
+  EXPECT_FALSE(mDrawCallList.HasPendingDrawCalls());
+
+  mDrawCallList.SubmitDrawCalls(CreateDrawCalls(2), CreateStats(30));
+  mDrawCallList.Clear();
+  EXPECT_FALSE(mDrawCallList.HasPendingDrawCalls());
+}
@@ -0,0 +1,412 @@
+#include "Core/Rendering/IndirectDraw/IndirectDrawBuilder.hpp"
+#include "Core/Rendering/Material/IMaterial.hpp"
+#include "Core/Rendering/Shader/IShader.hpp"
+#include "Helper/RecordingIndirectDrawBackend.hpp"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace Dwarf;
+using namespace testing;
+
+namespace
+{
+  class MockMaterial : public IMaterial
+  {
+  public:
+    MOCK_METHOD(std::shared_ptr<IShader>, GetShader, (), (override));
+    MOCK_METHOD(const std::unique_ptr<IShaderParameterCollection>&,
+                GetShaderParameters,
+                (),
+                (const, override));
+    MOCK_METHOD(MaterialProperties&, GetMaterialProperties, (), (override));
+    MOCK_METHOD(void, GenerateShaderParameters, (), (override));
+    MOCK_METHOD(void, UpdateShader, (), (override));
+    MOCK_METHOD(const std::vector<std::string>&,
+                GetKeywords,
+                (),
+                (const, override));
+    MOCK_METHOD(void,
+                SetKeywords,
+                (std::vector<std::string> keywords),
+                (override));
+    MOCK_METHOD(std::unique_ptr<IShaderAssetSourceContainer>&,
+                GetShaderAssetSources,
+                (),
+                (override));
+    MOCK_METHOD(nlohmann::json, Serialize, (), (override));
+  };
+
+  class MockShader : public IShader
+  {
+  public:
+    MOCK_METHOD(void, Compile, (), (override));
+    MOCK_METHOD(void, SubmitCompilation, (), (override));
+    MOCK_METHOD(bool, PollCompilation, (), (override));
+    MOCK_METHOD(bool, IsCompiling, (), (const, override));
+    MOCK_METHOD(bool, IsCompiled, (), (const, override));
+    MOCK_METHOD(const std::vector<std::string>&,
+                GetDeclaredKeywords,
+                (),
+                (const, override));
+    MOCK_METHOD(const std::vector<std::filesystem::path>&,
+                GetIncludedFiles,
+                (),
+                (const, override));
+    MOCK_METHOD(void,
+                SetParameter,
+                (std::string identifier, ShaderParameterValue parameter),
+                (override));
+    MOCK_METHOD(void, RemoveParameter, (std::string identifier), (override));
+    MOCK_METHOD(std::unique_ptr<IShaderParameterCollection>,
+                CreateParameters,
+                (),
+                (override));
+
+    auto
+    operator<(const IShader& other) const -> bool override
+    {
+      return this < &other;
+    }
+  };
+
+  class MockCamera : public ICamera
+  {
+  public:
+    MOCK_METHOD(glm::mat4x4, GetViewMatrix, (), (const, override));
+    MOCK_METHOD(glm::mat4x4, GetProjectionMatrix, (), (const, override));
+    MOCK_METHOD(CameraProperties&, GetProperties, (), (override));
+    MOCK_METHOD(void, OnUpdate, (double deltaTime), (override));
+    MOCK_METHOD(glm::vec3,
+                ScreenToWorld,
+                (glm::vec2 const& screenPosition, glm::vec2 const& viewport),
+                (const, override));
+    MOCK_METHOD(nlohmann::json, Serialize, (), (override));
+  };
+
+  /// @brief Mesh buffer with a full detail level and one reduced level.
+  class FakeMeshBuffer : public IMeshBuffer
+  {
+  private:
+    uint32_t           mVertexCount;
+    uint32_t           mIndexCount;
+    IndexType          mIndexType;
+    VertexFormat       mFormat;
+    VertexQuantization mQuantization;
+
+  public:
+    FakeMeshBuffer(uint32_t     vertexCount,
+                   uint32_t     indexCount,
+                   IndexType    indexType = IndexType::UInt32,
+                   VertexFormat format = VertexFormat::Standard)
+      : mVertexCount(vertexCount)
+      , mIndexCount(indexCount)
+      , mIndexType(indexType)
+      , mFormat(format)
+    {
+    }
+
+    [[nodiscard]] auto
+    GetVertexCount() const -> uint32_t override
+    {
+      return mVertexCount;
+    }
+
+    [[nodiscard]] auto
+    GetIndexCount() const -> uint32_t override
+    {
+      return mIndexCount;
+    }
+
+    [[nodiscard]] auto
+    GetIndexType() const -> IndexType override
+    {
+      return mIndexType;
+    }
+
+    [[nodiscard]] auto
+    GetLodCount() const -> uint32_t override
+    {
+      return 2;
+    }
+
+    [[nodiscard]] auto
+    GetLodIndexRange(uint32_t lod) const -> IndexRange override
+    {
+      return lod == 0 ? IndexRange{ 0, mIndexCount }
+                      : IndexRange{ mIndexCount, mIndexCount / 2 };
+    }
+
+    [[nodiscard]] auto
+    GetVertexLayout() const -> const VertexLayout& override
+    {
+      return VertexLayout::Get(mFormat);
+    }
+
+    [[nodiscard]] auto
+    GetVertexQuantization() const -> const VertexQuantization& override
+    {
+      return mQuantization;
+    }
+  };
+
+  auto
+  CreateItem(IndirectMeshPlacement placement,
+             IndexRange            range,
+             IMaterial&            material,
+             IShader&              shader) -> IndirectDrawItem
+  {
+    IndirectDrawItem item;
+    item.Placement = placement;
+    item.Range = range;
+    item.Material = &material;
+    item.Shader = &shader;
+    return item;
+  }
+}
+
+class IndirectDrawBuilderTest : public ::testing::Test
+{
+protected:
+  // Arrays, so the addresses and therefore the sort order are known
+  std::array<NiceMock<MockMaterial>, 2> mMaterials;
+  std::array<NiceMock<MockShader>, 2>   mShaders;
+  NiceMock<MockCamera>                  mCamera;
+  RecordingIndirectDrawBackend          mBackend;
+  IndirectDrawBuilder                   mBuilder;
+};
+
+TEST_F(IndirectDrawBuilderTest, CommandsAddressTheArenas)
+{
+  FakeMeshBuffer first(100, 300);
+  FakeMeshBuffer second(50, 120);
+
+  IndirectMeshPlacement firstPlacement = mBackend.AddMesh(first).value();
+  IndirectMeshPlacement secondPlacement = mBackend.AddMesh(second).value();
+  EXPECT_EQ(firstPlacement.Arena, secondPlacement.Arena);
+  EXPECT_EQ(secondPlacement.FirstIndex, 450);
+  EXPECT_EQ(secondPlacement.BaseVertex, 100);
+
+  mBuilder.Add(CreateItem(firstPlacement,
+                          first.GetLodIndexRange(0),
+                          mMaterials[0],
+                          mShaders[0]));
+  mBuilder.Add(CreateItem(secondPlacement,
+                          second.GetLodIndexRange(1),
+                          mMaterials[0],
+                          mShaders[0]));
+  mBuilder.Build();
+
+  const std::vector<IndirectDrawCommand>& commands = mBuilder.GetCommands();
+  ASSERT_EQ(commands.size(), 2);
+
+  EXPECT_EQ(commands[0].Count, 300);
+  EXPECT_EQ(commands[0].InstanceCount, 1);
+  EXPECT_EQ(commands[0].FirstIndex, 0);
+  EXPECT_EQ(commands[0].BaseVertex, 0);
+  EXPECT_EQ(commands[0].BaseInstance, 0);
+
+  // The reduced level starts after the full detail indices of the mesh
+  EXPECT_EQ(commands[1].Count, 60);
+  EXPECT_EQ(commands[1].FirstIndex, 450 + 120);
+  EXPECT_EQ(commands[1].BaseVertex, 100);
+  EXPECT_EQ(commands[1].BaseInstance, 1);
+
+  ASSERT_EQ(mBuilder.GetBatches().size(), 1);
+  EXPECT_EQ(mBuilder.GetBatches()[0].CommandCount, 2);
+}
+
+TEST_F(IndirectDrawBuilderTest, MeshesWithDifferentFormatsUseSeparateArenas)
+{
+  FakeMeshBuffer standard(10, 30);
+  FakeMeshBuffer shortIndices(10, 30, IndexType::UInt16);
+  FakeMeshBuffer compact(10, 30, IndexType::UInt32, VertexFormat::Compact);
+
+  IndirectMeshPlacement standardPlacement = mBackend.AddMesh(standard).value();
+  IndirectMeshPlacement shortPlacement = mBackend.AddMesh(shortIndices).value();
+  IndirectMeshPlacement compactPlacement = mBackend.AddMesh(compact).value();
+
+  EXPECT_EQ(mBackend.Arenas.size(), 3);
+  EXPECT_NE(standardPlacement.Arena, shortPlacement.Arena);
+  EXPECT_NE(standardPlacement.Arena, compactPlacement.Arena);
+  EXPECT_EQ(shortPlacement.FirstIndex, 0);
+  EXPECT_EQ(compactPlacement.BaseVertex, 0);
+
+  mBuilder.Add(CreateItem(
+    compactPlacement, { 0, 30 }, mMaterials[0], mShaders[0]));
+  mBuilder.Add(CreateItem(
+    standardPlacement, { 0, 30 }, mMaterials[0], mShaders[0]));
+  mBuilder.Build();
+
+  // Same material, but one multi draw per arena
+  const std::vector<IndirectDrawBatch>& batches = mBuilder.GetBatches();
+  ASSERT_EQ(batches.size(), 2);
+  EXPECT_EQ(batches[0].Arena, standardPlacement.Arena);
+  EXPECT_EQ(batches[1].Arena, compactPlacement.Arena);
+}
+
+TEST_F(IndirectDrawBuilderTest, DrawsAreBatchedByShaderAndMaterial)
+{
+  IndirectMeshPlacement placement;
+
+  mBuilder.Add(CreateItem(placement, { 0, 3 }, mMaterials[1], mShaders[1]));
+  mBuilder.Add(CreateItem(placement, { 3, 3 }, mMaterials[0], mShaders[0]));
+  mBuilder.Add(CreateItem(placement, { 6, 3 }, mMaterials[1], mShaders[0]));
+  mBuilder.Add(CreateItem(placement, { 9, 3 }, mMaterials[0], mShaders[0]));
+  mBuilder.Build();
+
+  const std::vector<IndirectDrawBatch>& batches = mBuilder.GetBatches();
+  ASSERT_EQ(batches.size(), 3);
+
+  EXPECT_EQ(batches[0].Shader, &mShaders[0]);
+  EXPECT_EQ(batches[0].Material, &mMaterials[0]);
+  EXPECT_EQ(batches[0].FirstCommand, 0);
+  EXPECT_EQ(batches[0].CommandCount, 2);
+
+  EXPECT_EQ(batches[1].Shader, &mShaders[0]);
+  EXPECT_EQ(batches[1].Material, &mMaterials[1]);
+  EXPECT_EQ(batches[1].FirstCommand, 2);
+  EXPECT_EQ(batches[1].CommandCount, 1);
+
+  EXPECT_EQ(batches[2].Shader, &mShaders[1]);
+  EXPECT_EQ(batches[2].Material, &mMaterials[1]);
+  EXPECT_EQ(batches[2].FirstCommand, 3);
+  EXPECT_EQ(batches[2].CommandCount, 1);
+
+  // Draws of a batch keep the order they were added in
+  const std::vector<IndirectDrawCommand>& commands = mBuilder.GetCommands();
+  ASSERT_EQ(commands.size(), 4);
+  EXPECT_EQ(commands[0].FirstIndex, 3);
+  EXPECT_EQ(commands[1].FirstIndex, 9);
+  EXPECT_EQ(commands[2].FirstIndex, 6);
+  EXPECT_EQ(commands[3].FirstIndex, 0);
+}
+
+TEST_F(IndirectDrawBuilderTest, DrawDataHoldsTransformAndMaterialIndex)
+{
+  IndirectMeshPlacement placement;
+
+  IndirectDrawItem first =
+    CreateItem(placement, { 0, 3 }, mMaterials[0], mShaders[0]);
+  first.ModelMatrix = glm::translate(glm::mat4(1.0F), glm::vec3(1, 2, 3));
+  first.Quantization.Scale = glm::vec3(2.0F);
+  first.Quantization.Offset = glm::vec3(-1.0F);
+  first.VertexCompression = true;
+
+  IndirectDrawItem second =
+    CreateItem(placement, { 0, 3 }, mMaterials[1], mShaders[0]);
+  IndirectDrawItem third =
+    CreateItem(placement, { 0, 3 }, mMaterials[0], mShaders[0]);
+
+  mBuilder.Add(first);
+  mBuilder.Add(second);
+  mBuilder.Add(third);
+  mBuilder.Build();
+
+  const std::vector<IndirectDrawData>& drawData = mBuilder.GetDrawData();
+  ASSERT_EQ(drawData.size(), 3);
+
+  EXPECT_EQ(drawData[0].ModelMatrix[3], glm::vec4(1, 2, 3, 1));
+  EXPECT_EQ(drawData[0].PositionScale, glm::vec4(2, 2, 2, 0));
+  EXPECT_EQ(drawData[0].PositionOffset, glm::vec4(-1, -1, -1, 0));
+  EXPECT_EQ(drawData[0].VertexCompression, 1);
+  EXPECT_EQ(drawData[1].VertexCompression, 0);
+
+  // Draws of the same material share the index
+  EXPECT_EQ(drawData[0].MaterialIndex, 0);
+  EXPECT_EQ(drawData[1].MaterialIndex, 0);
+  EXPECT_EQ(drawData[2].MaterialIndex, 1);
+}
+
+TEST_F(IndirectDrawBuilderTest, MaterialIndicesArePerShader)
+{
+  IndirectMeshPlacement placement;
+
+  mBuilder.Add(CreateItem(placement, { 0, 3 }, mMaterials[1], mShaders[1]));
+  mBuilder.Add(CreateItem(placement, { 0, 3 }, mMaterials[0], mShaders[0]));
+  mBuilder.Add(CreateItem(placement, { 0, 3 }, mMaterials[1], mShaders[0]));
+  mBuilder.Build();
+
+  // Every shader has its own material buffer, so the indices restart at 0
+  const std::vector<IndirectDrawData>& drawData = mBuilder.GetDrawData();
+  ASSERT_EQ(drawData.size(), 3);
+  EXPECT_EQ(drawData[0].MaterialIndex, 0);
+  EXPECT_EQ(drawData[1].MaterialIndex, 1);
+  EXPECT_EQ(drawData[2].MaterialIndex, 0);
+
+  const std::vector<IndirectMaterialSet>& sets = mBuilder.GetMaterialSets();
+  ASSERT_EQ(sets.size(), 2);
+  EXPECT_EQ(sets[0].Shader, &mShaders[0]);
+  EXPECT_THAT(sets[0].Materials, ElementsAre(&mMaterials[0], &mMaterials[1]));
+  EXPECT_EQ(sets[1].Shader, &mShaders[1]);
+  EXPECT_THAT(sets[1].Materials, ElementsAre(&mMaterials[1]));
+}
+
+TEST_F(IndirectDrawBuilderTest, SubmitUploadsTheMaterialsOfEveryShader)
+{
+  IndirectMeshPlacement placement;
+
+  mBuilder.Add(CreateItem(placement, { 0, 3 }, mMaterials[0], mShaders[0]));
+  mBuilder.Add(CreateItem(placement, { 3, 3 }, mMaterials[1], mShaders[1]));
+  mBuilder.Add(CreateItem(placement, { 6, 3 }, mMaterials[1], mShaders[0]));
+  mBuilder.Build();
+  mBuilder.Submit(mBackend, mCamera);
+
+  ASSERT_EQ(mBackend.UploadedMaterials.size(), 2);
+  EXPECT_EQ(mBackend.UploadedMaterials[0].Shader, &mShaders[0]);
+  EXPECT_THAT(mBackend.UploadedMaterials[0].Materials,
+              ElementsAre(&mMaterials[0], &mMaterials[1]));
+  EXPECT_EQ(mBackend.UploadedMaterials[1].Shader, &mShaders[1]);
+  EXPECT_THAT(mBackend.UploadedMaterials[1].Materials,
+              ElementsAre(&mMaterials[1]));
+}
+
+TEST_F(IndirectDrawBuilderTest, SubmitUploadsOnceAndDrawsEveryBatch)
+{
+  IndirectMeshPlacement placement;
+
+  mBuilder.Add(CreateItem(placement, { 0, 3 }, mMaterials[0], mShaders[0]));
+  mBuilder.Add(CreateItem(placement, { 3, 6 }, mMaterials[1], mShaders[0]));
+  mBuilder.Add(CreateItem(placement, { 9, 3 }, mMaterials[0], mShaders[0]));
+  mBuilder.Build();
+  mBuilder.Submit(mBackend, mCamera);
+
+  EXPECT_EQ(mBackend.UploadCount, 1);
+  EXPECT_EQ(mBackend.UploadedCommands.size(), 3);
+  EXPECT_EQ(mBackend.UploadedDrawData.size(), 3);
+
+  ASSERT_EQ(mBackend.Draws.size(), 2);
+  EXPECT_EQ(mBackend.Draws[0].Batch.Material, &mMaterials[0]);
+  EXPECT_EQ(mBackend.Draws[0].Batch.CommandCount, 2);
+  EXPECT_EQ(mBackend.Draws[0].Camera, &mCamera);
+  EXPECT_EQ(mBackend.Draws[1].Batch.Material, &mMaterials[1]);
+  EXPECT_EQ(mBackend.Draws[1].Batch.FirstCommand, 2);
+}
+
+TEST_F(IndirectDrawBuilderTest, EmptyFrameSubmitsNothing)
+{
+  mBuilder.Build();
+  mBuilder.Submit(mBackend, mCamera);
+
+  EXPECT_EQ(mBackend.UploadCount, 0);
+  EXPECT_TRUE(mBackend.Draws.empty());
+  EXPECT_TRUE(mBackend.UploadedMaterials.empty());
+}
+
+TEST_F(IndirectDrawBuilderTest, ClearRemovesPreviousDraws)
+{
+  IndirectMeshPlacement placement;
+
+  mBuilder.Add(CreateItem(placement, { 0, 3 }, mMaterials[0], mShaders[0]));
+  mBuilder.Build();
+  mBuilder.Clear();
+
+  EXPECT_EQ(mBuilder.GetDrawCount(), 0);
+  EXPECT_TRUE(mBuilder.GetCommands().empty());
+  EXPECT_TRUE(mBuilder.GetBatches().empty());
+
+  mBuilder.Add(CreateItem(placement, { 3, 3 }, mMaterials[1], mShaders[1]));
+  mBuilder.Build();
+  ASSERT_EQ(mBuilder.GetCommands().size(), 1);
+  EXPECT_EQ(mBuilder.GetCommands()[0].FirstIndex, 3);
+  EXPECT_EQ(mBuilder.GetDrawData()[0].MaterialIndex, 0);
+}
@@ -26,6 +26,11 @@ public:
               GetParameter,
               (const std::string& name),
               (override));
+  MOCK_METHOD(const Dwarf::MaterialParameterValue*,
+              FindParameter,
+              (const std::string& name),
+              (const, override));
+  MOCK_METHOD(uint64_t, GetVersion, (), (const, override));
   MOCK_METHOD(const std::vector<std::string>,
               GetParameterIdentifiers,
               (),
@@ -64,6 +69,19 @@ public:
               GetOrCreate,
               (std::unique_ptr<Dwarf::IShaderSourceCollection> shaderSources),
               (override));
+  MOCK_METHOD(size_t, ReleaseUnused, (), (override));
+  MOCK_METHOD(size_t, GetProgramCount, (), (const, override));
+  MOCK_METHOD(size_t,
+              RecompileIncluding,
+              (const std::filesystem::path& includePath),
+              (override));
+  MOCK_METHOD(void, AddMaterial, (Dwarf::IMaterial & material), (override));
+  MOCK_METHOD(void, RemoveMaterial, (Dwarf::IMaterial & material), (override));
+  MOCK_METHOD(size_t,
+              ReloadShaderAsset,
+              (const Dwarf::UUID& shaderAsset),
+              (override));
+  MOCK_METHOD(size_t, PatchReloadedMaterials, (), (override));
 };
 
 class MockIShaderAssetSourceContainer
@@ -165,6 +183,60 @@ TEST(MaterialTests, MaterialSerialization)
   // ASSERT_TRUE(serialized.contains("ShaderParameters"));
 }
 
+// Testing if keywords are normalized, select a new variant and are serialized
+TEST(MaterialTests, KeywordSelection)
+{
+  std::shared_ptr<MockIShaderRegistry> shaderRegistry =
+    std::make_shared<MockIShaderRegistry>();
+
+  std::unique_ptr<MockIShaderAssetSourceContainer> shaderSourceCollection =
+    std::make_unique<MockIShaderAssetSourceContainer>();
+  auto shaderParameters = std::make_unique<MockIShaderParameterCollection>();
+
+  EXPECT_CALL(*shaderRegistry, GetOrCreate(testing::_)).Times(2);
+
+  Dwarf::Material material(Dwarf::MaterialProperties(),
+                           std::move(shaderParameters),
+                           std::move(shaderSourceCollection),
+                           shaderRegistry,
+                           { "HAS_NORMAL_MAP", "HAS_ALBEDO_MAP" });
+  ASSERT_EQ(material.GetKeywords(),
+            std::vector<std::string>({ "HAS_ALBEDO_MAP", "HAS_NORMAL_MAP" }));
+
+  // Selecting the same keywords keeps the variant
+  material.SetKeywords(
+    { "HAS_ALBEDO_MAP", "HAS_NORMAL_MAP", "HAS_ALBEDO_MAP" });
+  material.SetKeywords({ "HAS_AO_MAP" });
+  ASSERT_EQ(material.GetKeywords(), std::vector<std::string>({ "HAS_AO_MAP" }));
+
+  auto serialized = material.Serialize();
+  ASSERT_TRUE(serialized.contains("Keywords"));
+  ASSERT_EQ(serialized["Keywords"].get<std::vector<std::string>>(),
+            std::vector<std::string>({ "HAS_AO_MAP" }));
+}
+
+// Testing if the keyword reserved for the indirect draw path is never stored
+TEST(MaterialTests, DropsReservedKeywords)
+{
+  std::shared_ptr<MockIShaderRegistry> shaderRegistry =
+    std::make_shared<MockIShaderRegistry>();
+
+  std::unique_ptr<MockIShaderAssetSourceContainer> shaderSourceCollection =
+    std::make_unique<MockIShaderAssetSourceContainer>();
+  auto shaderParameters = std::make_unique<MockIShaderParameterCollection>();
+
+  Dwarf::Material material(Dwarf::MaterialProperties(),
+                           std::move(shaderParameters),
+                           std::move(shaderSourceCollection),
+                           shaderRegistry,
+                           { "DWARF_INDIRECT_DRAW", "HAS_ALBEDO_MAP" });
+  ASSERT_EQ(material.GetKeywords(),
+            std::vector<std::string>({ "HAS_ALBEDO_MAP" }));
+
+  material.SetKeywords({ "HAS_AO_MAP", "DWARF_INDIRECT_DRAW" });
+  ASSERT_EQ(material.GetKeywords(), std::vector<std::string>({ "HAS_AO_MAP" }));
+}
+
 // TEST(MaterialTests, ShaderInitializationWithProperties)
 // {
 //   auto            shader = std::make_shared<MockIShader>();
@@ -0,0 +1,163 @@
+#include "Core/Rendering/Mesh/ClusterCuller/ClusterCuller.hpp"
+#include "Core/Rendering/Mesh/MeshletBuilder/MeshletBuilder.hpp"
+#include "Helper/MeshHelper.hpp"
+#include <gtest/gtest.h>
+
+using namespace Dwarf;
+using namespace MeshHelper;
+
+namespace
+{
+  auto
+  CreateFrustum(glm::vec3 eye, glm::vec3 target) -> CullingFrustum
+  {
+    glm::mat4 projection =
+      glm::perspective(glm::radians(60.0F), 1.0F, 0.1F, 100.0F);
+    glm::mat4 view = glm::lookAt(eye, target, glm::vec3(0, 0, 1));
+    return ClusterCuller::CreateFrustum(projection * view, eye);
+  }
+
+  auto
+  CountIndices(const std::vector<IndexRange>& ranges) -> uint32_t
+  {
+    uint32_t count = 0;
+    for (const IndexRange& range : ranges)
+    {
+      count += range.Count;
+    }
+    return count;
+  }
+}
+
+TEST(ClusterCullerTests, FrustumPlanesContainTarget)
+{
+  CullingFrustum frustum = CreateFrustum(glm::vec3(0, 10, 0), glm::vec3(0));
+
+  auto inside = [&](glm::vec3 point)
+  {
+    return std::ranges::all_of(
+      frustum.Planes,
+      [&](const glm::vec4& plane)
+      { return glm::dot(glm::vec3(plane), point) + plane.w >= 0.0F; });
+  };
+
+  for (const glm::vec4& plane : frustum.Planes)
+  {
+    EXPECT_NEAR(glm::length(glm::vec3(plane)), 1.0F, 1e-5F);
+  }
+  EXPECT_TRUE(inside(glm::vec3(0)));
+  EXPECT_FALSE(inside(glm::vec3(0, 20, 0)));
+  EXPECT_FALSE(inside(glm::vec3(50, 0, 0)));
+  EXPECT_FALSE(inside(glm::vec3(0, -200, 0)));
+}
+
+TEST(ClusterCullerTests, KeepsVisibleClusters)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateCenteredGrid(16, vertices, indices);
+  std::vector<Meshlet> meshlets = MeshletBuilder::Build(vertices, indices);
+
+  std::vector<IndexRange>  ranges;
+  ClusterCullingStatistics stats =
+    ClusterCuller::Cull(meshlets,
+                        glm::mat4(1.0F),
+                        CreateFrustum(glm::vec3(0, 50, 0), glm::vec3(0)),
+                        ranges);
+
+  EXPECT_EQ(stats.VisibleMeshlets, meshlets.size());
+  // Consecutive clusters are merged into a single range
+  ASSERT_EQ(ranges.size(), 1);
+  EXPECT_EQ(ranges[0].Offset, 0);
+  EXPECT_EQ(ranges[0].Count, indices.size());
+}
+
+TEST(ClusterCullerTests, CullsBackfacingClusters)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateCenteredGrid(16, vertices, indices);
+  std::vector<Meshlet> meshlets = MeshletBuilder::Build(vertices, indices);
+
+  std::vector<IndexRange>  ranges;
+  ClusterCullingStatistics stats =
+    ClusterCuller::Cull(meshlets,
+                        glm::mat4(1.0F),
+                        CreateFrustum(glm::vec3(0, -50, 0), glm::vec3(0)),
+                        ranges);
+
+  EXPECT_EQ(stats.VisibleMeshlets, 0);
+  EXPECT_EQ(stats.BackfaceCulled, meshlets.size());
+  EXPECT_TRUE(ranges.empty());
+}
+
+TEST(ClusterCullerTests, KeepsBackfacingClustersWithoutBackfaceCulling)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateCenteredGrid(16, vertices, indices);
+  std::vector<Meshlet> meshlets = MeshletBuilder::Build(vertices, indices);
+
+  // Double sided materials show the back faces
+  std::vector<IndexRange>  ranges;
+  ClusterCullingStatistics stats =
+    ClusterCuller::Cull(meshlets,
+                        glm::mat4(1.0F),
+                        CreateFrustum(glm::vec3(0, -50, 0), glm::vec3(0)),
+                        ranges,
+                        false);
+
+  EXPECT_EQ(stats.VisibleMeshlets, meshlets.size());
+  EXPECT_EQ(stats.BackfaceCulled, 0);
+  ASSERT_EQ(ranges.size(), 1);
+  EXPECT_EQ(ranges[0].Count, indices.size());
+}
+
+TEST(ClusterCullerTests, CullsClustersOutsideTheFrustum)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateCenteredGrid(64, vertices, indices);
+  std::vector<Meshlet> meshlets = MeshletBuilder::Build(vertices, indices);
+
+  // Looking down at a corner of the grid from close by
+  std::vector<IndexRange>  ranges;
+  ClusterCullingStatistics stats =
+    ClusterCuller::Cull(meshlets,
+                        glm::mat4(1.0F),
+                        CreateFrustum(glm::vec3(-28, 4, -28),
+                                      glm::vec3(-28, 0, -28.01F)),
+                        ranges);
+
+  EXPECT_GT(stats.VisibleMeshlets, 0);
+  EXPECT_GT(stats.FrustumCulled, 0);
+  EXPECT_EQ(stats.VisibleMeshlets + stats.FrustumCulled + stats.BackfaceCulled,
+            meshlets.size());
+  EXPECT_LT(CountIndices(ranges), indices.size());
+
+  for (size_t i = 1; i < ranges.size(); i++)
+  {
+    EXPECT_GT(ranges[i].Offset, ranges[i - 1].Offset + ranges[i - 1].Count);
+  }
+}
+
+TEST(ClusterCullerTests, AppliesModelMatrix)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateCenteredGrid(16, vertices, indices);
+  std::vector<Meshlet> meshlets = MeshletBuilder::Build(vertices, indices);
+  CullingFrustum frustum = CreateFrustum(glm::vec3(0, 50, 0), glm::vec3(0));
+
+  std::vector<IndexRange> ranges;
+  glm::mat4 behind = glm::translate(glm::mat4(1.0F), glm::vec3(0, 100, 0));
+  EXPECT_EQ(ClusterCuller::Cull(meshlets, behind, frustum, ranges)
+              .FrustumCulled,
+            meshlets.size());
+
+  // A non uniform scale disables the cone test instead of culling wrongly
+  glm::mat4 flipped = glm::scale(glm::mat4(1.0F), glm::vec3(1, -2, 1));
+  EXPECT_EQ(ClusterCuller::Cull(meshlets, flipped, frustum, ranges)
+              .VisibleMeshlets,
+            meshlets.size());
+}
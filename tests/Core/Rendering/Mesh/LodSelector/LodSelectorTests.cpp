@@ -0,0 +1,65 @@
+#include "Core/Rendering/Mesh/LodSelector/LodSelector.hpp"
+#include <gtest/gtest.h>
+
+using namespace Dwarf;
+
+TEST(LodSelectorTests, CreateSelectionComputesBounds)
+{
+  std::vector<Vertex> vertices = {
+    { glm::vec3(-1, 0, 0), glm::vec3(0, 1, 0), glm::vec2(0) },
+    { glm::vec3(3, 0, 0), glm::vec3(0, 1, 0), glm::vec2(0) },
+    { glm::vec3(1, 2, 0), glm::vec3(0, 1, 0), glm::vec2(0) }
+  };
+  std::vector<MeshLod> lods(2);
+  lods[0].ScreenSize = 0.5F;
+  lods[1].ScreenSize = 0.25F;
+
+  LodSelection selection = LodSelector::CreateSelection(vertices, lods);
+
+  EXPECT_FLOAT_EQ(selection.BoundsCenter.x, 1.0F);
+  EXPECT_FLOAT_EQ(selection.BoundsCenter.y, 1.0F);
+  EXPECT_FLOAT_EQ(selection.BoundsRadius, std::sqrt(5.0F));
+  ASSERT_EQ(selection.ScreenSizes.size(), 2);
+  EXPECT_FLOAT_EQ(selection.ScreenSizes[1], 0.25F);
+  EXPECT_EQ(selection.CurrentLod, 0);
+}
+
+TEST(LodSelectorTests, ScreenSizeShrinksWithDistance)
+{
+  const float fov = 1.5707964F; // 90 degrees
+  float       near = LodSelector::ProjectedScreenSize(
+    glm::vec3(0, 0, -10), 1.0F, glm::vec3(0), fov);
+  float far = LodSelector::ProjectedScreenSize(
+    glm::vec3(0, 0, -20), 1.0F, glm::vec3(0), fov);
+
+  EXPECT_NEAR(near, 0.1F, 1e-5F);
+  EXPECT_NEAR(far, near * 0.5F, 1e-5F);
+  EXPECT_GT(LodSelector::ProjectedScreenSize(
+              glm::vec3(0), 1.0F, glm::vec3(0.5F, 0, 0), fov),
+            1.0F);
+}
+
+TEST(LodSelectorTests, SelectsLevelByScreenSize)
+{
+  const std::vector<float> thresholds = { 0.5F, 0.25F, 0.125F };
+
+  EXPECT_EQ(LodSelector::SelectLod(1.0F, thresholds, 0), 0);
+  EXPECT_EQ(LodSelector::SelectLod(0.3F, thresholds, 0), 1);
+  EXPECT_EQ(LodSelector::SelectLod(0.2F, thresholds, 0), 2);
+  EXPECT_EQ(LodSelector::SelectLod(0.01F, thresholds, 0), 3);
+  EXPECT_EQ(LodSelector::SelectLod(1.0F, thresholds, 3), 0);
+  EXPECT_EQ(LodSelector::SelectLod(0.01F, {}, 2), 0);
+}
+
+TEST(LodSelectorTests, HysteresisPreventsFlickering)
+{
+  const std::vector<float> thresholds = { 0.5F };
+
+  // Slightly below the threshold keeps full detail
+  EXPECT_EQ(LodSelector::SelectLod(0.48F, thresholds, 0, 0.1F), 0);
+  EXPECT_EQ(LodSelector::SelectLod(0.44F, thresholds, 0, 0.1F), 1);
+
+  // Slightly above the threshold keeps the reduced level
+  EXPECT_EQ(LodSelector::SelectLod(0.52F, thresholds, 1, 0.1F), 1);
+  EXPECT_EQ(LodSelector::SelectLod(0.56F, thresholds, 1, 0.1F), 0);
+}
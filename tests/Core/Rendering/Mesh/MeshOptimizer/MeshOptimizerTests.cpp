@@ -0,0 +1,227 @@
+#include "Core/Rendering/Mesh/MeshOptimizer/MeshOptimizer.hpp"
+#include <algorithm>
+#include <array>
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace Dwarf;
+
+namespace
+{
+  constexpr uint32_t GRID_SIZE = 32;
+
+  // Builds a flat grid of GRID_SIZE x GRID_SIZE quads with the triangle order
+  // shuffled to simulate an unoptimized index buffer.
+  void
+  CreateShuffledGrid(std::vector<Vertex>&   vertices,
+                     std::vector<uint32_t>& indices)
+  {
+    for (uint32_t y = 0; y <= GRID_SIZE; y++)
+    {
+      for (uint32_t x = 0; x <= GRID_SIZE; x++)
+      {
+        vertices.emplace_back(
+          glm::vec3(x, 0, y), glm::vec3(0, 1, 0), glm::vec2(0));
+      }
+    }
+
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (uint32_t y = 0; y < GRID_SIZE; y++)
+    {
+      for (uint32_t x = 0; x < GRID_SIZE; x++)
+      {
+        uint32_t i0 = (y * (GRID_SIZE + 1)) + x;
+        uint32_t i1 = i0 + 1;
+        uint32_t i2 = i0 + GRID_SIZE + 1;
+        uint32_t i3 = i2 + 1;
+        triangles.push_back({ i0, i2, i1 });
+        triangles.push_back({ i1, i2, i3 });
+      }
+    }
+
+    std::mt19937 rng(1337);
+    std::ranges::shuffle(triangles, rng);
+
+    for (const auto& triangle : triangles)
+    {
+      indices.insert(indices.end(), triangle.begin(), triangle.end());
+    }
+  }
+
+  // Returns the triangles of an index buffer in a canonical form (rotated so
+  // the smallest index comes first, winding preserved) for comparisons.
+  auto
+  CanonicalTriangles(const std::vector<uint32_t>& indices,
+                     const std::vector<Vertex>&   vertices)
+    -> std::vector<std::array<float, 9>>
+  {
+    std::vector<std::array<float, 9>> result;
+    for (size_t i = 0; i < indices.size(); i += 3)
+    {
+      std::array<uint32_t, 3> tri = {
+        indices[i], indices[i + 1], indices[i + 2]
+      };
+      auto minIt = std::ranges::min_element(
+        tri,
+        [&](uint32_t a, uint32_t b)
+        {
+          const glm::vec3& pa = vertices[a].Position;
+          const glm::vec3& pb = vertices[b].Position;
+          return std::tie(pa.x, pa.y, pa.z) < std::tie(pb.x, pb.y, pb.z);
+        });
+      std::ranges::rotate(tri, minIt);
+
+      std::array<float, 9> entry{};
+      for (size_t c = 0; c < 3; c++)
+      {
+        entry[(c * 3) + 0] = vertices[tri[c]].Position.x;
+        entry[(c * 3) + 1] = vertices[tri[c]].Position.y;
+        entry[(c * 3) + 2] = vertices[tri[c]].Position.z;
+      }
+      result.push_back(entry);
+    }
+    std::ranges::sort(result);
+    return result;
+  }
+}
+
+TEST(MeshOptimizerTests, AnalyzeSingleTriangle)
+{
+  std::vector<uint32_t> indices = { 0, 1, 2 };
+
+  VertexCacheStatistics stats = MeshOptimizer::AnalyzeVertexCache(indices, 3);
+
+  EXPECT_EQ(stats.VerticesTransformed, 3);
+  EXPECT_FLOAT_EQ(stats.Acmr, 3.0F);
+  EXPECT_FLOAT_EQ(stats.Atvr, 1.0F);
+}
+
+TEST(MeshOptimizerTests, AnalyzeCacheEviction)
+{
+  // Two triangles sharing an edge, cache too small to keep the shared
+  // vertices around
+  std::vector<uint32_t> indices = { 0, 1, 2, 2, 1, 3 };
+
+  VertexCacheStatistics large =
+    MeshOptimizer::AnalyzeVertexCache(indices, 4, 16);
+  VertexCacheStatistics small =
+    MeshOptimizer::AnalyzeVertexCache(indices, 4, 1);
+
+  EXPECT_EQ(large.VerticesTransformed, 4);
+  EXPECT_FLOAT_EQ(large.Acmr, 2.0F);
+  EXPECT_EQ(small.VerticesTransformed, 5);
+  EXPECT_FLOAT_EQ(small.Atvr, 1.25F);
+}
+
+TEST(MeshOptimizerTests, VertexCacheImprovesAcmr)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateShuffledGrid(vertices, indices);
+  auto expected = CanonicalTriangles(indices, vertices);
+
+  VertexCacheStatistics before =
+    MeshOptimizer::AnalyzeVertexCache(indices, vertices.size());
+  MeshOptimizer::OptimizeVertexCache(indices, vertices.size());
+  VertexCacheStatistics after =
+    MeshOptimizer::AnalyzeVertexCache(indices, vertices.size());
+
+  EXPECT_LT(after.Acmr, before.Acmr);
+  EXPECT_LT(after.Acmr, 1.0F);
+  EXPECT_EQ(CanonicalTriangles(indices, vertices), expected);
+}
+
+TEST(MeshOptimizerTests, OverdrawKeepsTrianglesAndCacheEfficiency)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateShuffledGrid(vertices, indices);
+  auto expected = CanonicalTriangles(indices, vertices);
+
+  VertexCacheStatistics before =
+    MeshOptimizer::AnalyzeVertexCache(indices, vertices.size());
+  MeshOptimizer::OptimizeOverdraw(indices, vertices);
+  VertexCacheStatistics after =
+    MeshOptimizer::AnalyzeVertexCache(indices, vertices.size());
+
+  EXPECT_LT(after.Acmr, before.Acmr);
+  EXPECT_EQ(CanonicalTriangles(indices, vertices), expected);
+}
+
+TEST(MeshOptimizerTests, VertexFetchOrdersByFirstUse)
+{
+  std::vector<Vertex> vertices;
+  for (int i = 0; i < 5; i++)
+  {
+    vertices.emplace_back(glm::vec3(i, 0, 0), glm::vec3(0, 1, 0), glm::vec2(0));
+  }
+  // Vertex 0 is unreferenced
+  std::vector<uint32_t> indices = { 4, 2, 3, 3, 2, 1 };
+
+  MeshOptimizer::OptimizeVertexFetch(indices, vertices);
+
+  ASSERT_EQ(vertices.size(), 4);
+  EXPECT_EQ(indices, (std::vector<uint32_t>{ 0, 1, 2, 2, 1, 3 }));
+  EXPECT_FLOAT_EQ(vertices[0].Position.x, 4.0F);
+  EXPECT_FLOAT_EQ(vertices[1].Position.x, 2.0F);
+  EXPECT_FLOAT_EQ(vertices[2].Position.x, 3.0F);
+  EXPECT_FLOAT_EQ(vertices[3].Position.x, 1.0F);
+}
+
+TEST(MeshOptimizerTests, SplitByVertexLimitKeepsGeometry)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateShuffledGrid(vertices, indices);
+
+  const size_t           maxVertices = 100;
+  std::vector<MeshChunk> chunks =
+    MeshOptimizer::SplitByVertexLimit(vertices, indices, maxVertices);
+
+  ASSERT_GT(chunks.size(), 1);
+
+  std::vector<std::array<glm::vec3, 3>> original;
+  for (size_t i = 0; i < indices.size(); i += 3)
+  {
+    original.push_back({ vertices[indices[i]].Position,
+                         vertices[indices[i + 1]].Position,
+                         vertices[indices[i + 2]].Position });
+  }
+
+  // Triangles stay in order and reference the same positions
+  size_t triangle = 0;
+  for (const MeshChunk& chunk : chunks)
+  {
+    EXPECT_LE(chunk.Vertices.size(), maxVertices);
+    for (size_t i = 0; i < chunk.Indices.size(); i += 3)
+    {
+      for (size_t corner = 0; corner < 3; corner++)
+      {
+        ASSERT_LT(chunk.Indices[i + corner], chunk.Vertices.size());
+        EXPECT_EQ(chunk.Vertices[chunk.Indices[i + corner]].Position,
+                  original[triangle][corner]);
+      }
+      triangle++;
+    }
+  }
+  EXPECT_EQ(triangle, original.size());
+}
+
+TEST(MeshOptimizerTests, PartialTrianglesAreTrimmed)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateShuffledGrid(vertices, indices);
+  auto expected = CanonicalTriangles(indices, vertices);
+
+  // A stray line primitive at the end of the index buffer
+  std::vector<uint32_t> cacheIndices = indices;
+  cacheIndices.insert(cacheIndices.end(), { 0, 1 });
+  MeshOptimizer::OptimizeVertexCache(cacheIndices, vertices.size());
+  EXPECT_EQ(CanonicalTriangles(cacheIndices, vertices), expected);
+
+  std::vector<uint32_t> overdrawIndices = indices;
+  overdrawIndices.push_back(0);
+  MeshOptimizer::OptimizeOverdraw(overdrawIndices, vertices);
+  EXPECT_EQ(CanonicalTriangles(overdrawIndices, vertices), expected);
+}
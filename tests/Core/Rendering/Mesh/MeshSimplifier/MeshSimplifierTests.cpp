@@ -0,0 +1,252 @@
+#include "Core/Rendering/Mesh/MeshSimplifier/MeshSimplifier.hpp"
+#include <gtest/gtest.h>
+#include <map>
+
+using namespace Dwarf;
+
+namespace
+{
+  // Builds a closed unit icosphere without seams.
+  void
+  CreateIcosphere(int                    subdivisions,
+                  std::vector<Vertex>&   vertices,
+                  std::vector<uint32_t>& indices)
+  {
+    const float t = (1.0F + std::sqrt(5.0F)) / 2.0F;
+    const std::vector<glm::vec3> corners = {
+      { -1, t, 0 }, { 1, t, 0 }, { -1, -t, 0 }, { 1, -t, 0 },
+      { 0, -1, t }, { 0, 1, t }, { 0, -1, -t }, { 0, 1, -t },
+      { t, 0, -1 }, { t, 0, 1 }, { -t, 0, -1 }, { -t, 0, 1 }
+    };
+
+    for (const glm::vec3& corner : corners)
+    {
+      glm::vec3 position = glm::normalize(corner);
+      vertices.emplace_back(position, position, glm::vec2(0));
+    }
+
+    indices = { 0, 11, 5,  0, 5,  1, 0,  1, 7, 0,  7,  10, 0, 10, 11,
+                1, 5,  9,  5, 11, 4, 11, 10, 2, 10, 7,  6,  7, 1,  8,
+                3, 9,  4,  3, 4,  2, 3,  2,  6, 3,  6,  8,  3, 8,  9,
+                4, 9,  5,  2, 4,  11, 6, 2, 10, 8,  6,  7,  9, 8,  1 };
+
+    for (int level = 0; level < subdivisions; level++)
+    {
+      std::map<std::pair<uint32_t, uint32_t>, uint32_t> midpoints;
+      auto midpoint = [&](uint32_t a, uint32_t b) -> uint32_t
+      {
+        auto key = std::minmax(a, b);
+        if (auto it = midpoints.find(key); it != midpoints.end())
+        {
+          return it->second;
+        }
+        glm::vec3 position = glm::normalize(
+          (vertices[a].Position + vertices[b].Position) * 0.5F);
+        vertices.emplace_back(position, position, glm::vec2(0));
+        auto index = static_cast<uint32_t>(vertices.size() - 1);
+        midpoints[key] = index;
+        return index;
+      };
+
+      std::vector<uint32_t> subdivided;
+      for (size_t i = 0; i < indices.size(); i += 3)
+      {
+        uint32_t a = indices[i];
+        uint32_t b = indices[i + 1];
+        uint32_t c = indices[i + 2];
+        uint32_t ab = midpoint(a, b);
+        uint32_t bc = midpoint(b, c);
+        uint32_t ca = midpoint(c, a);
+        subdivided.insert(subdivided.end(),
+                          { a, ab, ca, b, bc, ab, c, ca, bc, ab, bc, ca });
+      }
+      indices = std::move(subdivided);
+    }
+  }
+
+  auto
+  PointTriangleDistance(glm::vec3 p, glm::vec3 a, glm::vec3 b, glm::vec3 c)
+    -> float
+  {
+    // Closest point on triangle (Ericson, Real-Time Collision Detection)
+    glm::vec3 ab = b - a;
+    glm::vec3 ac = c - a;
+    glm::vec3 ap = p - a;
+    float     d1 = glm::dot(ab, ap);
+    float     d2 = glm::dot(ac, ap);
+    if (d1 <= 0.0F && d2 <= 0.0F) return glm::distance(p, a);
+
+    glm::vec3 bp = p - b;
+    float     d3 = glm::dot(ab, bp);
+    float     d4 = glm::dot(ac, bp);
+    if (d3 >= 0.0F && d4 <= d3) return glm::distance(p, b);
+
+    float vc = (d1 * d4) - (d3 * d2);
+    if (vc <= 0.0F && d1 >= 0.0F && d3 <= 0.0F)
+    {
+      return glm::distance(p, a + ab * (d1 / (d1 - d3)));
+    }
+
+    glm::vec3 cp = p - c;
+    float     d5 = glm::dot(ab, cp);
+    float     d6 = glm::dot(ac, cp);
+    if (d6 >= 0.0F && d5 <= d6) return glm::distance(p, c);
+
+    float vb = (d5 * d2) - (d1 * d6);
+    if (vb <= 0.0F && d2 >= 0.0F && d6 <= 0.0F)
+    {
+      return glm::distance(p, a + ac * (d2 / (d2 - d6)));
+    }
+
+    float va = (d3 * d6) - (d5 * d4);
+    if (va <= 0.0F && (d4 - d3) >= 0.0F && (d5 - d6) >= 0.0F)
+    {
+      float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+      return glm::distance(p, b + (c - b) * w);
+    }
+
+    float denom = 1.0F / (va + vb + vc);
+    return glm::distance(p, a + ab * (vb * denom) + ac * (vc * denom));
+  }
+
+  // Largest distance of any source vertex to the simplified surface.
+  auto
+  MaxDeviation(const std::vector<Vertex>&   vertices,
+               const std::vector<uint32_t>& simplified) -> float
+  {
+    float maxDistance = 0.0F;
+    for (const Vertex& vertex : vertices)
+    {
+      float closest = std::numeric_limits<float>::max();
+      for (size_t i = 0; i < simplified.size(); i += 3)
+      {
+        closest = std::min(
+          closest,
+          PointTriangleDistance(vertex.Position,
+                                vertices[simplified[i]].Position,
+                                vertices[simplified[i + 1]].Position,
+                                vertices[simplified[i + 2]].Position));
+      }
+      maxDistance = std::max(maxDistance, closest);
+    }
+    return maxDistance;
+  }
+}
+
+TEST(MeshSimplifierTests, ReachesTargetIndexCount)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateIcosphere(3, vertices, indices);
+
+  size_t target = indices.size() / 4;
+  float  error = 0.0F;
+  std::vector<uint32_t> simplified =
+    MeshSimplifier::Simplify(vertices, indices, target, 1.0F, &error);
+
+  EXPECT_LE(simplified.size(), target);
+  EXPECT_GT(simplified.size(), 0);
+  EXPECT_EQ(simplified.size() % 3, 0);
+  for (uint32_t index : simplified)
+  {
+    EXPECT_LT(index, vertices.size());
+  }
+}
+
+TEST(MeshSimplifierTests, RespectsErrorBound)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateIcosphere(3, vertices, indices);
+
+  const float targetError = 0.05F;
+  float       error = 0.0F;
+  std::vector<uint32_t> simplified =
+    MeshSimplifier::Simplify(vertices, indices, 0, targetError, &error);
+
+  // The error limit stops the simplification before reaching the target
+  EXPECT_LT(simplified.size(), indices.size() / 2);
+  EXPECT_GT(simplified.size(), 0);
+  EXPECT_LE(error, targetError);
+  EXPECT_LE(MaxDeviation(vertices, simplified), targetError * 2.0F);
+}
+
+TEST(MeshSimplifierTests, ErrorGrowsWithReduction)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateIcosphere(3, vertices, indices);
+
+  float coarseError = 0.0F;
+  float fineError = 0.0F;
+  std::vector<uint32_t> fine = MeshSimplifier::Simplify(
+    vertices, indices, indices.size() / 2, 1.0F, &fineError);
+  std::vector<uint32_t> coarse = MeshSimplifier::Simplify(
+    vertices, indices, indices.size() / 8, 1.0F, &coarseError);
+
+  EXPECT_LT(coarse.size(), fine.size());
+  EXPECT_LE(fineError, coarseError);
+  EXPECT_LE(MaxDeviation(vertices, fine), MaxDeviation(vertices, coarse));
+}
+
+TEST(MeshSimplifierTests, FlatGridSimplifiesWithoutError)
+{
+  constexpr uint32_t  size = 16;
+  std::vector<Vertex> vertices;
+  for (uint32_t y = 0; y <= size; y++)
+  {
+    for (uint32_t x = 0; x <= size; x++)
+    {
+      vertices.emplace_back(
+        glm::vec3(x, 0, y), glm::vec3(0, 1, 0), glm::vec2(0));
+    }
+  }
+
+  std::vector<uint32_t> indices;
+  for (uint32_t y = 0; y < size; y++)
+  {
+    for (uint32_t x = 0; x < size; x++)
+    {
+      uint32_t i0 = (y * (size + 1)) + x;
+      uint32_t i2 = i0 + size + 1;
+      indices.insert(indices.end(), { i0, i2, i0 + 1, i0 + 1, i2, i2 + 1 });
+    }
+  }
+
+  float                 error = 1.0F;
+  std::vector<uint32_t> simplified =
+    MeshSimplifier::Simplify(vertices, indices, 0, 1e-4F, &error);
+
+  EXPECT_LT(simplified.size(), indices.size() / 4);
+  EXPECT_NEAR(error, 0.0F, 1e-4F);
+
+  // Border vertices are locked, so the covered area stays the same
+  float area = 0.0F;
+  for (size_t i = 0; i < simplified.size(); i += 3)
+  {
+    glm::vec3 a = vertices[simplified[i]].Position;
+    glm::vec3 b = vertices[simplified[i + 1]].Position;
+    glm::vec3 c = vertices[simplified[i + 2]].Position;
+    glm::vec3 normal = glm::cross(b - a, c - a);
+    EXPECT_GT(glm::dot(normal, glm::vec3(0, 1, 0)), 0.0F);
+    area += glm::length(normal) * 0.5F;
+  }
+  EXPECT_NEAR(area, static_cast<float>(size * size), 1e-3F);
+}
+
+TEST(MeshSimplifierTests, PartialTrianglesAreTrimmed)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateIcosphere(2, vertices, indices);
+  indices.insert(indices.end(), { 0, 1 });
+
+  std::vector<uint32_t> simplified =
+    MeshSimplifier::Simplify(vertices, indices, indices.size() / 2, 1.0F);
+  EXPECT_EQ(simplified.size() % 3, 0);
+
+  // Below the target nothing is simplified, only the stray indices dropped
+  std::vector<uint32_t> unchanged =
+    MeshSimplifier::Simplify(vertices, indices, indices.size(), 1.0F);
+  EXPECT_EQ(unchanged.size(), indices.size() - 2);
+}
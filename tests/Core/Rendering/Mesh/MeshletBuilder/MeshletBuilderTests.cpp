@@ -0,0 +1,106 @@
+#include "Core/Rendering/Mesh/MeshletBuilder/MeshletBuilder.hpp"
+#include "Helper/MeshHelper.hpp"
+#include <gtest/gtest.h>
+#include <set>
+
+using namespace Dwarf;
+using namespace MeshHelper;
+
+TEST(MeshletBuilderTests, RespectsLimitsAndCoversAllTriangles)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateGrid(32, vertices, indices);
+
+  std::vector<Meshlet> meshlets = MeshletBuilder::Build(vertices, indices);
+
+  ASSERT_FALSE(meshlets.empty());
+  uint32_t expectedOffset = 0;
+  for (const Meshlet& meshlet : meshlets)
+  {
+    EXPECT_EQ(meshlet.IndexOffset, expectedOffset);
+    EXPECT_EQ(meshlet.IndexCount % 3, 0);
+    EXPECT_LE(meshlet.IndexCount / 3, MeshletBuilder::MAX_TRIANGLES);
+    EXPECT_LE(meshlet.VertexCount, MeshletBuilder::MAX_VERTICES);
+
+    std::set<uint32_t> unique(indices.begin() + meshlet.IndexOffset,
+                              indices.begin() + meshlet.IndexOffset +
+                                meshlet.IndexCount);
+    EXPECT_EQ(unique.size(), meshlet.VertexCount);
+
+    expectedOffset += meshlet.IndexCount;
+  }
+  EXPECT_EQ(expectedOffset, indices.size());
+}
+
+TEST(MeshletBuilderTests, SmallLimitsSplitMore)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateGrid(16, vertices, indices);
+
+  std::vector<Meshlet> small = MeshletBuilder::Build(vertices, indices, 8, 4);
+  std::vector<Meshlet> large = MeshletBuilder::Build(vertices, indices);
+
+  EXPECT_GT(small.size(), large.size());
+  for (const Meshlet& meshlet : small)
+  {
+    EXPECT_LE(meshlet.VertexCount, 8);
+    EXPECT_LE(meshlet.IndexCount / 3, 4);
+  }
+}
+
+TEST(MeshletBuilderTests, BoundsContainVerticesAndConeFacesNormal)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateGrid(16, vertices, indices);
+
+  for (const Meshlet& meshlet : MeshletBuilder::Build(vertices, indices))
+  {
+    for (uint32_t i = 0; i < meshlet.IndexCount; i++)
+    {
+      glm::vec3 position = vertices[indices[meshlet.IndexOffset + i]].Position;
+      EXPECT_LE(glm::distance(position, meshlet.Center),
+                meshlet.Radius + 1e-4F);
+    }
+
+    // A flat cluster has a zero width cone along the surface normal
+    EXPECT_NEAR(glm::dot(meshlet.ConeAxis, glm::vec3(0, 1, 0)), 1.0F, 1e-5F);
+    EXPECT_NEAR(meshlet.ConeCutoff, 0.0F, 1e-3F);
+  }
+}
+
+TEST(MeshletBuilderTests, OpposingTrianglesDisableConeCulling)
+{
+  std::vector<Vertex> vertices = {
+    Vertex(glm::vec3(0, 0, 0), glm::vec3(0, 1, 0), glm::vec2(0)),
+    Vertex(glm::vec3(0, 0, 1), glm::vec3(0, 1, 0), glm::vec2(0)),
+    Vertex(glm::vec3(1, 0, 0), glm::vec3(0, 1, 0), glm::vec2(0))
+  };
+  std::vector<uint32_t> indices = { 0, 1, 2, 0, 2, 1 };
+
+  std::vector<Meshlet> meshlets = MeshletBuilder::Build(vertices, indices);
+
+  ASSERT_EQ(meshlets.size(), 1);
+  EXPECT_EQ(meshlets[0].VertexCount, 3);
+  EXPECT_EQ(meshlets[0].ConeCutoff, 1.0F);
+}
+
+TEST(MeshletBuilderTests, PartialTrianglesAreIgnored)
+{
+  std::vector<Vertex>   vertices;
+  std::vector<uint32_t> indices;
+  CreateGrid(4, vertices, indices);
+  size_t triangleIndices = indices.size();
+  indices.insert(indices.end(), { 0, 1 });
+
+  std::vector<Meshlet> meshlets = MeshletBuilder::Build(vertices, indices);
+
+  uint32_t indexCount = 0;
+  for (const Meshlet& meshlet : meshlets)
+  {
+    indexCount += meshlet.IndexCount;
+  }
+  EXPECT_EQ(indexCount, triangleIndices);
+}
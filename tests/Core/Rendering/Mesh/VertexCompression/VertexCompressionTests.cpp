@@ -0,0 +1,75 @@
+#include "Core/Rendering/Mesh/VertexCompression/VertexCompression.hpp"
+#include <gtest/gtest.h>
+
+using namespace Dwarf;
+
+TEST(VertexCompressionTests, CompactVertexIsTwentyBytes)
+{
+  EXPECT_EQ(sizeof(CompactVertex), 20);
+  EXPECT_EQ(VertexLayout::Get(VertexFormat::Compact).Stride, 20);
+  EXPECT_EQ(VertexLayout::Get(VertexFormat::Standard).Stride, sizeof(Vertex));
+}
+
+TEST(VertexCompressionTests, OctEncodingRoundTrip)
+{
+  const std::vector<glm::vec3> directions = {
+    { 1, 0, 0 },   { 0, 1, 0 },   { 0, 0, 1 },  { 0, 0, -1 },
+    { 1, 1, 1 },   { -1, 2, -3 }, { 0.3F, -0.2F, -0.9F }
+  };
+
+  for (const glm::vec3& direction : directions)
+  {
+    glm::vec3 normalized = glm::normalize(direction);
+    glm::vec2 encoded = VertexCompression::OctEncode(normalized);
+    glm::vec3 decoded = VertexCompression::OctDecode(encoded);
+
+    EXPECT_LE(std::abs(encoded.x), 1.0F);
+    EXPECT_LE(std::abs(encoded.y), 1.0F);
+    EXPECT_NEAR(glm::dot(decoded, normalized), 1.0F, 1e-5F);
+  }
+}
+
+TEST(VertexCompressionTests, CompressRoundTripWithinPrecision)
+{
+  std::vector<Vertex> vertices = {
+    Vertex(glm::vec3(-10.0F, 0.5F, 3.0F),
+           glm::normalize(glm::vec3(0.0F, 1.0F, 0.2F)),
+           glm::vec3(1, 0, 0),
+           glm::normalize(glm::vec3(0.0F, 0.2F, -1.0F)),
+           glm::vec2(0.25F, 0.75F)),
+    Vertex(glm::vec3(20.0F, -4.0F, 3.0F),
+           glm::vec3(0, 0, -1),
+           glm::vec3(0, 1, 0),
+           glm::vec3(-1, 0, 0),
+           glm::vec2(1.0F, 0.0F)),
+    Vertex(glm::vec3(5.0F, 8.0F, 3.0F),
+           glm::vec3(0, 1, 0),
+           glm::vec3(1, 0, 0),
+           glm::vec3(0, 0, 1),
+           glm::vec2(3.5F, -2.0F))
+  };
+
+  VertexQuantization quantization =
+    VertexCompression::ComputeQuantization(vertices);
+  std::vector<CompactVertex> compressed =
+    VertexCompression::Compress(vertices, quantization);
+
+  ASSERT_EQ(compressed.size(), vertices.size());
+
+  // snorm16 over a 30 unit extent
+  const float positionTolerance = 30.0F / 32767.0F;
+
+  for (size_t i = 0; i < vertices.size(); i++)
+  {
+    Vertex decoded = VertexCompression::Decompress(compressed[i], quantization);
+
+    EXPECT_NEAR(decoded.Position.x, vertices[i].Position.x, positionTolerance);
+    EXPECT_NEAR(decoded.Position.y, vertices[i].Position.y, positionTolerance);
+    EXPECT_NEAR(decoded.Position.z, vertices[i].Position.z, positionTolerance);
+    EXPECT_GT(glm::dot(decoded.Normal, vertices[i].Normal), 0.9999F);
+    EXPECT_GT(glm::dot(decoded.Tangent, vertices[i].Tangent), 0.9999F);
+    EXPECT_GT(glm::dot(decoded.BiTangent, vertices[i].BiTangent), 0.999F);
+    EXPECT_NEAR(decoded.UV.x, vertices[i].UV.x, 1e-3F);
+    EXPECT_NEAR(decoded.UV.y, vertices[i].UV.y, 1e-3F);
+  }
+}
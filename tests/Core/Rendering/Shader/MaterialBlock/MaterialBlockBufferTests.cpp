@@ -0,0 +1,240 @@
+#include "Core/Rendering/Material/IMaterial.hpp"
+#include "Core/Rendering/Shader/MaterialBlock/MaterialBlockBuffer.hpp"
+#include "Core/Rendering/Shader/ShaderParameterCollection/ShaderParameterCollection.hpp"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace Dwarf;
+using namespace testing;
+
+namespace
+{
+  class MockMaterial : public IMaterial
+  {
+  public:
+    MOCK_METHOD(std::shared_ptr<IShader>, GetShader, (), (override));
+    MOCK_METHOD(const std::unique_ptr<IShaderParameterCollection>&,
+                GetShaderParameters,
+                (),
+                (const, override));
+    MOCK_METHOD(MaterialProperties&, GetMaterialProperties, (), (override));
+    MOCK_METHOD(void, GenerateShaderParameters, (), (override));
+    MOCK_METHOD(void, UpdateShader, (), (override));
+    MOCK_METHOD(const std::vector<std::string>&,
+                GetKeywords,
+                (),
+                (const, override));
+    MOCK_METHOD(void,
+                SetKeywords,
+                (std::vector<std::string> keywords),
+                (override));
+    MOCK_METHOD(std::unique_ptr<IShaderAssetSourceContainer>&,
+                GetShaderAssetSources,
+                (),
+                (override));
+    MOCK_METHOD(nlohmann::json, Serialize, (), (override));
+  };
+
+  class MockShaderParameterCollection : public IShaderParameterCollection
+  {
+  public:
+    MOCK_METHOD(void,
+                SetParameter,
+                (std::string_view identifier, MaterialParameterValue parameter),
+                (override));
+    MOCK_METHOD(MaterialParameterValue&,
+                GetParameter,
+                (const std::string& name),
+                (override));
+    MOCK_METHOD(const MaterialParameterValue*,
+                FindParameter,
+                (const std::string& name),
+                (const, override));
+    MOCK_METHOD(uint64_t, GetVersion, (), (const, override));
+    MOCK_METHOD(const std::vector<std::string>,
+                GetParameterIdentifiers,
+                (),
+                (const, override));
+    MOCK_METHOD(void,
+                PatchParameters,
+                (const std::unique_ptr<IShaderParameterCollection>& parameters),
+                (override));
+    MOCK_METHOD(void, RemoveParameter, (const std::string& name), (override));
+    MOCK_METHOD(bool,
+                HasParameter,
+                (const std::string& name),
+                (const, override));
+    MOCK_METHOD(void, ClearParameters, (), (override));
+    MOCK_METHOD(nlohmann::json, Serialize, (), (override));
+  };
+
+  /// @brief std430 layout of a block with a vec4, two floats, a bool, an
+  /// unsigned integer and a mat3, as a driver would report it.
+  auto
+  CreateLayout() -> MaterialBlockLayout
+  {
+    MaterialBlockLayout layout;
+    layout.Members = { { "tint", ShaderParameterType::VEC4, 0 },
+                       { "metalness", ShaderParameterType::FLOAT, 16 },
+                       { "roughness", ShaderParameterType::FLOAT, 20 },
+                       { "useFog", ShaderParameterType::BOOLEAN, 24 },
+                       { "mode", ShaderParameterType::UNSIGNED_INTEGER, 28 },
+                       { "uvTransform", ShaderParameterType::MAT3, 32 } };
+    layout.Stride = 80;
+    return layout;
+  }
+
+  template<typename T>
+  auto
+  Read(std::span<const std::byte> data, size_t offset) -> T
+  {
+    T value;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    return value;
+  }
+}
+
+class MaterialBlockBufferTest : public ::testing::Test
+{
+protected:
+  std::array<NiceMock<MockMaterial>, 2>                       mMaterials;
+  std::array<std::unique_ptr<IShaderParameterCollection>, 2> mParameters;
+
+  void
+  SetUp() override
+  {
+    for (size_t i = 0; i < mMaterials.size(); i++)
+    {
+      mParameters[i] = std::make_unique<ShaderParameterCollection>();
+      mParameters[i]->SetParameter("tint", glm::vec4(1.0F));
+      mParameters[i]->SetParameter("metalness", 0.0F);
+      mParameters[i]->SetParameter("roughness", 0.5F);
+      ON_CALL(mMaterials[i], GetShaderParameters())
+        .WillByDefault(ReturnRef(mParameters[i]));
+    }
+  }
+
+  auto
+  GetMaterials() -> std::vector<IMaterial*>
+  {
+    return { &mMaterials[0], &mMaterials[1] };
+  }
+};
+
+TEST_F(MaterialBlockBufferTest, PacksParametersAtTheReflectedOffsets)
+{
+  MaterialBlockLayout layout = CreateLayout();
+  mParameters[0]->SetParameter("tint", glm::vec4(0.1F, 0.2F, 0.3F, 0.4F));
+  mParameters[0]->SetParameter("metalness", 0.75F);
+  mParameters[0]->SetParameter("useFog", true);
+  mParameters[0]->SetParameter("mode", 7U);
+  mParameters[0]->SetParameter("uvTransform", glm::mat3(2.0F));
+
+  std::vector<std::byte> block(layout.Stride, std::byte{ 0xFF });
+  MaterialBlockBuffer::Pack(layout, *mParameters[0], block);
+
+  EXPECT_EQ(Read<glm::vec4>(block, 0), glm::vec4(0.1F, 0.2F, 0.3F, 0.4F));
+  EXPECT_EQ(Read<float>(block, 16), 0.75F);
+  EXPECT_EQ(Read<float>(block, 20), 0.5F);
+  EXPECT_EQ(Read<uint32_t>(block, 24), 1);
+  EXPECT_EQ(Read<uint32_t>(block, 28), 7);
+
+  // The columns of a mat3 are aligned to 16 bytes
+  EXPECT_EQ(Read<float>(block, 32), 2.0F);
+  EXPECT_EQ(Read<float>(block, 36), 0.0F);
+  EXPECT_EQ(Read<float>(block, 52), 2.0F);
+  EXPECT_EQ(Read<float>(block, 72), 2.0F);
+}
+
+TEST_F(MaterialBlockBufferTest, MissingAndMismatchedParametersAreZeroed)
+{
+  MaterialBlockLayout layout = CreateLayout();
+  mParameters[0]->SetParameter("metalness", 3);
+
+  std::vector<std::byte> block(layout.Stride, std::byte{ 0xFF });
+  MaterialBlockBuffer::Pack(layout, *mParameters[0], block);
+
+  EXPECT_EQ(Read<float>(block, 16), 0.0F);
+  EXPECT_EQ(Read<uint32_t>(block, 24), 0);
+  EXPECT_EQ(Read<uint32_t>(block, 28), 0);
+  EXPECT_EQ(Read<float>(block, 32), 0.0F);
+}
+
+TEST_F(MaterialBlockBufferTest, FirstUpdateUploadsAllMaterials)
+{
+  MaterialBlockBuffer     buffer(CreateLayout());
+  std::vector<IMaterial*> materials = GetMaterials();
+
+  std::optional<MaterialBlockRange> changed = buffer.Update(materials);
+
+  ASSERT_TRUE(changed.has_value());
+  EXPECT_EQ(changed->Offset, 0);
+  EXPECT_EQ(changed->Size, 160);
+  EXPECT_EQ(buffer.GetData().size(), 160);
+  EXPECT_EQ(Read<float>(buffer.GetData(), 80 + 20), 0.5F);
+}
+
+TEST_F(MaterialBlockBufferTest, UnchangedMaterialsAreNotUploadedAgain)
+{
+  MaterialBlockBuffer     buffer(CreateLayout());
+  std::vector<IMaterial*> materials = GetMaterials();
+  buffer.Update(materials);
+
+  EXPECT_FALSE(buffer.Update(materials).has_value());
+}
+
+TEST_F(MaterialBlockBufferTest, MaterialsWithAnUnchangedVersionAreNotPacked)
+{
+  auto parameters = std::make_unique<NiceMock<MockShaderParameterCollection>>();
+  MockShaderParameterCollection& mockParameters = *parameters;
+  ON_CALL(mockParameters, GetVersion()).WillByDefault(Return(42));
+  mParameters[0] = std::move(parameters);
+
+  MaterialBlockBuffer     buffer(CreateLayout());
+  std::vector<IMaterial*> materials = GetMaterials();
+  buffer.Update(materials);
+
+  EXPECT_CALL(mockParameters, FindParameter(_)).Times(0);
+  EXPECT_FALSE(buffer.Update(materials).has_value());
+}
+
+TEST_F(MaterialBlockBufferTest, ReadingParametersKeepsTheBufferUnchanged)
+{
+  MaterialBlockBuffer     buffer(CreateLayout());
+  std::vector<IMaterial*> materials = GetMaterials();
+  buffer.Update(materials);
+
+  // The mutable accessor changes the version without changing the value
+  mParameters[1]->GetParameter("roughness");
+
+  EXPECT_FALSE(buffer.Update(materials).has_value());
+}
+
+TEST_F(MaterialBlockBufferTest, OnlyTheChangedMaterialIsUploaded)
+{
+  MaterialBlockBuffer     buffer(CreateLayout());
+  std::vector<IMaterial*> materials = GetMaterials();
+  buffer.Update(materials);
+
+  // Edited in place, the way the material inspector changes values
+  std::get<float>(mParameters[1]->GetParameter("roughness")) = 0.25F;
+  std::optional<MaterialBlockRange> changed = buffer.Update(materials);
+
+  ASSERT_TRUE(changed.has_value());
+  EXPECT_EQ(changed->Offset, 80);
+  EXPECT_EQ(changed->Size, 80);
+  EXPECT_EQ(Read<float>(buffer.GetData(), 80 + 20), 0.25F);
+}
+
+TEST_F(MaterialBlockBufferTest, AddedMaterialsAreUploaded)
+{
+  MaterialBlockBuffer     buffer(CreateLayout());
+  std::vector<IMaterial*> materials = GetMaterials();
+  buffer.Update(std::span(materials).first(1));
+
+  std::optional<MaterialBlockRange> changed = buffer.Update(materials);
+
+  ASSERT_TRUE(changed.has_value());
+  EXPECT_EQ(changed->Offset, 80);
+  EXPECT_EQ(changed->Size, 80);
+}
@@ -0,0 +1,185 @@
+#include "Core/Rendering/Shader/ProgramBinaryCache/ProgramBinaryCache.hpp"
+#include "Logging/IDwarfLogger.hpp"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace Dwarf;
+using namespace testing;
+
+namespace
+{
+  class MockLogger : public IDwarfLogger
+  {
+  public:
+    MOCK_METHOD(void, LogDebug, (const Log logMessage), (const, override));
+    MOCK_METHOD(void, LogInfo, (const Log logMessage), (const, override));
+    MOCK_METHOD(void, LogWarn, (const Log logMessage), (const, override));
+    MOCK_METHOD(void, LogError, (const Log logMessage), (const, override));
+  };
+
+  class ProgramBinaryCacheTest : public Test
+  {
+  protected:
+    std::filesystem::path                 mProjectPath;
+    std::shared_ptr<NiceMock<MockLogger>> mLogger;
+
+    void
+    SetUp() override
+    {
+      mProjectPath = std::filesystem::temp_directory_path() /
+                     "DwarfProgramBinaryCacheTests";
+      std::filesystem::remove_all(mProjectPath);
+      mLogger = std::make_shared<NiceMock<MockLogger>>();
+    }
+
+    void
+    TearDown() override
+    {
+      std::filesystem::remove_all(mProjectPath);
+    }
+
+    auto
+    CreateCache() -> std::unique_ptr<ProgramBinaryCache>
+    {
+      return std::make_unique<ProgramBinaryCache>(ProjectPath(mProjectPath),
+                                                  mLogger);
+    }
+
+    auto
+    GetEntryPath(const ProgramBinaryKey& key) -> std::filesystem::path
+    {
+      return mProjectPath / ProgramBinaryCache::CACHE_DIRECTORY /
+             (key.ToString() + ".bin");
+    }
+
+    static auto
+    CreateBinary() -> ProgramBinary
+    {
+      ProgramBinary binary;
+      binary.Format = 0x8E21;
+      binary.Data = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+      binary.Reflection = { 10, 11, 12 };
+      binary.CompileTime = std::chrono::milliseconds(20);
+      return binary;
+    }
+  };
+}
+
+TEST(ProgramBinaryKeyTests, KeyDependsOnEveryPart)
+{
+  ProgramBinaryKey key =
+    ProgramBinaryCache::ComputeKey({ "vertex", "fragment", "driver" });
+
+  EXPECT_EQ(key,
+            ProgramBinaryCache::ComputeKey({ "vertex", "fragment", "driver" }));
+  EXPECT_NE(key,
+            ProgramBinaryCache::ComputeKey({ "vertex", "fragment", "other" }));
+  EXPECT_NE(key,
+            ProgramBinaryCache::ComputeKey({ "vertexf", "ragment", "driver" }));
+  EXPECT_EQ(key.ToString().size(), 32);
+}
+
+TEST_F(ProgramBinaryCacheTest, MissingEntryIsNotFound)
+{
+  auto cache = CreateCache();
+
+  EXPECT_FALSE(cache->Load(ProgramBinaryCache::ComputeKey({ "a" })));
+}
+
+TEST_F(ProgramBinaryCacheTest, StoredEntrySurvivesRestart)
+{
+  ProgramBinaryKey key = ProgramBinaryCache::ComputeKey({ "a", "b" });
+  CreateCache()->Store(key, CreateBinary());
+
+  std::optional<ProgramBinary> loaded = CreateCache()->Load(key);
+
+  ASSERT_TRUE(loaded.has_value());
+  EXPECT_EQ(loaded->Format, CreateBinary().Format);
+  EXPECT_EQ(loaded->Data, CreateBinary().Data);
+  EXPECT_EQ(loaded->Reflection, CreateBinary().Reflection);
+  EXPECT_EQ(loaded->CompileTime, CreateBinary().CompileTime);
+}
+
+TEST_F(ProgramBinaryCacheTest, CorruptedEntryIsDiscarded)
+{
+  ProgramBinaryKey key = ProgramBinaryCache::ComputeKey({ "a", "b" });
+  auto             cache = CreateCache();
+  cache->Store(key, CreateBinary());
+
+  // Flip a byte of the reflection, which follows the binary data
+  {
+    std::fstream file(GetEntryPath(key),
+                      std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(-1, std::ios::end);
+    file.put(static_cast<char>(0x7F));
+  }
+
+  EXPECT_CALL(*mLogger, LogWarn(_)).Times(1);
+  EXPECT_FALSE(cache->Load(key).has_value());
+  EXPECT_FALSE(std::filesystem::exists(GetEntryPath(key)));
+}
+
+TEST_F(ProgramBinaryCacheTest, CorruptedBinaryDataIsDiscarded)
+{
+  ProgramBinaryKey key = ProgramBinaryCache::ComputeKey({ "a", "b" });
+  auto             cache = CreateCache();
+  cache->Store(key, CreateBinary());
+
+  // Flip the last byte of the binary data
+  {
+    auto         reflectionSize =
+      static_cast<std::streamoff>(CreateBinary().Reflection.size());
+    std::fstream file(GetEntryPath(key),
+                      std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(-reflectionSize - 1, std::ios::end);
+    file.put(static_cast<char>(0x7F));
+  }
+
+  EXPECT_FALSE(cache->Load(key).has_value());
+}
+
+TEST_F(ProgramBinaryCacheTest, TruncatedEntryIsDiscarded)
+{
+  ProgramBinaryKey key = ProgramBinaryCache::ComputeKey({ "a", "b" });
+  auto             cache = CreateCache();
+  cache->Store(key, CreateBinary());
+  std::filesystem::resize_file(GetEntryPath(key), 12);
+
+  EXPECT_FALSE(cache->Load(key).has_value());
+  EXPECT_FALSE(std::filesystem::exists(GetEntryPath(key)));
+}
+
+TEST_F(ProgramBinaryCacheTest, OtherVersionIsDiscarded)
+{
+  ProgramBinaryKey key = ProgramBinaryCache::ComputeKey({ "a", "b" });
+  auto             cache = CreateCache();
+  cache->Store(key, CreateBinary());
+
+  // The version follows the magic number
+  {
+    std::fstream file(GetEntryPath(key),
+                      std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(sizeof(uint32_t));
+    uint32_t version = ProgramBinaryCache::CACHE_VERSION + 1;
+    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+  }
+
+  EXPECT_FALSE(cache->Load(key).has_value());
+}
+
+TEST_F(ProgramBinaryCacheTest, TracksHitRateAndSavedTime)
+{
+  auto cache = CreateCache();
+
+  cache->RecordMiss();
+  cache->RecordHit(CreateBinary(), std::chrono::milliseconds(5));
+  cache->RecordHit(CreateBinary(), std::chrono::milliseconds(50));
+
+  ProgramBinaryCacheStatistics stats = cache->GetStatistics();
+  EXPECT_EQ(stats.Hits, 2);
+  EXPECT_EQ(stats.Misses, 1);
+  EXPECT_EQ(stats.SavedTime, std::chrono::milliseconds(15));
+
+  EXPECT_CALL(*mLogger, LogInfo(_)).Times(1);
+  cache.reset();
+}
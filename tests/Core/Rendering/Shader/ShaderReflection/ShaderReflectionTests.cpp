@@ -0,0 +1,112 @@
+#include "Core/Rendering/Shader/ShaderReflection/ShaderReflection.hpp"
+#include <gtest/gtest.h>
+
+using namespace Dwarf;
+
+namespace
+{
+  auto
+  CreateReflection() -> ShaderReflection
+  {
+    ShaderReflection reflection;
+    reflection.Uniforms = {
+      { "albedoMap", ShaderParameterType::TEX2D, 4, 0 },
+      { "environment", std::nullopt, 7, 1 },
+      { "roughness", ShaderParameterType::FLOAT, 2, -1 },
+      { "tint", ShaderParameterType::VEC4, 3, -1 }
+    };
+
+    MaterialBlockLayout& block = reflection.MaterialBlock.emplace();
+    block.Members = { { "metalness", ShaderParameterType::FLOAT, 0 },
+                      { "transform", ShaderParameterType::MAT4, 16 } };
+    block.Stride = 80;
+    return reflection;
+  }
+}
+
+TEST(ShaderReflectionTests, FindsUniformsByName)
+{
+  ShaderReflection reflection = CreateReflection();
+
+  const ShaderUniform* tint = reflection.FindUniform("tint");
+  ASSERT_NE(tint, nullptr);
+  EXPECT_EQ(tint->Location, 3);
+  EXPECT_EQ(tint->Type, ShaderParameterType::VEC4);
+
+  EXPECT_EQ(reflection.FindUniform("albedoMap")->TextureUnit, 0);
+  EXPECT_EQ(reflection.FindUniform("modelMatrix"), nullptr);
+  EXPECT_EQ(reflection.FindUniform("tin"), nullptr);
+}
+
+TEST(ShaderReflectionTests, SurvivesSerialization)
+{
+  ShaderReflection reflection = CreateReflection();
+
+  std::optional<ShaderReflection> loaded =
+    ShaderReflection::Deserialize(reflection.Serialize());
+
+  ASSERT_TRUE(loaded.has_value());
+  ASSERT_EQ(loaded->Uniforms.size(), reflection.Uniforms.size());
+  for (size_t i = 0; i < reflection.Uniforms.size(); i++)
+  {
+    EXPECT_EQ(loaded->Uniforms[i].Name, reflection.Uniforms[i].Name);
+    EXPECT_EQ(loaded->Uniforms[i].Type, reflection.Uniforms[i].Type);
+    EXPECT_EQ(loaded->Uniforms[i].Location, reflection.Uniforms[i].Location);
+    EXPECT_EQ(loaded->Uniforms[i].TextureUnit,
+              reflection.Uniforms[i].TextureUnit);
+  }
+
+  ASSERT_TRUE(loaded->MaterialBlock.has_value());
+  EXPECT_EQ(loaded->MaterialBlock->Stride, 80);
+  ASSERT_EQ(loaded->MaterialBlock->Members.size(), 2);
+  EXPECT_EQ(loaded->MaterialBlock->Members[1].Name, "transform");
+  EXPECT_EQ(loaded->MaterialBlock->Members[1].Type, ShaderParameterType::MAT4);
+  EXPECT_EQ(loaded->MaterialBlock->Members[1].Offset, 16);
+}
+
+TEST(ShaderReflectionTests, ProgramWithoutMaterialBlockSurvivesSerialization)
+{
+  ShaderReflection reflection = CreateReflection();
+  reflection.MaterialBlock.reset();
+
+  std::optional<ShaderReflection> loaded =
+    ShaderReflection::Deserialize(reflection.Serialize());
+
+  ASSERT_TRUE(loaded.has_value());
+  EXPECT_FALSE(loaded->MaterialBlock.has_value());
+  EXPECT_EQ(loaded->Uniforms.size(), 4);
+}
+
+TEST(ShaderReflectionTests, TruncatedDataIsRejected)
+{
+  std::vector<uint8_t> data = CreateReflection().Serialize();
+
+  for (size_t size = 0; size < data.size(); size++)
+  {
+    EXPECT_FALSE(ShaderReflection::Deserialize(
+                   std::span<const uint8_t>(data).first(size))
+                   .has_value())
+      << "Accepted " << size << " of " << data.size() << " bytes";
+  }
+}
+
+TEST(ShaderReflectionTests, TrailingDataIsRejected)
+{
+  std::vector<uint8_t> data = CreateReflection().Serialize();
+  data.push_back(0);
+
+  EXPECT_FALSE(ShaderReflection::Deserialize(data).has_value());
+}
+
+TEST(ShaderReflectionTests, UnknownParameterTypeIsRejected)
+{
+  ShaderReflection reflection;
+  reflection.Uniforms = { { "tint", ShaderParameterType::VEC4, 0, -1 } };
+  std::vector<uint8_t> data = reflection.Serialize();
+
+  // The type follows the count, the name length and the name
+  size_t typeOffset = sizeof(uint32_t) + sizeof(uint32_t) + 4;
+  data[typeOffset] = 200;
+
+  EXPECT_FALSE(ShaderReflection::Deserialize(data).has_value());
+}
@@ -0,0 +1,475 @@
+#include "Core/Asset/Database/AssetComponents.hpp"
+#include "Core/Asset/Shader/ShaderSourceCollection/ShaderSourceCollection.hpp"
+#include "Core/Rendering/Material/Material.hpp"
+#include "Core/Rendering/Shader/ShaderRegistry/ShaderRegistry.hpp"
+#include "Logging/IDwarfLogger.hpp"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace Dwarf;
+using namespace testing;
+
+namespace
+{
+  class MockLogger : public IDwarfLogger
+  {
+  public:
+    MOCK_METHOD(void, LogDebug, (const Log logMessage), (const, override));
+    MOCK_METHOD(void, LogInfo, (const Log logMessage), (const, override));
+    MOCK_METHOD(void, LogWarn, (const Log logMessage), (const, override));
+    MOCK_METHOD(void, LogError, (const Log logMessage), (const, override));
+  };
+
+  class MockShader : public IShader
+  {
+  public:
+    MOCK_METHOD(void, Compile, (), (override));
+    MOCK_METHOD(void, SubmitCompilation, (), (override));
+    MOCK_METHOD(bool, PollCompilation, (), (override));
+    MOCK_METHOD(bool, IsCompiling, (), (const, override));
+    MOCK_METHOD(bool, IsCompiled, (), (const, override));
+    MOCK_METHOD(const std::vector<std::string>&,
+                GetDeclaredKeywords,
+                (),
+                (const, override));
+    MOCK_METHOD(const std::vector<std::filesystem::path>&,
+                GetIncludedFiles,
+                (),
+                (const, override));
+    MOCK_METHOD(void,
+                SetParameter,
+                (std::string identifier, ShaderParameterValue parameter),
+                (override));
+    MOCK_METHOD(void, RemoveParameter, (std::string identifier), (override));
+    MOCK_METHOD(std::unique_ptr<IShaderParameterCollection>,
+                CreateParameters,
+                (),
+                (override));
+
+    auto
+    operator<(const IShader& other) const -> bool override
+    {
+      return this < &other;
+    }
+  };
+
+  class MockShaderFactory : public IShaderFactory
+  {
+  public:
+    MOCK_METHOD(std::shared_ptr<IShader>,
+                Create,
+                (std::unique_ptr<IShaderSourceCollection> shaderSources),
+                (const, override));
+  };
+
+  class MockShaderRecompiler : public IShaderRecompiler
+  {
+  public:
+    MOCK_METHOD(void,
+                MarkForRecompilation,
+                (std::shared_ptr<IShader> shader),
+                (override));
+    MOCK_METHOD(void,
+                TrackCompilation,
+                (std::shared_ptr<IShader> shader),
+                (override));
+    MOCK_METHOD(void, Recompile, (), (override));
+    MOCK_METHOD(size_t, GetPendingCompilationCount, (), (const, override));
+  };
+
+  class MockShaderParameterCollection : public IShaderParameterCollection
+  {
+  public:
+    MOCK_METHOD(void,
+                SetParameter,
+                (std::string_view identifier, MaterialParameterValue parameter),
+                (override));
+    MOCK_METHOD(MaterialParameterValue&,
+                GetParameter,
+                (const std::string& name),
+                (override));
+    MOCK_METHOD(const MaterialParameterValue*,
+                FindParameter,
+                (const std::string& name),
+                (const, override));
+    MOCK_METHOD(uint64_t, GetVersion, (), (const, override));
+    MOCK_METHOD(const std::vector<std::string>,
+                GetParameterIdentifiers,
+                (),
+                (const, override));
+    MOCK_METHOD(void,
+                PatchParameters,
+                (const std::unique_ptr<IShaderParameterCollection>& parameters),
+                (override));
+    MOCK_METHOD(void, RemoveParameter, (const std::string& name), (override));
+    MOCK_METHOD(bool,
+                HasParameter,
+                (const std::string& name),
+                (const, override));
+    MOCK_METHOD(void, ClearParameters, (), (override));
+    MOCK_METHOD(nlohmann::json, Serialize, (), (override));
+  };
+
+  // Asset reference sharing its component instead of an ECS registry
+  class FakeAssetReference : public IAssetReference
+  {
+  private:
+    std::shared_ptr<IAssetComponent> mAsset;
+    ASSET_TYPE                       mType;
+    UUID                             mUID;
+    std::filesystem::path            mPath;
+
+  public:
+    FakeAssetReference(std::shared_ptr<IAssetComponent> asset,
+                       ASSET_TYPE                       type,
+                       UUID                             uid = UUID())
+      : mAsset(std::move(asset))
+      , mType(type)
+      , mUID(std::move(uid))
+    {
+    }
+
+    auto
+    GetHandle() const -> entt::entity override
+    {
+      return entt::null;
+    }
+
+    auto
+    GetUID() const -> const UUID& override
+    {
+      return mUID;
+    }
+
+    auto
+    GetPath() const -> const std::filesystem::path& override
+    {
+      return mPath;
+    }
+
+    auto
+    GetAsset() -> IAssetComponent& override
+    {
+      return *mAsset;
+    }
+
+    auto
+    GetType() const -> ASSET_TYPE override
+    {
+      return mType;
+    }
+
+    auto
+    IsValid() const -> bool override
+    {
+      return true;
+    }
+  };
+
+  auto
+  CreateSources(const std::string&       vertexSource,
+                const std::string&       fragmentSource,
+                bool                     fragmentFirst = false,
+                std::vector<std::string> keywords = {})
+    -> std::unique_ptr<IShaderSourceCollection>
+  {
+    std::vector<std::unique_ptr<IAssetReference>> sources;
+    sources.push_back(std::make_unique<FakeAssetReference>(
+      std::make_unique<VertexShaderAsset>(vertexSource),
+      ASSET_TYPE::VERTEX_SHADER));
+    sources.push_back(std::make_unique<FakeAssetReference>(
+      std::make_unique<FragmentShaderAsset>(fragmentSource),
+      ASSET_TYPE::FRAGMENT_SHADER));
+    if (fragmentFirst)
+    {
+      std::swap(sources[0], sources[1]);
+    }
+    auto collection = std::make_unique<ShaderSourceCollection>(sources);
+    collection->SetKeywords(std::move(keywords));
+    return collection;
+  }
+
+  /// @brief Shader stage asset that can be edited like a reimported file.
+  struct FakeShaderStage
+  {
+    UUID                             UID;
+    ASSET_TYPE                       Type;
+    std::shared_ptr<IAssetComponent> Asset;
+
+    void
+    Edit(const std::string& source)
+    {
+      if (Type == ASSET_TYPE::VERTEX_SHADER)
+      {
+        Asset = std::make_shared<VertexShaderAsset>(source);
+      }
+      else
+      {
+        Asset = std::make_shared<FragmentShaderAsset>(source);
+      }
+    }
+  };
+
+  class FakeShaderAssetSourceContainer : public IShaderAssetSourceContainer
+  {
+  private:
+    std::vector<FakeShaderStage*> mStages;
+
+  public:
+    FakeShaderAssetSourceContainer(std::vector<FakeShaderStage*> stages)
+      : mStages(std::move(stages))
+    {
+    }
+
+    auto
+    GetShaderSources() -> std::unique_ptr<IShaderSourceCollection> override
+    {
+      std::vector<std::unique_ptr<IAssetReference>> sources;
+      for (FakeShaderStage* stage : mStages)
+      {
+        sources.push_back(std::make_unique<FakeAssetReference>(
+          stage->Asset, stage->Type, stage->UID));
+      }
+      return std::make_unique<ShaderSourceCollection>(sources);
+    }
+
+    auto
+    Serialize() -> nlohmann::json override
+    {
+      return {};
+    }
+  };
+
+  class ShaderRegistryTest : public Test
+  {
+  protected:
+    std::shared_ptr<NiceMock<MockLogger>>           mLogger;
+    std::shared_ptr<NiceMock<MockShaderFactory>>    mShaderFactory;
+    std::shared_ptr<NiceMock<MockShaderRecompiler>> mShaderRecompiler;
+    std::shared_ptr<ShaderRegistry>                 mShaderRegistry;
+
+    auto
+    CreateStage(ASSET_TYPE type, const std::string& source) -> FakeShaderStage
+    {
+      FakeShaderStage stage{ UUID(), type, nullptr };
+      stage.Edit(source);
+      return stage;
+    }
+
+    auto
+    CreateMaterial(std::vector<FakeShaderStage*>   stages,
+                   MockShaderParameterCollection** parameters)
+      -> std::unique_ptr<Material>
+    {
+      auto shaderParameters =
+        std::make_unique<NiceMock<MockShaderParameterCollection>>();
+      *parameters = shaderParameters.get();
+      return std::make_unique<Material>(
+        MaterialProperties(),
+        std::move(shaderParameters),
+        std::make_unique<FakeShaderAssetSourceContainer>(std::move(stages)),
+        mShaderRegistry);
+    }
+
+    void
+    SetUp() override
+    {
+      mLogger = std::make_shared<NiceMock<MockLogger>>();
+      mShaderFactory = std::make_shared<NiceMock<MockShaderFactory>>();
+      mShaderRecompiler = std::make_shared<NiceMock<MockShaderRecompiler>>();
+      ON_CALL(*mShaderFactory, Create(_))
+        .WillByDefault(
+          [](std::unique_ptr<IShaderSourceCollection>)
+          { return std::make_shared<NiceMock<MockShader>>(); });
+      mShaderRegistry = std::make_shared<ShaderRegistry>(
+        mLogger, mShaderFactory, mShaderRecompiler);
+    }
+  };
+}
+
+TEST_F(ShaderRegistryTest, ReusesProgramWithSameSources)
+{
+  EXPECT_CALL(*mShaderFactory, Create(_)).Times(1);
+  EXPECT_CALL(*mShaderRecompiler, TrackCompilation(_)).Times(1);
+
+  auto first = mShaderRegistry->GetOrCreate(CreateSources("vert", "frag"));
+  auto second = mShaderRegistry->GetOrCreate(CreateSources("vert", "frag"));
+
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(mShaderRegistry->GetProgramCount(), 1);
+}
+
+TEST_F(ShaderRegistryTest, KeyIgnoresSourceOrder)
+{
+  auto first = CreateSources("vert", "frag");
+  auto swapped = CreateSources("vert", "frag", true);
+
+  EXPECT_EQ(ShaderRegistry::ComputeProgramKey(*first),
+            ShaderRegistry::ComputeProgramKey(*swapped));
+}
+
+TEST_F(ShaderRegistryTest, KeyDependsOnStageType)
+{
+  // Same contents in different stages are different programs
+  auto first = CreateSources("a", "b");
+  auto swapped = CreateSources("b", "a");
+
+  EXPECT_NE(ShaderRegistry::ComputeProgramKey(*first),
+            ShaderRegistry::ComputeProgramKey(*swapped));
+}
+
+TEST_F(ShaderRegistryTest, CreatesProgramForChangedSource)
+{
+  EXPECT_CALL(*mShaderFactory, Create(_)).Times(2);
+
+  auto first = mShaderRegistry->GetOrCreate(CreateSources("vert", "frag"));
+  auto second = mShaderRegistry->GetOrCreate(CreateSources("vert", "frag2"));
+
+  EXPECT_NE(first, second);
+  EXPECT_EQ(mShaderRegistry->GetProgramCount(), 2);
+}
+
+TEST_F(ShaderRegistryTest, ReleasesUnusedPrograms)
+{
+  auto used = mShaderRegistry->GetOrCreate(CreateSources("vert", "frag"));
+  mShaderRegistry->GetOrCreate(CreateSources("vert", "unused"));
+  EXPECT_EQ(mShaderRegistry->GetProgramCount(), 2);
+
+  EXPECT_EQ(mShaderRegistry->ReleaseUnused(), 1);
+  EXPECT_EQ(mShaderRegistry->GetProgramCount(), 1);
+
+  // The used program is still shared
+  EXPECT_EQ(mShaderRegistry->GetOrCreate(CreateSources("vert", "frag")), used);
+}
+
+TEST_F(ShaderRegistryTest, KeywordsSelectSeparateVariants)
+{
+  auto plain = CreateSources("vert", "frag");
+  auto variant = CreateSources("vert", "frag", false, { "HAS_NORMAL_MAP" });
+  auto reordered =
+    CreateSources("vert", "frag", false, { "B", "A", "A" });
+  auto ordered = CreateSources("vert", "frag", false, { "A", "B" });
+  auto joined = CreateSources("vert", "frag", false, { "AB" });
+
+  EXPECT_NE(ShaderRegistry::ComputeProgramKey(*plain),
+            ShaderRegistry::ComputeProgramKey(*variant));
+  EXPECT_EQ(ShaderRegistry::ComputeProgramKey(*reordered),
+            ShaderRegistry::ComputeProgramKey(*ordered));
+  EXPECT_NE(ShaderRegistry::ComputeProgramKey(*ordered),
+            ShaderRegistry::ComputeProgramKey(*joined));
+}
+
+TEST_F(ShaderRegistryTest, RecompilesOnlyProgramsIncludingChangedFile)
+{
+  std::vector<std::filesystem::path> lightingIncludes = {
+    "shaders/include/lighting.glsl", "shaders/include/common.glsl"
+  };
+  std::vector<std::filesystem::path> commonIncludes = {
+    "shaders/include/common.glsl"
+  };
+  std::vector<std::shared_ptr<NiceMock<MockShader>>> shaders;
+  for (const auto* includes : { &lightingIncludes, &commonIncludes })
+  {
+    auto shader = std::make_shared<NiceMock<MockShader>>();
+    ON_CALL(*shader, GetIncludedFiles()).WillByDefault(ReturnRef(*includes));
+    shaders.push_back(shader);
+  }
+  EXPECT_CALL(*mShaderFactory, Create(_))
+    .WillOnce(Return(shaders[0]))
+    .WillOnce(Return(shaders[1]));
+
+  auto lit = mShaderRegistry->GetOrCreate(CreateSources("vert", "lit"));
+  auto unlit = mShaderRegistry->GetOrCreate(CreateSources("vert", "unlit"));
+
+  EXPECT_CALL(*mShaderRecompiler,
+              MarkForRecompilation(std::shared_ptr<IShader>(shaders[0])))
+    .Times(1);
+  EXPECT_EQ(mShaderRegistry->RecompileIncluding(
+              "shaders/include/../include/lighting.glsl"),
+            1);
+
+  EXPECT_CALL(*mShaderRecompiler, MarkForRecompilation(_)).Times(2);
+  EXPECT_EQ(
+    mShaderRegistry->RecompileIncluding("shaders/include/common.glsl"), 2);
+}
+
+TEST_F(ShaderRegistryTest, ReloadRecompilesOnlyAffectedPrograms)
+{
+  FakeShaderStage vertex = CreateStage(ASSET_TYPE::VERTEX_SHADER, "vert");
+  FakeShaderStage litFragment =
+    CreateStage(ASSET_TYPE::FRAGMENT_SHADER, "lit");
+  FakeShaderStage unlitFragment =
+    CreateStage(ASSET_TYPE::FRAGMENT_SHADER, "unlit");
+
+  MockShaderParameterCollection* firstParameters = nullptr;
+  MockShaderParameterCollection* secondParameters = nullptr;
+  MockShaderParameterCollection* unlitParameters = nullptr;
+  auto first = CreateMaterial({ &vertex, &litFragment }, &firstParameters);
+  auto second = CreateMaterial({ &vertex, &litFragment }, &secondParameters);
+  auto unlit = CreateMaterial({ &vertex, &unlitFragment }, &unlitParameters);
+  ASSERT_EQ(first->GetShader(), second->GetShader());
+  ASSERT_EQ(mShaderRegistry->GetProgramCount(), 2);
+
+  std::shared_ptr<IShader> unlitShader = unlit->GetShader();
+
+  // The two materials sharing the edited stage share one new program
+  litFragment.Edit("lit edited");
+  int compilations = 0;
+  EXPECT_CALL(*mShaderFactory, Create(_))
+    .WillRepeatedly(
+      [&compilations](std::unique_ptr<IShaderSourceCollection>)
+      {
+        compilations++;
+        auto shader = std::make_shared<NiceMock<MockShader>>();
+        ON_CALL(*shader, IsCompiling()).WillByDefault(Return(true));
+        return shader;
+      });
+  EXPECT_EQ(mShaderRegistry->ReloadShaderAsset(litFragment.UID), 2);
+  EXPECT_EQ(compilations, 1);
+  EXPECT_EQ(first->GetShader(), second->GetShader());
+  EXPECT_EQ(unlit->GetShader(), unlitShader);
+
+  // The old program was only used by the reloaded materials
+  EXPECT_EQ(mShaderRegistry->GetProgramCount(), 2);
+
+  // Parameters are patched once the new program is compiled and only for the
+  // affected materials
+  EXPECT_CALL(*firstParameters, PatchParameters(_)).Times(1);
+  EXPECT_CALL(*secondParameters, PatchParameters(_)).Times(1);
+  EXPECT_CALL(*unlitParameters, PatchParameters(_)).Times(0);
+  EXPECT_EQ(mShaderRegistry->PatchReloadedMaterials(), 0);
+
+  auto* shader = dynamic_cast<MockShader*>(first->GetShader().get());
+  ON_CALL(*shader, IsCompiling()).WillByDefault(Return(false));
+  ON_CALL(*shader, IsCompiled()).WillByDefault(Return(true));
+  EXPECT_EQ(mShaderRegistry->PatchReloadedMaterials(), 2);
+  EXPECT_EQ(mShaderRegistry->PatchReloadedMaterials(), 0);
+}
+
+TEST_F(ShaderRegistryTest, ReloadOfUnusedStageCompilesNothing)
+{
+  FakeShaderStage vertex = CreateStage(ASSET_TYPE::VERTEX_SHADER, "vert");
+  FakeShaderStage fragment = CreateStage(ASSET_TYPE::FRAGMENT_SHADER, "frag");
+  FakeShaderStage unused = CreateStage(ASSET_TYPE::FRAGMENT_SHADER, "unused");
+
+  MockShaderParameterCollection* parameters = nullptr;
+  auto material = CreateMaterial({ &vertex, &fragment }, &parameters);
+
+  EXPECT_CALL(*mShaderFactory, Create(_)).Times(0);
+  unused.Edit("unused edited");
+  EXPECT_EQ(mShaderRegistry->ReloadShaderAsset(unused.UID), 0);
+}
+
+TEST_F(ShaderRegistryTest, DestroyedMaterialsAreNotReloaded)
+{
+  FakeShaderStage vertex = CreateStage(ASSET_TYPE::VERTEX_SHADER, "vert");
+  FakeShaderStage fragment = CreateStage(ASSET_TYPE::FRAGMENT_SHADER, "frag");
+
+  MockShaderParameterCollection* parameters = nullptr;
+  auto material = CreateMaterial({ &vertex, &fragment }, &parameters);
+  material.reset();
+
+  EXPECT_CALL(*mShaderFactory, Create(_)).Times(0);
+  fragment.Edit("frag edited");
+  EXPECT_EQ(mShaderRegistry->ReloadShaderAsset(fragment.UID), 0);
+}
@@ -0,0 +1,116 @@
+#include "Core/Scene/Scene.hpp"
+#include <gtest/gtest.h>
+
+using namespace Dwarf;
+using namespace testing;
+
+TEST(SceneChangeTrackerTests, ReportsEntitiesChangedSinceVersion)
+{
+  Scene  scene(nullptr, nullptr);
+  Entity first = scene.CreateEntity("First");
+  Entity second = scene.CreateEntity("Second");
+
+  SceneChangeTracker& tracker = scene.GetChangeTracker();
+  uint64_t            version = tracker.GetVersion();
+  EXPECT_TRUE(tracker.GetChangedEntities(version).empty());
+
+  scene.GetRegistry().patch<NameComponent>(second.GetHandle());
+  EXPECT_EQ(std::vector<entt::entity>{ second.GetHandle() },
+            tracker.GetChangedEntities(version));
+  EXPECT_EQ(tracker.GetVersion(),
+            tracker.GetEntityVersion(second.GetHandle()));
+  EXPECT_GE(version, tracker.GetEntityVersion(first.GetHandle()));
+
+  // Earlier versions include the creation of both entities
+  EXPECT_EQ(
+    (std::vector<entt::entity>{ scene.GetRootEntity().GetHandle(),
+                                first.GetHandle(),
+                                second.GetHandle() }),
+    tracker.GetChangedEntities(0));
+}
+
+TEST(SceneChangeTrackerTests, ReportsRemovedEntities)
+{
+  Scene  scene(nullptr, nullptr);
+  Entity parent = scene.CreateEntity("Parent");
+  Entity child = scene.CreateEntity("Child");
+  Entity other = scene.CreateEntity("Other");
+  child.SetParent(parent.GetHandle());
+
+  SceneChangeTracker& tracker = scene.GetChangeTracker();
+  uint64_t            version = tracker.GetVersion();
+  UUID                parentId = parent.GetUID();
+  UUID                childId = child.GetUID();
+  scene.DeleteEntity(parent);
+
+  EXPECT_EQ((std::vector<UUID>{ childId, parentId }),
+            tracker.GetRemovedEntities(version));
+  EXPECT_TRUE(tracker.GetRemovedEntities(tracker.GetVersion()).empty());
+
+  // Only the root lost a child, the removed entities are not reported
+  EXPECT_EQ(std::vector<entt::entity>{ scene.GetRootEntity().GetHandle() },
+            tracker.GetChangedEntities(version));
+  EXPECT_GE(version, tracker.GetEntityVersion(other.GetHandle()));
+}
+
+TEST(SceneChangeTrackerTests, CapturesChangedEntities)
+{
+  Scene  scene(nullptr, nullptr);
+  Entity parent = scene.CreateEntity("Parent");
+  Entity child = scene.CreateEntity("Child");
+  Entity other = scene.CreateEntity("Other");
+  child.SetParent(parent.GetHandle());
+
+  uint64_t version = scene.GetChangeTracker().GetVersion();
+  UUID     otherId = other.GetUID();
+  scene.GetRegistry().patch<TransformComponent>(
+    child.GetHandle(),
+    [](TransformComponent& transform)
+    { transform.Position = { 1.0F, 2.0F, 3.0F }; });
+  scene.DeleteEntity(other);
+
+  SceneDelta delta = scene.CaptureDelta(version);
+  ASSERT_EQ(1, delta.Entities.size());
+  EXPECT_EQ(child.GetUID().toBytes(), delta.Entities[0].Entity.Id);
+  EXPECT_EQ("Child", delta.Entities[0].Entity.Name);
+  EXPECT_EQ(2.0F, delta.Entities[0].Entity.Position.y);
+  EXPECT_EQ(parent.GetUID().toBytes(), delta.Entities[0].Parent);
+  EXPECT_EQ(std::vector<UUIDBytes>{ otherId.toBytes() },
+            delta.RemovedEntities);
+  ASSERT_TRUE(delta.RootChildren.has_value());
+  EXPECT_EQ(std::vector<UUIDBytes>{ parent.GetUID().toBytes() },
+            *delta.RootChildren);
+  EXPECT_TRUE(scene.CaptureDelta(scene.GetChangeTracker().GetVersion())
+                .IsEmpty());
+}
+TEST(SceneChangeTrackerTests, DropsChangesNoConsumerHolds)
+{
+  Scene  scene(nullptr, nullptr);
+  Entity first = scene.CreateEntity("First");
+  Entity second = scene.CreateEntity("Second");
+  scene.DeleteEntity(first);
+
+  SceneChangeTracker& tracker = scene.GetChangeTracker();
+  uint64_t            version = tracker.GetVersion();
+  int                 consumer = 0;
+  tracker.HoldVersion(&consumer, version);
+  EXPECT_TRUE(tracker.GetRemovedEntities(0).empty());
+
+  // Changes after the held version are still reported once per entity
+  scene.GetRegistry().patch<NameComponent>(second.GetHandle());
+  scene.GetRegistry().patch<NameComponent>(second.GetHandle());
+  EXPECT_EQ(std::vector<entt::entity>{ second.GetHandle() },
+            tracker.GetChangedEntities(version));
+
+  // Older versions visit every entity
+  EXPECT_EQ((std::vector<entt::entity>{ scene.GetRootEntity().GetHandle(),
+                                        second.GetHandle() }),
+            tracker.GetChangedEntities(0));
+
+  UUID secondId = second.GetUID();
+  scene.DeleteEntity(second);
+  EXPECT_EQ(std::vector<UUID>{ secondId },
+            tracker.GetRemovedEntities(version));
+  tracker.ReleaseVersion(&consumer);
+  EXPECT_TRUE(tracker.GetRemovedEntities(version).empty());
+}
@@ -0,0 +1,182 @@
+#include "Core/Scene/ChangeTracking/SceneUndoHistory.hpp"
+#include "Core/Scene/Scene.hpp"
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+using namespace Dwarf;
+using namespace testing;
+
+namespace
+{
+  /// @brief Describes the hierarchy, names, IDs and positions of the entities
+  /// below an entity.
+  auto
+  Describe(Scene& scene, entt::entity entity) -> std::string
+  {
+    std::string description;
+    for (entt::entity child : Entity(entity, scene.GetRegistry()).GetChildren())
+    {
+      const auto& transform =
+        scene.GetRegistry().get<TransformComponent>(child);
+      description += fmt::format(
+        "{}:{}:{}:{}:{}:{}({})",
+        scene.GetRegistry().get<IDComponent>(child).getId().toString(),
+        scene.GetRegistry().get<NameComponent>(child).Name,
+        transform.Position.x,
+        transform.Position.y,
+        transform.Position.z,
+        scene.GetRegistry().all_of<LightComponent>(child),
+        Describe(scene, child));
+    }
+    return description;
+  }
+
+  auto
+  Describe(Scene& scene) -> std::string
+  {
+    return Describe(scene, scene.GetRootEntity().GetHandle());
+  }
+
+  /// @brief Finds an entity by its ID.
+  auto
+  Find(Scene& scene, const UUID& id) -> Entity
+  {
+    for (entt::entity entity : scene.GetRegistry().view<IDComponent>())
+    {
+      if (scene.GetRegistry().get<IDComponent>(entity).getId() == id)
+      {
+        return { entity, scene.GetRegistry() };
+      }
+    }
+    return { entt::null, scene.GetRegistry() };
+  }
+
+  class SceneUndoHistoryTests : public Test
+  {
+  protected:
+    Scene mScene = Scene(nullptr, nullptr);
+    UUID  mHouseId;
+    UUID  mDoorId;
+    UUID  mWindowId;
+
+    void
+    SetUp() override
+    {
+      Entity house = mScene.CreateEntity("House");
+      Entity door = mScene.CreateEntity("Door");
+      Entity window = mScene.CreateEntity("Window");
+      door.SetParent(house.GetHandle());
+      window.SetParent(house.GetHandle());
+      mHouseId = house.GetUID();
+      mDoorId = door.GetUID();
+      mWindowId = window.GetUID();
+    }
+  };
+}
+
+TEST_F(SceneUndoHistoryTests, UndoesAndRedoesComponentChanges)
+{
+  SceneUndoHistory history(mScene);
+  std::string      initial = Describe(mScene);
+  EXPECT_FALSE(history.CanUndo());
+  EXPECT_FALSE(history.Checkpoint());
+
+  Entity door = Find(mScene, mDoorId);
+  mScene.GetRegistry().patch<TransformComponent>(
+    door.GetHandle(),
+    [](TransformComponent& transform)
+    { transform.Position = { 0.0F, 1.0F, 0.0F }; });
+  door.AddComponent<LightComponent>();
+  mScene.GetRegistry().replace<NameComponent>(door.GetHandle(), "Gate");
+  std::string changed = Describe(mScene);
+  ASSERT_NE(initial, changed);
+
+  EXPECT_TRUE(history.Undo());
+  EXPECT_EQ(initial, Describe(mScene));
+  EXPECT_FALSE(history.CanUndo());
+  EXPECT_TRUE(history.CanRedo());
+
+  EXPECT_TRUE(history.Redo());
+  EXPECT_EQ(changed, Describe(mScene));
+  EXPECT_FALSE(history.CanRedo());
+}
+
+TEST_F(SceneUndoHistoryTests, UndoesCreationAndDeletion)
+{
+  SceneUndoHistory history(mScene);
+  std::string      initial = Describe(mScene);
+
+  Entity porch = mScene.CreateEntity("Porch");
+  Entity step = mScene.CreateEntity("Step");
+  step.SetParent(porch.GetHandle());
+  porch.SetParent(Find(mScene, mHouseId).GetHandle());
+  EXPECT_TRUE(history.Checkpoint());
+  std::string created = Describe(mScene);
+
+  // The house is deleted with all of its children
+  mScene.DeleteEntity(Find(mScene, mHouseId));
+  EXPECT_TRUE(history.Checkpoint());
+  EXPECT_EQ("", Describe(mScene));
+
+  EXPECT_TRUE(history.Undo());
+  EXPECT_EQ(created, Describe(mScene));
+  EXPECT_TRUE(history.Undo());
+  EXPECT_EQ(initial, Describe(mScene));
+  EXPECT_FALSE(history.Undo());
+
+  EXPECT_TRUE(history.Redo());
+  EXPECT_EQ(created, Describe(mScene));
+  EXPECT_TRUE(history.Redo());
+  EXPECT_EQ("", Describe(mScene));
+  EXPECT_TRUE(history.Undo());
+  EXPECT_EQ(created, Describe(mScene));
+}
+
+TEST_F(SceneUndoHistoryTests, UndoesReparentingAndReordering)
+{
+  SceneUndoHistory history(mScene);
+  std::string      initial = Describe(mScene);
+
+  Entity window = Find(mScene, mWindowId);
+  window.SetParent(mScene.GetRootEntity().GetHandle());
+  history.Checkpoint();
+  std::string moved = Describe(mScene);
+
+  window.SetParent(Find(mScene, mHouseId).GetHandle());
+  window.SetChildIndex(0);
+  history.Checkpoint();
+  std::string reordered = Describe(mScene);
+  ASSERT_NE(initial, reordered);
+
+  EXPECT_TRUE(history.Undo());
+  EXPECT_EQ(moved, Describe(mScene));
+  EXPECT_TRUE(history.Undo());
+  EXPECT_EQ(initial, Describe(mScene));
+  EXPECT_TRUE(history.Redo());
+  EXPECT_TRUE(history.Redo());
+  EXPECT_EQ(reordered, Describe(mScene));
+}
+
+TEST_F(SceneUndoHistoryTests, NewChangesDiscardRedoSteps)
+{
+  SceneUndoHistory history(mScene);
+
+  mScene.GetRegistry().replace<NameComponent>(
+    Find(mScene, mDoorId).GetHandle(), "Gate");
+  EXPECT_TRUE(history.Undo());
+  EXPECT_TRUE(history.CanRedo());
+
+  // Entities created and deleted within one step leave no step behind
+  mScene.DeleteEntity(mScene.CreateEntity("Temporary"));
+  mScene.GetRegistry().replace<NameComponent>(
+    Find(mScene, mWindowId).GetHandle(), "Hatch");
+  EXPECT_TRUE(history.Checkpoint());
+  EXPECT_FALSE(history.CanRedo());
+
+  EXPECT_TRUE(history.Undo());
+  EXPECT_EQ("Door",
+            Find(mScene, mDoorId).GetComponent<NameComponent>().Name);
+  EXPECT_EQ("Window",
+            Find(mScene, mWindowId).GetComponent<NameComponent>().Name);
+  EXPECT_FALSE(history.Undo());
+}
\ No newline at end of file
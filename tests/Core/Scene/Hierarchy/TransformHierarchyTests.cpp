@@ -0,0 +1,269 @@
+#include "Core/Scene/Hierarchy/TransformHierarchy.hpp"
+#include "Core/Scene/Scene.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace Dwarf;
+using namespace testing;
+
+namespace
+{
+  /// @brief Creates an entity with a transform and attaches it to a parent.
+  auto
+  CreateNode(entt::registry& registry,
+             entt::entity    parent,
+             glm::vec3       position = glm::vec3(0.0F)) -> entt::entity
+  {
+    entt::entity entity = registry.create();
+    auto&        transform = registry.emplace<TransformComponent>(entity);
+    transform.SetPosition(position);
+    transform.Parent = parent;
+    if (parent != entt::null)
+    {
+      registry.get<TransformComponent>(parent).Children.push_back(entity);
+    }
+    return entity;
+  }
+
+  void
+  SetParent(entt::registry& registry, entt::entity entity, entt::entity parent)
+  {
+    auto& transform = registry.get<TransformComponent>(entity);
+    std::erase(registry.get<TransformComponent>(transform.Parent).Children,
+               entity);
+    transform.Parent = parent;
+    registry.get<TransformComponent>(parent).Children.push_back(entity);
+  }
+
+  auto
+  GetWorldPosition(const TransformHierarchy& hierarchy, entt::entity entity)
+    -> glm::vec3
+  {
+    return glm::vec3(hierarchy.GetWorldMatrix(entity)[3]);
+  }
+
+  /// @brief Moves 1% of the nodes of a random 100k node hierarchy per frame
+  /// and checks that exactly the moved subtrees are recomputed.
+  void
+  UpdateMovingHierarchy(uint32_t threadCount)
+  {
+    constexpr uint32_t NODE_COUNT = 100000;
+    constexpr uint32_t MOVED_COUNT = NODE_COUNT / 100;
+
+    entt::registry            registry;
+    std::vector<entt::entity> nodes = { CreateNode(registry, entt::null) };
+    TransformHierarchy        hierarchy(registry, nodes[0]);
+    hierarchy.SetThreadCount(threadCount);
+
+    // Every node is attached to a random earlier node
+    std::mt19937 random(42);
+    for (uint32_t index = 1; index < NODE_COUNT; ++index)
+    {
+      std::uniform_int_distribution<uint32_t> parent(0, index - 1);
+      nodes.push_back(
+        CreateNode(registry, nodes[parent(random)], { 1.0F, 0.0F, 0.0F }));
+    }
+    EXPECT_EQ(hierarchy.Update(), NODE_COUNT);
+
+    for (int frame = 0; frame < 3; ++frame)
+    {
+      std::uniform_int_distribution<uint32_t> node(1, NODE_COUNT - 1);
+      for (uint32_t moved = 0; moved < MOVED_COUNT; ++moved)
+      {
+        registry.get<TransformComponent>(nodes[node(random)])
+          .SetPosition({ 0.0F, 1.0F, 0.0F });
+      }
+
+      // Reference: every node below a moved node has to be recomputed
+      std::span<const entt::entity> entities = hierarchy.GetEntities();
+      std::span<const uint32_t>     parents = hierarchy.GetParentIndices();
+      std::vector<bool>             expected(entities.size());
+      size_t                        expectedCount = 0;
+      for (uint32_t index = 1; index < entities.size(); ++index)
+      {
+        expected[index] =
+          registry.get<TransformComponent>(entities[index]).DirtyFlag ||
+          expected[parents[index]];
+        expectedCount += expected[index] ? 1 : 0;
+      }
+
+      EXPECT_EQ(hierarchy.Update(), expectedCount);
+      EXPECT_LT(expectedCount, NODE_COUNT / 2);
+    }
+
+    // Positions add up along the parent chain
+    std::span<const entt::entity> entities = hierarchy.GetEntities();
+    std::span<const uint32_t>     parents = hierarchy.GetParentIndices();
+    std::span<const glm::mat4>    worldMatrices = hierarchy.GetWorldMatrices();
+    for (uint32_t index = 1; index < entities.size(); ++index)
+    {
+      glm::vec3 expected =
+        glm::vec3(worldMatrices[parents[index]][3]) +
+        registry.get<TransformComponent>(entities[index]).GetPosition();
+      ASSERT_EQ(glm::vec3(worldMatrices[index][3]), expected);
+    }
+  }
+}
+
+TEST(TransformHierarchyTests, WorldMatricesComposeTheFullParentChain)
+{
+  entt::registry     registry;
+  entt::entity       root = CreateNode(registry, entt::null);
+  TransformHierarchy hierarchy(registry, root);
+
+  entt::entity parent = CreateNode(registry, root, { 1.0F, 0.0F, 0.0F });
+  entt::entity child = CreateNode(registry, parent, { 0.0F, 2.0F, 0.0F });
+  entt::entity grandChild = CreateNode(registry, child, { 0.0F, 0.0F, 3.0F });
+
+  EXPECT_EQ(hierarchy.Update(), 4);
+
+  EXPECT_EQ(GetWorldPosition(hierarchy, parent), glm::vec3(1.0F, 0.0F, 0.0F));
+  EXPECT_EQ(GetWorldPosition(hierarchy, child), glm::vec3(1.0F, 2.0F, 0.0F));
+  EXPECT_EQ(GetWorldPosition(hierarchy, grandChild),
+            glm::vec3(1.0F, 2.0F, 3.0F));
+}
+
+TEST(TransformHierarchyTests, ParentsPrecedeTheirChildren)
+{
+  entt::registry     registry;
+  entt::entity       root = CreateNode(registry, entt::null);
+  TransformHierarchy hierarchy(registry, root);
+
+  entt::entity first = CreateNode(registry, root);
+  entt::entity second = CreateNode(registry, root);
+  CreateNode(registry, second);
+  CreateNode(registry, first);
+  SetParent(registry, first, second);
+
+  hierarchy.Update();
+
+  std::span<const entt::entity> entities = hierarchy.GetEntities();
+  std::span<const uint32_t>     parents = hierarchy.GetParentIndices();
+  ASSERT_EQ(entities.size(), 5);
+  EXPECT_EQ(entities[0], root);
+  EXPECT_EQ(parents[0], TransformHierarchy::NO_PARENT);
+  for (uint32_t index = 1; index < entities.size(); ++index)
+  {
+    ASSERT_LT(parents[index], index);
+    EXPECT_EQ(registry.get<TransformComponent>(entities[index]).Parent,
+              entities[parents[index]]);
+  }
+}
+
+TEST(TransformHierarchyTests, OnlyDirtySubtreesAreRecomputed)
+{
+  entt::registry     registry;
+  entt::entity       root = CreateNode(registry, entt::null);
+  TransformHierarchy hierarchy(registry, root);
+
+  entt::entity moved = CreateNode(registry, root);
+  entt::entity child = CreateNode(registry, moved);
+  CreateNode(registry, child);
+  entt::entity sibling = CreateNode(registry, root, { 5.0F, 0.0F, 0.0F });
+  hierarchy.Update();
+
+  EXPECT_EQ(hierarchy.Update(), 0);
+
+  registry.get<TransformComponent>(moved).SetPosition({ 0.0F, 1.0F, 0.0F });
+  EXPECT_EQ(hierarchy.Update(), 3);
+  EXPECT_EQ(GetWorldPosition(hierarchy, child), glm::vec3(0.0F, 1.0F, 0.0F));
+  EXPECT_EQ(GetWorldPosition(hierarchy, sibling), glm::vec3(5.0F, 0.0F, 0.0F));
+}
+
+TEST(TransformHierarchyTests, ReparentingMovesTheSubtree)
+{
+  entt::registry     registry;
+  entt::entity       root = CreateNode(registry, entt::null);
+  TransformHierarchy hierarchy(registry, root);
+
+  entt::entity child = CreateNode(registry, root, { 1.0F, 0.0F, 0.0F });
+  entt::entity parent = CreateNode(registry, root, { 0.0F, 4.0F, 0.0F });
+  hierarchy.Update();
+  EXPECT_EQ(GetWorldPosition(hierarchy, child), glm::vec3(1.0F, 0.0F, 0.0F));
+
+  SetParent(registry, child, parent);
+  hierarchy.Update();
+
+  EXPECT_EQ(GetWorldPosition(hierarchy, child), glm::vec3(1.0F, 4.0F, 0.0F));
+}
+
+TEST(TransformHierarchyTests, DestroyedEntitiesAreRemoved)
+{
+  entt::registry     registry;
+  entt::entity       root = CreateNode(registry, entt::null);
+  TransformHierarchy hierarchy(registry, root);
+
+  entt::entity removed = CreateNode(registry, root);
+  entt::entity kept = CreateNode(registry, root, { 2.0F, 0.0F, 0.0F });
+  hierarchy.Update();
+
+  std::erase(registry.get<TransformComponent>(root).Children, removed);
+  registry.destroy(removed);
+  hierarchy.Update();
+
+  EXPECT_EQ(hierarchy.GetEntities().size(), 2);
+  EXPECT_EQ(GetWorldPosition(hierarchy, kept), glm::vec3(2.0F, 0.0F, 0.0F));
+}
+
+TEST(TransformHierarchyTests, UnknownTransformsFallBackToTheLocalMatrix)
+{
+  entt::registry     registry;
+  entt::entity       root = CreateNode(registry, entt::null);
+  TransformHierarchy hierarchy(registry, root);
+  hierarchy.Update();
+
+  entt::entity added = CreateNode(registry, root, { 0.0F, 0.0F, 7.0F });
+
+  EXPECT_EQ(GetWorldPosition(hierarchy, added), glm::vec3(0.0F, 0.0F, 7.0F));
+}
+
+TEST(TransformHierarchyTests, ReadingTheLocalMatrixKeepsTheTransformDirty)
+{
+  entt::registry     registry;
+  entt::entity       root = CreateNode(registry, entt::null);
+  TransformHierarchy hierarchy(registry, root);
+
+  entt::entity moved = CreateNode(registry, root);
+  hierarchy.Update();
+
+  auto& transform = registry.get<TransformComponent>(moved);
+  transform.SetPosition({ 0.0F, 0.0F, 6.0F });
+  EXPECT_EQ(glm::vec3(transform.GetMatrix()[3]), glm::vec3(0.0F, 0.0F, 6.0F));
+  EXPECT_TRUE(transform.DirtyFlag);
+
+  EXPECT_EQ(hierarchy.Update(), 1);
+  EXPECT_FALSE(transform.DirtyFlag);
+  EXPECT_EQ(GetWorldPosition(hierarchy, moved), glm::vec3(0.0F, 0.0F, 6.0F));
+}
+
+TEST(TransformHierarchyTests, LargeHierarchyRecomputesOnlyTheMovedSubtrees)
+{
+  UpdateMovingHierarchy(1);
+}
+
+TEST(TransformHierarchyTests, ParallelUpdateRecomputesOnlyTheMovedSubtrees)
+{
+  UpdateMovingHierarchy(4);
+}
+
+TEST(TransformHierarchyTests, ParallelUpdateDetectsReparenting)
+{
+  entt::registry     registry;
+  entt::entity       root = CreateNode(registry, entt::null);
+  TransformHierarchy hierarchy(registry, root);
+  hierarchy.SetThreadCount(4);
+
+  entt::entity parent = CreateNode(registry, root, { 0.0F, 4.0F, 0.0F });
+  entt::entity child = entt::null;
+  for (uint32_t index = 0; index < TransformHierarchy::MIN_PARALLEL_NODES;
+       ++index)
+  {
+    child = CreateNode(registry, root, { 1.0F, 0.0F, 0.0F });
+  }
+  hierarchy.Update();
+
+  SetParent(registry, child, parent);
+  hierarchy.Update();
+
+  EXPECT_EQ(GetWorldPosition(hierarchy, child), glm::vec3(1.0F, 4.0F, 0.0F));
+}
@@ -0,0 +1,194 @@
+#include "Core/Scene/IO/SceneBinary/SceneBinary.hpp"
+#include "Core/Scene/Scene.hpp"
+#include "Helper/SceneDataHelper.hpp"
+#include <cstring>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+using namespace Dwarf;
+using namespace testing;
+using namespace SceneDataHelper;
+
+namespace
+{
+  auto
+  CreateTestGraph() -> SceneGraphData
+  {
+    SceneGraphData graph;
+    graph.Settings = R"({"Fog":{"Start":10.0}})";
+
+    SceneEntityData sun = CreateEntityData("Sun");
+    sun.Rotation = { 45.0F, 30.0F, 0.0F };
+    SceneLightData light;
+    light.Type = LightType::SpotLight;
+    light.Color = { 1.0F, 0.5F, 0.25F };
+    light.Attenuation = 2.0F;
+    light.Radius = 40.0F;
+    light.OpeningAngle = 60.0F;
+    sun.Light = light;
+    graph.Entities.push_back(sun);
+
+    SceneEntityData house = CreateEntityData("House");
+    house.Position = { 1.0F, 2.0F, 3.0F };
+    house.Scale = { 2.0F, 2.0F, 2.0F };
+    SceneMeshRendererData meshRenderer;
+    meshRenderer.Model = UUID().toBytes();
+    meshRenderer.Materials.push_back({ 0, UUID().toBytes() });
+    meshRenderer.Materials.push_back({ 1, std::nullopt });
+    meshRenderer.IsHidden = true;
+    meshRenderer.CastShadow = false;
+    house.MeshRenderer = meshRenderer;
+    graph.Entities.push_back(house);
+
+    SceneEntityData door = CreateEntityData("Door", 1);
+    door.MeshRenderer = SceneMeshRendererData();
+    graph.Entities.push_back(door);
+    graph.Entities.push_back(CreateEntityData("Door", 1));
+    graph.Entities.push_back(CreateEntityData("Handle", 3));
+    return graph;
+  }
+
+  void
+  ExpectEqual(const glm::vec3& expected, const glm::vec3& actual)
+  {
+    EXPECT_EQ(expected.x, actual.x);
+    EXPECT_EQ(expected.y, actual.y);
+    EXPECT_EQ(expected.z, actual.z);
+  }
+}
+
+TEST(SceneBinaryTests, RoundTripsSceneGraph)
+{
+  SceneGraphData                graph = CreateTestGraph();
+  std::optional<SceneGraphData> result =
+    SceneBinary::Read(SceneBinary::Write(graph));
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(graph.Settings, result->Settings);
+  ASSERT_EQ(graph.Entities.size(), result->Entities.size());
+  for (size_t index = 0; index < graph.Entities.size(); ++index)
+  {
+    const SceneEntityData& expected = graph.Entities[index];
+    const SceneEntityData& actual = result->Entities[index];
+    EXPECT_EQ(expected.Id, actual.Id);
+    EXPECT_EQ(expected.Name, actual.Name);
+    EXPECT_EQ(expected.Parent, actual.Parent);
+    ExpectEqual(expected.Position, actual.Position);
+    ExpectEqual(expected.Rotation, actual.Rotation);
+    ExpectEqual(expected.Scale, actual.Scale);
+    EXPECT_EQ(expected.Light.has_value(), actual.Light.has_value());
+    EXPECT_EQ(expected.MeshRenderer.has_value(),
+              actual.MeshRenderer.has_value());
+  }
+
+  const SceneLightData& light = result->Entities[0].Light.value();
+  EXPECT_EQ(LightType::SpotLight, light.Type);
+  ExpectEqual({ 1.0F, 0.5F, 0.25F }, light.Color);
+  EXPECT_EQ(2.0F, light.Attenuation);
+  EXPECT_EQ(40.0F, light.Radius);
+  EXPECT_EQ(60.0F, light.OpeningAngle);
+
+  const SceneMeshRendererData& expectedMesh =
+    graph.Entities[1].MeshRenderer.value();
+  const SceneMeshRendererData& mesh = result->Entities[1].MeshRenderer.value();
+  EXPECT_EQ(expectedMesh.Model, mesh.Model);
+  EXPECT_TRUE(mesh.IsHidden);
+  EXPECT_FALSE(mesh.CastShadow);
+  ASSERT_EQ(2, mesh.Materials.size());
+  EXPECT_EQ(0, mesh.Materials[0].Index);
+  EXPECT_EQ(expectedMesh.Materials[0].Material, mesh.Materials[0].Material);
+  EXPECT_EQ(1, mesh.Materials[1].Index);
+  EXPECT_FALSE(mesh.Materials[1].Material.has_value());
+
+  const SceneMeshRendererData& emptyMesh =
+    result->Entities[2].MeshRenderer.value();
+  EXPECT_FALSE(emptyMesh.Model.has_value());
+  EXPECT_TRUE(emptyMesh.Materials.empty());
+  EXPECT_FALSE(emptyMesh.IsHidden);
+  EXPECT_TRUE(emptyMesh.CastShadow);
+}
+
+TEST(SceneBinaryTests, RoundTripsEmptyGraph)
+{
+  std::optional<SceneGraphData> result =
+    SceneBinary::Read(SceneBinary::Write(SceneGraphData()));
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_TRUE(result->Settings.empty());
+  EXPECT_TRUE(result->Entities.empty());
+}
+
+TEST(SceneBinaryTests, StoresRepeatedNamesOnce)
+{
+  SceneGraphData unique;
+  SceneGraphData repeated;
+  for (int index = 0; index < 100; ++index)
+  {
+    unique.Entities.push_back(
+      CreateEntityData(fmt::format("Entity with a long name {:03}", index)));
+    repeated.Entities.push_back(CreateEntityData("Entity with a long name"));
+  }
+
+  EXPECT_LT(SceneBinary::Write(repeated).size() + 90 * 20,
+            SceneBinary::Write(unique).size());
+}
+
+TEST(SceneBinaryTests, RejectsTruncatedData)
+{
+  std::vector<uint8_t> data = SceneBinary::Write(CreateTestGraph());
+
+  for (size_t size : { size_t(0), size_t(4), size_t(31), data.size() - 1 })
+  {
+    std::vector<uint8_t> truncated(data.begin(), data.begin() + size);
+    EXPECT_FALSE(SceneBinary::Read(truncated).has_value());
+  }
+}
+
+TEST(SceneBinaryTests, RejectsCorruptedData)
+{
+  std::vector<uint8_t> data = SceneBinary::Write(CreateTestGraph());
+  data[data.size() / 2] ^= 0xFF;
+
+  EXPECT_FALSE(SceneBinary::Read(data).has_value());
+}
+
+TEST(SceneBinaryTests, RejectsOtherVersions)
+{
+  std::vector<uint8_t> data = SceneBinary::Write(CreateTestGraph());
+  uint32_t             version = SceneBinary::FORMAT_VERSION + 1;
+  std::memcpy(data.data() + sizeof(uint32_t), &version, sizeof(version));
+
+  EXPECT_FALSE(SceneBinary::Read(data).has_value());
+}
+
+TEST(SceneBinaryTests, RejectsOtherFiles)
+{
+  std::string          text = R"({"Settings":{},"Graph":[]})";
+  std::vector<uint8_t> data(text.begin(), text.end());
+  data.resize(128);
+
+  EXPECT_FALSE(SceneBinary::Read(data).has_value());
+}
+
+TEST(SceneBinaryTests, DeserializesScene)
+{
+  SceneGraphData graph = CreateTestGraph();
+  graph.Entities[1].MeshRenderer.reset();
+  graph.Entities[2].MeshRenderer.reset();
+
+  Scene          scene(graph, nullptr, nullptr);
+  SceneGraphData result = scene.SerializeGraph();
+
+  ASSERT_EQ(graph.Entities.size(), result.Entities.size());
+  for (size_t index = 0; index < graph.Entities.size(); ++index)
+  {
+    EXPECT_EQ(graph.Entities[index].Id, result.Entities[index].Id);
+    EXPECT_EQ(graph.Entities[index].Name, result.Entities[index].Name);
+    EXPECT_EQ(graph.Entities[index].Parent, result.Entities[index].Parent);
+    ExpectEqual(graph.Entities[index].Position,
+                result.Entities[index].Position);
+  }
+  ASSERT_TRUE(result.Entities[0].Light.has_value());
+  EXPECT_EQ(LightType::SpotLight, result.Entities[0].Light->Type);
+  EXPECT_EQ(40.0F, result.Entities[0].Light->Radius);
+}
@@ -0,0 +1,204 @@
+#include "Core/Scene/IO/SceneWriter/SceneWriter.hpp"
+#include "Core/Scene/Scene.hpp"
+#include "Logging/IDwarfLogger.hpp"
+#include <fmt/format.h>
+#include <fstream>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace Dwarf;
+using namespace testing;
+
+namespace
+{
+  class MockLogger : public IDwarfLogger
+  {
+  public:
+    MOCK_METHOD(void, LogDebug, (const Log logMessage), (const, override));
+    MOCK_METHOD(void, LogInfo, (const Log logMessage), (const, override));
+    MOCK_METHOD(void, LogWarn, (const Log logMessage), (const, override));
+    MOCK_METHOD(void, LogError, (const Log logMessage), (const, override));
+  };
+
+  class MockSceneBinaryCache : public ISceneBinaryCache
+  {
+  public:
+    MOCK_METHOD(std::optional<SceneGraphData>,
+                Load,
+                (const IAssetReference& sceneAsset),
+                (override));
+    MOCK_METHOD(void,
+                Store,
+                (const UUID& sceneId, const SceneGraphData& graph),
+                (override));
+  };
+
+  class MockSceneProperties : public ISceneProperties
+  {
+  public:
+    MOCK_METHOD(nlohmann::json, Serialize, (), (override));
+    MOCK_METHOD(std::string, GetName, (), (const, override));
+    MOCK_METHOD(void, SetName, (const std::string& sceneName), (override));
+    MOCK_METHOD(const std::optional<UUID>&, GetAssetId, (), (const, override));
+    MOCK_METHOD(void, SetAssetId, (const UUID& id), (override));
+    MOCK_METHOD(ISceneSettings&, GetSettings, (), (const, override));
+  };
+
+  /// @brief Builds a scene with nested entities, lights and mesh renderers.
+  void
+  PopulateScene(Scene& scene, int rootCount)
+  {
+    for (int root = 0; root < rootCount; ++root)
+    {
+      Entity parent = scene.CreateEntity(fmt::format("Root {}", root));
+      parent.GetComponent<TransformComponent>().SetPosition(
+        { (float)root, 1.5F, -2.0F });
+      for (int index = 0; index < 3; ++index)
+      {
+        Entity child = scene.CreateEntity("Child \"quoted\"\nline");
+        child.SetParent(parent.GetHandle());
+        if (index == 1)
+        {
+          child.AddComponent<LightComponent>().Radius = 20.0F;
+        }
+        if (index == 2)
+        {
+          auto& meshRenderer = child.AddComponent<MeshRendererComponent>();
+          meshRenderer.MaterialAssets[0] = nullptr;
+          meshRenderer.IsHidden = true;
+        }
+      }
+    }
+  }
+
+  class SceneWriterTest : public Test
+  {
+  protected:
+    std::filesystem::path                           mProjectPath;
+    std::shared_ptr<NiceMock<MockLogger>>           mLogger;
+    std::shared_ptr<NiceMock<MockSceneBinaryCache>> mSceneBinaryCache;
+
+    void
+    SetUp() override
+    {
+      mProjectPath =
+        std::filesystem::temp_directory_path() / "DwarfSceneWriterTests";
+      std::filesystem::remove_all(mProjectPath);
+      std::filesystem::create_directories(mProjectPath / "Assets");
+      mLogger = std::make_shared<NiceMock<MockLogger>>();
+      mSceneBinaryCache = std::make_shared<NiceMock<MockSceneBinaryCache>>();
+    }
+
+    void
+    TearDown() override
+    {
+      std::filesystem::remove_all(mProjectPath);
+    }
+
+    auto
+    CreateWriter() -> std::unique_ptr<SceneWriter>
+    {
+      return std::make_unique<SceneWriter>(
+        ProjectPath(mProjectPath), mLogger, mSceneBinaryCache);
+    }
+
+    static auto
+    ReadFile(const std::filesystem::path& path) -> std::string
+    {
+      std::ifstream file(path);
+      return { std::istreambuf_iterator<char>(file),
+               std::istreambuf_iterator<char>() };
+    }
+  };
+}
+
+TEST(SceneWriterSerializationTests, MatchesSceneSerialization)
+{
+  auto properties = std::make_unique<NiceMock<MockSceneProperties>>();
+  ON_CALL(*properties, Serialize())
+    .WillByDefault(Return(
+      nlohmann::json::parse(R"({"Fog":{"Start":10.0},"Name":"Test"})")));
+  Scene scene(std::move(properties), nullptr);
+  PopulateScene(scene, 5);
+
+  SceneGraphData graph = scene.SerializeGraph();
+  std::string    expected = scene.Serialize().dump(2);
+
+  for (uint32_t threadCount : { 1U, 2U, 4U, 16U })
+  {
+    EXPECT_EQ(expected, SceneWriter::SerializeScene(graph, threadCount));
+  }
+}
+
+TEST(SceneWriterSerializationTests, SerializesEmptyScene)
+{
+  Scene scene(nullptr, nullptr);
+
+  EXPECT_EQ(scene.Serialize().dump(2),
+            SceneWriter::SerializeScene(scene.SerializeGraph(), 4));
+}
+
+TEST_F(SceneWriterTest, WritesSceneFileAndCooksBinary)
+{
+  std::filesystem::path scenePath = mProjectPath / "Assets" / "Test.dscene";
+  UUID                  sceneId;
+  SceneGraphData        graph;
+  graph.Entities.emplace_back().Name = "Entity";
+
+  EXPECT_CALL(*mSceneBinaryCache, Store(sceneId, _))
+    .WillOnce(
+      [&scenePath](const UUID&, const SceneGraphData& stored)
+      {
+        // The scene file is in place before the binary is cooked
+        EXPECT_TRUE(std::filesystem::exists(scenePath));
+        ASSERT_EQ(1, stored.Entities.size());
+        EXPECT_EQ("Entity", stored.Entities[0].Name);
+      });
+
+  bool                         written = false;
+  std::unique_ptr<SceneWriter> writer = CreateWriter();
+  writer->Write(graph, scenePath, sceneId, [&written]() { written = true; });
+  writer->Flush();
+
+  EXPECT_TRUE(written);
+  EXPECT_EQ(SceneWriter::SerializeScene(graph, 1) + "\n",
+            ReadFile(scenePath));
+  EXPECT_TRUE(std::filesystem::is_empty(
+    mProjectPath / SceneWriter::TEMPORARY_DIRECTORY));
+  EXPECT_EQ(1, std::distance(std::filesystem::directory_iterator(
+                               mProjectPath / "Assets"),
+                             std::filesystem::directory_iterator()));
+}
+
+TEST_F(SceneWriterTest, ReplacesExistingSceneFile)
+{
+  std::filesystem::path scenePath = mProjectPath / "Assets" / "Test.dscene";
+  std::ofstream(scenePath) << "old content";
+
+  SceneGraphData graph;
+  graph.Entities.emplace_back().Name = "New";
+  CreateWriter()->Write(graph, scenePath, UUID(), {});
+
+  // The destructor writes the queued scenes
+  EXPECT_EQ(SceneWriter::SerializeScene(graph, 1) + "\n",
+            ReadFile(scenePath));
+}
+
+TEST_F(SceneWriterTest, KeepsSceneFileWhenWriteFails)
+{
+  std::filesystem::path scenePath =
+    mProjectPath / "Missing" / "Directory" / "Test.dscene";
+  EXPECT_CALL(*mSceneBinaryCache, Store(_, _)).Times(0);
+  EXPECT_CALL(*mLogger, LogError(_)).Times(1);
+
+  bool                         written = false;
+  std::unique_ptr<SceneWriter> writer = CreateWriter();
+  writer->Write(
+    SceneGraphData(), scenePath, UUID(), [&written]() { written = true; });
+  writer->Flush();
+
+  EXPECT_FALSE(written);
+  EXPECT_FALSE(std::filesystem::exists(scenePath));
+  EXPECT_TRUE(std::filesystem::is_empty(
+    mProjectPath / SceneWriter::TEMPORARY_DIRECTORY));
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+#include "Core/Scene/Components/MeshRendererComponentHandle.hpp"
+#include "Helper/MeshSceneFixture.hpp"
+#include <future>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace Dwarf;
+using namespace testing;
+
+namespace
+{
+  class RenderProxySyncTests : public MeshSceneFixture
+  {
+  protected:
+    void
+    SetUp() override
+    {
+      // Two submeshes using the material slots 0 and 1
+      for (uint32_t slot = 0; slot < 2; ++slot)
+      {
+        AddMesh(glm::vec3(-1.0F), glm::vec3(1.0F), slot);
+      }
+    }
+
+    auto
+    CreateMeshEntity() -> Entity
+    {
+      std::map<int, std::unique_ptr<IAssetReference>> materials;
+      materials[1] = CreateReference(mMaterialId, mMaterial, mMaterialValid);
+      return MeshSceneFixture::CreateMeshEntity(
+        "Mesh", glm::vec3(0.0F), std::move(materials));
+    }
+  };
+}
+
+TEST_F(RenderProxySyncTests, ResolvesMeshRenderers)
+{
+  Entity entity = CreateMeshEntity();
+  mScene.CreateEntity("Empty");
+
+  auto& registry = mScene.GetRegistry();
+  ASSERT_EQ(1, registry.view<RenderProxyComponent>().size());
+  const auto& proxy = registry.get<RenderProxyComponent>(entity.GetHandle());
+  EXPECT_TRUE(proxy.IsVisible());
+  EXPECT_TRUE(proxy.CastsShadow());
+  EXPECT_EQ(glm::vec3(-1.0F), proxy.LocalBounds.Min);
+  EXPECT_EQ(glm::vec3(1.0F), proxy.LocalBounds.Max);
+
+  // Only the submesh with a material assigned is rendered
+  ASSERT_EQ(1, proxy.Meshes.size());
+  EXPECT_EQ(mModel.Meshes()[1], proxy.Meshes[0].Mesh);
+  EXPECT_EQ(&mMaterial, proxy.Meshes[0].Material);
+}
+
+TEST_F(RenderProxySyncTests, FollowsMeshRendererChanges)
+{
+  Entity                      entity = CreateMeshEntity();
+  MeshRendererComponentHandle meshRenderer(mScene.GetRegistry(),
+                                           entity.GetHandle());
+  auto&                       registry = mScene.GetRegistry();
+
+  meshRenderer.SetIsHidden(true);
+  meshRenderer.SetCastShadow(false);
+  EXPECT_EQ(0, registry.get<RenderProxyComponent>(entity.GetHandle()).Flags);
+
+  meshRenderer.SetMaterialAsset(
+    0, CreateReference(mMaterialId, mMaterial, mMaterialValid));
+  EXPECT_EQ(2,
+            registry.get<RenderProxyComponent>(entity.GetHandle())
+              .Meshes.size());
+
+  meshRenderer.SetModelAsset(nullptr);
+  const auto& proxy = registry.get<RenderProxyComponent>(entity.GetHandle());
+  EXPECT_TRUE(proxy.Meshes.empty());
+  EXPECT_TRUE(proxy.LocalBounds.IsEmpty());
+
+  registry.remove<MeshRendererComponent>(entity.GetHandle());
+  EXPECT_FALSE(registry.all_of<RenderProxyComponent>(entity.GetHandle()));
+}
+
+TEST_F(RenderProxySyncTests, RefreshesAfterAssetChanges)
+{
+  Entity entity = CreateMeshEntity();
+  mScene.GetTransformHierarchy().Update();
+  mScene.GetSpatialIndex().Update();
+
+  // A reimported model with another extent and a removed material
+  AddMesh(glm::vec3(-4.0F), glm::vec3(4.0F), 1);
+  mMaterialValid = false;
+  mScene.GetRenderProxies().RefreshAll();
+  EXPECT_FALSE(mScene.GetRenderProxies().IsRefreshing());
+
+  const auto& proxy =
+    mScene.GetRegistry().get<RenderProxyComponent>(entity.GetHandle());
+  EXPECT_TRUE(proxy.Meshes.empty());
+  EXPECT_EQ(glm::vec3(4.0F), proxy.LocalBounds.Max);
+
+  // The spatial index picks up the refreshed bounds
+  mScene.GetSpatialIndex().Update();
+  EXPECT_EQ(glm::vec3(4.0F),
+            mScene.GetSpatialIndex().GetBounds(entity.GetHandle()).Max);
+}
+
+TEST_F(RenderProxySyncTests, ChangesProxiesOnlyUnderTheMutex)
+{
+  Entity                      entity = CreateMeshEntity();
+  MeshRendererComponentHandle meshRenderer(mScene.GetRegistry(),
+                                           entity.GetHandle());
+  const auto&                 proxy =
+    mScene.GetRegistry().get<RenderProxyComponent>(entity.GetHandle());
+
+  // A reader such as the draw call worker holds the mutex, the edit can't
+  // change the proxy before it is released
+  std::unique_lock<std::mutex> lock(mScene.GetRenderProxies().GetMutex());
+  std::promise<void>           editing;
+  std::thread                  editor(
+    [&meshRenderer, &editing]()
+    {
+      editing.set_value();
+      meshRenderer.SetIsHidden(true);
+    });
+  editing.get_future().wait();
+  EXPECT_TRUE(proxy.IsVisible());
+
+  lock.unlock();
+  editor.join();
+  EXPECT_FALSE(proxy.IsVisible());
+}
\ No newline at end of file
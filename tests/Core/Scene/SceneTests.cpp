@@ -1,9 +1,222 @@
-// #include <Core/Asset/AssetDatabase.h>
+#include "Core/Scene/Scene.hpp"
+#include "Helper/SceneDataHelper.hpp"
 #include <gtest/gtest.h>
 
-// TEST(SceneTests, Sample)
-// {
-//   const auto expected = 1;
-//   //   const auto actual = multiply(1, 1);
-//   ASSERT_EQ(expected, 1);
-// }
\ No newline at end of file
+using namespace Dwarf;
+using namespace testing;
+using namespace SceneDataHelper;
+
+namespace
+{
+  /// @brief Records the mesh renderer signals of a scene.
+  struct MeshRendererListener
+  {
+    IScene* Scene = nullptr;
+    int     Constructed = 0;
+    int     ConstructedWhileCreating = 0;
+    int     Updated = 0;
+
+    void
+    OnConstruct(entt::registry& registry, entt::entity entity)
+    {
+      ++Constructed;
+      ConstructedWhileCreating += Scene->IsCreatingEntities() ? 1 : 0;
+    }
+
+    void
+    OnUpdate(entt::registry& registry, entt::entity entity)
+    {
+      ++Updated;
+    }
+  };
+
+  /// @brief Counts the batch notifications of a scene.
+  struct BatchObserver : public ISceneObserver
+  {
+    IScene* Scene = nullptr;
+    int     BatchesCreated = 0;
+
+    void
+    OnEntityCreated() override
+    {
+    }
+
+    void
+    OnEntityDeleted() override
+    {
+    }
+
+    void
+    OnEntitiesCreated() override
+    {
+      EXPECT_FALSE(Scene->IsCreatingEntities());
+      ++BatchesCreated;
+    }
+  };
+}
+
+TEST(SceneTests, CreateEntitiesBuildsHierarchy)
+{
+  Scene  scene(nullptr, nullptr);
+  Entity existing = scene.CreateEntity("Existing");
+
+  SceneGraphData graph;
+  graph.Entities.push_back(CreateEntityData("House"));
+  graph.Entities.push_back(CreateEntityData("Door", 0));
+  graph.Entities.push_back(CreateEntityData("Handle", 1));
+  graph.Entities.push_back(CreateEntityData("Window", 0));
+  graph.Entities.push_back(CreateEntityData(""));
+  graph.Entities[1].Position = { 1.0F, 2.0F, 3.0F };
+
+  std::vector<entt::entity> handles =
+    scene.CreateEntities(graph, scene.GetRootEntity().GetHandle());
+
+  ASSERT_EQ(5, handles.size());
+  EXPECT_EQ((std::vector<entt::entity>{
+              existing.GetHandle(), handles[0], handles[4] }),
+            scene.GetRootEntity().GetChildren());
+  EXPECT_EQ((std::vector<entt::entity>{ handles[1], handles[3] }),
+            Entity(handles[0], scene.GetRegistry()).GetChildren());
+  EXPECT_EQ(handles[1], Entity(handles[2], scene.GetRegistry()).GetParent());
+  EXPECT_EQ(scene.GetRootEntity().GetHandle(),
+            Entity(handles[4], scene.GetRegistry()).GetParent());
+
+  for (size_t index = 0; index < handles.size(); ++index)
+  {
+    Entity entity(handles[index], scene.GetRegistry());
+    EXPECT_EQ(UUID(graph.Entities[index].Id), entity.GetUID());
+  }
+  EXPECT_EQ("Door",
+            scene.GetRegistry().get<NameComponent>(handles[1]).Name);
+  EXPECT_EQ("Entity",
+            scene.GetRegistry().get<NameComponent>(handles[4]).Name);
+  EXPECT_EQ(2.0F,
+            scene.GetRegistry()
+              .get<TransformComponent>(handles[1])
+              .GetPosition()
+              .y);
+}
+
+TEST(SceneTests, CreateEntitiesNotifiesObserversOnce)
+{
+  Scene                scene(nullptr, nullptr);
+  MeshRendererListener listener;
+  listener.Scene = &scene;
+  BatchObserver observer;
+  observer.Scene = &scene;
+  scene.RegisterSceneObserver(&observer);
+  scene.GetRegistry()
+    .on_construct<MeshRendererComponent>()
+    .connect<&MeshRendererListener::OnConstruct>(listener);
+  scene.GetRegistry()
+    .on_update<MeshRendererComponent>()
+    .connect<&MeshRendererListener::OnUpdate>(listener);
+
+  SceneGraphData graph;
+  for (int index = 0; index < 10; ++index)
+  {
+    SceneEntityData& entity = graph.Entities.emplace_back(
+      CreateEntityData("Mesh", index > 0 ? 0 : SceneEntityData::NO_PARENT));
+    entity.MeshRenderer.emplace().IsHidden = index % 2 == 0;
+  }
+  uint64_t                  version = scene.GetChangeTracker().GetVersion();
+  std::vector<entt::entity> handles =
+    scene.CreateEntities(graph, scene.GetRootEntity().GetHandle());
+
+  // No mesh renderer is updated to notify the listeners
+  EXPECT_FALSE(scene.IsCreatingEntities());
+  EXPECT_EQ(10, listener.Constructed);
+  EXPECT_EQ(10, listener.ConstructedWhileCreating);
+  EXPECT_EQ(0, listener.Updated);
+  EXPECT_EQ(1, observer.BatchesCreated);
+  // Name, transform and mesh renderer of every entity and the children of
+  // the root are the only recorded changes
+  EXPECT_EQ(version + (10 * 3) + 1, scene.GetChangeTracker().GetVersion());
+  EXPECT_TRUE(
+    scene.GetRegistry().get<MeshRendererComponent>(handles[4]).IsHidden);
+  EXPECT_FALSE(
+    scene.GetRegistry().get<MeshRendererComponent>(handles[5]).IsHidden);
+}
+
+TEST(SceneTests, DeserializesNestedEntities)
+{
+  Scene  source(nullptr, nullptr);
+  Entity parent = source.CreateEntity("Parent");
+  Entity child = source.CreateEntity("Child");
+  child.SetParent(parent.GetHandle());
+  child.AddComponent<LightComponent>().Type = LightType::PointLight;
+  child.GetComponent<TransformComponent>().SetPosition({ 0.0F, 5.0F, 0.0F });
+
+  nlohmann::json serializedGraph = nlohmann::json::array();
+  serializedGraph.push_back(parent.Serialize());
+  Scene scene(SerializedGraph(serializedGraph), nullptr, nullptr);
+
+  ASSERT_EQ(1, scene.GetRootEntity().GetChildren().size());
+  Entity loadedParent(scene.GetRootEntity().GetChildren()[0],
+                      scene.GetRegistry());
+  EXPECT_EQ(parent.GetUID(), loadedParent.GetUID());
+  ASSERT_EQ(1, loadedParent.GetChildren().size());
+  Entity loadedChild(loadedParent.GetChildren()[0], scene.GetRegistry());
+  EXPECT_EQ(child.GetUID(), loadedChild.GetUID());
+  EXPECT_EQ(LightType::PointLight,
+            loadedChild.GetComponent<LightComponent>().Type);
+  EXPECT_EQ(5.0F,
+            loadedChild.GetComponent<TransformComponent>().GetPosition().y);
+}
+
+TEST(SceneTests, CountsComponentChanges)
+{
+  SceneGraphData graph;
+  graph.Entities.push_back(CreateEntityData("Parent"));
+  graph.Entities.push_back(CreateEntityData("Child", 0));
+  Scene scene(graph, nullptr, nullptr);
+  EXPECT_FALSE(scene.HasUnsavedChanges());
+
+  Entity   parent(scene.GetRootEntity().GetChildren()[0], scene.GetRegistry());
+  uint64_t version = scene.GetChangeTracker().GetVersion();
+  Entity   entity = scene.CreateEntity("Entity");
+  EXPECT_LT(version, scene.GetChangeTracker().GetVersion());
+  EXPECT_TRUE(scene.HasUnsavedChanges());
+
+  scene.MarkSaved();
+  EXPECT_FALSE(scene.HasUnsavedChanges());
+  entity.SetParent(parent.GetHandle());
+  EXPECT_TRUE(scene.HasUnsavedChanges());
+
+  scene.MarkSaved();
+  scene.GetRegistry().patch<NameComponent>(entity.GetHandle());
+  EXPECT_TRUE(scene.HasUnsavedChanges());
+
+  scene.MarkSaved();
+  entity.AddComponent<LightComponent>();
+  EXPECT_TRUE(scene.HasUnsavedChanges());
+
+  scene.MarkSaved();
+  scene.DeleteEntity(entity);
+  EXPECT_TRUE(scene.HasUnsavedChanges());
+
+  // Reading components does not count as a change
+  scene.MarkSaved();
+  version = scene.GetChangeTracker().GetVersion();
+  scene.GetRegistry().get<TransformComponent>(parent.GetHandle());
+  scene.SerializeGraph();
+  EXPECT_EQ(version, scene.GetChangeTracker().GetVersion());
+  EXPECT_FALSE(scene.HasUnsavedChanges());
+}
+
+TEST(SceneTests, SaveCallbackMarksTheSnapshotAsSaved)
+{
+  Scene  scene(nullptr, nullptr);
+  Entity entity = scene.CreateEntity("Entity");
+
+  std::function<void()> onSaved = scene.CreateSaveCallback();
+  EXPECT_TRUE(scene.HasUnsavedChanges());
+  onSaved();
+  EXPECT_FALSE(scene.HasUnsavedChanges());
+
+  // Changes made while the snapshot was written stay unsaved
+  onSaved = scene.CreateSaveCallback();
+  entity.AddComponent<LightComponent>();
+  onSaved();
+  EXPECT_TRUE(scene.HasUnsavedChanges());
+}
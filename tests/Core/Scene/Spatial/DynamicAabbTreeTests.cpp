@@ -0,0 +1,208 @@
+#include "Core/Scene/Spatial/DynamicAabbTree.hpp"
+#include "Helper/BoundingBoxHelper.hpp"
+#include <gtest/gtest.h>
+
+using namespace Dwarf;
+using namespace testing;
+using namespace BoundingBoxHelper;
+
+namespace
+{
+  auto
+  Sorted(std::vector<entt::entity> entities) -> std::vector<entt::entity>
+  {
+    std::ranges::sort(entities);
+    return entities;
+  }
+
+  auto
+  BuildTree(const std::vector<BoundingBox>& boxes) -> DynamicAabbTree
+  {
+    DynamicAabbTree tree;
+    for (uint32_t index = 0; index < boxes.size(); ++index)
+    {
+      tree.CreateProxy(boxes[index], (entt::entity)index);
+    }
+    return tree;
+  }
+}
+
+TEST(DynamicAabbTreeTests, QueriesMatchBruteForce)
+{
+  std::vector<BoundingBox> boxes = CreateBoxes(2000, 100.0F, 1);
+  DynamicAabbTree          tree = BuildTree(boxes);
+  ASSERT_EQ(2000, tree.GetProxyCount());
+
+  std::vector<entt::entity> results;
+
+  BoundingBox box = { glm::vec3(-20.0F, -30.0F, -10.0F),
+                      glm::vec3(30.0F, 20.0F, 40.0F) };
+  tree.QueryBox(box, results);
+  EXPECT_EQ(BruteForce(boxes, [&](const BoundingBox& other)
+                       { return other.Overlaps(box); }),
+            Sorted(results));
+  EXPECT_FALSE(results.empty());
+
+  tree.QuerySphere(glm::vec3(10.0F, 0.0F, -5.0F), 25.0F, results);
+  EXPECT_EQ(BruteForce(boxes,
+                       [](const BoundingBox& other) {
+                         return other.OverlapsSphere(
+                           glm::vec3(10.0F, 0.0F, -5.0F), 25.0F);
+                       }),
+            Sorted(results));
+  EXPECT_FALSE(results.empty());
+
+  CullingFrustum frustum =
+    CreateFrustum(glm::vec3(0.0F, 0.0F, 150.0F), glm::vec3(0.0F), 200.0F);
+  tree.QueryFrustum(frustum, results);
+  EXPECT_EQ(BruteForce(boxes, [&](const BoundingBox& other)
+                       { return IsInFrustum(frustum, other); }),
+            Sorted(results));
+  EXPECT_FALSE(results.empty());
+}
+
+TEST(DynamicAabbTreeTests, RayHitsAreOrderedByDistance)
+{
+  std::vector<BoundingBox> boxes;
+  for (int index = 0; index < 10; ++index)
+  {
+    glm::vec3 center((float)index * 5.0F, 0.0F, 0.0F);
+    boxes.push_back({ center - glm::vec3(1.0F), center + glm::vec3(1.0F) });
+  }
+  boxes.push_back(
+    { glm::vec3(0.0F, 5.0F, -1.0F), glm::vec3(2.0F, 6.0F, 1.0F) });
+  DynamicAabbTree tree = BuildTree(boxes);
+
+  std::vector<SpatialRayHit> hits;
+  tree.QueryRay(glm::vec3(-10.0F, 0.0F, 0.0F),
+                glm::vec3(1.0F, 0.0F, 0.0F),
+                30.0F,
+                hits);
+
+  // The boxes entered within the maximum distance of the ray
+  ASSERT_EQ(5, hits.size());
+  for (uint32_t index = 0; index < hits.size(); ++index)
+  {
+    EXPECT_EQ((entt::entity)index, hits[index].Entity);
+    EXPECT_FLOAT_EQ(9.0F + (5.0F * (float)index), hits[index].Distance);
+  }
+
+  // Rays starting inside a box hit it at distance 0
+  tree.QueryRay(glm::vec3(1.0F, 5.5F, 0.0F),
+                glm::vec3(0.0F, 1.0F, 0.0F),
+                100.0F,
+                hits);
+  ASSERT_EQ(1, hits.size());
+  EXPECT_EQ((entt::entity)10, hits[0].Entity);
+  EXPECT_EQ(0.0F, hits[0].Distance);
+}
+
+TEST(DynamicAabbTreeTests, AxisAlignedRaysHitAlongBoxFaces)
+{
+  DynamicAabbTree tree = BuildTree(
+    { { glm::vec3(0.0F), glm::vec3(2.0F) },
+      { glm::vec3(4.0F, 0.0F, 0.0F), glm::vec3(6.0F, 2.0F, 2.0F) } });
+
+  // The rays run within the planes of the box faces
+  std::vector<SpatialRayHit> hits;
+  tree.QueryRay(glm::vec3(-1.0F, 2.0F, 0.0F),
+                glm::vec3(1.0F, 0.0F, 0.0F),
+                100.0F,
+                hits);
+  ASSERT_EQ(2, hits.size());
+  EXPECT_EQ(1.0F, hits[0].Distance);
+  EXPECT_EQ(5.0F, hits[1].Distance);
+
+  tree.QueryRay(glm::vec3(0.0F, 0.0F, -1.0F),
+                glm::vec3(0.0F, 0.0F, 1.0F),
+                100.0F,
+                hits);
+  ASSERT_EQ(1, hits.size());
+  EXPECT_EQ((entt::entity)0, hits[0].Entity);
+
+  // Parallel rays outside the slab miss
+  tree.QueryRay(glm::vec3(-1.0F, 2.5F, 1.0F),
+                glm::vec3(1.0F, 0.0F, 0.0F),
+                100.0F,
+                hits);
+  EXPECT_TRUE(hits.empty());
+}
+
+TEST(DynamicAabbTreeTests, SmallMovementsKeepTheFatBounds)
+{
+  DynamicAabbTree tree;
+  BoundingBox     bounds = { glm::vec3(-1.0F), glm::vec3(1.0F) };
+  uint32_t        proxy = tree.CreateProxy(bounds, (entt::entity)7);
+  tree.CreateProxy({ glm::vec3(10.0F), glm::vec3(11.0F) }, (entt::entity)8);
+  BoundingBox fatBounds = tree.GetFatBounds(proxy);
+  EXPECT_TRUE(fatBounds.Contains(bounds));
+  EXPECT_NE(fatBounds.Min, bounds.Min);
+
+  BoundingBox moved = { bounds.Min + glm::vec3(0.1F),
+                        bounds.Max + glm::vec3(0.1F) };
+  EXPECT_FALSE(tree.MoveProxy(proxy, moved));
+  EXPECT_EQ(fatBounds.Min, tree.GetFatBounds(proxy).Min);
+
+  // Queries use the exact bounds, not the fat ones
+  std::vector<entt::entity> results;
+  tree.QueryBox({ glm::vec3(-1.05F), glm::vec3(-1.0F) }, results);
+  EXPECT_TRUE(results.empty());
+  tree.QueryBox({ glm::vec3(1.05F), glm::vec3(1.06F) }, results);
+  EXPECT_EQ(std::vector<entt::entity>{ (entt::entity)7 }, results);
+
+  BoundingBox farAway = { glm::vec3(50.0F), glm::vec3(52.0F) };
+  EXPECT_TRUE(tree.MoveProxy(proxy, farAway));
+  EXPECT_TRUE(tree.GetFatBounds(proxy).Contains(farAway));
+  tree.QuerySphere(glm::vec3(51.0F), 0.5F, results);
+  EXPECT_EQ(std::vector<entt::entity>{ (entt::entity)7 }, results);
+}
+
+TEST(DynamicAabbTreeTests, RemovesAndReusesProxies)
+{
+  std::vector<BoundingBox> boxes = CreateBoxes(500, 50.0F, 2);
+  DynamicAabbTree          tree;
+  std::vector<uint32_t>    proxies;
+  for (uint32_t index = 0; index < boxes.size(); ++index)
+  {
+    proxies.push_back(tree.CreateProxy(boxes[index], (entt::entity)index));
+  }
+
+  for (uint32_t index = 0; index < boxes.size(); index += 2)
+  {
+    tree.DestroyProxy(proxies[index]);
+  }
+  EXPECT_EQ(250, tree.GetProxyCount());
+
+  std::vector<entt::entity> results;
+  BoundingBox everything = { glm::vec3(-100.0F), glm::vec3(100.0F) };
+  tree.QueryBox(everything, results);
+  EXPECT_EQ(BruteForce(boxes,
+                       [&](const BoundingBox& box)
+                       { return (&box - boxes.data()) % 2 == 1; }),
+            Sorted(results));
+
+  uint32_t reused = tree.CreateProxy(boxes[0], (entt::entity)1000);
+  EXPECT_LT(reused, 2 * boxes.size());
+  tree.QueryBox(boxes[0], results);
+  EXPECT_NE(results.end(), std::ranges::find(results, (entt::entity)1000));
+
+  tree.Clear();
+  EXPECT_EQ(0, tree.GetProxyCount());
+  EXPECT_EQ(0, tree.GetHeight());
+  tree.QueryBox(everything, results);
+  EXPECT_TRUE(results.empty());
+}
+
+TEST(DynamicAabbTreeTests, StaysBalancedForSortedInsertion)
+{
+  // Boxes inserted along a line would degenerate into a list without
+  // rotations
+  DynamicAabbTree tree;
+  for (int index = 0; index < 4096; ++index)
+  {
+    glm::vec3 min((float)index * 2.0F, 0.0F, 0.0F);
+    tree.CreateProxy({ min, min + glm::vec3(1.0F) }, (entt::entity)index);
+  }
+
+  EXPECT_LE(tree.GetHeight(), 2 * 12);
+}
\ No newline at end of file
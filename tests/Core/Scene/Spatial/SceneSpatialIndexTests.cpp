@@ -0,0 +1,102 @@
+#include "Core/Scene/Components/MeshRendererComponentHandle.hpp"
+#include "Helper/MeshSceneFixture.hpp"
+#include <gtest/gtest.h>
+
+using namespace Dwarf;
+using namespace testing;
+
+namespace
+{
+  class SceneSpatialIndexTests : public MeshSceneFixture
+  {
+  protected:
+    void
+    SetUp() override
+    {
+      // A unit cube around the origin
+      AddMesh(glm::vec3(-1.0F), glm::vec3(1.0F), 0);
+    }
+
+    void
+    Update()
+    {
+      mScene.GetTransformHierarchy().Update();
+      mScene.GetSpatialIndex().Update();
+    }
+  };
+}
+
+TEST_F(SceneSpatialIndexTests, IndexesMeshRenderersInWorldSpace)
+{
+  Entity parent = mScene.CreateEntity("Parent");
+  parent.GetComponent<TransformComponent>().SetPosition({ 10.0F, 0.0F, 0.0F });
+  Entity child = CreateMeshEntity("Child", { 0.0F, 5.0F, 0.0F });
+  child.SetParent(parent.GetHandle());
+  mScene.CreateEntity("Empty");
+
+  SceneSpatialIndex& index = mScene.GetSpatialIndex();
+  EXPECT_EQ(0, index.GetTree().GetProxyCount());
+
+  Update();
+  ASSERT_EQ(1, index.GetTree().GetProxyCount());
+  BoundingBox bounds = index.GetBounds(child.GetHandle());
+  EXPECT_EQ(glm::vec3(9.0F, 4.0F, -1.0F), bounds.Min);
+  EXPECT_EQ(glm::vec3(11.0F, 6.0F, 1.0F), bounds.Max);
+  EXPECT_TRUE(index.GetBounds(parent.GetHandle()).IsEmpty());
+
+  std::vector<entt::entity> results;
+  index.QuerySphere({ 10.0F, 5.0F, 3.0F }, 2.5F, results);
+  EXPECT_EQ(std::vector<entt::entity>{ child.GetHandle() }, results);
+
+  std::vector<SpatialRayHit> hits;
+  index.QueryRay(
+    { 10.0F, 20.0F, 0.0F }, { 0.0F, -1.0F, 0.0F }, 100.0F, hits);
+  ASSERT_EQ(1, hits.size());
+  EXPECT_EQ(14.0F, hits[0].Distance);
+}
+
+TEST_F(SceneSpatialIndexTests, RefitsMovedSubtrees)
+{
+  Entity parent = mScene.CreateEntity("Parent");
+  Entity child = CreateMeshEntity("Child", { 0.0F, 0.0F, 0.0F });
+  Entity other = CreateMeshEntity("Other", { -20.0F, 0.0F, 0.0F });
+  child.SetParent(parent.GetHandle());
+  Update();
+
+  parent.GetComponent<TransformComponent>().SetPosition({ 30.0F, 0.0F, 0.0F });
+  Update();
+
+  std::vector<entt::entity> results;
+  mScene.GetSpatialIndex().QueryBox(
+    { glm::vec3(-2.0F), glm::vec3(2.0F) }, results);
+  EXPECT_TRUE(results.empty());
+  mScene.GetSpatialIndex().QueryBox(
+    { glm::vec3(28.0F, -2.0F, -2.0F), glm::vec3(32.0F, 2.0F, 2.0F) },
+    results);
+  EXPECT_EQ(std::vector<entt::entity>{ child.GetHandle() }, results);
+  EXPECT_EQ(glm::vec3(-21.0F, -1.0F, -1.0F),
+            mScene.GetSpatialIndex().GetBounds(other.GetHandle()).Min);
+}
+
+TEST_F(SceneSpatialIndexTests, RemovesEntitiesWithoutModels)
+{
+  Entity first = CreateMeshEntity("First", { 0.0F, 0.0F, 0.0F });
+  Entity second = CreateMeshEntity("Second", { 5.0F, 0.0F, 0.0F });
+  Update();
+  ASSERT_EQ(2, mScene.GetSpatialIndex().GetTree().GetProxyCount());
+
+  MeshRendererComponentHandle(mScene.GetRegistry(), first.GetHandle())
+    .SetModelAsset(nullptr);
+  Update();
+  EXPECT_EQ(1, mScene.GetSpatialIndex().GetTree().GetProxyCount());
+  EXPECT_TRUE(mScene.GetSpatialIndex().GetBounds(first.GetHandle()).IsEmpty());
+
+  mScene.DeleteEntity(second);
+  EXPECT_EQ(0, mScene.GetSpatialIndex().GetTree().GetProxyCount());
+  Update();
+
+  std::vector<entt::entity> results;
+  mScene.GetSpatialIndex().QueryBox(
+    { glm::vec3(-10.0F), glm::vec3(10.0F) }, results);
+  EXPECT_TRUE(results.empty());
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+#include "Core/GenericComponents.hpp"
+#include "Core/UUID.hpp"
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+#include <unordered_set>
+
+using namespace Dwarf;
+using namespace testing;
+
+TEST(UUIDTests, GeneratesVersion4UUIDs)
+{
+  for (int index = 0; index < 1000; ++index)
+  {
+    UUIDBytes bytes = UUID().toBytes();
+    EXPECT_EQ(0x40, bytes[6] & 0xF0);
+    EXPECT_EQ(0x80, bytes[8] & 0xC0);
+  }
+}
+
+TEST(UUIDTests, GeneratesUniqueUUIDsOnAllThreads)
+{
+  constexpr int THREAD_COUNT = 4;
+  constexpr int UUID_COUNT = 10000;
+
+  std::vector<std::vector<UUID>> generated(THREAD_COUNT);
+  std::vector<std::thread>       threads;
+  for (int thread = 0; thread < THREAD_COUNT; ++thread)
+  {
+    threads.emplace_back(
+      [&generated, thread]()
+      {
+        for (int index = 0; index < UUID_COUNT; ++index)
+        {
+          generated[thread].emplace_back();
+        }
+      });
+  }
+  for (std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  std::unordered_set<UUID> unique;
+  for (const std::vector<UUID>& uuids : generated)
+  {
+    unique.insert(uuids.begin(), uuids.end());
+  }
+  EXPECT_EQ(THREAD_COUNT * UUID_COUNT, unique.size());
+}
+
+TEST(UUIDTests, ParsesAndFormatsStrings)
+{
+  UUID uuid("0123abcd-4567-89ef-0123-456789abcdef");
+
+  EXPECT_EQ("0123abcd-4567-89ef-0123-456789abcdef", uuid.toString());
+  EXPECT_EQ(0x01, uuid.toBytes()[0]);
+  EXPECT_EQ(0xEF, uuid.toBytes()[15]);
+  EXPECT_EQ(uuid, UUID("{0123ABCD-4567-89EF-0123-456789ABCDEF}"));
+  EXPECT_EQ(uuid, UUID("0123abcd456789ef0123456789abcdef"));
+
+  UUID generated;
+  EXPECT_EQ(generated, UUID(generated.toString()));
+}
+
+TEST(UUIDTests, RejectsInvalidStrings)
+{
+  EXPECT_THROW(UUID(""), std::runtime_error);
+  EXPECT_THROW(UUID("0123abcd-4567-89ef-0123-456789abcde"), std::runtime_error);
+  EXPECT_THROW(UUID("0123abcd-4567-89ef-0123-456789abcdef0"),
+               std::runtime_error);
+  EXPECT_THROW(UUID("0123abcd-4567-89ef-0123-456789abcdeg"),
+               std::runtime_error);
+}
+
+TEST(UUIDTests, MatchesBoostFormatting)
+{
+  boost::uuids::uuid reference = boost::uuids::random_generator()();
+  UUID               uuid(boost::uuids::to_string(reference));
+  UUIDBytes          bytes = uuid.toBytes();
+
+  EXPECT_EQ(boost::uuids::to_string(reference), uuid.toString());
+  EXPECT_TRUE(std::equal(
+    reference.begin(), reference.end(), bytes.begin(), bytes.end()));
+}
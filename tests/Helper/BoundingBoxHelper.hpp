@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Core/Scene/Spatial/DynamicAabbTree.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+
+/// @brief Random bounding boxes and brute force queries to compare the
+/// spatial index against.
+namespace BoundingBoxHelper
+{
+  /// @brief Creates boxes of random size scattered over a cube.
+  inline auto
+  CreateBoxes(uint32_t count, float worldSize, uint32_t seed)
+    -> std::vector<Dwarf::BoundingBox>
+  {
+    std::mt19937                          random(seed);
+    std::uniform_real_distribution<float> position(-worldSize, worldSize);
+    std::uniform_real_distribution<float> size(0.1F, 2.0F);
+
+    std::vector<Dwarf::BoundingBox> boxes(count);
+    for (Dwarf::BoundingBox& box : boxes)
+    {
+      glm::vec3 center(position(random), position(random), position(random));
+      glm::vec3 extents(size(random), size(random), size(random));
+      box = { center - extents, center + extents };
+    }
+    return boxes;
+  }
+
+  inline auto
+  CreateFrustum(glm::vec3 position, glm::vec3 target, float farPlane)
+    -> Dwarf::CullingFrustum
+  {
+    glm::mat4 projection =
+      glm::perspective(glm::radians(60.0F), 16.0F / 9.0F, 0.1F, farPlane);
+    glm::mat4 view = glm::lookAt(position, target, glm::vec3(0, 1, 0));
+    return Dwarf::ClusterCuller::CreateFrustum(projection * view, position);
+  }
+
+  inline auto
+  IsInFrustum(const Dwarf::CullingFrustum& frustum,
+              const Dwarf::BoundingBox&    box) -> bool
+  {
+    for (const glm::vec4& plane : frustum.Planes)
+    {
+      glm::vec3 normal = glm::vec3(plane);
+      if (glm::dot(normal, box.GetCenter()) + plane.w <
+          -glm::dot(glm::abs(normal), box.GetExtents()))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// @brief Collects the indices of the boxes passing a test, the entity of
+  /// every box is its index.
+  template<typename Test>
+  auto
+  BruteForce(const std::vector<Dwarf::BoundingBox>& boxes, Test test)
+    -> std::vector<entt::entity>
+  {
+    std::vector<entt::entity> results;
+    for (uint32_t index = 0; index < boxes.size(); ++index)
+    {
+      if (test(boxes[index]))
+      {
+        results.push_back((entt::entity)index);
+      }
+    }
+    return results;
+  }
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Core/Rendering/Mesh/Vertex.hpp"
+#include <vector>
+
+/// @brief Procedural geometry for the mesh processing tests.
+namespace MeshHelper
+{
+  /// @brief Builds a flat grid of quads in the xz plane facing +y.
+  /// @param origin Position of the first corner of the grid.
+  inline void
+  CreateGrid(uint32_t                    size,
+             std::vector<Dwarf::Vertex>& vertices,
+             std::vector<uint32_t>&      indices,
+             glm::vec3                   origin = glm::vec3(0.0F))
+  {
+    for (uint32_t y = 0; y <= size; y++)
+    {
+      for (uint32_t x = 0; x <= size; x++)
+      {
+        vertices.emplace_back(
+          origin + glm::vec3(x, 0, y), glm::vec3(0, 1, 0), glm::vec2(0));
+      }
+    }
+
+    for (uint32_t y = 0; y < size; y++)
+    {
+      for (uint32_t x = 0; x < size; x++)
+      {
+        uint32_t i0 = (y * (size + 1)) + x;
+        uint32_t i2 = i0 + size + 1;
+        indices.insert(indices.end(),
+                       { i0, i2, i0 + 1, i0 + 1, i2, i2 + 1 });
+      }
+    }
+  }
+
+  /// @brief Builds a flat grid of quads in the xz plane centered at the
+  /// origin facing +y.
+  inline void
+  CreateCenteredGrid(uint32_t                    size,
+                     std::vector<Dwarf::Vertex>& vertices,
+                     std::vector<uint32_t>&      indices)
+  {
+    float halfSize = static_cast<float>(size) * 0.5F;
+    CreateGrid(size, vertices, indices, glm::vec3(-halfSize, 0, -halfSize));
+  }
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Core/Asset/Database/AssetComponents.hpp"
+#include "Core/Rendering/Mesh/Mesh.hpp"
+#include "Core/Scene/Scene.hpp"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+/// @brief Fixture for tests of a scene with mesh renderers. The meshes of the
+/// model have two vertices, so their bounds are exactly the given extents.
+class MeshSceneFixture : public testing::Test
+{
+public:
+  class MockLogger : public Dwarf::IDwarfLogger
+  {
+  public:
+    MOCK_METHOD(void,
+                LogDebug,
+                (const Dwarf::Log logMessage),
+                (const, override));
+    MOCK_METHOD(void,
+                LogInfo,
+                (const Dwarf::Log logMessage),
+                (const, override));
+    MOCK_METHOD(void,
+                LogWarn,
+                (const Dwarf::Log logMessage),
+                (const, override));
+    MOCK_METHOD(void,
+                LogError,
+                (const Dwarf::Log logMessage),
+                (const, override));
+  };
+
+  class MockAssetReference : public Dwarf::IAssetReference
+  {
+  public:
+    MOCK_METHOD(entt::entity, GetHandle, (), (const, override));
+    MOCK_METHOD(const Dwarf::UUID&, GetUID, (), (const, override));
+    MOCK_METHOD(const std::filesystem::path&,
+                GetPath,
+                (),
+                (const, override));
+    MOCK_METHOD(Dwarf::IAssetComponent&, GetAsset, (), (override));
+    MOCK_METHOD(Dwarf::ASSET_TYPE, GetType, (), (const, override));
+    MOCK_METHOD(bool, IsValid, (), (const, override));
+  };
+
+protected:
+  std::shared_ptr<MockLogger> mLogger =
+    std::make_shared<testing::NiceMock<MockLogger>>();
+  Dwarf::UUID          mModelId;
+  Dwarf::ModelAsset    mModel;
+  Dwarf::UUID          mMaterialId;
+  Dwarf::MaterialAsset mMaterial = Dwarf::MaterialAsset(nullptr);
+  bool                 mMaterialValid = true;
+
+  // Declared last, so the mesh renderers are destroyed before the assets
+  Dwarf::Scene mScene = Dwarf::Scene(nullptr, nullptr);
+
+  /// @brief Adds a mesh to the model.
+  void
+  AddMesh(glm::vec3 min, glm::vec3 max, uint32_t materialIndex)
+  {
+    std::vector<Dwarf::Vertex> vertices(2);
+    vertices[0].Position = min;
+    vertices[1].Position = max;
+    mModel.Meshes().push_back(
+      std::make_shared<Dwarf::Mesh>(vertices,
+                                    std::vector<uint32_t>(),
+                                    materialIndex,
+                                    Dwarf::VertexFormat::Standard,
+                                    Dwarf::IndexType::UInt32,
+                                    mLogger));
+  }
+
+  /// @brief Creates a reference to an asset, valid as long as the flag is
+  /// set.
+  static auto
+  CreateReference(Dwarf::UUID&            id,
+                  Dwarf::IAssetComponent& asset,
+                  const bool&             valid)
+    -> std::unique_ptr<Dwarf::IAssetReference>
+  {
+    auto reference = std::make_unique<testing::NiceMock<MockAssetReference>>();
+    ON_CALL(*reference, IsValid())
+      .WillByDefault([&valid]() { return valid; });
+    ON_CALL(*reference, GetUID()).WillByDefault(testing::ReturnRef(id));
+    ON_CALL(*reference, GetAsset()).WillByDefault(testing::ReturnRef(asset));
+    return reference;
+  }
+
+  auto
+  CreateModelReference() -> std::unique_ptr<Dwarf::IAssetReference>
+  {
+    static const bool valid = true;
+    return CreateReference(mModelId, mModel, valid);
+  }
+
+  /// @brief Creates an entity rendering the model.
+  /// @param materials References to the materials by material slot.
+  auto
+  CreateMeshEntity(
+    const std::string&                                       name,
+    glm::vec3                                                position,
+    std::map<int, std::unique_ptr<Dwarf::IAssetReference>> materials = {})
+    -> Dwarf::Entity
+  {
+    Dwarf::Entity entity = mScene.CreateEntity(name);
+    entity.GetComponent<Dwarf::TransformComponent>().SetPosition(position);
+    entity.AddComponent<Dwarf::MeshRendererComponent>(CreateModelReference(),
+                                                      std::move(materials));
+    return entity;
+  }
+};
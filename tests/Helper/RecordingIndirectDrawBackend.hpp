@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Core/Rendering/IndirectDraw/IIndirectDrawBackend.hpp"
+
+/// @brief Indirect draw backend that records the submitted data instead of
+/// drawing, so the CPU side of the indirect path can be tested without a
+/// graphics context.
+class RecordingIndirectDrawBackend : public Dwarf::IIndirectDrawBackend
+{
+public:
+  struct RecordedDraw
+  {
+    Dwarf::IndirectDrawBatch Batch;
+    Dwarf::ICamera*          Camera = nullptr;
+  };
+
+  struct RecordedMaterials
+  {
+    Dwarf::IShader*                Shader = nullptr;
+    std::vector<Dwarf::IMaterial*> Materials;
+  };
+
+  struct Arena
+  {
+    Dwarf::VertexFormat Format = Dwarf::VertexFormat::Standard;
+    Dwarf::IndexType    Type = Dwarf::IndexType::UInt32;
+    uint32_t            VertexCount = 0;
+    uint32_t            IndexCount = 0;
+  };
+
+  std::vector<Arena>                      Arenas;
+  std::vector<Dwarf::IndirectDrawData>    UploadedDrawData;
+  std::vector<Dwarf::IndirectDrawCommand> UploadedCommands;
+  std::vector<RecordedMaterials>          UploadedMaterials;
+  std::vector<RecordedDraw>               Draws;
+  uint32_t                                UploadCount = 0;
+
+  void
+  ClearMeshes() override
+  {
+    Arenas.clear();
+  }
+
+  auto
+  AddMesh(const Dwarf::IMeshBuffer& meshBuffer)
+    -> std::optional<Dwarf::IndirectMeshPlacement> override
+  {
+    auto arena = std::ranges::find_if(
+      Arenas,
+      [&meshBuffer](const Arena& candidate)
+      {
+        return candidate.Format == meshBuffer.GetVertexLayout().Format &&
+               candidate.Type == meshBuffer.GetIndexType();
+      });
+    if (arena == Arenas.end())
+    {
+      arena = Arenas.insert(
+        Arenas.end(),
+        { meshBuffer.GetVertexLayout().Format, meshBuffer.GetIndexType() });
+    }
+
+    Dwarf::IndirectMeshPlacement placement{
+      static_cast<uint32_t>(std::distance(Arenas.begin(), arena)),
+      arena->IndexCount,
+      static_cast<int32_t>(arena->VertexCount)
+    };
+
+    // The detail levels are stored after the full detail indices
+    Dwarf::IndexRange lastLevel =
+      meshBuffer.GetLodIndexRange(meshBuffer.GetLodCount() - 1);
+    arena->VertexCount += meshBuffer.GetVertexCount();
+    arena->IndexCount += lastLevel.Offset + lastLevel.Count;
+    return placement;
+  }
+
+  void
+  Upload(std::span<const Dwarf::IndirectDrawData>    drawData,
+         std::span<const Dwarf::IndirectDrawCommand> commands) override
+  {
+    UploadedDrawData.assign(drawData.begin(), drawData.end());
+    UploadedCommands.assign(commands.begin(), commands.end());
+    UploadCount++;
+  }
+
+  void
+  UploadMaterials(Dwarf::IShader&                    shader,
+                  std::span<Dwarf::IMaterial* const> materials) override
+  {
+    UploadedMaterials.push_back(
+      { &shader, { materials.begin(), materials.end() } });
+  }
+
+  void
+  Draw(const Dwarf::IndirectDrawBatch& batch, Dwarf::ICamera& camera) override
+  {
+    Draws.push_back({ batch, &camera });
+  }
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Core/Scene/IO/SceneBinary/SceneGraphData.hpp"
+
+/// @brief Builders for the plain scene data used by the scene and scene file
+/// tests.
+namespace SceneDataHelper
+{
+  /// @brief Creates the data of an entity with a new ID.
+  /// @param parent Index of the parent entity in the scene graph.
+  inline auto
+  CreateEntityData(
+    const std::string& name,
+    uint32_t           parent = Dwarf::SceneEntityData::NO_PARENT)
+    -> Dwarf::SceneEntityData
+  {
+    Dwarf::SceneEntityData entity;
+    entity.Id = Dwarf::UUID().toBytes();
+    entity.Name = name;
+    entity.Parent = parent;
+    return entity;
+  }
+}